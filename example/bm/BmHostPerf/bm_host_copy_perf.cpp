@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025-2025. All rights reserved.
+ * MemFabric_Hybrid is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *          http://license.coscl.org.cn/MulanPSL2
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+*/
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "hybm_host_copy_engine.h"
+
+using namespace ock::mf;
+
+namespace {
+using Clock = std::chrono::steady_clock;
+
+constexpr uint32_t WARMUP_ITERATIONS = 2U;
+constexpr uint8_t FILL_BYTE = 0x5a;
+constexpr uint64_t MAX_CASE_BYTES = 2UL * 1024UL * 1024UL * 1024UL;
+
+struct CopyBenchArgs {
+    uint32_t iterations = 0;
+    std::vector<uint64_t> sizes{65536UL, 1048576UL, 16777216UL, 268435456UL, 1073741824UL};
+    std::vector<uint64_t> batches{1U, 64U};
+};
+
+bool ParseList(const std::string &text, std::vector<uint64_t> &values)
+{
+    values.clear();
+    std::stringstream ss(text);
+    std::string item;
+    while (std::getline(ss, item, ',')) {
+        char *end = nullptr;
+        auto value = std::strtoull(item.c_str(), &end, 0);
+        if (item.empty() || end == nullptr || *end != '\0' || value == 0) {
+            return false;
+        }
+        values.emplace_back(value);
+    }
+    return !values.empty();
+}
+
+bool ParseArgs(int argc, char *argv[], CopyBenchArgs &args)
+{
+    if (argc < 2) {
+        return false;
+    }
+    args.iterations = static_cast<uint32_t>(std::strtoul(argv[1], nullptr, 10));
+    if (args.iterations == 0) {
+        return false;
+    }
+
+    for (int i = 2; i < argc; i++) {
+        std::string arg = argv[i];
+        std::vector<uint64_t> values;
+        if (arg.compare(0, 8, "--sizes=") == 0 && ParseList(arg.substr(8), values)) {
+            args.sizes = values;
+        } else if (arg.compare(0, 10, "--batches=") == 0 && ParseList(arg.substr(10), values)) {
+            args.batches = values;
+        } else {
+            return false;
+        }
+    }
+    return true;
+}
+
+/* one json object per line, same fields as bm_host_perf for a single process */
+void PrintCase(const char *op, uint64_t size, uint64_t batch, uint32_t iterations, std::vector<uint64_t> &samples)
+{
+    std::sort(samples.begin(), samples.end());
+    double sum = 0;
+    for (auto ns : samples) {
+        sum += static_cast<double>(ns);
+    }
+    auto seconds = sum / 1e9;
+    std::cout << "{\"op\":\"" << op << "\",\"size\":" << size << ",\"batch\":" << batch
+              << ",\"iterations\":" << iterations
+              << ",\"p50_us\":" << static_cast<double>(samples[samples.size() / 2U]) / 1000.0
+              << ",\"avg_us\":" << sum / static_cast<double>(samples.size()) / 1000.0
+              << ",\"max_us\":" << static_cast<double>(samples.back()) / 1000.0
+              << ",\"gbps\":" << static_cast<double>(size * batch * samples.size()) / seconds / 1e9 << "}"
+              << std::endl;
+}
+
+void RunCase(const char *op, uint64_t size, uint64_t batch, uint32_t iterations, const std::function<void()> &copy)
+{
+    std::vector<uint64_t> samples;
+    samples.reserve(iterations);
+    for (auto i = 0U; i < WARMUP_ITERATIONS + iterations; i++) {
+        auto start = Clock::now();
+        copy();
+        auto cost = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count();
+        if (i >= WARMUP_ITERATIONS) {
+            samples.emplace_back(static_cast<uint64_t>(cost));
+        }
+    }
+    PrintCase(op, size, batch, iterations, samples);
+}
+
+bool RunSize(const CopyBenchArgs &args, uint64_t size, uint64_t batch)
+{
+    // entries of a batch are contiguous, pages are touched before timing
+    std::vector<uint8_t> src(size * batch, FILL_BYTE);
+    std::vector<uint8_t> dest(size * batch, 0);
+    std::vector<const void *> srcs;
+    std::vector<void *> dests;
+    std::vector<uint64_t> sizes(batch, size);
+    for (uint64_t i = 0; i < batch; i++) {
+        srcs.emplace_back(src.data() + i * size);
+        dests.emplace_back(dest.data() + i * size);
+    }
+
+    auto &engine = HostCopyEngine::Instance();
+    if (batch == 1U) {
+        RunCase("memcpy", size, batch, args.iterations, [&]() { std::memcpy(dests[0], srcs[0], size); });
+        RunCase("copy_engine", size, batch, args.iterations, [&]() { engine.Copy(dests[0], srcs[0], size); });
+    } else {
+        RunCase("memcpy_batch", size, batch, args.iterations, [&]() {
+            for (uint64_t i = 0; i < batch; i++) {
+                std::memcpy(dests[i], srcs[i], size);
+            }
+        });
+        RunCase("copy_engine_batch", size, batch, args.iterations, [&]() {
+            engine.BatchCopy(dests.data(), srcs.data(), sizes.data(), static_cast<uint32_t>(batch));
+        });
+    }
+    if (std::memcmp(src.data(), dest.data(), src.size()) != 0) {
+        std::cerr << "copy result mismatch, size " << size << " batch " << batch << std::endl;
+        return false;
+    }
+    return true;
+}
+
+void Usage(const char *name)
+{
+    std::cerr << "usage: " << name << " {iterations} [--sizes=65536,1048576] [--batches=1,64]" << std::endl;
+}
+}
+
+int main(int argc, char *argv[])
+{
+    CopyBenchArgs args;
+    if (!ParseArgs(argc, argv, args)) {
+        Usage(argv[0]);
+        return -1;
+    }
+
+    for (auto size : args.sizes) {
+        for (auto batch : args.batches) {
+            // large sizes are measured without batch to bound the buffers
+            if (size * batch > MAX_CASE_BYTES) {
+                continue;
+            }
+            if (!RunSize(args, size, batch)) {
+                return -1;
+            }
+        }
+    }
+    return 0;
+}
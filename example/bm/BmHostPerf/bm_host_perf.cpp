@@ -0,0 +1,714 @@
+/*
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025-2025. All rights reserved.
+ * MemFabric_Hybrid is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *          http://license.coscl.org.cn/MulanPSL2
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+*/
+#include <sys/wait.h>
+#include <unistd.h>
+#include <algorithm>
+#include <chrono>
+#include <csignal>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "smem.h"
+#include "smem_bm.h"
+#include "smem_trans.h"
+#include "smem_net_common.h"
+#include "smem_net_group_engine.h"
+#include "smem_store_factory.h"
+
+using namespace ock::smem;
+
+namespace {
+using Clock = std::chrono::steady_clock;
+
+constexpr uint32_t MAX_BENCH_RANKS = 64U;
+constexpr uint32_t CONTROL_TIMEOUT_MS = 60000U;
+constexpr uint32_t ALLGATHER_MAX_SIZE = 65536U;
+constexpr uint32_t WARMUP_ITERATIONS = 8U;
+constexpr uint16_t TRANS_PORT_BASE = 27000U;
+constexpr auto TRANS_DISCOVER_TIMEOUT = std::chrono::seconds(60);
+constexpr auto TRANS_DISCOVER_INTERVAL = std::chrono::milliseconds(500);
+constexpr uint8_t FILL_BYTE = 0x5a;
+constexpr uint64_t GVA_SIZE_ALIGN = 2UL * 1024UL * 1024UL;
+
+struct BenchArgs {
+    uint32_t rankCount = 0;
+    uint32_t iterations = 0;
+    std::string url;
+    UrlExtraction store;
+    smem_bm_data_op_type opType = SMEMB_DATA_OP_HOST_SIM;
+    std::vector<uint64_t> sizes{4096UL, 65536UL, 1048576UL};
+    std::vector<uint32_t> batches{1U, 16U, 64U};
+    bool withTrans = false;
+};
+
+enum class CaseOp : uint8_t {
+    BM_COPY_H2GH,
+    BM_COPY_GH2H,
+    BM_COPY_BATCH_H2GH,
+    BARRIER,
+    ALLGATHER,
+    TRANS_BATCH_WRITE,
+};
+
+/* each phase runs in freshly forked ranks, bm and trans entities do not share a process */
+enum class Phase : uint8_t {
+    BM,
+    TRANS,
+};
+
+struct BenchCase {
+    CaseOp op;
+    uint64_t size;
+    uint32_t batch;
+};
+
+/* per rank result of one case, followed by sampleCount latencies in nanoseconds on the pipe */
+struct CaseRecord {
+    int32_t result;
+    uint32_t sampleCount;
+    uint64_t elapsedNs;
+    uint64_t bytes;
+};
+
+const char *OpName(CaseOp op)
+{
+    switch (op) {
+        case CaseOp::BM_COPY_H2GH:
+            return "bm_copy_h2gh";
+        case CaseOp::BM_COPY_GH2H:
+            return "bm_copy_gh2h";
+        case CaseOp::BM_COPY_BATCH_H2GH:
+            return "bm_copy_batch_h2gh";
+        case CaseOp::BARRIER:
+            return "barrier";
+        case CaseOp::ALLGATHER:
+            return "allgather";
+        case CaseOp::TRANS_BATCH_WRITE:
+            return "trans_batch_write";
+        default:
+            return "unknown";
+    }
+}
+
+bool ParseList(const std::string &text, std::vector<uint64_t> &values)
+{
+    values.clear();
+    std::stringstream ss(text);
+    std::string item;
+    while (std::getline(ss, item, ',')) {
+        char *end = nullptr;
+        auto value = std::strtoull(item.c_str(), &end, 0);
+        if (item.empty() || end == nullptr || *end != '\0' || value == 0) {
+            return false;
+        }
+        values.emplace_back(value);
+    }
+    return !values.empty();
+}
+
+bool ParseArgs(int argc, char *argv[], BenchArgs &args)
+{
+    if (argc < 4) {
+        return false;
+    }
+    args.rankCount = static_cast<uint32_t>(std::strtoul(argv[1], nullptr, 10));
+    args.iterations = static_cast<uint32_t>(std::strtoul(argv[2], nullptr, 10));
+    args.url = argv[3];
+    if (args.rankCount < 2U || args.rankCount > MAX_BENCH_RANKS || args.iterations == 0) {
+        return false;
+    }
+    if (args.store.ExtractIpPortFromUrl(args.url) != 0) {
+        return false;
+    }
+
+    for (int i = 4; i < argc; i++) {
+        std::string arg = argv[i];
+        std::vector<uint64_t> values;
+        if (arg == "--trans") {
+            args.withTrans = true;
+        } else if (arg == "--rdma") {
+            args.opType = SMEMB_DATA_OP_HOST_RDMA;
+        } else if (arg.compare(0, 8, "--sizes=") == 0 && ParseList(arg.substr(8), values)) {
+            args.sizes = values;
+        } else if (arg.compare(0, 10, "--batches=") == 0 && ParseList(arg.substr(10), values)) {
+            args.batches.assign(values.begin(), values.end());
+        } else {
+            return false;
+        }
+    }
+    // trans ranks are paired as sender and receiver
+    return !args.withTrans || args.rankCount % 2U == 0;
+}
+
+/* parent and ranks build the same list, so records on the pipes are matched by position */
+std::vector<BenchCase> BuildCases(const BenchArgs &args, Phase phase)
+{
+    std::vector<BenchCase> cases;
+    if (phase == Phase::TRANS) {
+        for (auto size : args.sizes) {
+            for (auto batch : args.batches) {
+                cases.push_back({CaseOp::TRANS_BATCH_WRITE, size, batch});
+            }
+        }
+        return cases;
+    }
+
+    for (auto size : args.sizes) {
+        cases.push_back({CaseOp::BM_COPY_H2GH, size, 1U});
+        cases.push_back({CaseOp::BM_COPY_GH2H, size, 1U});
+        for (auto batch : args.batches) {
+            if (batch > 1U) {
+                cases.push_back({CaseOp::BM_COPY_BATCH_H2GH, size, batch});
+            }
+        }
+    }
+    cases.push_back({CaseOp::BARRIER, 0UL, 1U});
+    for (auto size : args.sizes) {
+        if (size <= ALLGATHER_MAX_SIZE) {
+            cases.push_back({CaseOp::ALLGATHER, size, 1U});
+        }
+    }
+    return cases;
+}
+
+uint64_t MaxBufferSize(const BenchArgs &args)
+{
+    auto maxSize = *std::max_element(args.sizes.begin(), args.sizes.end());
+    auto maxBatch = *std::max_element(args.batches.begin(), args.batches.end());
+    return maxSize * maxBatch;
+}
+
+bool WriteAll(int fd, const void *data, size_t size)
+{
+    auto ptr = static_cast<const uint8_t *>(data);
+    while (size > 0) {
+        auto written = write(fd, ptr, size);
+        if (written <= 0) {
+            return false;
+        }
+        ptr += written;
+        size -= static_cast<size_t>(written);
+    }
+    return true;
+}
+
+bool ReadAll(int fd, void *data, size_t size)
+{
+    auto ptr = static_cast<uint8_t *>(data);
+    while (size > 0) {
+        auto got = read(fd, ptr, size);
+        if (got <= 0) {
+            return false;
+        }
+        ptr += got;
+        size -= static_cast<size_t>(got);
+    }
+    return true;
+}
+
+class RankRunner {
+public:
+    RankRunner(const BenchArgs &args, Phase phase, uint32_t rankId)
+        : args_(args), phase_(phase), rankId_(rankId), peerId_((rankId + 1U) % args.rankCount),
+          cases_(BuildCases(args, phase)),
+          records_(cases_.size(), CaseRecord{0, 0U, 0UL, 0UL}), samples_(cases_.size())
+    {
+    }
+
+    int Run()
+    {
+        auto ret = smem_init(0);
+        if (ret != 0) {
+            std::cerr << "rank " << rankId_ << " smem init failed: " << ret << std::endl;
+            return ret;
+        }
+        ret = InitGroup();
+        if (ret == 0) {
+            ret = phase_ == Phase::BM ? RunBm() : RunTrans();
+        }
+        group_ = nullptr;
+        smem_uninit();
+        return ret;
+    }
+
+    bool Report(int fd) const
+    {
+        for (size_t i = 0; i < cases_.size(); i++) {
+            if (!WriteAll(fd, &records_[i], sizeof(CaseRecord)) ||
+                !WriteAll(fd, samples_[i].data(), records_[i].sampleCount * sizeof(uint64_t))) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+private:
+    int InitGroup()
+    {
+        // stores are cached by url and shared with the trans entry, whose watch task requires a connected one
+        auto client = StoreFactory::CreateStore(args_.store.ip, args_.store.port, false, args_.rankCount,
+                                                static_cast<int32_t>(rankId_));
+        if (client == nullptr) {
+            std::cerr << "rank " << rankId_ << " connect store failed: " << StoreFactory::GetFailedReason()
+                      << std::endl;
+            return -1;
+        }
+        SmemGroupOption option = {args_.rankCount, rankId_, CONTROL_TIMEOUT_MS, false, nullptr, nullptr};
+        auto prefix = std::string("BM_HOST_PERF_").append(phase_ == Phase::BM ? "BM_" : "TRANS_");
+        group_ = SmemNetGroupEngine::Create(StoreFactory::PrefixStore(client, prefix), option);
+        if (group_ == nullptr) {
+            std::cerr << "rank " << rankId_ << " create group failed." << std::endl;
+            return -1;
+        }
+        return group_->GroupBarrier();
+    }
+
+    int RunBm()
+    {
+        smem_bm_config_t config;
+        (void)smem_bm_config_init(&config);
+        config.autoRanking = false;
+        config.rankId = rankId_;
+        config.startConfigStoreServer = false;
+        auto ret = smem_bm_init(args_.url.c_str(), args_.rankCount, 0, &config);
+        if (ret != 0) {
+            std::cerr << "rank " << rankId_ << " smem bm init failed: " << ret << std::endl;
+            return ret;
+        }
+
+        auto bufferSize = MaxBufferSize(args_);
+        auto gvaSize = (bufferSize + GVA_SIZE_ALIGN - 1UL) / GVA_SIZE_ALIGN * GVA_SIZE_ALIGN;
+        auto handle = smem_bm_create(0, 0, args_.opType, gvaSize, 0, 0);
+        if (handle == nullptr) {
+            std::cerr << "rank " << rankId_ << " smem bm create failed." << std::endl;
+            smem_bm_uninit(0);
+            return -1;
+        }
+        ret = smem_bm_join(handle, 0);
+        if (ret == 0) {
+            ret = group_->GroupBarrier();
+        }
+        if (ret == 0) {
+            std::vector<uint8_t> local(bufferSize, FILL_BYTE);
+            auto remote = static_cast<uint8_t *>(smem_bm_ptr_by_mem_type(handle, SMEM_MEM_TYPE_HOST, peerId_));
+            ret = remote == nullptr ? -1 : RunCases(handle, local.data(), remote);
+            (void)group_->GroupBarrier();
+        }
+        if (ret != 0) {
+            std::cerr << "rank " << rankId_ << " bm benchmark failed: " << ret << std::endl;
+        }
+        smem_bm_destroy(handle);
+        smem_bm_uninit(0);
+        return ret;
+    }
+
+    int RunCases(smem_bm_t handle, uint8_t *local, uint8_t *remote)
+    {
+        for (size_t i = 0; i < cases_.size(); i++) {
+            const auto &cs = cases_[i];
+            int ret = 0;
+            switch (cs.op) {
+                case CaseOp::BM_COPY_H2GH:
+                    ret = Measure(i, cs.size, [&]() {
+                        smem_copy_params params = {local, remote, cs.size};
+                        return smem_bm_copy(handle, &params, SMEMB_COPY_H2GH, 0);
+                    });
+                    break;
+                case CaseOp::BM_COPY_GH2H:
+                    ret = Measure(i, cs.size, [&]() {
+                        smem_copy_params params = {remote, local, cs.size};
+                        return smem_bm_copy(handle, &params, SMEMB_COPY_GH2H, 0);
+                    });
+                    break;
+                case CaseOp::BM_COPY_BATCH_H2GH:
+                    ret = MeasureBmBatch(i, handle, local, remote);
+                    break;
+                case CaseOp::BARRIER:
+                    ret = Measure(i, 0UL, [this]() { return group_->GroupBarrier(); });
+                    break;
+                case CaseOp::ALLGATHER:
+                    ret = MeasureAllGather(i);
+                    break;
+                default:
+                    continue;
+            }
+            if (ret != 0) {
+                std::cerr << "rank " << rankId_ << " case " << OpName(cs.op) << " size " << cs.size << " batch "
+                          << cs.batch << " failed: " << ret << std::endl;
+                return ret;
+            }
+        }
+        return 0;
+    }
+
+    int MeasureBmBatch(size_t index, smem_bm_t handle, uint8_t *local, uint8_t *remote)
+    {
+        const auto &cs = cases_[index];
+        std::vector<void *> sources(cs.batch);
+        std::vector<void *> destinations(cs.batch);
+        std::vector<uint64_t> sizes(cs.batch, cs.size);
+        for (uint32_t i = 0; i < cs.batch; i++) {
+            sources[i] = local + i * cs.size;
+            destinations[i] = remote + i * cs.size;
+        }
+        smem_batch_copy_params params = {sources.data(), destinations.data(), sizes.data(), cs.batch};
+        return Measure(index, cs.size * cs.batch,
+                       [&]() { return smem_bm_copy_batch(handle, &params, SMEMB_COPY_H2GH, 0); });
+    }
+
+    int MeasureAllGather(size_t index)
+    {
+        const auto &cs = cases_[index];
+        std::vector<char> send(cs.size, static_cast<char>(rankId_));
+        std::vector<char> recv(cs.size * args_.rankCount);
+        auto sendSize = static_cast<uint32_t>(send.size());
+        auto recvSize = static_cast<uint32_t>(recv.size());
+        return Measure(index, cs.size * args_.rankCount,
+                       [&]() { return group_->GroupAllGather(send.data(), sendSize, recv.data(), recvSize); });
+    }
+
+    int RunTrans()
+    {
+        // even ranks write to the next odd rank
+        auto isSender = rankId_ % 2U == 0;
+        smem_trans_config_t config;
+        (void)smem_trans_config_init(&config);
+        config.role = isSender ? SMEM_TRANS_SENDER : SMEM_TRANS_RECEIVER;
+        config.dataOpType = args_.opType;
+        config.startConfigServer = false;
+        auto ret = smem_trans_init(&config);
+        if (ret != 0) {
+            std::cerr << "rank " << rankId_ << " smem trans init failed: " << ret << std::endl;
+            return ret;
+        }
+
+        auto handle = smem_trans_create(args_.url.c_str(), UniqueIdOf(rankId_).c_str(), &config);
+        if (handle == nullptr) {
+            std::cerr << "rank " << rankId_ << " smem trans create failed."
+                      << std::endl;
+            smem_trans_uninit(0);
+            return -1;
+        }
+
+        // host memory is allocated from the trans dram space, registration only accepts device memory
+        auto bufferSize = (MaxBufferSize(args_) + GVA_SIZE_ALIGN - 1UL) / GVA_SIZE_ALIGN * GVA_SIZE_ALIGN;
+        auto buffer = static_cast<uint8_t *>(smem_trans_malloc(handle, bufferSize));
+        ret = buffer == nullptr ? -1 : 0;
+        if (buffer == nullptr) {
+            std::cerr << "rank " << rankId_ << " smem trans malloc failed."
+                      << std::endl;
+        }
+        std::vector<uint64_t> addresses(args_.rankCount);
+        if (ret == 0) {
+            std::fill(buffer, buffer + bufferSize, FILL_BYTE);
+            auto self = reinterpret_cast<uint64_t>(buffer);
+            ret = group_->GroupAllGather(reinterpret_cast<const char *>(&self), sizeof(self),
+                                         reinterpret_cast<char *>(addresses.data()),
+                                         static_cast<uint32_t>(addresses.size() * sizeof(uint64_t)));
+        }
+        if (ret == 0) {
+            ret = group_->GroupBarrier();
+        }
+        if (ret == 0 && isSender) {
+            ret = WaitTransPeer(handle, buffer, reinterpret_cast<uint8_t *>(addresses[peerId_]));
+        }
+        for (size_t i = 0; ret == 0 && isSender && i < cases_.size(); i++) {
+            if (cases_[i].op == CaseOp::TRANS_BATCH_WRITE) {
+                ret = MeasureTransBatch(i, handle, buffer, reinterpret_cast<uint8_t *>(addresses[peerId_]));
+            }
+        }
+        (void)group_->GroupBarrier();
+        if (ret != 0) {
+            std::cerr << "rank " << rankId_ << " trans benchmark failed: " << ret << std::endl;
+        }
+        if (buffer != nullptr) {
+            (void)smem_trans_free(handle, buffer);
+        }
+        smem_trans_destroy(handle, 0);
+        smem_trans_uninit(0);
+        return ret;
+    }
+
+    // slices of the peer are imported by the trans watch task in background, retry until it is visible
+    int WaitTransPeer(smem_trans_t handle, uint8_t *local, uint8_t *remote) const
+    {
+        auto peer = UniqueIdOf(peerId_);
+        auto deadline = std::chrono::steady_clock::now() + TRANS_DISCOVER_TIMEOUT;
+        int ret;
+        while ((ret = smem_trans_write(handle, local, peer.c_str(), remote, 1U, 0)) != 0 &&
+               std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::sleep_for(TRANS_DISCOVER_INTERVAL);
+        }
+        if (ret != 0) {
+            std::cerr << "rank " << rankId_ << " trans peer " << peer << " not discovered: " << ret << std::endl;
+        }
+        return ret;
+    }
+
+    int MeasureTransBatch(size_t index, smem_trans_t handle, uint8_t *local, uint8_t *remote)
+    {
+        const auto &cs = cases_[index];
+        std::vector<const void *> sources(cs.batch);
+        std::vector<void *> destinations(cs.batch);
+        std::vector<size_t> sizes(cs.batch, cs.size);
+        for (uint32_t i = 0; i < cs.batch; i++) {
+            sources[i] = local + i * cs.size;
+            destinations[i] = remote + i * cs.size;
+        }
+        auto peer = UniqueIdOf(peerId_);
+        return Measure(index, cs.size * cs.batch, [&]() {
+            return smem_trans_batch_write(handle, sources.data(), peer.c_str(), destinations.data(), sizes.data(),
+                                          cs.batch, 0);
+        });
+    }
+
+    std::string UniqueIdOf(uint32_t rankId) const
+    {
+        return args_.store.ip + ":" + std::to_string(TRANS_PORT_BASE + rankId);
+    }
+
+    template <class Op>
+    int Measure(size_t index, uint64_t bytesPerOp, Op &&op)
+    {
+        auto &record = records_[index];
+        for (uint32_t i = 0; i < WARMUP_ITERATIONS; i++) {
+            record.result = op();
+            if (record.result != 0) {
+                return record.result;
+            }
+        }
+
+        auto &samples = samples_[index];
+        samples.reserve(args_.iterations);
+        auto begin = Clock::now();
+        for (uint32_t i = 0; i < args_.iterations; i++) {
+            auto start = Clock::now();
+            record.result = op();
+            if (record.result != 0) {
+                return record.result;
+            }
+            auto costNs = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count();
+            samples.emplace_back(static_cast<uint64_t>(costNs));
+        }
+        record.sampleCount = static_cast<uint32_t>(samples.size());
+        record.elapsedNs =
+            static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - begin).count());
+        record.bytes = bytesPerOp * args_.iterations;
+        return 0;
+    }
+
+private:
+    const BenchArgs &args_;
+    const Phase phase_;
+    const uint32_t rankId_;
+    const uint32_t peerId_;
+    const std::vector<BenchCase> cases_;
+    std::vector<CaseRecord> records_;
+    std::vector<std::vector<uint64_t>> samples_;
+    SmemGroupEnginePtr group_;
+};
+
+double Percentile(const std::vector<uint64_t> &sorted, double ratio)
+{
+    auto pos = static_cast<size_t>(ratio * static_cast<double>(sorted.size()));
+    return static_cast<double>(sorted[std::min(pos, sorted.size() - 1)]) / 1000.0;
+}
+
+/* one json object per line: latency over all measuring ranks, throughput summed over them */
+void PrintCase(const BenchArgs &args, const BenchCase &cs, std::vector<uint64_t> &samples, uint32_t ranks,
+               uint64_t bytes, double rankSeconds)
+{
+    std::sort(samples.begin(), samples.end());
+    double sum = 0;
+    for (auto ns : samples) {
+        sum += static_cast<double>(ns);
+    }
+    auto seconds = rankSeconds / ranks;
+    std::cout << "{\"op\":\"" << OpName(cs.op) << "\",\"size\":" << cs.size << ",\"batch\":" << cs.batch
+              << ",\"ranks\":" << ranks << ",\"iterations\":" << args.iterations
+              << ",\"p50_us\":" << Percentile(samples, 0.5) << ",\"p99_us\":" << Percentile(samples, 0.99)
+              << ",\"p999_us\":" << Percentile(samples, 0.999)
+              << ",\"avg_us\":" << sum / static_cast<double>(samples.size()) / 1000.0
+              << ",\"max_us\":" << static_cast<double>(samples.back()) / 1000.0
+              << ",\"ops_per_sec\":" << static_cast<double>(samples.size()) / seconds
+              << ",\"gbps\":" << static_cast<double>(bytes) / seconds / 1e9 << "}" << std::endl;
+}
+
+int CollectResults(const BenchArgs &args, Phase phase, const std::vector<int> &fds)
+{
+    auto cases = BuildCases(args, phase);
+    std::vector<std::vector<uint64_t>> samples(cases.size());
+    std::vector<uint32_t> ranks(cases.size(), 0U);
+    std::vector<uint64_t> bytes(cases.size(), 0UL);
+    std::vector<double> seconds(cases.size(), 0.0);
+    std::vector<bool> valid(cases.size(), true);
+    for (uint32_t rank = 0; rank < fds.size(); rank++) {
+        for (size_t i = 0; i < cases.size(); i++) {
+            CaseRecord record{};
+            if (!ReadAll(fds[rank], &record, sizeof(record))) {
+                std::cerr << "read result of rank " << rank << " failed." << std::endl;
+                return -1;
+            }
+            auto &all = samples[i];
+            auto offset = all.size();
+            all.resize(offset + record.sampleCount);
+            if (!ReadAll(fds[rank], all.data() + offset, record.sampleCount * sizeof(uint64_t))) {
+                std::cerr << "read samples of rank " << rank << " failed." << std::endl;
+                return -1;
+            }
+            valid[i] = valid[i] && record.result == 0;
+            ranks[i] += record.sampleCount > 0 ? 1U : 0U;
+            bytes[i] += record.bytes;
+            seconds[i] += static_cast<double>(record.elapsedNs) / 1e9;
+        }
+    }
+
+    for (size_t i = 0; i < cases.size(); i++) {
+        if (valid[i] && !samples[i].empty()) {
+            PrintCase(args, cases[i], samples[i], ranks[i], bytes[i], seconds[i]);
+        }
+    }
+    return 0;
+}
+
+int RunPhase(const BenchArgs &args, Phase phase)
+{
+    std::vector<pid_t> pids;
+    std::vector<int> fds;
+    int ret = 0;
+    for (uint32_t rank = 0; rank < args.rankCount; rank++) {
+        int pipeFds[2];
+        if (pipe(pipeFds) != 0) {
+            std::cerr << "create pipe failed: " << strerror(errno) << std::endl;
+            ret = -1;
+            break;
+        }
+        auto pid = fork();
+        if (pid < 0) {
+            std::cerr << "fork rank " << rank << " failed: " << strerror(errno) << std::endl;
+            close(pipeFds[0]);
+            close(pipeFds[1]);
+            ret = -1;
+            break;
+        }
+        if (pid == 0) {
+            close(pipeFds[0]);
+            RankRunner runner(args, phase, rank);
+            auto result = runner.Run();
+            // samples are reported after all collectives finish, a full pipe never blocks a peer
+            auto reported = runner.Report(pipeFds[1]);
+            close(pipeFds[1]);
+            _exit(result == 0 && reported ? 0 : 1);
+        }
+        close(pipeFds[1]);
+        pids.emplace_back(pid);
+        fds.emplace_back(pipeFds[0]);
+    }
+
+    if (ret == 0) {
+        ret = CollectResults(args, phase, fds);
+    } else {
+        for (auto pid : pids) {
+            (void)kill(pid, SIGKILL);
+        }
+    }
+    for (size_t i = 0; i < pids.size(); i++) {
+        int status = 0;
+        (void)waitpid(pids[i], &status, 0);
+        close(fds[i]);
+        if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+            std::cerr << "rank " << i << " exited abnormally, status: " << status << std::endl;
+            ret = -1;
+        }
+    }
+    return ret;
+}
+
+/* the store server lives in its own process, so the launcher has no threads when forking ranks */
+pid_t StartStoreServer(const BenchArgs &args, int &stopFd)
+{
+    int readyFds[2];
+    int stopFds[2];
+    if (pipe(readyFds) != 0 || pipe(stopFds) != 0) {
+        std::cerr << "create pipe failed: " << strerror(errno) << std::endl;
+        return -1;
+    }
+    auto pid = fork();
+    if (pid == 0) {
+        close(readyFds[0]);
+        close(stopFds[1]);
+        auto server = StoreFactory::CreateStoreServer("0.0.0.0", args.store.port, args.rankCount);
+        uint8_t ready = server == nullptr ? 0U : 1U;
+        if (server == nullptr) {
+            std::cerr << "start store server failed: " << StoreFactory::GetFailedReason() << std::endl;
+        }
+        (void)WriteAll(readyFds[1], &ready, sizeof(ready));
+        close(readyFds[1]);
+        // serve until the launcher closes the stop pipe
+        while (ready != 0U && read(stopFds[0], &ready, sizeof(ready)) > 0) {
+        }
+        server = nullptr;
+        StoreFactory::DestroyStore("0.0.0.0", args.store.port);
+        _exit(0);
+    }
+
+    close(readyFds[1]);
+    close(stopFds[0]);
+    uint8_t ready = 0;
+    if (pid < 0 || !ReadAll(readyFds[0], &ready, sizeof(ready)) || ready == 0U) {
+        close(readyFds[0]);
+        close(stopFds[1]);
+        if (pid > 0) {
+            (void)waitpid(pid, nullptr, 0);
+        }
+        return -1;
+    }
+    close(readyFds[0]);
+    stopFd = stopFds[1];
+    return pid;
+}
+
+void Usage(const char *name)
+{
+    std::cerr << "usage: " << name << " {rankCount} {iterations} tcp://{ip}:{port} "
+              << "[--sizes=4096,65536] [--batches=1,16] [--trans] [--rdma]" << std::endl;
+}
+}
+
+int main(int argc, char *argv[])
+{
+    BenchArgs args;
+    if (!ParseArgs(argc, argv, args)) {
+        Usage(argv[0]);
+        return -1;
+    }
+
+    int stopFd = -1;
+    auto serverPid = StartStoreServer(args, stopFd);
+    if (serverPid < 0) {
+        return -1;
+    }
+
+    auto ret = RunPhase(args, Phase::BM);
+    if (ret == 0 && args.withTrans) {
+        ret = RunPhase(args, Phase::TRANS);
+    }
+
+    close(stopFd);
+    (void)waitpid(serverPid, nullptr, 0);
+    return ret;
+}
@@ -0,0 +1,224 @@
+/*
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025-2025. All rights reserved.
+ * MemFabric_Hybrid is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *          http://license.coscl.org.cn/MulanPSL2
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+*/
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "acc_tcp_server.h"
+#include "smem_net_common.h"
+
+using namespace ock::acc;
+
+namespace {
+using Clock = std::chrono::steady_clock;
+
+constexpr uint32_t CONNECT_RETRY_TIMES = 30U;
+constexpr uint16_t MAX_CLIENT_WORKERS = 16U;
+
+struct StormArgs {
+    uint32_t connCount = 0;
+    uint32_t threadCount = 0;
+    ock::smem::UrlExtraction url;
+    uint16_t listenerCount = 1U;
+    uint16_t handshakeThreadCount = UNO_4;
+    uint32_t handshakeUs = 0;
+};
+
+double Percentile(const std::vector<uint64_t> &sorted, double ratio)
+{
+    if (sorted.empty()) {
+        return 0.0;
+    }
+    auto index = static_cast<size_t>(ratio * static_cast<double>(sorted.size() - 1U));
+    return static_cast<double>(sorted[index]) / 1000.0;
+}
+
+bool ParseUint(const std::string &arg, const std::string &prefix, uint64_t &value)
+{
+    if (arg.compare(0, prefix.size(), prefix) != 0) {
+        return false;
+    }
+    value = std::strtoull(arg.c_str() + prefix.size(), nullptr, 10);
+    return true;
+}
+
+bool ParseArgs(int argc, char *argv[], StormArgs &args)
+{
+    const int minArgCount = 4;
+    if (argc < minArgCount) {
+        return false;
+    }
+    args.connCount = static_cast<uint32_t>(std::strtoul(argv[1], nullptr, 10));
+    args.threadCount = static_cast<uint32_t>(std::strtoul(argv[2], nullptr, 10));
+    if (args.threadCount == 0 || args.connCount < args.threadCount ||
+        args.url.ExtractIpPortFromUrl(argv[3]) != 0) {
+        return false;
+    }
+
+    for (int i = minArgCount; i < argc; i++) {
+        std::string arg = argv[i];
+        uint64_t value = 0;
+        if (ParseUint(arg, "--listeners=", value)) {
+            args.listenerCount = static_cast<uint16_t>(value);
+        } else if (ParseUint(arg, "--handshake-threads=", value)) {
+            args.handshakeThreadCount = static_cast<uint16_t>(value);
+        } else if (ParseUint(arg, "--handshake-us=", value)) {
+            args.handshakeUs = static_cast<uint32_t>(value);
+        } else {
+            return false;
+        }
+    }
+    return args.listenerCount > 0;
+}
+
+/* listener side, the new link handler sleeps to stand in for tls handshake cost */
+AccTcpServerPtr StartServer(const StormArgs &args)
+{
+    auto server = AccTcpServer::Create();
+    if (server == nullptr) {
+        return nullptr;
+    }
+    server->RegisterNewRequestHandler(0, [](const AccTcpRequestContext &) { return 0; });
+    server->RegisterLinkBrokenHandler([](const AccTcpLinkComplexPtr &) { return 0; });
+    auto handshakeUs = args.handshakeUs;
+    server->RegisterNewLinkHandler([handshakeUs](const AccConnReq &, const AccTcpLinkComplexPtr &) {
+        if (handshakeUs > 0) {
+            std::this_thread::sleep_for(std::chrono::microseconds(handshakeUs));
+        }
+        return 0;
+    });
+
+    AccTcpServerOptions options;
+    options.listenIp = args.url.ip;
+    options.listenPort = args.url.port;
+    options.enableListener = true;
+    options.listenerCount = args.listenerCount;
+    options.handshakeThreadCount = args.handshakeThreadCount;
+    options.maxWorldSize = args.connCount;
+    if (server->Start(options) != ACC_OK) {
+        return nullptr;
+    }
+    return server;
+}
+
+AccTcpServerPtr StartClient(const StormArgs &args)
+{
+    auto client = AccTcpServer::Create();
+    if (client == nullptr) {
+        return nullptr;
+    }
+    client->RegisterNewRequestHandler(0, [](const AccTcpRequestContext &) { return 0; });
+    client->RegisterLinkBrokenHandler([](const AccTcpLinkComplexPtr &) { return 0; });
+
+    AccTcpServerOptions options;
+    options.workerCount = static_cast<uint16_t>(std::min<uint32_t>(args.threadCount, MAX_CLIENT_WORKERS));
+    options.maxWorldSize = args.connCount;
+    if (client->Start(options) != ACC_OK) {
+        return nullptr;
+    }
+    return client;
+}
+} // namespace
+
+/**
+ * Connect many links to one listener at the same time and report connect latency.
+ * Usage: conn_storm_perf {connCount} {threadCount} tcp://{ip}:{port} [--listeners=1] [--handshake-threads=4]
+ *        [--handshake-us=0]
+ */
+int main(int argc, char *argv[])
+{
+    StormArgs args;
+    if (!ParseArgs(argc, argv, args)) {
+        std::cerr << "usage: " << argv[0] << " {connCount} {threadCount} tcp://{ip}:{port} [--listeners=1] "
+                  << "[--handshake-threads=4] [--handshake-us=0]" << std::endl;
+        return -1;
+    }
+
+    auto server = StartServer(args);
+    if (server == nullptr) {
+        std::cerr << "start listener on " << args.url.ip << ":" << args.url.port << " failed" << std::endl;
+        return -1;
+    }
+    auto client = StartClient(args);
+    if (client == nullptr) {
+        std::cerr << "start client failed" << std::endl;
+        server->Stop();
+        return -1;
+    }
+
+    std::vector<std::vector<uint64_t>> samples(args.threadCount);
+    std::vector<std::vector<AccTcpLinkComplexPtr>> links(args.threadCount);
+    std::atomic<uint32_t> errors{0};
+    std::atomic<bool> go{false};
+    std::vector<std::thread> threads;
+    for (uint32_t tid = 0; tid < args.threadCount; tid++) {
+        threads.emplace_back([&, tid]() {
+            while (!go.load(std::memory_order_acquire)) {
+                std::this_thread::yield();
+            }
+            for (uint32_t cid = tid; cid < args.connCount; cid += args.threadCount) {
+                AccConnReq req{};
+                req.rankId = cid;
+                AccTcpLinkComplexPtr link;
+                auto start = Clock::now();
+                auto ret = client->ConnectToPeerServer(args.url.ip, args.url.port, req, CONNECT_RETRY_TIMES, link);
+                auto cost = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count();
+                if (ret != ACC_OK) {
+                    errors.fetch_add(1U);
+                    continue;
+                }
+                samples[tid].push_back(static_cast<uint64_t>(cost));
+                links[tid].push_back(link);
+            }
+        });
+    }
+
+    auto start = Clock::now();
+    go.store(true, std::memory_order_release);
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    auto seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+    std::vector<uint64_t> all;
+    for (auto &item : samples) {
+        all.insert(all.end(), item.begin(), item.end());
+    }
+    std::sort(all.begin(), all.end());
+    double sum = 0;
+    for (auto ns : all) {
+        sum += static_cast<double>(ns);
+    }
+    std::cout << "{\"op\":\"connect\",\"conns\":" << args.connCount << ",\"threads\":" << args.threadCount
+              << ",\"listeners\":" << args.listenerCount << ",\"handshake_threads\":" << args.handshakeThreadCount
+              << ",\"handshake_us\":" << args.handshakeUs << ",\"errors\":" << errors.load()
+              << ",\"seconds\":" << seconds << ",\"conns_per_sec\":" << static_cast<double>(all.size()) / seconds
+              << ",\"p50_us\":" << Percentile(all, 0.5) << ",\"p99_us\":" << Percentile(all, 0.99)
+              << ",\"p999_us\":" << Percentile(all, 0.999)
+              << ",\"avg_us\":" << (all.empty() ? 0.0 : sum / static_cast<double>(all.size()) / 1000.0)
+              << ",\"max_us\":" << (all.empty() ? 0.0 : static_cast<double>(all.back()) / 1000.0) << "}"
+              << std::endl;
+
+    for (auto &item : links) {
+        for (auto &link : item) {
+            link->Close();
+        }
+    }
+    client->Stop();
+    server->Stop();
+    return errors.load() == 0 ? 0 : -1;
+}
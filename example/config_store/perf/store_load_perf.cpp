@@ -0,0 +1,463 @@
+/*
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025-2025. All rights reserved.
+ * MemFabric_Hybrid is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *          http://license.coscl.org.cn/MulanPSL2
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+*/
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "smem_net_common.h"
+#include "smem_store_factory.h"
+#include "smem_local_memory_backend.h"
+#include "smem_tcp_config_store.h"
+
+using namespace ock::smem;
+
+namespace {
+using Clock = std::chrono::steady_clock;
+
+constexpr int64_t BARRIER_TIMEOUT_MS = 60000L;
+constexpr int64_t WATCH_TIMEOUT_MS = 10000L;
+constexpr int32_t CONNECT_RETRY_TIMES = 30;
+const std::vector<std::string> ALL_SCENARIOS{"kv", "barrier", "allgather", "watch", "cas"};
+
+struct LoadArgs {
+    uint32_t clientCount = 0;
+    uint32_t threadCount = 0;
+    uint32_t rounds = 0;
+    UrlExtraction url;
+    bool startServer = false;
+    uint64_t valueSize = 64UL;
+    std::vector<std::string> scenarios = ALL_SCENARIOS;
+};
+
+uint64_t NowNs()
+{
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now().time_since_epoch()).count());
+}
+
+/* latency samples and counters of every opcode issued by one thread */
+class Recorder {
+public:
+    template <class Op>
+    Result Time(const std::string &opcode, Op &&op)
+    {
+        auto start = NowNs();
+        auto ret = op();
+        auto &stat = stats_[opcode];
+        if (ret != 0) {
+            stat.errors++;
+        } else {
+            stat.samples.emplace_back(NowNs() - start);
+        }
+        return ret;
+    }
+
+    void Add(const std::string &opcode, uint64_t latencyNs)
+    {
+        stats_[opcode].samples.emplace_back(latencyNs);
+    }
+
+    void Conflict(const std::string &opcode)
+    {
+        stats_[opcode].conflicts++;
+    }
+
+    void Fail(const std::string &opcode, uint64_t count)
+    {
+        stats_[opcode].errors += count;
+    }
+
+    void Merge(const Recorder &other)
+    {
+        for (auto &it : other.stats_) {
+            auto &stat = stats_[it.first];
+            stat.samples.insert(stat.samples.end(), it.second.samples.begin(), it.second.samples.end());
+            stat.errors += it.second.errors;
+            stat.conflicts += it.second.conflicts;
+        }
+    }
+
+    void Print(const std::string &scenario, const LoadArgs &args, double seconds)
+    {
+        for (auto &it : stats_) {
+            auto &samples = it.second.samples;
+            std::sort(samples.begin(), samples.end());
+            double sum = 0;
+            for (auto ns : samples) {
+                sum += static_cast<double>(ns);
+            }
+            auto count = samples.size();
+            std::cout << "{\"scenario\":\"" << scenario << "\",\"op\":\"" << it.first
+                      << "\",\"clients\":" << args.clientCount << ",\"threads\":" << args.threadCount
+                      << ",\"ops\":" << count << ",\"errors\":" << it.second.errors
+                      << ",\"conflicts\":" << it.second.conflicts
+                      << ",\"ops_per_sec\":" << static_cast<double>(count) / seconds
+                      << ",\"p50_us\":" << Percentile(samples, 0.5) << ",\"p99_us\":" << Percentile(samples, 0.99)
+                      << ",\"p999_us\":" << Percentile(samples, 0.999)
+                      << ",\"avg_us\":" << (count == 0 ? 0.0 : sum / static_cast<double>(count) / 1000.0)
+                      << ",\"max_us\":" << (count == 0 ? 0.0 : static_cast<double>(samples.back()) / 1000.0) << "}"
+                      << std::endl;
+        }
+    }
+
+    uint64_t Errors() const
+    {
+        uint64_t errors = 0;
+        for (auto &it : stats_) {
+            errors += it.second.errors;
+        }
+        return errors;
+    }
+
+private:
+    struct OpStat {
+        std::vector<uint64_t> samples;
+        uint64_t errors = 0;
+        uint64_t conflicts = 0;
+    };
+
+    static double Percentile(const std::vector<uint64_t> &sorted, double ratio)
+    {
+        if (sorted.empty()) {
+            return 0.0;
+        }
+        auto pos = static_cast<size_t>(ratio * static_cast<double>(sorted.size()));
+        return static_cast<double>(sorted[std::min(pos, sorted.size() - 1)]) / 1000.0;
+    }
+
+    std::map<std::string, OpStat> stats_;
+};
+
+/* rendezvous of the worker threads between rounds */
+class ThreadBarrier {
+public:
+    explicit ThreadBarrier(uint32_t count) : count_(count) {}
+
+    void Wait()
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        auto generation = generation_;
+        if (++arrived_ == count_) {
+            arrived_ = 0;
+            generation_++;
+            cond_.notify_all();
+            return;
+        }
+        cond_.wait(lock, [this, generation]() { return generation != generation_; });
+    }
+
+private:
+    const uint32_t count_;
+    uint32_t arrived_ = 0;
+    uint64_t generation_ = 0;
+    std::mutex mutex_;
+    std::condition_variable cond_;
+};
+
+class LoadGenerator {
+public:
+    explicit LoadGenerator(const LoadArgs &args)
+        : args_(args), clients_(args.clientCount), recorders_(args.threadCount), barrier_(args.threadCount),
+          value_(args.valueSize, 'v'), casExpect_(args.threadCount)
+    {
+    }
+
+    int Run()
+    {
+        backend_ = SmMakeRef<SmemLocalMemoryBackend>();
+        if (backend_ == nullptr || backend_->Initialize("", "", "") != SUCCESS) {
+            std::cerr << "create client backend failed" << std::endl;
+            return -1;
+        }
+
+        // every client is an independent link, thousands of handshakes are a storm by themselves
+        auto ret = RunScenario("connect", [this](uint32_t tid, uint32_t) { Connect(tid); }, 1U);
+        for (auto &scenario : args_.scenarios) {
+            if (ret != 0) {
+                break;
+            }
+            if (scenario == "kv") {
+                ret = RunScenario(scenario, [this](uint32_t tid, uint32_t round) { KeyValue(tid, round); });
+            } else if (scenario == "barrier") {
+                ret = RunScenario(scenario, [this](uint32_t tid, uint32_t round) { BarrierStorm(tid, round); });
+            } else if (scenario == "allgather") {
+                ret = RunScenario(scenario, [this](uint32_t tid, uint32_t round) { AllGather(tid, round); });
+            } else if (scenario == "watch") {
+                ret = RunScenario(scenario, [this](uint32_t tid, uint32_t round) { WatchStorm(tid, round); });
+            } else if (scenario == "cas") {
+                ret = RunScenario(scenario, [this](uint32_t tid, uint32_t round) { CasContention(tid, round); });
+            }
+        }
+
+        // shutdown waits a heartbeat interval for each link, stop all links at once
+        std::vector<std::thread> threads;
+        for (auto &client : clients_) {
+            if (client != nullptr) {
+                threads.emplace_back([&client]() { client->Shutdown(); });
+            }
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+        clients_.clear();
+        return ret;
+    }
+
+private:
+    template <class Body>
+    int RunScenario(const std::string &name, Body &&body, uint32_t rounds = 0)
+    {
+        rounds = rounds == 0 ? args_.rounds : rounds;
+        for (auto &recorder : recorders_) {
+            recorder = Recorder{};
+        }
+
+        auto start = Clock::now();
+        std::vector<std::thread> threads;
+        for (uint32_t tid = 0; tid < args_.threadCount; tid++) {
+            threads.emplace_back([this, tid, rounds, &body]() {
+                for (uint32_t round = 0; round < rounds; round++) {
+                    body(tid, round);
+                    barrier_.Wait();
+                }
+            });
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+        auto seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+        Recorder total;
+        for (auto &recorder : recorders_) {
+            total.Merge(recorder);
+        }
+        total.Print(name, args_, seconds);
+        if (total.Errors() != 0) {
+            std::cerr << "scenario " << name << " has " << total.Errors() << " failed requests" << std::endl;
+            return -1;
+        }
+        return 0;
+    }
+
+    /* clients are spread over threads round robin, thread tid owns client tid, tid + threadCount, ... */
+    template <class Fn>
+    void ForEachClient(uint32_t tid, Fn &&fn)
+    {
+        for (uint32_t cid = tid; cid < args_.clientCount; cid += args_.threadCount) {
+            fn(cid, clients_[cid]);
+        }
+    }
+
+    void Connect(uint32_t tid)
+    {
+        ForEachClient(tid, [this, tid](uint32_t, SmRef<TcpConfigStore> &client) {
+            recorders_[tid].Time("connect", [this, &client]() {
+                client = SmMakeRef<TcpConfigStore>(Convert<SmemLocalMemoryBackend, ConfigStoreBackend>(backend_),
+                                                   args_.url.ip, args_.url.port, false);
+                smem_tls_config tlsConfig{};
+                return client->ClientStart(tlsConfig, CONNECT_RETRY_TIMES);
+            });
+        });
+    }
+
+    void KeyValue(uint32_t tid, uint32_t)
+    {
+        ForEachClient(tid, [this, tid](uint32_t cid, SmRef<TcpConfigStore> &client) {
+            auto key = "load/kv/" + std::to_string(cid);
+            recorders_[tid].Time("set", [this, &client, &key]() { return client->Set(key, value_); });
+            std::vector<uint8_t> value;
+            recorders_[tid].Time("get", [&client, &key, &value]() { return client->Get(key, value, 0); });
+        });
+    }
+
+    /* store barrier blocks until all participants arrive, so one client per thread joins each round */
+    void BarrierStorm(uint32_t tid, uint32_t round)
+    {
+        auto owned = (args_.clientCount - tid + args_.threadCount - 1U) / args_.threadCount;
+        auto &client = clients_[tid + (round % owned) * args_.threadCount];
+        auto key = "load/barrier/" + std::to_string(round);
+        recorders_[tid].Time("barrier", [this, &client, &key]() {
+            return client->Barrier(key, args_.threadCount, BARRIER_TIMEOUT_MS);
+        });
+    }
+
+    /* group all gather: every client appends its part then reads the gathered value */
+    void AllGather(uint32_t tid, uint32_t round)
+    {
+        auto key = "load/allgather/" + std::to_string(round);
+        ForEachClient(tid, [this, tid, &key](uint32_t, SmRef<TcpConfigStore> &client) {
+            uint64_t newSize = 0;
+            recorders_[tid].Time("append", [this, &client, &key, &newSize]() {
+                return client->Append(key, value_, newSize);
+            });
+        });
+        barrier_.Wait();
+        ForEachClient(tid, [this, tid, &key](uint32_t, SmRef<TcpConfigStore> &client) {
+            std::vector<uint8_t> value;
+            recorders_[tid].Time("get", [&client, &key, &value]() { return client->Get(key, value, 0); });
+        });
+    }
+
+    /* notifies of one thread in a round, callbacks may outlive the round when the server is slow */
+    struct WatchContext {
+        std::mutex mutex;
+        std::condition_variable cond;
+        std::vector<uint64_t> latencies;
+    };
+
+    /* every client watches one key, latency of notify is from the set to each callback */
+    void WatchStorm(uint32_t tid, uint32_t round)
+    {
+        auto key = "load/watch/" + std::to_string(round);
+        auto context = std::make_shared<WatchContext>();
+        uint32_t pending = 0;
+        ForEachClient(tid, [this, tid, &key, &context, &pending](uint32_t, SmRef<TcpConfigStore> &client) {
+            uint32_t wid = 0;
+            auto notify = [this, context](int, const std::string &, const std::vector<uint8_t> &) {
+                auto latency = NowNs() - setTimeNs_.load();
+                std::lock_guard<std::mutex> guard(context->mutex);
+                context->latencies.emplace_back(latency);
+                context->cond.notify_one();
+            };
+            if (recorders_[tid].Time("watch", [&client, &key, &notify, &wid]() {
+                    return client->Watch(key, notify, wid);
+                }) == 0) {
+                pending++;
+            }
+        });
+        barrier_.Wait();
+
+        if (tid == 0) {
+            setTimeNs_.store(NowNs());
+            recorders_[tid].Time("set", [this, &key]() { return clients_[0]->Set(key, value_); });
+        }
+        std::unique_lock<std::mutex> lock(context->mutex);
+        (void)context->cond.wait_for(lock, std::chrono::milliseconds(WATCH_TIMEOUT_MS),
+                                     [&context, pending]() { return context->latencies.size() >= pending; });
+        for (auto latency : context->latencies) {
+            recorders_[tid].Add("notify", latency);
+        }
+        recorders_[tid].Fail("notify", pending - std::min<uint64_t>(pending, context->latencies.size()));
+    }
+
+    /* all clients increase one counter by compare and swap, a mismatch is a conflict */
+    void CasContention(uint32_t tid, uint32_t)
+    {
+        const std::string key = "load/cas";
+        ForEachClient(tid, [this, tid, &key](uint32_t, SmRef<TcpConfigStore> &client) {
+            auto &expect = casExpect_[tid];
+            auto current = expect.empty() ? 0UL : std::stoul(std::string(expect.begin(), expect.end()));
+            auto next = std::to_string(current + 1UL);
+            std::vector<uint8_t> value(next.begin(), next.end());
+            std::vector<uint8_t> exists;
+            auto ret = recorders_[tid].Time("cas", [&]() { return client->Cas(key, expect, value, exists); });
+            if (ret == 0 && exists != expect) {
+                recorders_[tid].Conflict("cas");
+                expect = exists;
+            } else if (ret == 0) {
+                expect = value;
+            }
+        });
+    }
+
+private:
+    const LoadArgs &args_;
+    SmRef<SmemLocalMemoryBackend> backend_;
+    std::vector<SmRef<TcpConfigStore>> clients_;
+    std::vector<Recorder> recorders_;
+    ThreadBarrier barrier_;
+    const std::vector<uint8_t> value_;
+    std::atomic<uint64_t> setTimeNs_{0};
+    std::vector<std::vector<uint8_t>> casExpect_;
+};
+
+bool ParseArgs(int argc, char *argv[], LoadArgs &args)
+{
+    const int minArgCount = 5;
+    if (argc < minArgCount) {
+        return false;
+    }
+    args.clientCount = static_cast<uint32_t>(std::strtoul(argv[1], nullptr, 10));
+    args.threadCount = static_cast<uint32_t>(std::strtoul(argv[2], nullptr, 10));
+    args.rounds = static_cast<uint32_t>(std::strtoul(argv[3], nullptr, 10));
+    if (args.threadCount == 0 || args.clientCount < args.threadCount || args.rounds == 0 ||
+        args.url.ExtractIpPortFromUrl(argv[4]) != 0) {
+        return false;
+    }
+
+    for (int i = minArgCount; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--server") {
+            args.startServer = true;
+        } else if (arg.compare(0, 8, "--value=") == 0) {
+            args.valueSize = std::strtoull(arg.c_str() + 8, nullptr, 10);
+        } else if (arg.compare(0, 6, "--mix=") == 0) {
+            args.scenarios.clear();
+            std::stringstream ss(arg.substr(6));
+            std::string item;
+            while (std::getline(ss, item, ',')) {
+                if (std::find(ALL_SCENARIOS.begin(), ALL_SCENARIOS.end(), item) == ALL_SCENARIOS.end()) {
+                    return false;
+                }
+                args.scenarios.emplace_back(item);
+            }
+        } else {
+            return false;
+        }
+    }
+    return args.valueSize > 0;
+}
+} // namespace
+
+/**
+ * Generate load on a config store server with many client links and report latency per opcode.
+ * Usage: store_load_perf {clientCount} {threadCount} {rounds} tcp://{ip}:{port} [--server] [--value=64]
+ *        [--mix=kv,barrier,allgather,watch,cas]
+ * With --server the server is started in this process and listens on all addresses of the port.
+ */
+int main(int argc, char *argv[])
+{
+    LoadArgs args;
+    if (!ParseArgs(argc, argv, args)) {
+        std::cerr << "usage: " << argv[0] << " {clientCount} {threadCount} {rounds} tcp://{ip}:{port} [--server] "
+                  << "[--value=64] [--mix=kv,barrier,allgather,watch,cas]" << std::endl;
+        return -1;
+    }
+
+    StorePtr server;
+    if (args.startServer) {
+        server = StoreFactory::CreateStoreServer("0.0.0.0", args.url.port);
+        if (server == nullptr) {
+            std::cerr << "start store server failed: " << StoreFactory::GetFailedReason() << std::endl;
+            return -1;
+        }
+    }
+
+    LoadGenerator generator(args);
+    auto ret = generator.Run();
+
+    if (server != nullptr) {
+        server = nullptr;
+        StoreFactory::DestroyStore("0.0.0.0", args.url.port);
+    }
+    return ret;
+}
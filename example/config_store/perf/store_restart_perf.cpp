@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025-2025. All rights reserved.
+ * MemFabric_Hybrid is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *          http://license.coscl.org.cn/MulanPSL2
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+*/
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "smem.h"
+#include "smem_net_common.h"
+#include "smem_store_factory.h"
+
+using namespace ock::smem;
+
+namespace {
+constexpr uint32_t WORLD_SIZE = 2U;
+constexpr uint32_t SERVER_RANK = 0U;
+constexpr uint32_t CLIENT_RANK = 1U;
+
+double ElapsedMs(const std::chrono::steady_clock::time_point &start)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+std::string KeyOf(uint64_t index)
+{
+    return "restart_perf/key_" + std::to_string(index);
+}
+
+void StopStores(const UrlExtraction &url, StorePtr &server, StorePtr &client)
+{
+    // stop server first, otherwise server clears all keys when the last client leaves
+    server = nullptr;
+    StoreFactory::DestroyStore("0.0.0.0", url.port);
+    client = nullptr;
+    StoreFactory::DestroyStore(url.ip, url.port);
+}
+
+int StartStores(const UrlExtraction &url, StorePtr &server, StorePtr &client)
+{
+    server = StoreFactory::CreateStoreServer("0.0.0.0", url.port, WORLD_SIZE, SERVER_RANK);
+    if (server == nullptr) {
+        std::cerr << "start store server failed: " << StoreFactory::GetFailedReason() << std::endl;
+        return -1;
+    }
+    client = StoreFactory::CreateStoreClient(url.ip, url.port, WORLD_SIZE, CLIENT_RANK);
+    if (client == nullptr) {
+        std::cerr << "start store client failed: " << StoreFactory::GetFailedReason() << std::endl;
+        return -1;
+    }
+    return 0;
+}
+} // namespace
+
+/**
+ * Measure the time from a store server restarting to serving requests, when key space is persisted.
+ * Usage: store_restart_perf {keyCount} {valueSize} {persistDir} tcp://{ip}:{port}
+ * Server listens on all addresses of the port, client connects to the ip.
+ */
+int main(int argc, char *argv[])
+{
+    const int argCount = 5;
+    if (argc != argCount) {
+        std::cerr << "usage: " << argv[0] << " {keyCount} {valueSize} {persistDir} tcp://{ip}:{port}" << std::endl;
+        return -1;
+    }
+    auto keyCount = std::stoull(argv[1]);
+    auto valueSize = std::stoull(argv[2]);
+    std::string persistDir = argv[3];
+    UrlExtraction url;
+    if (keyCount == 0 || url.ExtractIpPortFromUrl(argv[4]) != 0) {
+        std::cerr << "invalid key count or url" << std::endl;
+        return -1;
+    }
+    if (smem_set_conf_store_persist_dir(persistDir.c_str()) != 0) {
+        std::cerr << "invalid persist dir: " << persistDir << std::endl;
+        return -1;
+    }
+
+    StorePtr server;
+    StorePtr client;
+    if (StartStores(url, server, client) != 0) {
+        return -1;
+    }
+
+    // publishing all keys by clients is what a full re-join costs without persistence
+    std::vector<uint8_t> value(valueSize, 'v');
+    auto start = std::chrono::steady_clock::now();
+    for (uint64_t i = 0; i < keyCount; i++) {
+        if (client->Set(KeyOf(i), value) != 0) {
+            std::cerr << "set key " << i << " failed" << std::endl;
+            StopStores(url, server, client);
+            return -1;
+        }
+    }
+    auto publishMs = ElapsedMs(start);
+    StopStores(url, server, client);
+
+    start = std::chrono::steady_clock::now();
+    if (StartStores(url, server, client) != 0) {
+        return -1;
+    }
+    std::vector<uint8_t> readBack;
+    auto ret = client->Get(KeyOf(keyCount - 1), readBack, 0);
+    auto restartMs = ElapsedMs(start);
+    StopStores(url, server, client);
+    if (ret != 0 || readBack != value) {
+        std::cerr << "key lost after restart, ret: " << ret << std::endl;
+        return -1;
+    }
+
+    std::cout << "keys: " << keyCount << ", value size: " << valueSize << std::endl;
+    std::cout << "publish by client: " << publishMs << " ms" << std::endl;
+    std::cout << "restart to serving: " << restartMs << " ms" << std::endl;
+    return 0;
+}
@@ -59,5 +59,20 @@ Result AccTcpLinkComplexDefault::EnqueueAndModifyEpoll(const AccMsgHeader &h, co
 
     return worker_->ModifyLink(this, POLLIN | POLLOUT | EPOLLET);
 }
+
+Result AccTcpLinkComplexDefault::EnqueueAndModifyEpoll(const AccMsgHeader &h,
+                                                       const std::vector<AccDataBufferPtr> &segments,
+                                                       const AccDataBufferPtr &cbCtx)
+{
+    ASSERT_RETURN(worker_ != nullptr, ACC_ERROR);
+    auto result = queue_->EnqueueBack(h, segments, cbCtx);
+    if (UNLIKELY(result != ACC_OK)) {
+        LOG_WARN("Failed to enqueue message into link " << this->id_ << ", errorCode:" << result
+                                                        << ", queue size:" << queue_->GetSize());
+        return result;
+    }
+
+    return worker_->ModifyLink(this, POLLIN | POLLOUT | EPOLLET);
+}
 } // namespace acc
 } // namespace ock
\ No newline at end of file
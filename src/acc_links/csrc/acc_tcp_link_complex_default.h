@@ -14,6 +14,7 @@
 
 #include <list>
 #include <utility>
+#include <vector>
 
 #include "acc_tcp_link_default.h"
 
@@ -29,8 +30,10 @@ struct AccLinkedMessageNode {
     AccMsgHeader header{};
     AccDataBufferPtr data{nullptr};
     AccDataBufferPtr cbCtx{nullptr};
+    std::vector<AccDataBufferPtr> tails; /* segments sent after data in order, for scatter message body */
     uint32_t headerRemain = sizeof(AccMsgHeader);
     uint32_t dataRemain = 0;
+    uint32_t tailIndex = 0;
 
     AccLinkedMessageNode() = default;
 
@@ -38,6 +41,31 @@ struct AccLinkedMessageNode {
         : header(h), data(d), cbCtx(ctx), dataRemain{d->DataLen()}
     {}
 
+    AccLinkedMessageNode(const AccMsgHeader &h, const std::vector<AccDataBufferPtr> &segments,
+                         const AccDataBufferPtr &ctx)
+        : header(h), cbCtx(ctx), tails(segments)
+    {
+        (void)NextSegment();
+    }
+
+    /* switch to next non-empty segment, return false if no more segment */
+    inline bool NextSegment()
+    {
+        while (tailIndex < tails.size()) {
+            data = tails[tailIndex++];
+            dataRemain = data->DataLen();
+            if (dataRemain > 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    inline bool HasMoreSegments() const
+    {
+        return tailIndex < tails.size();
+    }
+
     inline bool HeaderSent() const
     {
         return headerRemain == 0;
@@ -45,12 +73,12 @@ struct AccLinkedMessageNode {
 
     inline bool DataSent() const
     {
-        return dataRemain == 0;
+        return dataRemain == 0 && !HasMoreSegments();
     }
 
     inline bool Sent() const
     {
-        return headerRemain == 0 && dataRemain == 0;
+        return headerRemain == 0 && DataSent();
     }
 
     inline void *HeaderPtrToBeSend() const
@@ -76,9 +104,12 @@ struct AccLinkedMessageNode {
 
     inline bool DataAllSent(uint32_t size)
     {
-        if (dataRemain <= size) {
+        while (dataRemain <= size) {
+            size -= dataRemain;
             dataRemain = 0;
-            return true;
+            if (!NextSegment()) {
+                return true;
+            }
         }
         dataRemain -= size;
         return false;
@@ -138,31 +169,27 @@ public:
         auto tmpNode = new (std::nothrow) AccLinkedMessageNode(h, d, cbCtx);
         ASSERT_RETURN(tmpNode != nullptr, ACC_NEW_OBJECT_FAIL);
         tmpNode->dataRemain = d->DataLen();
+        return EnqueueNodeBack(tmpNode);
+    }
 
-        {
-            /* check and add */
-            std::lock_guard<std::mutex> guard(mutex_);
-            if (size_ >= sizeCap_) {
-                delete tmpNode;
-                tmpNode = nullptr;
-                return ACC_QUEUE_IS_FULL;
-            }
-
-            /* if the empty */
-            if (headNode_ == nullptr) {
-                headNode_ = tmpNode;
-                tailNode_ = tmpNode;
-                ++size_;
-                return ACC_OK;
-            }
-
-            /* if not empty */
-            auto currentTail = tailNode_;
-            tailNode_ = tmpNode;
-            currentTail->next = tmpNode;
-            ++size_;
-            return ACC_OK;
+    /**
+     * @brief Enqueue a header and data segments into queue on the back
+     *
+     * @param h            [in] header
+     * @param segments     [in] data segments sent in order as one message body
+     * @return 0 if successful, ACC_QUEUE_IS_FULL if full
+     */
+    Result EnqueueBack(const AccMsgHeader &h, const std::vector<AccDataBufferPtr> &segments,
+                       const AccDataBufferPtr &cbCtx)
+    {
+        ASSERT_RETURN(!segments.empty(), ACC_INVALID_PARAM);
+        for (auto &seg : segments) {
+            ASSERT_RETURN(seg.Get() != nullptr, ACC_INVALID_PARAM);
         }
+
+        auto tmpNode = new (std::nothrow) AccLinkedMessageNode(h, segments, cbCtx);
+        ASSERT_RETURN(tmpNode != nullptr, ACC_NEW_OBJECT_FAIL);
+        return EnqueueNodeBack(tmpNode);
     }
 
     /**
@@ -236,6 +263,33 @@ public:
         return tmpNode;
     }
 
+private:
+    Result EnqueueNodeBack(AccLinkedMessageNode *tmpNode)
+    {
+        /* check and add */
+        std::lock_guard<std::mutex> guard(mutex_);
+        if (size_ >= sizeCap_) {
+            delete tmpNode;
+            tmpNode = nullptr;
+            return ACC_QUEUE_IS_FULL;
+        }
+
+        /* if the empty */
+        if (headNode_ == nullptr) {
+            headNode_ = tmpNode;
+            tailNode_ = tmpNode;
+            ++size_;
+            return ACC_OK;
+        }
+
+        /* if not empty */
+        auto currentTail = tailNode_;
+        tailNode_ = tmpNode;
+        currentTail->next = tmpNode;
+        ++size_;
+        return ACC_OK;
+    }
+
 private:
     uint32_t sizeCap_ = UNO_256;               /* cap of the send queue */
     uint32_t size_ = 0;                        /* size */
@@ -270,6 +324,8 @@ public:
 
     Result EnqueueAndModifyEpoll(const AccMsgHeader &h, const AccDataBufferPtr &d,
                                  const AccDataBufferPtr &cbCtx) override;
+    Result EnqueueAndModifyEpoll(const AccMsgHeader &h, const std::vector<AccDataBufferPtr> &segments,
+                                 const AccDataBufferPtr &cbCtx) override;
 
 protected:
     AccLinkedMessageNode *DequeueFront() noexcept;
@@ -279,6 +335,7 @@ protected:
 
     ssize_t PollInRecv(void *ptr, ssize_t len) noexcept;
     ssize_t PollOutWrite(void *ptr, ssize_t len) noexcept;
+    ssize_t PollOutWriteData(const AccLinkedMessageNode *msg) noexcept;
     Result HandlePollIn() noexcept;
     Result HandlePollOut(AccMsgHeader &header, AccDataBufferPtr &cbCtx) noexcept;
     Result SendPostProcess(int32_t errorNumber) noexcept;
@@ -334,6 +391,28 @@ inline ssize_t AccTcpLinkComplexDefault::PollOutWrite(void *ptr, ssize_t len) no
     }
 }
 
+inline ssize_t AccTcpLinkComplexDefault::PollOutWriteData(const AccLinkedMessageNode *msg) noexcept
+{
+    if (!msg->HasMoreSegments() || ssl_ != nullptr) {
+        return PollOutWrite(msg->DataPtrToBeSend(), msg->dataRemain);
+    }
+
+    /* gather current segment and following ones in one syscall */
+    struct iovec iov[UNO_32];
+    int iovCount = 0;
+    iov[iovCount].iov_base = msg->DataPtrToBeSend();
+    iov[iovCount++].iov_len = msg->dataRemain;
+    for (auto i = msg->tailIndex; i < msg->tails.size() && iovCount < static_cast<int>(UNO_32); ++i) {
+        auto &seg = msg->tails[i];
+        if (seg->DataLen() == 0) {
+            continue;
+        }
+        iov[iovCount].iov_base = seg->DataPtrVoid();
+        iov[iovCount++].iov_len = seg->DataLen();
+    }
+    return ::writev(fd_, iov, iovCount);
+}
+
 inline Result AccTcpLinkComplexDefault::HandlePollIn() noexcept
 {
     const auto headDataPtr = reinterpret_cast<uintptr_t>(&header_);
@@ -438,7 +517,7 @@ inline Result AccTcpLinkComplexDefault::HandlePollOut(AccMsgHeader &header, AccD
 
     /* send data if not sent */
     if (!oneMsg->DataSent()) {
-        auto result = PollOutWrite(oneMsg->DataPtrToBeSend(), oneMsg->dataRemain);
+        auto result = PollOutWriteData(oneMsg);
         if (LIKELY(result > 0)) {
             if (!oneMsg->DataAllSent(result)) { /* not all sent */
                 queue_->EnqueueFront(oneMsg);
@@ -376,6 +376,13 @@ public:
         return ACC_ERROR;
     }
 
+    Result EnqueueAndModifyEpoll(const AccMsgHeader &h, const std::vector<AccDataBufferPtr> &segments,
+                                 const AccDataBufferPtr &cbCtx) override
+    {
+        LOG_DEBUG("Not support non-blocking send, header " << h.ToString());
+        return ACC_ERROR;
+    }
+
 protected:
     SSL *ssl_ = nullptr; /* ssl link ptr */
 
@@ -22,6 +22,8 @@ constexpr int LISTEN_POLL_TIME = 500; // 500ms
 #else
 constexpr int LISTEN_POLL_TIME = 10; // 10ms
 #endif
+constexpr int LISTEN_BACKLOG = 4096; // capped by net.core.somaxconn
+
 Result AccTcpListener::Start() noexcept
 {
     auto parser = mf::SocketAddressParserMgr::getInstance().GetParser(listenPort_);
@@ -51,7 +53,17 @@ Result AccTcpListener::Start() noexcept
         }
     }
 
-    if (::bind(tmpFD, parser->GetSockAddr(), parser->GetAddrLen()) < 0 || ::listen(tmpFD, 200L) < 0) {
+    /* listeners sharing the port are balanced by kernel, each of them accepts a part of connections */
+    if (sharePort_) {
+        int flags = 1;
+        if (::setsockopt(tmpFD, SOL_SOCKET, SO_REUSEPORT, reinterpret_cast<void *>(&flags), sizeof(flags)) < 0) {
+            SafeCloseFd(tmpFD);
+            LOG_ERROR("Failed to set share port of " << NameAndPort() << " as " << strerror(errno));
+            return ACC_ERROR;
+        }
+    }
+
+    if (::bind(tmpFD, parser->GetSockAddr(), parser->GetAddrLen()) < 0 || ::listen(tmpFD, LISTEN_BACKLOG) < 0) {
         auto errorNum = errno;
         SafeCloseFd(tmpFD);
         if (errorNum == EADDRINUSE) {
@@ -88,13 +100,20 @@ Result AccTcpListener::StartAcceptThread() noexcept
 {
     threadStarted_.store(false);
 
+    auto ret = StartHandshakeThreads();
+    if (ret != ACC_OK) {
+        return ret;
+    }
+
     try {
         acceptThread_ = std::thread([this]() { this->RunInThread(); });
     } catch (const std::system_error &e) {
         LOG_ERROR("Failed to create accept thread: " << e.what());
+        StopHandshakeThreads(false);
         return ACC_ERROR;
     } catch (...) {
         LOG_ERROR("Unknown error creating accept thread");
+        StopHandshakeThreads(false);
         return ACC_ERROR;
     }
 
@@ -106,6 +125,58 @@ Result AccTcpListener::StartAcceptThread() noexcept
     return ACC_OK;
 }
 
+Result AccTcpListener::StartHandshakeThreads() noexcept
+{
+    needStop_ = false;
+    try {
+        for (uint16_t i = 0; i < handshakeThreadCount_; i++) {
+            handshakeThreads_.emplace_back([this]() { this->RunHandshakeInThread(); });
+            std::string thrName = "AccHandshake" + std::to_string(i);
+            if (pthread_setname_np(handshakeThreads_.back().native_handle(), thrName.c_str()) != 0) {
+                LOG_WARN("Failed to set thread name of handshake thread " << i);
+            }
+        }
+    } catch (const std::system_error &e) {
+        LOG_ERROR("Failed to create handshake thread: " << e.what());
+        StopHandshakeThreads(false);
+        return ACC_ERROR;
+    } catch (...) {
+        LOG_ERROR("Unknown error creating handshake thread");
+        StopHandshakeThreads(false);
+        return ACC_ERROR;
+    }
+
+    return ACC_OK;
+}
+
+void AccTcpListener::StopHandshakeThreads(bool afterFork) noexcept
+{
+    {
+        std::lock_guard<std::mutex> guard(pendingMutex_);
+        needStop_ = true;
+    }
+    pendingCond_.notify_all();
+
+    for (auto &thread : handshakeThreads_) {
+        if (!thread.joinable()) {
+            continue;
+        }
+        if (afterFork) {
+            thread.detach();
+        } else {
+            thread.join();
+        }
+    }
+    handshakeThreads_.clear();
+
+    /* connections not handshake yet are refused */
+    std::lock_guard<std::mutex> guard(pendingMutex_);
+    for (auto &conn : pending_) {
+        SafeCloseFd(conn.fd, !afterFork);
+    }
+    pending_.clear();
+}
+
 void AccTcpListener::Stop(bool afterFork) noexcept
 {
     if (!started_) {
@@ -121,6 +192,7 @@ void AccTcpListener::Stop(bool afterFork) noexcept
         }
     }
 
+    StopHandshakeThreads(afterFork);
     SafeCloseFd(listenFd_, !afterFork);
 
     started_ = false;
@@ -163,7 +235,7 @@ void AccTcpListener::RunInThread() noexcept
             struct timeval timeout = {ACC_LINK_RECV_TIMEOUT, 0};
             setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
 
-            ProcessNewConnection(fd, addressIn);
+            DispatchNewConnection(fd, addressIn);
         } catch (std::exception &ex) {
             LOG_WARN("Got exception in AccTcpListener::RunInThread, exception " << ex.what()
                                                                                 << ", ignore and continue");
@@ -175,6 +247,39 @@ void AccTcpListener::RunInThread() noexcept
     LOG_INFO("Working thread for AccTcpStore listener at " << NameAndPort() << " exiting");
 }
 
+void AccTcpListener::DispatchNewConnection(int fd, struct sockaddr_in addressIn) noexcept
+{
+    if (handshakeThreads_.empty()) {
+        ProcessNewConnection(fd, addressIn);
+        return;
+    }
+
+    /* conn req and tls handshake may block for a while, keep accept thread taking new connections */
+    {
+        std::lock_guard<std::mutex> guard(pendingMutex_);
+        pending_.push_back({fd, addressIn});
+    }
+    pendingCond_.notify_one();
+}
+
+void AccTcpListener::RunHandshakeInThread() noexcept
+{
+    while (true) {
+        PendingConnection conn{};
+        {
+            std::unique_lock<std::mutex> lock(pendingMutex_);
+            pendingCond_.wait(lock, [this]() { return needStop_ || !pending_.empty(); });
+            if (needStop_) {
+                break;
+            }
+            conn = pending_.front();
+            pending_.pop_front();
+        }
+
+        ProcessNewConnection(conn.fd, conn.addressIn);
+    }
+}
+
 void AccTcpListener::ProcessNewConnection(int fd, struct sockaddr_in addressIn) noexcept
 {
     std::string ipPort = inet_ntoa(addressIn.sin_addr);
@@ -198,6 +303,9 @@ void AccTcpListener::ProcessNewConnection(int fd, struct sockaddr_in addressIn)
             SafeCloseFd(fd);
             return;
         }
+        if (sslHelper_ != nullptr) {
+            sslHelper_->CountHandshake(ssl);
+        }
     }
 
     LOG_INFO("Connected from " << ipPort << " successfully, ssl " << (enableTls_ ? "enable" : "disable"));
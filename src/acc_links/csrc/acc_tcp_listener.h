@@ -12,6 +12,10 @@
 #ifndef ACC_LINKS_ACC_TCP_LISTENER_H
 #define ACC_LINKS_ACC_TCP_LISTENER_H
 
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+
 #include "mf_net.h"
 #include "acc_includes.h"
 #include "acc_tcp_common.h"
@@ -24,8 +28,17 @@ using NewConnHandlerInner = std::function<int(const AccConnReq &reg, const AccTc
 
 class AccTcpListener : public AccReferable {
 public:
-    AccTcpListener(std::string ip, uint16_t port, bool reusePort, bool enableTls = false, SSL_CTX *sslCtx = nullptr)
-        : listenIp_(std::move(ip)), listenPort_(port), reusePort_(reusePort), enableTls_(enableTls), sslCtx_(sslCtx)
+    AccTcpListener(std::string ip, uint16_t port, bool reusePort, bool enableTls = false, SSL_CTX *sslCtx = nullptr,
+                   uint16_t handshakeThreadCount = 0, bool sharePort = false,
+                   const AccTcpSslHelperPtr &sslHelper = nullptr)
+        : listenIp_(std::move(ip)),
+          listenPort_(port),
+          reusePort_(reusePort),
+          enableTls_(enableTls),
+          sslCtx_(sslCtx),
+          handshakeThreadCount_(handshakeThreadCount),
+          sharePort_(sharePort),
+          sslHelper_(sslHelper)
     {}
 
     ~AccTcpListener() override = default;
@@ -37,11 +50,21 @@ public:
 
 private:
     void RunInThread() noexcept;
+    void RunHandshakeInThread() noexcept;
+    void DispatchNewConnection(int fd, struct sockaddr_in addressIn) noexcept;
     void ProcessNewConnection(int fd, struct sockaddr_in addressIn) noexcept;
     Result StartAcceptThread() noexcept;
+    Result StartHandshakeThreads() noexcept;
+    void StopHandshakeThreads(bool afterFork) noexcept;
 
     inline std::string NameAndPort() const noexcept;
 
+private:
+    struct PendingConnection {
+        int fd;
+        struct sockaddr_in addressIn;
+    };
+
 private:
     int listenFd_ = -1;                         /* listen fd */
     volatile bool needStop_ = false;            /* stop thread flag */
@@ -54,6 +77,13 @@ private:
     const bool reusePort_;                      /* reuse listen port or not */
     const bool enableTls_;                      /* enable tls */
     SSL_CTX *sslCtx_ = nullptr;                 /* ssl ctx */
+    const uint16_t handshakeThreadCount_;       /* handshake threads, 0 for handshake in accept thread */
+    const bool sharePort_;                      /* share listen port with other listeners by SO_REUSEPORT */
+    AccTcpSslHelperPtr sslHelper_;              /* count tls handshakes */
+    std::vector<std::thread> handshakeThreads_; /* threads receive conn req and do tls handshake */
+    std::mutex pendingMutex_;                   /* lock of pending connections */
+    std::condition_variable pendingCond_;       /* notify handshake threads */
+    std::deque<PendingConnection> pending_;     /* accepted connections waiting for handshake */
 };
 using AccTcpListenerPtr = AccRef<AccTcpListener>;
 
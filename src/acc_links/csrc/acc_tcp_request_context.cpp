@@ -26,5 +26,24 @@ Result AccTcpRequestContext::Reply(int16_t result, const AccDataBufferPtr &d) co
     AccMsgHeader replyHeader(header_.type, result, d->DataLen(), header_.seqNo);
     return link_->EnqueueAndModifyEpoll(replyHeader, d, nullptr);
 }
+
+Result AccTcpRequestContext::Reply(int16_t result, const std::vector<AccDataBufferPtr> &segments) const
+{
+    ASSERT_RETURN(!segments.empty(), ACC_INVALID_PARAM);
+    ASSERT_RETURN(link_.Get() != nullptr, ACC_LINK_ERROR);
+    if (UNLIKELY(!link_->Established())) {
+        LOG_ERROR("Failed to send reply message with message type " << header_.type << ", seqlo " << header_.seqNo
+                                                                    << " as the link is broken, id: " << link_->Id());
+        return ACC_LINK_ERROR;
+    }
+    uint64_t bodyLen = 0;
+    for (auto &seg : segments) {
+        ASSERT_RETURN(seg.Get() != nullptr, ACC_INVALID_PARAM);
+        bodyLen += seg->DataLen();
+    }
+    ASSERT_RETURN(bodyLen <= UINT32_MAX, ACC_INVALID_PARAM);
+    AccMsgHeader replyHeader(header_.type, result, static_cast<uint32_t>(bodyLen), header_.seqNo);
+    return link_->EnqueueAndModifyEpoll(replyHeader, segments, nullptr);
+}
 } // namespace acc
 } // namespace ock
\ No newline at end of file
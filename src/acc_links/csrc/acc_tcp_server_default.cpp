@@ -10,6 +10,8 @@
  * See the Mulan PSL v2 for more details.
 */
 
+#include <random>
+
 #include "mf_file_util.h"
 
 #include "acc_tcp_server.h"
@@ -19,6 +21,10 @@
 
 namespace ock {
 namespace acc {
+constexpr uint16_t MAX_LISTENER_COUNT = UNO_16;
+constexpr uint32_t CONNECT_BACKOFF_MIN_MS = 50;
+constexpr uint32_t CONNECT_BACKOFF_MAX_MS = UNO_1000;
+
 template<class T>
 class AtmoicRollback {
 public:
@@ -159,6 +165,16 @@ Result AccTcpServerDefault::ValidateOptions() const
         return ACC_INVALID_PARAM;
     }
 
+    if (options_.enableListener && (options_.listenerCount == 0 || options_.listenerCount > MAX_LISTENER_COUNT)) {
+        LOG_ERROR("Invalid listener count as it should be between 1 and " << MAX_LISTENER_COUNT);
+        return ACC_INVALID_PARAM;
+    }
+
+    if (options_.handshakeThreadCount > UNO_256) {
+        LOG_ERROR("Invalid handshake thread count as it should not be bigger than 256");
+        return ACC_INVALID_PARAM;
+    }
+
     if (options_.workerStartCpuId < -1) {
         LOG_ERROR("Invalid worker start cpu Id as it should not be smaller than -1");
         return ACC_INVALID_PARAM;
@@ -291,30 +307,39 @@ Result AccTcpServerDefault::StartListener()
         return ACC_OK;
     }
 
-    AccTcpListenerPtr tmpListener = new (std::nothrow)
-        AccTcpListener(options_.listenIp, options_.listenPort, options_.reusePort, tlsOption_.enableTls, sslCtx_);
-    ASSERT_RETURN(tmpListener.Get() != nullptr, ACC_NEW_OBJECT_FAIL);
+    /* several listeners bind the same port with SO_REUSEPORT, kernel spreads connections among them */
+    auto sharePort = options_.listenerCount > 1;
+    for (uint16_t i = 0; i < options_.listenerCount; i++) {
+        AccTcpListenerPtr tmpListener = new (std::nothrow)
+            AccTcpListener(options_.listenIp, options_.listenPort, options_.reusePort, tlsOption_.enableTls, sslCtx_,
+                           options_.handshakeThreadCount, sharePort, sslHelper_);
+        if (tmpListener.Get() == nullptr) {
+            LOG_ERROR("Failed to create listener " << i << ", probably out of memory");
+            StopAndCleanListener();
+            return ACC_NEW_OBJECT_FAIL;
+        }
 
-    tmpListener->RegisterNewConnectionHandler(
-        std::bind(&AccTcpServerDefault::HandleNewConnection, this, std::placeholders::_1, std::placeholders::_2));
+        tmpListener->RegisterNewConnectionHandler(
+            std::bind(&AccTcpServerDefault::HandleNewConnection, this, std::placeholders::_1, std::placeholders::_2));
 
-    auto result = tmpListener->Start();
-    if (result != ACC_OK) {
-        return result;
+        auto result = tmpListener->Start();
+        if (result != ACC_OK) {
+            StopAndCleanListener();
+            return result;
+        }
+
+        listeners_.push_back(tmpListener);
     }
 
-    listener_ = tmpListener;
     return ACC_OK;
 }
 
 void AccTcpServerDefault::StopAndCleanListener(bool afterFork)
 {
-    if (listener_ == nullptr) {
-        return;
+    for (auto &listener : listeners_) {
+        listener->Stop(afterFork);
     }
-
-    listener_->Stop(afterFork);
-    listener_ = nullptr;
+    listeners_.clear();
 }
 
 void AccTcpServerDefault::StopAndCleanSSLHelper(bool afterFork)
@@ -485,10 +510,13 @@ Result AccTcpServerDefault::ConnectToPeerServer(const std::string &peerIp, uint1
     int synCnt = 1; /* Set connect() retry time for quick connect */
     setsockopt(tmpFD, IPPROTO_TCP, TCP_SYNCNT, &synCnt, sizeof(synCnt));
 
+    /* keep the time budget of one second per retry, but retry sooner and spread clients refused together */
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(maxRetryTimes);
+    uint32_t backoffMs = CONNECT_BACKOFF_MIN_MS;
     uint32_t timesRetried = 0;
     int lastErrno = 0;
     auto [addrPtr, addrLen] = parser->GetPeerAddress(peerIp, port);
-    while (timesRetried < maxRetryTimes) {
+    while (maxRetryTimes > 0) {
         LOG_INFO_LIMIT("Trying to connect to " << ipAndPort);
         errno = 0;
         if (::connect(tmpFD, addrPtr, addrLen) == 0) {
@@ -513,9 +541,10 @@ Result AccTcpServerDefault::ConnectToPeerServer(const std::string &peerIp, uint1
             lastErrno = errno;
         }
 
-        // interval between each retry, 1 sec for each time,
-        sleep(1);
         timesRetried++;
+        if (WaitBeforeReconnect(deadline, backoffMs) != ACC_OK) {
+            break;
+        }
     }
 
     SafeCloseFd(tmpFD);
@@ -523,6 +552,30 @@ Result AccTcpServerDefault::ConnectToPeerServer(const std::string &peerIp, uint1
     return ACC_ERROR;
 }
 
+Result AccTcpServerDefault::WaitBeforeReconnect(std::chrono::steady_clock::time_point deadline, uint32_t &backoffMs)
+{
+    static thread_local std::mt19937 generator{std::random_device{}()};
+
+    auto now = std::chrono::steady_clock::now();
+    if (now >= deadline) {
+        return ACC_TIMEOUT;
+    }
+
+    /* sleep a random time in [backoff / 2, backoff], then double the backoff */
+    std::uniform_int_distribution<uint32_t> distribution(backoffMs / UNO_2, backoffMs);
+    auto interval = std::min(std::chrono::duration_cast<std::chrono::milliseconds>(deadline - now),
+                             std::chrono::milliseconds(distribution(generator)));
+    std::this_thread::sleep_for(interval);
+    backoffMs = std::min(backoffMs * UNO_2, CONNECT_BACKOFF_MAX_MS);
+    return ACC_OK;
+}
+
+AccTlsHandshakeStat AccTcpServerDefault::GetTlsHandshakeStat() const
+{
+    auto helper = sslHelper_;
+    return helper != nullptr ? helper->HandshakeStat() : AccTlsHandshakeStat{};
+}
+
 AccTcpServerDefault::~AccTcpServerDefault()
 {
     if (sslCtx_ != nullptr) {
@@ -575,10 +628,15 @@ Result AccTcpServerDefault::GenerateSslCtx()
     return ACC_OK;
 }
 
-Result AccTcpServerDefault::CreateSSLLink(SSL *&ssl, int &tmpFD)
+Result AccTcpServerDefault::CreateSSLLink(SSL *&ssl, int &tmpFD, const std::string &ipAndPort)
 {
     if (tlsOption_.enableTls) {
-        auto result = AccTcpSslHelper::NewSslLink(false, tmpFD, sslCtx_, ssl);
+        /* resume the session of last link to the same peer, saves the certificate exchange on reconnecting */
+        SSL_SESSION *session = sslHelper_ != nullptr ? sslHelper_->GetSession(ipAndPort) : nullptr;
+        auto result = AccTcpSslHelper::NewSslLink(false, tmpFD, sslCtx_, ssl, session);
+        if (session != nullptr) {
+            OpenSslApiWrapper::SslSessionFree(session);
+        }
         if (result != ACC_OK) {
             LOG_ERROR("Failed to new server ssl link");
             SafeCloseFd(tmpFD);
@@ -623,7 +681,7 @@ Result AccTcpServerDefault::Handshake(int &tmpFD, const AccConnReq &connReq, con
     }
 
     SSL *ssl = nullptr;
-    if (CreateSSLLink(ssl, tmpFD) != ACC_OK) {
+    if (CreateSSLLink(ssl, tmpFD, ipAndPort) != ACC_OK) {
         LOG_ERROR("Failed to create ssl link");
         return ACC_NEW_OBJECT_FAIL;
     }
@@ -641,6 +699,11 @@ Result AccTcpServerDefault::Handshake(int &tmpFD, const AccConnReq &connReq, con
         return ACC_ERROR;
     }
 
+    if (ssl != nullptr && sslHelper_ != nullptr) {
+        sslHelper_->CountHandshake(ssl);
+        sslHelper_->SaveSession(ssl, ipAndPort);
+    }
+
     auto workIndex = WorkerSelect();
     if (workIndex == ACC_ERROR) {
         LOG_ERROR("Failed to select available worker.");
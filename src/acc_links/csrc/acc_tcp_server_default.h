@@ -46,6 +46,8 @@ public:
 
     void RegisterDecryptHandler(const AccDecryptHandler &h) override;
 
+    AccTlsHandshakeStat GetTlsHandshakeStat() const override;
+
 private:
     Result ValidateOptions() const;
     Result ValidateHandler() const;
@@ -59,10 +61,11 @@ private:
     void StopAndCleanSSLHelper(bool afterFork = false);
 
     Result GenerateSslCtx();
-    Result CreateSSLLink(SSL *&ssl, int &tmpFD);
+    Result CreateSSLLink(SSL *&ssl, int &tmpFD, const std::string &ipAndPort);
     void ValidateSSLLink(SSL *&ssl, int &tmpFD);
     Result LinkReceive(AccRef<AccTcpLinkComplexDefault> &tmpLink, const std::string &ipAndPort);
 
+    Result WaitBeforeReconnect(std::chrono::steady_clock::time_point deadline, uint32_t &backoffMs);
     Result Handshake(int &fd, const AccConnReq &connReq, const std::string &ipAndPort, AccTcpLinkComplexPtr &newLink);
 
     /* listener callback */
@@ -82,7 +85,7 @@ private:
     AccLinkBrokenHandler linkBrokenHandle_ = nullptr;
     AccDecryptHandler decryptHandler_ = nullptr;
     std::vector<AccTcpWorkerPtr> workers_;
-    AccTcpListenerPtr listener_;
+    std::vector<AccTcpListenerPtr> listeners_;
     std::atomic<uint32_t> nextWorkerIndex_{0};
     std::unordered_map<uint32_t, AccTcpLinkComplexDefaultPtr> connectedLinks_;
     AccNewLinkHandler newLinkHandle_ = nullptr;
@@ -25,9 +25,19 @@ AccDataBuffer::AccDataBuffer(const void *data, uint32_t size) : AccDataBuffer{si
     }
 }
 
+AccDataBuffer::AccDataBuffer(const void *data, uint32_t size, std::shared_ptr<const void> holder)
+    : dataSize_{size},
+      memSize_{size},
+      data_{static_cast<uint8_t *>(const_cast<void *>(data))},
+      holder_{std::move(holder)}
+{}
+
 AccDataBuffer::~AccDataBuffer()
 {
-    delete[] data_;
+    if (holder_ == nullptr) {
+        delete[] data_;
+    }
+    holder_ = nullptr;
     data_ = nullptr;
     memSize_ = 0;
     dataSize_ = 0;
@@ -39,6 +49,10 @@ bool AccDataBuffer::AllocIfNeed(uint32_t newSize) noexcept
         return false;
     }
 
+    if (holder_ != nullptr) { /* external memory can not be re-allocated */
+        return newSize <= memSize_;
+    }
+
     if (data_ == nullptr) {
         memSize_ = std::max(memSize_, newSize);
         data_ = new (std::nothrow) uint8_t[memSize_];
@@ -76,5 +90,14 @@ AccDataBufferPtr AccDataBuffer::Create(uint32_t memSize)
 
     return buffer;
 }
+
+AccDataBufferPtr AccDataBuffer::Create(const void *data, uint32_t size, std::shared_ptr<const void> holder)
+{
+    if (data == nullptr || holder == nullptr) {
+        return nullptr;
+    }
+
+    return AccMakeRef<AccDataBuffer>(data, size, std::move(holder));
+}
 } // namespace acc
 } // namespace ock
\ No newline at end of file
@@ -11,6 +11,7 @@
 */
 
 #include "acc_tcp_ssl_helper.h"
+#include <sys/stat.h>
 #include "acc_common_util.h"
 #include "mf_file_util.h"
 #include "mf_str_util.h"
@@ -23,6 +24,14 @@ constexpr uint32_t CHECK_PERIOD_HOURS = 7 * 24;
 constexpr uint32_t HOURS_OF_ONE_DAY = 24;
 constexpr std::pair<uint32_t, uint32_t> CERT_CHECK_AHEAD_DAYS_RANGE(7, 180);
 constexpr std::pair<uint32_t, uint32_t> CHECK_PERIOD_HOURS_RANGE(24, 30 * 24);
+constexpr unsigned char SESSION_ID_CONTEXT[] = "acc_links";
+constexpr uint32_t TICKET_IV_LENGTH = 16;
+constexpr std::chrono::seconds TICKET_KEY_ROTATE_PERIOD(60 * 60);
+constexpr int TICKET_HELPER_EX_INDEX = 0; // 与SSL_CTX_set_app_data一致
+constexpr const char *TICKET_KEY_FILE_ENV = "ACCLINK_TICKET_KEY_FILE";
+constexpr off_t TICKET_SECRET_MIN_LENGTH = 32;
+constexpr off_t TICKET_SECRET_MAX_LENGTH = 4096;
+constexpr mode_t TICKET_SECRET_MAX_MODE = 0640;
 } // namespace
 
 #define SSL_LAYER_CHECK_RET(_condition, _msg) \
@@ -69,6 +78,14 @@ AccResult AccTcpSslHelper::InitTlsPath(AccTlsOption &param)
     tlsCert = param.tlsCert;
     tlsPk = param.tlsPk;
     tlsPkPwd = param.tlsPkPwd;
+    tlsTicketKeyFile = param.tlsTicketKeyFile;
+    if (tlsTicketKeyFile.empty() && std::getenv(TICKET_KEY_FILE_ENV) != nullptr) {
+        tlsTicketKeyFile = std::getenv(TICKET_KEY_FILE_ENV);
+    }
+    if (!tlsTicketKeyFile.empty() && !mf::FileUtil::Realpath(tlsTicketKeyFile)) {
+        LOG_ERROR("Failed to check ticket key file path");
+        return ACC_ERROR;
+    }
 
     tlsCaPaths.clear();
     const std::string caDir = tlsTopPath + "/" + param.tlsCaPath;
@@ -99,6 +116,7 @@ void AccTcpSslHelper::Stop(bool afterFork)
 {
     StopCheckCertExpired(afterFork);
     EraseDecryptData();
+    ClearSessions();
 }
 
 AccResult AccTcpSslHelper::InitSSL(SSL_CTX *sslCtx)
@@ -129,9 +147,306 @@ AccResult AccTcpSslHelper::InitSSL(SSL_CTX *sslCtx)
 
     ret = LoadPrivateKey(sslCtx);
     SSL_LAYER_CHECK_RET(ret != ACC_OK, "Failed to load private key");
+
+    ret = InitSessionResumption(sslCtx);
+    SSL_LAYER_CHECK_RET(ret != ACC_OK, "Failed to init session resumption");
     return ACC_OK;
 }
 
+AccResult AccTcpSslHelper::InitSessionResumption(SSL_CTX *sslCtx)
+{
+    // 开启双向认证时，会话恢复需要设置会话上下文
+    auto ret = OpenSslApiWrapper::SslCtxSetSessionIdContext(sslCtx, SESSION_ID_CONTEXT,
+                                                           sizeof(SESSION_ID_CONTEXT) - 1U);
+    SSL_LAYER_CHECK_RET(ret <= 0, "Failed to set session id context");
+
+    return SetTicketKeys(sslCtx);
+}
+
+AccResult AccTcpSslHelper::SetTicketKeys(SSL_CTX *sslCtx)
+{
+    // 先生成一次密钥，随机数或密钥文件不可用时启动即失败，而不是每次签发ticket时失败
+    SSL_LAYER_CHECK_RET(!mTicketKeys.Init(tlsTicketKeyFile), "Failed to generate ticket keys");
+
+    auto ret = OpenSslApiWrapper::SslCtxSetExData(sslCtx, TICKET_HELPER_EX_INDEX, this);
+    SSL_LAYER_CHECK_RET(ret <= 0, "Failed to bind ticket keys to ssl ctx");
+    ret = OpenSslApiWrapper::SslCtxCallbackCtrl(sslCtx, OpenSslApiWrapper::SSL_CTRL_SET_TLSEXT_TICKET_KEY_CB,
+                                                reinterpret_cast<void (*)(void)>(TicketKeyCallback));
+    SSL_LAYER_CHECK_RET(ret <= 0, "Failed to set ticket key callback");
+    return ACC_OK;
+}
+
+int AccTcpSslHelper::TicketKeyCallback(SSL *ssl, unsigned char *keyName, unsigned char *iv,
+                                       EVP_CIPHER_CTX *cipherCtx, HMAC_CTX *hmacCtx, int enc)
+{
+    auto sslCtx = OpenSslApiWrapper::SslGetSslCtx(ssl);
+    auto helper = sslCtx == nullptr ? nullptr : static_cast<AccTcpSslHelper *>(
+        OpenSslApiWrapper::SslCtxGetExData(sslCtx, TICKET_HELPER_EX_INDEX));
+    if (helper == nullptr) {
+        return -1;
+    }
+
+    auto &ring = helper->mTicketKeys;
+    TicketKey key;
+    int ret = -1;
+    if (enc == 1) {
+        // 签发: 使用当前密钥，IV随机
+        if (ring.Current(key) &&
+            OpenSslApiWrapper::RandBytes(iv, static_cast<int>(TICKET_IV_LENGTH)) > 0 &&
+            OpenSslApiWrapper::EvpEncryptInitEx(cipherCtx, OpenSslApiWrapper::EvpAes256Cbc(), nullptr, key.aesKey,
+                                                iv) > 0 &&
+            OpenSslApiWrapper::HmacInitEx(hmacCtx, key.hmacKey, static_cast<int>(sizeof(key.hmacKey)),
+                                          OpenSslApiWrapper::EvpSha256(), nullptr) > 0) {
+            std::copy(key.name, key.name + sizeof(key.name), keyName);
+            ret = 1;
+        }
+    } else {
+        // 恢复: 密钥已轮换淘汰时返回0走完整握手，使用上一个密钥时返回2，让服务端用当前密钥重新签发
+        bool isCurrent = false;
+        if (!ring.Find(keyName, key, isCurrent)) {
+            ret = 0;
+        } else if (OpenSslApiWrapper::EvpDecryptInitEx(cipherCtx, OpenSslApiWrapper::EvpAes256Cbc(), nullptr,
+                                                       key.aesKey, iv) > 0 &&
+                   OpenSslApiWrapper::HmacInitEx(hmacCtx, key.hmacKey, static_cast<int>(sizeof(key.hmacKey)),
+                                                 OpenSslApiWrapper::EvpSha256(), nullptr) > 0) {
+            ret = isCurrent ? 1 : 2;
+        }
+    }
+    key.Erase();
+    return ret;
+}
+
+void AccTcpSslHelper::TicketKey::Erase()
+{
+    std::fill(name, name + sizeof(name), 0);
+    std::fill(aesKey, aesKey + sizeof(aesKey), 0);
+    std::fill(hmacKey, hmacKey + sizeof(hmacKey), 0);
+    valid = false;
+}
+
+AccTcpSslHelper::TicketKeyRing::~TicketKeyRing()
+{
+    EraseSecret();
+    current_.Erase();
+    previous_.Erase();
+}
+
+bool AccTcpSslHelper::TicketKeyRing::Init(const std::string &secretFile)
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    EraseSecret();
+    current_.Erase();
+    previous_.Erase();
+    secretFile_ = secretFile;
+    if (!secretFile_.empty() && !LoadSecret()) {
+        return false;
+    }
+    return RotateIfDue();
+}
+
+bool AccTcpSslHelper::TicketKeyRing::Current(TicketKey &key)
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    if (!RotateIfDue()) {
+        return false;
+    }
+    key = current_;
+    return true;
+}
+
+bool AccTcpSslHelper::TicketKeyRing::Find(const unsigned char *name, TicketKey &key, bool &isCurrent)
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    RotateIfDue();
+    for (auto item : {&current_, &previous_}) {
+        if (item->valid && std::equal(item->name, item->name + sizeof(item->name), name)) {
+            key = *item;
+            isCurrent = (item == &current_);
+            return true;
+        }
+    }
+    return false;
+}
+
+bool AccTcpSslHelper::TicketKeyRing::RotateIfDue()
+{
+    return secretFile_.empty() ? RotateRandom() : RotateDerived();
+}
+
+bool AccTcpSslHelper::TicketKeyRing::RotateRandom()
+{
+    // 使用时按时间轮换，空闲的进程不需要定时线程；淘汰的密钥再保留一个周期，ticket最长可用两个周期
+    auto now = std::chrono::steady_clock::now();
+    if (current_.valid && now - current_.created < TICKET_KEY_ROTATE_PERIOD) {
+        return true;
+    }
+    previous_.Erase();
+    if (current_.valid && now - current_.created < TICKET_KEY_ROTATE_PERIOD * 2) {
+        previous_ = current_;
+    }
+    current_.Erase();
+
+    if (OpenSslApiWrapper::RandBytes(current_.name, static_cast<int>(sizeof(current_.name))) <= 0 ||
+        OpenSslApiWrapper::RandPrivBytes(current_.aesKey, static_cast<int>(sizeof(current_.aesKey))) <= 0 ||
+        OpenSslApiWrapper::RandPrivBytes(current_.hmacKey, static_cast<int>(sizeof(current_.hmacKey))) <= 0) {
+        LOG_ERROR("Failed to generate random ticket key");
+        current_.Erase();
+        return false;
+    }
+    current_.created = now;
+    current_.valid = true;
+    return true;
+}
+
+bool AccTcpSslHelper::TicketKeyRing::RotateDerived()
+{
+    // 按墙上时间划分周期，共享密钥文件的服务端在同一周期派生出相同的密钥，重启或切换后仍可解密上一周期签发的ticket
+    auto seconds = std::chrono::duration_cast<std::chrono::seconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+    auto period = static_cast<uint64_t>(seconds) / static_cast<uint64_t>(TICKET_KEY_ROTATE_PERIOD.count());
+    if (current_.valid && period == period_) {
+        return true;
+    }
+
+    // 每个周期重新读取密钥文件，替换文件即轮换密钥；读取失败时沿用已加载的密钥
+    if (!LoadSecret() && secret_.empty()) {
+        return false;
+    }
+    current_.Erase();
+    previous_.Erase();
+    if (!DeriveKey(period, current_) || !DeriveKey(period - 1U, previous_)) {
+        LOG_ERROR("Failed to derive ticket key");
+        current_.Erase();
+        previous_.Erase();
+        return false;
+    }
+    period_ = period;
+    return true;
+}
+
+bool AccTcpSslHelper::TicketKeyRing::LoadSecret()
+{
+    struct stat fileStat {};
+    if (stat(secretFile_.c_str(), &fileStat) != 0 || !S_ISREG(fileStat.st_mode)) {
+        LOG_ERROR("Ticket key file is not a regular file");
+        return false;
+    }
+    if ((fileStat.st_mode & ~TICKET_SECRET_MAX_MODE & 0777U) != 0) {
+        LOG_ERROR("Permission of ticket key file exceeds " << std::oct << TICKET_SECRET_MAX_MODE);
+        return false;
+    }
+    if (fileStat.st_size < TICKET_SECRET_MIN_LENGTH || fileStat.st_size > TICKET_SECRET_MAX_LENGTH) {
+        LOG_ERROR("Size of ticket key file should be in [" << TICKET_SECRET_MIN_LENGTH << ", "
+                                                           << TICKET_SECRET_MAX_LENGTH << "]");
+        return false;
+    }
+
+    std::ifstream in(secretFile_, std::ios::binary);
+    std::vector<unsigned char> secret(static_cast<size_t>(fileStat.st_size));
+    in.read(reinterpret_cast<char *>(secret.data()), static_cast<std::streamsize>(secret.size()));
+    if (!in || in.gcount() != static_cast<std::streamsize>(secret.size())) {
+        LOG_ERROR("Failed to read ticket key file");
+        std::fill(secret.begin(), secret.end(), 0);
+        return false;
+    }
+    EraseSecret();
+    secret_ = std::move(secret);
+    return true;
+}
+
+bool AccTcpSslHelper::TicketKeyRing::DeriveKey(uint64_t period, TicketKey &key) const
+{
+    // HMAC-SHA256(secret, label || period)，名称、加密密钥与完整性密钥使用不同的label
+    auto derive = [this, period](const std::string &label, unsigned char *out, size_t outLen) {
+        std::vector<unsigned char> data(label.begin(), label.end());
+        for (int shift = 56; shift >= 0; shift -= 8) {
+            data.push_back(static_cast<unsigned char>(period >> static_cast<uint32_t>(shift)));
+        }
+        unsigned char digest[TICKET_KEY_SECRET_LENGTH] = {};
+        unsigned int digestLen = 0;
+        auto ok = OpenSslApiWrapper::Hmac(OpenSslApiWrapper::EvpSha256(), secret_.data(),
+                                          static_cast<int>(secret_.size()), data.data(), data.size(), digest,
+                                          &digestLen) != nullptr &&
+                  digestLen == sizeof(digest);
+        if (ok) {
+            std::copy_n(digest, std::min(outLen, sizeof(digest)), out);
+        }
+        std::fill(digest, digest + sizeof(digest), 0);
+        return ok;
+    };
+
+    if (!derive("acc_links ticket name", key.name, sizeof(key.name)) ||
+        !derive("acc_links ticket aes", key.aesKey, sizeof(key.aesKey)) ||
+        !derive("acc_links ticket hmac", key.hmacKey, sizeof(key.hmacKey))) {
+        key.Erase();
+        return false;
+    }
+    key.valid = true;
+    return true;
+}
+
+void AccTcpSslHelper::TicketKeyRing::EraseSecret()
+{
+    std::fill(secret_.begin(), secret_.end(), 0);
+    secret_.clear();
+}
+
+SSL_SESSION *AccTcpSslHelper::GetSession(const std::string &peer)
+{
+    std::lock_guard<std::mutex> guard(mSessionMutex);
+    auto it = mSessions.find(peer);
+    if (it == mSessions.end() || OpenSslApiWrapper::SslSessionUpRef(it->second) <= 0) {
+        return nullptr;
+    }
+    return it->second;
+}
+
+void AccTcpSslHelper::SaveSession(SSL *ssl, const std::string &peer)
+{
+    // TLS1.3的会话ticket在握手完成后由服务端单独发送，需在读到服务端响应后再获取
+    auto session = OpenSslApiWrapper::SslGet1Session(ssl);
+    if (session == nullptr) {
+        return;
+    }
+    if (OpenSslApiWrapper::SslSessionIsResumable(session) != 1) {
+        OpenSslApiWrapper::SslSessionFree(session);
+        return;
+    }
+
+    std::lock_guard<std::mutex> guard(mSessionMutex);
+    auto &cached = mSessions[peer];
+    if (cached != nullptr) {
+        OpenSslApiWrapper::SslSessionFree(cached);
+    }
+    cached = session;
+}
+
+void AccTcpSslHelper::ClearSessions()
+{
+    std::lock_guard<std::mutex> guard(mSessionMutex);
+    for (auto &item : mSessions) {
+        OpenSslApiWrapper::SslSessionFree(item.second);
+    }
+    mSessions.clear();
+}
+
+void AccTcpSslHelper::CountHandshake(SSL *ssl)
+{
+    if (OpenSslApiWrapper::SslSessionReused(ssl) == 1) {
+        mResumedHandshakes.fetch_add(1U, std::memory_order_relaxed);
+    } else {
+        mFullHandshakes.fetch_add(1U, std::memory_order_relaxed);
+    }
+}
+
+AccTlsHandshakeStat AccTcpSslHelper::HandshakeStat() const
+{
+    AccTlsHandshakeStat stat;
+    stat.fullHandshakes = mFullHandshakes.load(std::memory_order_relaxed);
+    stat.resumedHandshakes = mResumedHandshakes.load(std::memory_order_relaxed);
+    return stat;
+}
+
 AccResult AccTcpSslHelper::LoadCaCert(SSL_CTX *sslCtx)
 {
     // 设置校验函数
@@ -267,7 +582,7 @@ void AccTcpSslHelper::EraseDecryptData()
     mKeyPass.second = 0;
 }
 
-AccResult AccTcpSslHelper::NewSslLink(bool isServer, int fd, SSL_CTX *ctx, SSL *&ssl)
+AccResult AccTcpSslHelper::NewSslLink(bool isServer, int fd, SSL_CTX *ctx, SSL *&ssl, SSL_SESSION *session)
 {
     auto tmpSsl = OpenSslApiWrapper::SslNew(ctx);
     if (tmpSsl == nullptr) {
@@ -275,6 +590,11 @@ AccResult AccTcpSslHelper::NewSslLink(bool isServer, int fd, SSL_CTX *ctx, SSL *
         return ACC_MALLOC_FAIL;
     }
 
+    // 会话无法恢复时服务端回退为完整握手，设置失败不影响建链
+    if (!isServer && session != nullptr && OpenSslApiWrapper::SslSetSession(tmpSsl, session) != 1) {
+        LOG_WARN("Failed to set session to resume, do full handshake");
+    }
+
     auto ret = OpenSslApiWrapper::SslSetFd(tmpSsl, fd);
     if (ret <= 0) {
         LOG_ERROR("Failed to set fd to TLS, result " << ret);
@@ -13,6 +13,8 @@
 #ifndef ACC_LINKS_ACC_TCP_SSL_HELPER_H
 #define ACC_LINKS_ACC_TCP_SSL_HELPER_H
 
+#include <algorithm>
+#include <chrono>
 #include <condition_variable>
 #include <mutex>
 #include <thread>
@@ -21,6 +23,7 @@
 #include <cstdint>
 #include <fstream>
 #include <climits>
+#include <unordered_map>
 
 #include "acc_includes.h"
 #include "openssl_api_dl.h"
@@ -30,6 +33,8 @@ namespace acc {
 
 constexpr int MIN_PRIVATE_KEY_CONTENT_BIT_LEN = 3072; // RSA密钥长度要求大于3072
 constexpr int MIN_PRIVATE_KEY_CONTENT_BYTE_LEN = MIN_PRIVATE_KEY_CONTENT_BIT_LEN / 8;
+constexpr uint32_t TICKET_KEY_NAME_LENGTH = 16;   // 与TLSEXT_KEYNAME_LENGTH一致
+constexpr uint32_t TICKET_KEY_SECRET_LENGTH = 32; // AES-256及HMAC-SHA256密钥长度
 
 class AccTcpSslHelper : public AccReferable {
 public:
@@ -43,12 +48,24 @@ public:
 
     void EraseDecryptData();
 
-    static AccResult NewSslLink(bool isServer, int fd, SSL_CTX *ctx, SSL *&ssl);
+    static AccResult NewSslLink(bool isServer, int fd, SSL_CTX *ctx, SSL *&ssl, SSL_SESSION *session = nullptr);
     void RegisterDecryptHandler(const AccDecryptHandler &h);
 
+    /* client side resumption, the last resumable session of each peer is kept, returned session must be freed */
+    SSL_SESSION *GetSession(const std::string &peer);
+    void SaveSession(SSL *ssl, const std::string &peer);
+
+    void CountHandshake(SSL *ssl);
+    AccTlsHandshakeStat HandshakeStat() const;
+
 private:
     AccResult InitTlsPath(AccTlsOption &param);
     AccResult InitSSL(SSL_CTX *sslCtx);
+    AccResult InitSessionResumption(SSL_CTX *sslCtx);
+    AccResult SetTicketKeys(SSL_CTX *sslCtx);
+    static int TicketKeyCallback(SSL *ssl, unsigned char *keyName, unsigned char *iv, EVP_CIPHER_CTX *cipherCtx,
+                                 HMAC_CTX *hmacCtx, int enc);
+    void ClearSessions();
 
     static int CaVerifyCallback(X509_STORE_CTX *x509ctx, void *arg);
     static int ProcessCrlAndVerifyCert(std::vector<std::string> paths, X509_STORE_CTX *x509ctx);
@@ -65,6 +82,44 @@ private:
     void ReadCheckCertParams();
     AccResult GetPkPass();
 
+private:
+    struct TicketKey {
+        unsigned char name[TICKET_KEY_NAME_LENGTH] = {};
+        unsigned char aesKey[TICKET_KEY_SECRET_LENGTH] = {};
+        unsigned char hmacKey[TICKET_KEY_SECRET_LENGTH] = {};
+        std::chrono::steady_clock::time_point created;
+        bool valid = false;
+
+        void Erase();
+    };
+
+    /*
+     * session ticket keys rotated periodically, random keys of this server by default; with a secret file, keys of
+     * each period are derived from the secret, so servers sharing the file decrypt tickets issued by each other
+     */
+    class TicketKeyRing {
+    public:
+        ~TicketKeyRing();
+        bool Init(const std::string &secretFile);
+        bool Current(TicketKey &key);
+        bool Find(const unsigned char *name, TicketKey &key, bool &isCurrent);
+
+    private:
+        bool RotateIfDue();
+        bool RotateRandom();
+        bool RotateDerived();
+        bool LoadSecret();
+        bool DeriveKey(uint64_t period, TicketKey &key) const;
+        void EraseSecret();
+
+        std::mutex mutex_;
+        std::string secretFile_;
+        std::vector<unsigned char> secret_;
+        uint64_t period_ = 0;
+        TicketKey current_;
+        TicketKey previous_;
+    };
+
 private:
     AccDecryptHandler mDecryptHandler_ = nullptr; // 解密回调
     std::pair<char *, int> mKeyPass = {nullptr, 0};
@@ -75,12 +130,19 @@ private:
     int32_t certCheckAheadDays = 0;
     int32_t checkPeriodHours = 0;
 
+    std::mutex mSessionMutex;
+    std::unordered_map<std::string, SSL_SESSION *> mSessions; // 每个对端最近一次可恢复的会话
+    std::atomic<uint64_t> mFullHandshakes{0};
+    std::atomic<uint64_t> mResumedHandshakes{0};
+    TicketKeyRing mTicketKeys;
+
     std::string crlFullPath;
     // 证书相关路径
     std::string tlsTopPath;
     std::string tlsCert;
     std::string tlsPk;
     std::string tlsPkPwd;
+    std::string tlsTicketKeyFile;
     std::vector<std::string> tlsCaPaths;
     std::vector<std::string> tlsCrlPaths;
 };
@@ -50,6 +50,17 @@ FuncSslCtxCtrl OPENSSLAPIDL::sslCtxCtrl = nullptr;
 FuncSslGetCurrentCipher OPENSSLAPIDL::sslGetCurrentCipher = nullptr;
 FuncSslGetVersion OPENSSLAPIDL::sslGetVersion = nullptr;
 FuncSslIsServer OPENSSLAPIDL::sslIsServer = nullptr;
+FuncSslGet1Session OPENSSLAPIDL::sslGet1Session = nullptr;
+FuncSslSetSession OPENSSLAPIDL::sslSetSession = nullptr;
+FuncSslSessionReused OPENSSLAPIDL::sslSessionReused = nullptr;
+FuncSslSessionOperation OPENSSLAPIDL::sslSessionUpRef = nullptr;
+FuncSslSessionIsResumable OPENSSLAPIDL::sslSessionIsResumable = nullptr;
+FuncSslSessionFree OPENSSLAPIDL::sslSessionFree = nullptr;
+FuncSslCtxSetSessionIdContext OPENSSLAPIDL::sslCtxSetSessionIdContext = nullptr;
+FuncSslCtxCallbackCtrl OPENSSLAPIDL::sslCtxCallbackCtrl = nullptr;
+FuncSslGetSslCtx OPENSSLAPIDL::sslGetSslCtx = nullptr;
+FuncSslCtxSetExData OPENSSLAPIDL::sslCtxSetExData = nullptr;
+FuncSslCtxGetExData OPENSSLAPIDL::sslCtxGetExData = nullptr;
 FuncSetCipherSuites OPENSSLAPIDL::setCipherSuites = nullptr;
 FuncUsePrivKey OPENSSLAPIDL::usePrivKey = nullptr;
 FuncUsePrivKeyFile OPENSSLAPIDL::usePrivKeyFile = nullptr;
@@ -65,6 +76,7 @@ FuncSsLCtxGet0Certificate OPENSSLAPIDL::ssLCtxGet0Certificate = nullptr;
 
 FuncEvpAesCipher OPENSSLAPIDL::evpAes128Gcm = nullptr;
 FuncEvpAesCipher OPENSSLAPIDL::evpAes256Gcm = nullptr;
+FuncEvpAesCipher OPENSSLAPIDL::evpAes256Cbc = nullptr;
 
 FuncEvpCipherCtxNew OPENSSLAPIDL::evpCipherCtxNew = nullptr;
 FuncEvpCipherCtxFree OPENSSLAPIDL::evpCipherCtxFree = nullptr;
@@ -106,6 +118,9 @@ FuncX509GetNotBefore OPENSSLAPIDL::x509GetNotBefore = nullptr;
 FuncX509GetPubkey OPENSSLAPIDL::x509GetPubkey = nullptr;
 FuncEvpPkeyBits OPENSSLAPIDL::evpPkeyBits = nullptr;
 FuncEvpPkeyFree OPENSSLAPIDL::evpPkeyFree = nullptr;
+FuncEvpSha256 OPENSSLAPIDL::evpSha256 = nullptr;
+FuncHmacInitEx OPENSSLAPIDL::hmacInitEx = nullptr;
+FuncHmac OPENSSLAPIDL::hmac = nullptr;
 FuncPemReadX509 OPENSSLAPIDL::pemReadX509 = nullptr;
 FuncX509Free OPENSSLAPIDL::x509Free = nullptr;
 FuncAsn1Time2Tm OPENSSLAPIDL::asn1Time2Tm = nullptr;
@@ -192,6 +207,17 @@ int OPENSSLAPIDL::LoadSSLSymbols(void *sslHandle)
     DLSYM(sslHandle, FuncSslWriteEx, sslWriteEx, "SSL_write_ex");
     DLSYM(sslHandle, FuncSslReadEx, sslReadEx, "SSL_read_ex");
     DLSYM(sslHandle, FuncSslIsServer, sslIsServer, "SSL_is_server");
+    DLSYM(sslHandle, FuncSslGet1Session, sslGet1Session, "SSL_get1_session");
+    DLSYM(sslHandle, FuncSslSetSession, sslSetSession, "SSL_set_session");
+    DLSYM(sslHandle, FuncSslSessionReused, sslSessionReused, "SSL_session_reused");
+    DLSYM(sslHandle, FuncSslSessionOperation, sslSessionUpRef, "SSL_SESSION_up_ref");
+    DLSYM(sslHandle, FuncSslSessionIsResumable, sslSessionIsResumable, "SSL_SESSION_is_resumable");
+    DLSYM(sslHandle, FuncSslSessionFree, sslSessionFree, "SSL_SESSION_free");
+    DLSYM(sslHandle, FuncSslCtxSetSessionIdContext, sslCtxSetSessionIdContext, "SSL_CTX_set_session_id_context");
+    DLSYM(sslHandle, FuncSslCtxCallbackCtrl, sslCtxCallbackCtrl, "SSL_CTX_callback_ctrl");
+    DLSYM(sslHandle, FuncSslGetSslCtx, sslGetSslCtx, "SSL_get_SSL_CTX");
+    DLSYM(sslHandle, FuncSslCtxSetExData, sslCtxSetExData, "SSL_CTX_set_ex_data");
+    DLSYM(sslHandle, FuncSslCtxGetExData, sslCtxGetExData, "SSL_CTX_get_ex_data");
     return 0;
 }
 
@@ -208,6 +234,7 @@ int OPENSSLAPIDL::LoadCryptoSymbols(void *cryptoHandle)
     DLSYM(cryptoHandle, FuncEvpDecryptFinalEx, evpDecryptFinalEx, "EVP_DecryptFinal_ex");
     DLSYM(cryptoHandle, FuncEvpAesCipher, evpAes128Gcm, "EVP_aes_128_gcm");
     DLSYM(cryptoHandle, FuncEvpAesCipher, evpAes256Gcm, "EVP_aes_256_gcm");
+    DLSYM(cryptoHandle, FuncEvpAesCipher, evpAes256Cbc, "EVP_aes_256_cbc");
 
     DLSYM(cryptoHandle, FuncRandPoll, randPoll, "RAND_poll");
     DLSYM(cryptoHandle, FuncRandStatus, randStatus, "RAND_status");
@@ -241,6 +268,9 @@ int OPENSSLAPIDL::LoadCryptoSymbols(void *cryptoHandle)
     DLSYM(cryptoHandle, FuncPemReadX509, pemReadX509, "PEM_read_X509");
     DLSYM(cryptoHandle, FuncX509Free, x509Free, "X509_free");
     DLSYM(cryptoHandle, FuncAsn1Time2Tm, asn1Time2Tm, "ASN1_TIME_to_tm");
+    DLSYM(cryptoHandle, FuncEvpSha256, evpSha256, "EVP_sha256");
+    DLSYM(cryptoHandle, FuncHmacInitEx, hmacInitEx, "HMAC_Init_ex");
+    DLSYM(cryptoHandle, FuncHmac, hmac, "HMAC");
     return 0;
 }
 
@@ -26,6 +26,9 @@ using BIO_METHOD = struct bio_method;
 using X509_STORE = struct x509_store;
 using ASN1_TIME = struct asn1_string_st;
 using EVP_PKEY = struct evp_pkey_st;
+using SSL_SESSION = struct ssl_session_st;
+using EVP_MD = struct evp_md_st;
+using HMAC_CTX = struct hmac_ctx_st;
 
 using FuncInit = int (*)(uint64_t, const OPENSSL_INIT_SETTINGS *);
 using FuncOpensslCleanup = void (*)();
@@ -48,6 +51,17 @@ using FuncSslCtxCtrl = long (*)(SSL_CTX *, int, long, void *);
 using FuncSslGetCurrentCipher = const SSL_CIPHER *(*)(const SSL *);
 using FuncSslGetVersion = const char *(*)(const SSL *);
 using FuncSslIsServer = int (*)(SSL *);
+using FuncSslGet1Session = SSL_SESSION *(*)(SSL *);
+using FuncSslSetSession = int (*)(SSL *, SSL_SESSION *);
+using FuncSslSessionReused = int (*)(const SSL *);
+using FuncSslSessionOperation = int (*)(SSL_SESSION *);
+using FuncSslSessionIsResumable = int (*)(const SSL_SESSION *);
+using FuncSslSessionFree = void (*)(SSL_SESSION *);
+using FuncSslCtxSetSessionIdContext = int (*)(SSL_CTX *, const unsigned char *, unsigned int);
+using FuncSslCtxCallbackCtrl = long (*)(SSL_CTX *, int, void (*)(void));
+using FuncSslGetSslCtx = SSL_CTX *(*)(const SSL *);
+using FuncSslCtxSetExData = int (*)(SSL_CTX *, int, void *);
+using FuncSslCtxGetExData = void *(*)(const SSL_CTX *, int);
 
 using FuncUsePrivKey = int (*)(SSL_CTX *ctx, EVP_PKEY *pkey);
 using FuncUsePrivKeyFile = int (*)(SSL_CTX *ctx, const char *, int);
@@ -104,6 +118,10 @@ using FuncX509GetNotBefore = ASN1_TIME *(*)(const X509 *x);
 using FuncX509GetPubkey = EVP_PKEY *(*)(X509 * x);
 using FuncEvpPkeyBits = int (*)(const EVP_PKEY *pkey);
 using FuncEvpPkeyFree = void (*)(EVP_PKEY *pkey);
+using FuncEvpSha256 = const EVP_MD *(*)(void);
+using FuncHmacInitEx = int (*)(HMAC_CTX *ctx, const void *key, int len, const EVP_MD *md, ENGINE *impl);
+using FuncHmac = unsigned char *(*)(const EVP_MD *md, const void *key, int keyLen, const unsigned char *data,
+                                    size_t dataLen, unsigned char *out, unsigned int *outLen);
 
 class OPENSSLAPIDL {
 public:
@@ -134,6 +152,17 @@ public:
     static FuncSslGetCurrentCipher sslGetCurrentCipher;
     static FuncSslGetVersion sslGetVersion;
     static FuncSslIsServer sslIsServer;
+    static FuncSslGet1Session sslGet1Session;
+    static FuncSslSetSession sslSetSession;
+    static FuncSslSessionReused sslSessionReused;
+    static FuncSslSessionOperation sslSessionUpRef;
+    static FuncSslSessionIsResumable sslSessionIsResumable;
+    static FuncSslSessionFree sslSessionFree;
+    static FuncSslCtxSetSessionIdContext sslCtxSetSessionIdContext;
+    static FuncSslCtxCallbackCtrl sslCtxCallbackCtrl;
+    static FuncSslGetSslCtx sslGetSslCtx;
+    static FuncSslCtxSetExData sslCtxSetExData;
+    static FuncSslCtxGetExData sslCtxGetExData;
     static FuncSetCipherSuites setCipherSuites;
     static FuncUsePrivKey usePrivKey;
     static FuncUsePrivKeyFile usePrivKeyFile;
@@ -152,6 +181,7 @@ public:
 
     static FuncEvpAesCipher evpAes128Gcm;
     static FuncEvpAesCipher evpAes256Gcm;
+    static FuncEvpAesCipher evpAes256Cbc;
 
     static FuncEvpCipherCtxNew evpCipherCtxNew;
     static FuncEvpCipherCtxFree evpCipherCtxFree;
@@ -193,6 +223,9 @@ public:
     static FuncX509GetPubkey x509GetPubkey;
     static FuncEvpPkeyBits evpPkeyBits;
     static FuncEvpPkeyFree evpPkeyFree;
+    static FuncEvpSha256 evpSha256;
+    static FuncHmacInitEx hmacInitEx;
+    static FuncHmac hmac;
 
     static int LoadOpensslAPI(const std::string &libPath);
 
@@ -20,6 +20,7 @@ public:
     static const uint32_t OPENSSL_INIT_LOAD_SSL_STRINGS = 2097152U;
     static const uint32_t OPENSSL_INIT_LOAD_CRYPTO_STRINGS = 2U;
     static const uint32_t SSL_CTRL_SET_MIN_PROTO_VERSION = 123U;
+    static const uint32_t SSL_CTRL_SET_TLSEXT_TICKET_KEY_CB = 72U;
     static const uint32_t TLS1_3_VERSION = 772U;
     static const uint32_t SSL_ERROR_WANT_READ = 2U;
     static const uint32_t SSL_ERROR_WANT_WRITE = 3U;
@@ -184,6 +185,72 @@ public:
         return OPENSSLAPIDL::sslIsServer(ssl);
     }
 
+    static inline SSL_SESSION *SslGet1Session(SSL *ssl)
+    {
+        VALIDATE_RETURN(OPENSSLAPIDL::sslGet1Session != nullptr, "openssl handler not loaded", nullptr);
+        return OPENSSLAPIDL::sslGet1Session(ssl);
+    }
+
+    static inline int SslSetSession(SSL *ssl, SSL_SESSION *session)
+    {
+        VALIDATE_RETURN(OPENSSLAPIDL::sslSetSession != nullptr, "openssl handler not loaded", -1);
+        return OPENSSLAPIDL::sslSetSession(ssl, session);
+    }
+
+    static inline int SslSessionReused(const SSL *ssl)
+    {
+        VALIDATE_RETURN(OPENSSLAPIDL::sslSessionReused != nullptr, "openssl handler not loaded", -1);
+        return OPENSSLAPIDL::sslSessionReused(ssl);
+    }
+
+    static inline int SslSessionUpRef(SSL_SESSION *session)
+    {
+        VALIDATE_RETURN(OPENSSLAPIDL::sslSessionUpRef != nullptr, "openssl handler not loaded", -1);
+        return OPENSSLAPIDL::sslSessionUpRef(session);
+    }
+
+    static inline int SslSessionIsResumable(const SSL_SESSION *session)
+    {
+        VALIDATE_RETURN(OPENSSLAPIDL::sslSessionIsResumable != nullptr, "openssl handler not loaded", -1);
+        return OPENSSLAPIDL::sslSessionIsResumable(session);
+    }
+
+    static inline void SslSessionFree(SSL_SESSION *session)
+    {
+        VALIDATE_RETURN_VOID(OPENSSLAPIDL::sslSessionFree != nullptr, "openssl handler not loaded");
+        OPENSSLAPIDL::sslSessionFree(session);
+    }
+
+    static inline int SslCtxSetSessionIdContext(SSL_CTX *ctx, const unsigned char *sidCtx, unsigned int sidCtxLen)
+    {
+        VALIDATE_RETURN(OPENSSLAPIDL::sslCtxSetSessionIdContext != nullptr, "openssl handler not loaded", -1);
+        return OPENSSLAPIDL::sslCtxSetSessionIdContext(ctx, sidCtx, sidCtxLen);
+    }
+
+    static inline long SslCtxCallbackCtrl(SSL_CTX *ctx, int cmd, void (*fp)(void))
+    {
+        VALIDATE_RETURN(OPENSSLAPIDL::sslCtxCallbackCtrl != nullptr, "openssl handler not loaded", -1);
+        return OPENSSLAPIDL::sslCtxCallbackCtrl(ctx, cmd, fp);
+    }
+
+    static inline SSL_CTX *SslGetSslCtx(const SSL *ssl)
+    {
+        VALIDATE_RETURN(OPENSSLAPIDL::sslGetSslCtx != nullptr, "openssl handler not loaded", nullptr);
+        return OPENSSLAPIDL::sslGetSslCtx(ssl);
+    }
+
+    static inline int SslCtxSetExData(SSL_CTX *ctx, int idx, void *data)
+    {
+        VALIDATE_RETURN(OPENSSLAPIDL::sslCtxSetExData != nullptr, "openssl handler not loaded", -1);
+        return OPENSSLAPIDL::sslCtxSetExData(ctx, idx, data);
+    }
+
+    static inline void *SslCtxGetExData(const SSL_CTX *ctx, int idx)
+    {
+        VALIDATE_RETURN(OPENSSLAPIDL::sslCtxGetExData != nullptr, "openssl handler not loaded", nullptr);
+        return OPENSSLAPIDL::sslCtxGetExData(ctx, idx);
+    }
+
     static inline void SslCtxSetVerify(SSL_CTX *ctx, int mode, int (*cb)(int, X509_STORE_CTX *))
     {
         VALIDATE_RETURN_VOID(OPENSSLAPIDL::sslCtxSetVerify != nullptr, "openssl handler not loaded");
@@ -280,6 +347,12 @@ public:
         return OPENSSLAPIDL::evpAes256Gcm();
     }
 
+    static inline const EVP_CIPHER *EvpAes256Cbc()
+    {
+        VALIDATE_RETURN(OPENSSLAPIDL::evpAes256Cbc != nullptr, "openssl handler not loaded", nullptr);
+        return OPENSSLAPIDL::evpAes256Cbc();
+    }
+
     static inline EVP_CIPHER_CTX *EvpCipherCtxNew()
     {
         VALIDATE_RETURN(OPENSSLAPIDL::evpCipherCtxNew != nullptr, "openssl handler not loaded", nullptr);
@@ -350,6 +423,12 @@ public:
         return OPENSSLAPIDL::randStatus();
     }
 
+    static inline int RandBytes(unsigned char *buf, int num)
+    {
+        VALIDATE_RETURN(OPENSSLAPIDL::randBytes != nullptr, "openssl handler not loaded", -1);
+        return OPENSSLAPIDL::randBytes(buf, num);
+    }
+
     static inline int RandPrivBytes(unsigned char *buf, int num)
     {
         VALIDATE_RETURN(OPENSSLAPIDL::randPrivBytes != nullptr, "openssl handler not loaded", -1);
@@ -488,6 +567,25 @@ public:
         return OPENSSLAPIDL::evpPkeyFree(pkey);
     }
 
+    static inline const EVP_MD *EvpSha256()
+    {
+        VALIDATE_RETURN(OPENSSLAPIDL::evpSha256 != nullptr, "openssl handler not loaded", nullptr);
+        return OPENSSLAPIDL::evpSha256();
+    }
+
+    static inline int HmacInitEx(HMAC_CTX *ctx, const void *key, int len, const EVP_MD *md, ENGINE *impl)
+    {
+        VALIDATE_RETURN(OPENSSLAPIDL::hmacInitEx != nullptr, "openssl handler not loaded", -1);
+        return OPENSSLAPIDL::hmacInitEx(ctx, key, len, md, impl);
+    }
+
+    static inline unsigned char *Hmac(const EVP_MD *md, const void *key, int keyLen, const unsigned char *data,
+                                      size_t dataLen, unsigned char *out, unsigned int *outLen)
+    {
+        VALIDATE_RETURN(OPENSSLAPIDL::hmac != nullptr, "openssl handler not loaded", nullptr);
+        return OPENSSLAPIDL::hmac(md, key, keyLen, data, dataLen, out, outLen);
+    }
+
     static inline int Load(const std::string &libPsth)
     {
         return OPENSSLAPIDL::LoadOpensslAPI(libPsth);
@@ -19,6 +19,7 @@
 #include <string>
 #include <sstream>
 #include <thread>
+#include <vector>
 
 #include "acc_ref.h"
 #include "acc_log.h"
@@ -36,6 +37,7 @@ constexpr uint32_t UNO_48 = 48;
 constexpr uint32_t UNO_32 = 32;
 constexpr uint32_t UNO_16 = 16;
 constexpr uint32_t UNO_7 = 7;
+constexpr uint32_t UNO_4 = 4;
 constexpr uint32_t UNO_2 = 2;
 constexpr uint32_t UNO_1 = 1;
 
@@ -106,12 +108,22 @@ struct AccTcpServerOptions {
     uint16_t keepaliveProbeTimes = UNO_7;    /* tcp keepalive probe times */
     uint16_t keepaliveProbeInterval = UNO_2; /* tcp keepalive probe interval */
     bool reusePort = true;                   /* reuse listen port */
+    uint16_t listenerCount = UNO_1;          /* accept threads, more than 1 share the port by SO_REUSEPORT */
+    uint16_t handshakeThreadCount = UNO_4;   /* handshake threads per listener, 0 for handshake in accept thread */
     bool enableListener = false;             /* start listener or not */
     int16_t magic = 0;                       /* magic number of  */
     int16_t version = 0;                     /* version */
     uint32_t maxWorldSize = UNO_1024;        /* max client number */
 };
 
+/**
+ * @brief Count of tls handshakes, resumed ones reuse the session of an earlier link
+ */
+struct AccTlsHandshakeStat {
+    uint64_t fullHandshakes = 0;
+    uint64_t resumedHandshakes = 0;
+};
+
 /**
  * @brief Callback function of private key password decryptor, see @RegisterDecryptHandler
  *
@@ -136,6 +148,7 @@ struct AccTlsOption {
     std::set<std::string> tlsCrlFile; /* path of crl file */
     std::string tlsPk;                /* private key */
     std::string tlsPkPwd;             /* private key password, required, encrypt or plain both allowed */
+    std::string tlsTicketKeyFile;     /* optional, secret of session ticket keys shared by servers, absolute path */
 
     AccTlsOption() : enableTls(false) {}
 };
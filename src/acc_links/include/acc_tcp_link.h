@@ -218,6 +218,18 @@ public:
     virtual int32_t EnqueueAndModifyEpoll(const AccMsgHeader &h, const AccDataBufferPtr &d,
                                           const AccDataBufferPtr &cbCtx) = 0;
 
+    /**
+     * @brief Put the data segments to be sent into queue and return, segments are sent in order
+     * as one message body without being merged into one buffer
+     *
+     * @param h            [in] message header, bodyLen should be total length of all segments
+     * @param segments     [in] data segments to be sent
+     * @param cbCtx        [in] context data for sent callback function, it passed back by sent handle callback function
+     * @return 0 if successfully
+     */
+    virtual int32_t EnqueueAndModifyEpoll(const AccMsgHeader &h, const std::vector<AccDataBufferPtr> &segments,
+                                          const AccDataBufferPtr &cbCtx) = 0;
+
 protected:
     AccTcpLinkComplex(int fd, const std::string &ipPort, uint32_t id) : AccTcpLink(fd, ipPort, id) {}
 };
@@ -47,6 +47,15 @@ public:
      */
     virtual int32_t Reply(int16_t result, const AccDataBufferPtr &d) const;
 
+    /**
+     * @brief Reply a message to peer with result, body is composed of data segments
+     *
+     * @param result       [in] response result
+     * @param segments     [in] data segments to be response, sent in order without merging
+     * @return 0 if successful
+     */
+    virtual int32_t Reply(int16_t result, const std::vector<AccDataBufferPtr> &segments) const;
+
     /**
      * @brief Get message type
      *
@@ -101,7 +101,7 @@ public:
      * @param peerIp        [in] ip of peer tcp server
      * @param port          [in] port of peer tcp server listened at
      * @param req           [in] connection info
-     * @param maxRetryTimes [in] max retry times
+     * @param maxRetryTimes [in] max retry times, retries back off with jitter within maxRetryTimes seconds
      * @param newLink       [out] connected link
      * @return 0 if successfully
      */
@@ -143,7 +143,15 @@ public:
     virtual void RegisterLinkBrokenHandler(const AccLinkBrokenHandler &h) = 0;
 
     /**
-     * @brief Register the handler for new link connected
+     * @brief Get the count of tls handshakes done by listener and by connecting to peers
+     *
+     * @return handshake counters, all zero if tls disabled
+     */
+    virtual AccTlsHandshakeStat GetTlsHandshakeStat() const = 0;
+
+    /**
+     * @brief Register the handler for new link connected, it may be called by several handshake threads
+     * concurrently, see AccTcpServerOptions::handshakeThreadCount
      *
      * @param h            [in] handler
      */
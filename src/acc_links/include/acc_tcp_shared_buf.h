@@ -12,6 +12,8 @@
 #ifndef ACC_LINKS_ACC_TCP_SHARED_BUF_H
 #define ACC_LINKS_ACC_TCP_SHARED_BUF_H
 
+#include <memory>
+
 #include "acc_def.h"
 
 namespace ock {
@@ -28,6 +30,12 @@ public:
      */
     static AccDataBufferPtr Create(uint32_t memSize);
 
+    /**
+     * @brief Create a data buffer object referencing external memory without copy,
+     * the memory is kept alive by holder until the buffer is released
+     */
+    static AccDataBufferPtr Create(const void *data, uint32_t size, std::shared_ptr<const void> holder);
+
 public:
     /**
      * @brief Allocate memory if current allocated memory is not enough
@@ -85,10 +93,13 @@ public:
 
     explicit AccDataBuffer(uint32_t memSize);
 
+    AccDataBuffer(const void *data, uint32_t size, std::shared_ptr<const void> holder);
+
 private:
     uint32_t dataSize_ = 0;
     uint32_t memSize_;
     uint8_t *data_;
+    std::shared_ptr<const void> holder_{nullptr}; /* owner of external memory, data_ is not freed if set */
 };
 
 inline uint8_t *AccDataBuffer::DataPtr() const
@@ -122,6 +122,13 @@ enum MF_HYBM_MOD {
 
     TP_HYBM_ACL_BATCH_LD_TO_LH,
     TP_HYBM_ACL_BATCH_LH_TO_LD,
+
+    TP_HYBM_SEGMENT_IMPORT_RANK,
+    TP_HYBM_SEGMENT_MMAP_RANK,
+    TP_HYBM_SEGMENT_PREFAULT,
+
+    TP_HYBM_COMPOSE_COPY,
+    TP_HYBM_COMPOSE_SPLIT_COPY,
 };
 
 #endif // MF_HYBRID_HYBM_PTRACER_H
\ No newline at end of file
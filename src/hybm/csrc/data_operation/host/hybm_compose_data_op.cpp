@@ -9,12 +9,38 @@
  * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
  * See the Mulan PSL v2 for more details.
  */
+#include <algorithm>
+#include <chrono>
+#include <thread>
 #include "hybm_logger.h"
+#include "hybm_ptracer.h"
+#include "hybm_data_op.h"
 #include "hybm_data_op_factory.h"
+#include "hybm_data_op_shm.h"
 #include "hybm_compose_data_op.h"
 
 namespace ock {
 namespace mf {
+namespace {
+/* data op types given by the reach function, the others are kept without checking */
+constexpr uint32_t REACH_CHECKED_OP_TYPES = HYBM_DOP_TYPE_SDMA | HYBM_DOP_TYPE_DEVICE_RDMA | HYBM_DOP_TYPE_HOST_RDMA |
+                                            HYBM_DOP_TYPE_HOST_URMA | HYBM_DOP_TYPE_HOST_SIM;
+constexpr uint32_t HOST_PATH_OP_TYPES = HYBM_DOP_TYPE_HOST_RDMA | HYBM_DOP_TYPE_HOST_TCP | HYBM_DOP_TYPE_HOST_URMA |
+                                        HYBM_DOP_TYPE_HOST_SHM | HYBM_DOP_TYPE_HOST_SIM;
+constexpr uint64_t SPLIT_COPY_MIN = 64UL * 1024UL * 1024UL;
+
+bool IsHostPath(hybm_data_op_type type)
+{
+    return (static_cast<uint32_t>(type) & HOST_PATH_OP_TYPES) != 0U;
+}
+
+bool IsHostMemoryDirection(hybm_data_copy_direction direction)
+{
+    return direction == HYBM_LOCAL_HOST_TO_GLOBAL_HOST || direction == HYBM_GLOBAL_HOST_TO_GLOBAL_HOST ||
+           direction == HYBM_GLOBAL_HOST_TO_LOCAL_HOST;
+}
+}
+
 HostComposeDataOp::HostComposeDataOp(hybm_options options, transport::TransManagerPtr tm,
                                      HybmEntityTagInfoPtr tag) noexcept
     : options_{std::move(options)}, transport_{std::move(tm)}, entityTagInfo_{std::move(tag)}
@@ -60,6 +86,27 @@ Result HostComposeDataOp::Initialize() noexcept
             hostRdmaDataOperator_ = nullptr;
             return ret;
         }
+
+        // co-located ranks copy by share memory, other ranks and failures still go to host rdma
+        shmDataOperator_ = DataOperatorFactory::CreateShmDataOperator(options_.rankId, transport_);
+        if (shmDataOperator_ != nullptr && shmDataOperator_->Initialize() != BM_OK) {
+            BM_LOG_WARN("Shm data operator init failed, co-located ranks use host rdma.");
+            shmDataOperator_ = nullptr;
+        }
+    }
+
+    if (options_.bmDataOpType & HYBM_DOP_TYPE_HOST_SIM) {
+        simDataOperator_ = DataOperatorFactory::CreateSimDataOperator(options_.rankId, transport_);
+        auto ret = simDataOperator_->Initialize();
+        if (ret != BM_OK) {
+            BM_LOG_ERROR("Sim data operator init failed, ret:" << ret);
+            sdmaDataOperator_ = nullptr;
+            devRdmaDataOperator_ = nullptr;
+            hostRdmaDataOperator_ = nullptr;
+            shmDataOperator_ = nullptr;
+            simDataOperator_ = nullptr;
+            return ret;
+        }
     }
 
     return BM_OK;
@@ -67,6 +114,14 @@ Result HostComposeDataOp::Initialize() noexcept
 
 void HostComposeDataOp::UnInitialize() noexcept
 {
+    if (simDataOperator_ != nullptr) {
+        simDataOperator_->UnInitialize();
+        simDataOperator_ = nullptr;
+    }
+    if (shmDataOperator_ != nullptr) {
+        shmDataOperator_->UnInitialize();
+        shmDataOperator_ = nullptr;
+    }
     if (hostRdmaDataOperator_ != nullptr) {
         hostRdmaDataOperator_->UnInitialize();
         hostRdmaDataOperator_ = nullptr;
@@ -84,24 +139,40 @@ void HostComposeDataOp::UnInitialize() noexcept
 Result HostComposeDataOp::DataCopy(hybm_copy_params &params, hybm_data_copy_direction direction,
                                    const ExtOptions &options) noexcept
 {
-    auto availableOps = GetPrioritedDataOperators(options);
+    auto autoRoute = (options.flags & COPY_AUTO_ROUTE_FLAG) != 0U;
+    ExtOptions opOptions = options;
+    opOptions.flags &= ~COPY_AUTO_ROUTE_FLAG;
+    auto availableOps = autoRoute ? GetRoutedDataOperators(opOptions, direction, params.dataSize)
+                                  : GetPrioritedDataOperators(opOptions, direction);
     if (availableOps.empty()) {
         BM_LOG_ERROR("data copy from rank " << options.srcRankId << " to rank " << options.destRankId
                                             << " no data operator available");
         return BM_INVALID_PARAM;
     }
 
+    if (autoRoute) {
+        auto ret = SplitDataCopy(availableOps, params, direction, opOptions);
+        if (ret != BM_NOT_SUPPORTED) {
+            return ret;
+        }
+    }
+    return SequentialDataCopy(availableOps, params, direction, opOptions);
+}
+
+Result HostComposeDataOp::SequentialDataCopy(const DataOperators &ops, hybm_copy_params &params,
+                                             hybm_data_copy_direction direction, const ExtOptions &options) noexcept
+{
     Result result = BM_ERROR;
-    for (auto &ops : availableOps) {
+    for (auto &op : ops) {
         BM_LOG_DEBUG("try data copy from rank " << options.srcRankId << " to rank " << options.destRankId
-                                                << " with data op " << ops.first);
-        result = ops.second->DataCopy(params, direction, options);
+                                                << " with data op " << op.first);
+        result = TimedDataCopy(op, params, direction, options);
         if (result == BM_OK) {
             break;
         }
 
         BM_LOG_WARN("data copy from rank " << options.srcRankId << " to rank " << options.destRankId << " with data op "
-                                           << ops.first << " failed " << result);
+                                           << op.first << " failed " << result);
     }
 
     if (result != BM_OK) {
@@ -111,54 +182,137 @@ Result HostComposeDataOp::DataCopy(hybm_copy_params &params, hybm_data_copy_dire
     return result;
 }
 
+Result HostComposeDataOp::SplitDataCopy(const DataOperators &ops, hybm_copy_params &params,
+                                        hybm_data_copy_direction direction, const ExtOptions &options) noexcept
+{
+    // host paths run in a helper thread, device paths stay in caller thread which has the acl device set
+    if ((options.flags & ASYNC_COPY_FLAG) != 0U || params.dataSize < SPLIT_COPY_MIN ||
+        !IsHostMemoryDirection(direction) || ops.size() < 2U) {
+        return BM_NOT_SUPPORTED;
+    }
+
+    auto &best = ops.front();
+    auto other = std::find_if(ops.begin() + 1, ops.end(), [&best](const auto &op) {
+        return IsHostPath(op.first) != IsHostPath(best.first) && op.second != best.second;
+    });
+    if (other == ops.end()) {
+        return BM_NOT_SUPPORTED;
+    }
+
+    auto firstSize = costModel_.SplitSize(best.first, other->first, params.dataSize);
+    if (firstSize == 0) {
+        return BM_NOT_SUPPORTED;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    hybm_copy_params firstParams{params.src, params.dest, firstSize};
+    hybm_copy_params secondParams{static_cast<uint8_t *>(params.src) + firstSize,
+                                  static_cast<uint8_t *>(params.dest) + firstSize, params.dataSize - firstSize};
+    auto &hostOp = IsHostPath(best.first) ? best : *other;
+    auto &deviceOp = IsHostPath(best.first) ? *other : best;
+    auto &hostParams = IsHostPath(best.first) ? firstParams : secondParams;
+    auto &deviceParams = IsHostPath(best.first) ? secondParams : firstParams;
+
+    Result hostRet = BM_ERROR;
+    std::thread helper;
+    try {
+        helper = std::thread([&]() { hostRet = TimedDataCopy(hostOp, hostParams, direction, options); });
+    } catch (...) {
+        BM_LOG_WARN("start split copy thread failed, copy without split.");
+        return BM_NOT_SUPPORTED;
+    }
+    auto deviceRet = TimedDataCopy(deviceOp, deviceParams, direction, options);
+    helper.join();
+    BM_LOG_DEBUG("split data copy size " << params.dataSize << " by data op " << hostOp.first << " size "
+                                         << hostParams.dataSize << " ret " << hostRet << " and data op "
+                                         << deviceOp.first << " size " << deviceParams.dataSize << " ret "
+                                         << deviceRet);
+
+    // failed part is copied again by all operators
+    if (hostRet != BM_OK) {
+        hostRet = SequentialDataCopy(ops, hostParams, direction, options);
+    }
+    if (deviceRet != BM_OK) {
+        deviceRet = SequentialDataCopy(ops, deviceParams, direction, options);
+    }
+    auto ret = hostRet != BM_OK ? hostRet : deviceRet;
+    auto costNs = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+    TP_TRACE_RECORD(TP_HYBM_COMPOSE_SPLIT_COPY, static_cast<uint64_t>(costNs.count()), ret);
+    return ret;
+}
+
+Result HostComposeDataOp::TimedDataCopy(const std::pair<hybm_data_op_type, DataOperatorPtr> &op,
+                                        hybm_copy_params &params, hybm_data_copy_direction direction,
+                                        const ExtOptions &options) noexcept
+{
+    // async copy returns before data arrives, only sync copies are measured
+    if ((options.flags & ASYNC_COPY_FLAG) != 0U) {
+        return op.second->DataCopy(params, direction, options);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    auto ret = op.second->DataCopy(params, direction, options);
+    auto costNs = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+    TP_TRACE_RECORD(TP_HYBM_COMPOSE_COPY, static_cast<uint64_t>(costNs.count()), ret);
+    // copies inside local rank are plain memcpy whatever the operator, they tell nothing about the path
+    if (ret == BM_OK && PeerRank(options) != options_.rankId) {
+        costModel_.Record(op.first, params.dataSize, static_cast<uint64_t>(costNs.count()));
+    }
+    return ret;
+}
+
 Result HostComposeDataOp::BatchDataCopy(hybm_batch_copy_params &params, hybm_data_copy_direction direction,
                                         const ExtOptions &options) noexcept
 {
-    auto availableOps = GetPrioritedDataOperators(options);
-    if (availableOps.empty()) {
+    ExtOptions remains = options;
+    remains.flags &= ~COPY_AUTO_ROUTE_FLAG;
+    auto availableOps = GetPrioritedDataOperators(remains, direction);
+    if ((options.flags & COPY_AUTO_ROUTE_FLAG) != 0U) {
+        uint64_t totalSize = 0;
+        for (auto i = 0U; i < params.batchSize; i++) {
+            totalSize += params.dataSizes[i];
+        }
+        std::stable_sort(availableOps.begin(), availableOps.end(), [this, totalSize](const auto &a, const auto &b) {
+            return costModel_.Predict(a.first, totalSize) < costModel_.Predict(b.first, totalSize);
+        });
+    }
+    if (availableOps.empty() && shmDataOperator_ == nullptr) {
         BM_LOG_ERROR("batch data copy from rank " << options.srcRankId << " to rank " << options.destRankId
                                                   << " no data operator available");
         return BM_INVALID_PARAM;
     }
 
+    // sdma无rank概念, 整批先走sdma
     Result result = BM_ERROR;
+    auto sdma = std::find_if(availableOps.begin(), availableOps.end(),
+                             [](const auto &op) { return op.first == HYBM_DOP_TYPE_SDMA; });
+    if (sdma != availableOps.end()) {
+        result = sdma->second->BatchDataCopy(params, direction, remains);
+        if (result == BM_OK) {
+            return result;
+        }
+        BM_LOG_WARN("data batch copy by " << direction << " with sdma failed " << result);
+    }
+
+    // groups with co-located ranks are copied by share memory, the others are left to operators below
+    if (shmDataOperator_ != nullptr) {
+        ShmBatchDataCopy(params, direction, remains);
+        if (remains.groupMap.empty()) {
+            return BM_OK;
+        }
+    }
+
     for (auto &ops : availableOps) {
-        // sdma无rank概念
-        if (ops.first == HYBM_DOP_TYPE_SDMA) {
-            result = ops.second->BatchDataCopy(params, direction, options);
-            if (result == BM_OK) {
-                return result;
-            }
-            BM_LOG_WARN("data batch copy by " << direction << " with sdma failed " << result);
+        if (ops.first == HYBM_DOP_TYPE_SDMA || ops.first == HYBM_DOP_TYPE_HOST_SHM) {
             continue;
         }
 
         // 为每组调用batch_copy
-        for (auto &[p2pInfo, indices] : options.groupMap) {
-            uint32_t groupSize = indices.size();
-            // 为当前组构建临时参数
-            std::vector<void *> sources_group(groupSize);
-            std::vector<void *> destinations_group(groupSize);
-            std::vector<size_t> dataSizes_group(groupSize);
-            // 填充组内参数
-            for (uint32_t j = 0; j < groupSize; ++j) {
-                uint32_t idx = indices[j];
-                sources_group[j] = params.sources[idx];
-                destinations_group[j] = params.destinations[idx];
-                dataSizes_group[j] = params.dataSizes[idx];
-            }
-            hybm_batch_copy_params copyParams = {sources_group.data(), destinations_group.data(),
-                                                 dataSizes_group.data(), groupSize};
-            ExtOptions copyOptions{};
-            copyOptions.srcRankId = p2pInfo.first;
-            copyOptions.destRankId = p2pInfo.second;
-            copyOptions.stream = options.stream;
-            copyOptions.flags = options.flags;
-            result = ops.second->BatchDataCopy(copyParams, direction, copyOptions);
+        for (auto &[p2pInfo, indices] : remains.groupMap) {
+            result = GroupDataCopy(ops.second, params, direction, remains, p2pInfo, indices);
             if (result != BM_OK) {
-                BM_LOG_WARN("data batch copy from rank " << copyOptions.srcRankId << " to rank "
-                                                         << copyOptions.destRankId << " with data op " << ops.first
-                                                         << " failed " << result);
+                BM_LOG_WARN("data batch copy from rank " << p2pInfo.first << " to rank " << p2pInfo.second
+                                                         << " with data op " << ops.first << " failed " << result);
                 break;
             }
         }
@@ -174,10 +328,67 @@ Result HostComposeDataOp::BatchDataCopy(hybm_batch_copy_params &params, hybm_dat
     return result;
 }
 
+void HostComposeDataOp::ShmBatchDataCopy(hybm_batch_copy_params &params, hybm_data_copy_direction direction,
+                                         ExtOptions &remains) noexcept
+{
+    // same gate as the single copy, share memory stands in for host rdma of the rank pair
+    auto shmOpTypes = static_cast<uint32_t>(HYBM_DOP_TYPE_HOST_RDMA) | static_cast<uint32_t>(HYBM_DOP_TYPE_HOST_SHM);
+    for (auto it = remains.groupMap.begin(); it != remains.groupMap.end();) {
+        ExtOptions groupOptions{};
+        groupOptions.srcRankId = it->first.first;
+        groupOptions.destRankId = it->first.second;
+        auto opTypes = entityTagInfo_->GetRank2RankOpType(groupOptions.srcRankId, groupOptions.destRankId);
+        if ((opTypes & shmOpTypes) == 0U || !shmDataOperator_->Reaches(direction, groupOptions)) {
+            ++it;
+            continue;
+        }
+
+        auto ret = GroupDataCopy(shmDataOperator_, params, direction, remains, it->first, it->second);
+        if (ret != BM_OK) {
+            BM_LOG_WARN("data batch copy from rank " << it->first.first << " to rank " << it->first.second
+                                                     << " with shm failed " << ret << ", try other data op.");
+            ++it;
+            continue;
+        }
+        it = remains.groupMap.erase(it);
+    }
+}
+
+Result HostComposeDataOp::GroupDataCopy(const DataOperatorPtr &op, hybm_batch_copy_params &params,
+                                        hybm_data_copy_direction direction, const ExtOptions &options,
+                                        const std::pair<uint32_t, uint32_t> &p2pInfo,
+                                        const std::vector<uint32_t> &indices) noexcept
+{
+    uint32_t groupSize = indices.size();
+    // 为当前组构建临时参数
+    std::vector<void *> sources_group(groupSize);
+    std::vector<void *> destinations_group(groupSize);
+    std::vector<size_t> dataSizes_group(groupSize);
+    // 填充组内参数
+    for (uint32_t j = 0; j < groupSize; ++j) {
+        uint32_t idx = indices[j];
+        sources_group[j] = params.sources[idx];
+        destinations_group[j] = params.destinations[idx];
+        dataSizes_group[j] = params.dataSizes[idx];
+    }
+    hybm_batch_copy_params copyParams = {sources_group.data(), destinations_group.data(), dataSizes_group.data(),
+                                         groupSize};
+    ExtOptions copyOptions{};
+    copyOptions.srcRankId = p2pInfo.first;
+    copyOptions.destRankId = p2pInfo.second;
+    copyOptions.stream = options.stream;
+    copyOptions.flags = options.flags;
+    return op->BatchDataCopy(copyParams, direction, copyOptions);
+}
+
 Result HostComposeDataOp::DataCopyAsync(hybm_copy_params &params, hybm_data_copy_direction direction,
                                         const ExtOptions &options) noexcept
 {
-    auto availableOps = GetPrioritedDataOperators(options);
+    ExtOptions opOptions = options;
+    opOptions.flags &= ~COPY_AUTO_ROUTE_FLAG;
+    auto availableOps = (options.flags & COPY_AUTO_ROUTE_FLAG) != 0U
+                            ? GetRoutedDataOperators(opOptions, direction, params.dataSize)
+                            : GetPrioritedDataOperators(opOptions, direction);
     if (availableOps.empty()) {
         BM_LOG_ERROR("data copy async from rank " << options.srcRankId << " to rank " << options.destRankId
                                                   << " no data operator available");
@@ -188,7 +399,7 @@ Result HostComposeDataOp::DataCopyAsync(hybm_copy_params &params, hybm_data_copy
     for (auto &ops : availableOps) {
         BM_LOG_DEBUG("try data copy async from rank " << options.srcRankId << " to rank " << options.destRankId
                                                       << " with data op " << ops.first);
-        result = ops.second->DataCopyAsync(params, direction, options);
+        result = ops.second->DataCopyAsync(params, direction, opOptions);
         if (result == BM_OK) {
             break;
         }
@@ -202,18 +413,78 @@ Result HostComposeDataOp::DataCopyAsync(hybm_copy_params &params, hybm_data_copy
 Result HostComposeDataOp::Wait(int32_t waitId) noexcept
 {
     /*
-     * Note: Currently, only SDMA supports asynchronous operations; we only perform the wait for the SDMA Data Operator.
+     * Note: Currently, only SDMA and simulation support asynchronous operations; we wait for both of them.
      * Subsequent consideration involves using the 3 bits in the wait ID to indicate which data operator is being used.
      */
-    if (sdmaDataOperator_ == nullptr) {
+    if (sdmaDataOperator_ == nullptr && simDataOperator_ == nullptr) {
         BM_LOG_ERROR("SDMA data operator not exist.");
         return BM_ERROR;
     }
 
-    return sdmaDataOperator_->Wait(waitId);
+    Result result = BM_OK;
+    if (sdmaDataOperator_ != nullptr) {
+        result = sdmaDataOperator_->Wait(waitId);
+    }
+    if (simDataOperator_ != nullptr) {
+        auto ret = simDataOperator_->Wait(waitId);
+        result = (result == BM_OK) ? ret : result;
+    }
+    return result;
+}
+
+void HostComposeDataOp::SetReachFunc(std::function<hybm_data_op_type(uint32_t)> reachFunc) noexcept
+{
+    reachFunc_ = std::move(reachFunc);
 }
 
-HostComposeDataOp::DataOperators HostComposeDataOp::GetPrioritedDataOperators(const ExtOptions &options) noexcept
+HostComposeDataOp::DataOperators HostComposeDataOp::GetRoutedDataOperators(const ExtOptions &options,
+    hybm_data_copy_direction direction, uint64_t size) noexcept
+{
+    auto dataOperators = GetPrioritedDataOperators(options, direction);
+    auto peerRank = PeerRank(options);
+    if (reachFunc_ != nullptr && peerRank != options_.rankId) {
+        auto reachTypes = static_cast<uint32_t>(reachFunc_(peerRank));
+        DataOperators reachable;
+        for (auto &op : dataOperators) {
+            auto type = static_cast<uint32_t>(op.first);
+            if ((type & REACH_CHECKED_OP_TYPES) == 0U || (type & reachTypes) != 0U) {
+                reachable.emplace_back(op);
+            }
+        }
+        // nothing left means the reach info is not ready yet, keep all to let them try
+        if (!reachable.empty()) {
+            dataOperators.swap(reachable);
+        }
+    }
+
+    std::vector<std::pair<double, uint32_t>> costs;
+    for (auto i = 0U; i < dataOperators.size(); i++) {
+        costs.emplace_back(costModel_.Predict(dataOperators[i].first, size), i);
+    }
+    std::stable_sort(costs.begin(), costs.end(),
+                     [](const auto &a, const auto &b) { return a.first < b.first; });
+    DataOperators routed;
+    for (auto &cost : costs) {
+        routed.emplace_back(dataOperators[cost.second]);
+    }
+
+    // only copies measured by TimedDataCopy probe the other paths
+    if ((options.flags & ASYNC_COPY_FLAG) == 0U && peerRank != options_.rankId) {
+        auto probe = costModel_.ProbeIndex(static_cast<uint32_t>(routed.size()), size);
+        if (probe != 0U) {
+            std::rotate(routed.begin(), routed.begin() + probe, routed.begin() + probe + 1);
+        }
+    }
+    return routed;
+}
+
+uint32_t HostComposeDataOp::PeerRank(const ExtOptions &options) const noexcept
+{
+    return options.srcRankId == options_.rankId ? options.destRankId : options.srcRankId;
+}
+
+HostComposeDataOp::DataOperators HostComposeDataOp::GetPrioritedDataOperators(const ExtOptions &options,
+    hybm_data_copy_direction direction) noexcept
 {
     HostComposeDataOp::DataOperators dataOperators;
     auto opTypes = entityTagInfo_->GetRank2RankOpType(options.srcRankId, options.destRankId);
@@ -221,6 +492,12 @@ HostComposeDataOp::DataOperators HostComposeDataOp::GetPrioritedDataOperators(co
         dataOperators.emplace_back(HYBM_DOP_TYPE_SDMA, sdmaDataOperator_);
     }
 
+    // co-located peer is reached by share memory without going through the NIC, it stands in for host rdma
+    auto shmOpTypes = static_cast<uint32_t>(HYBM_DOP_TYPE_HOST_RDMA) | static_cast<uint32_t>(HYBM_DOP_TYPE_HOST_SHM);
+    if (shmDataOperator_ != nullptr && (opTypes & shmOpTypes) != 0U && shmDataOperator_->Reaches(direction, options)) {
+        dataOperators.emplace_back(HYBM_DOP_TYPE_HOST_SHM, shmDataOperator_);
+    }
+
     if (devRdmaDataOperator_ != nullptr && (opTypes & static_cast<uint32_t>(HYBM_DOP_TYPE_DEVICE_RDMA)) != 0U) {
         dataOperators.emplace_back(HYBM_DOP_TYPE_DEVICE_RDMA, devRdmaDataOperator_);
     }
@@ -237,6 +514,10 @@ HostComposeDataOp::DataOperators HostComposeDataOp::GetPrioritedDataOperators(co
         dataOperators.emplace_back(HYBM_DOP_TYPE_HOST_TCP, hostRdmaDataOperator_);
     }
 
+    if (simDataOperator_ != nullptr && (opTypes & static_cast<uint32_t>(HYBM_DOP_TYPE_HOST_SIM)) != 0U) {
+        dataOperators.emplace_back(HYBM_DOP_TYPE_HOST_SIM, simDataOperator_);
+    }
+
     return dataOperators;
 }
 } // namespace mf
@@ -14,16 +14,24 @@
 #define MEMFABRIC_HYBRID_HYBM_COMPOSE_DATA_OP_H
 
 #include <cstdint>
+#include <functional>
 #include <vector>
 #include "hybm_entity_tag_info.h"
 #include "hybm_data_operator.h"
+#include "hybm_data_op_cost_model.h"
 #include "hybm_transport_manager.h"
 
 namespace ock {
 namespace mf {
+class HostDataOpShm;
+
 /**
  * @brief Combine multiple data operators into a single external interface, with the diversity of data operators
  * not exposed to the Entity.
+ *
+ * Copies of explicit direction try the data operators by fixed priority. Copies of auto direction drop the paths
+ * not reaching the peer rank and try the others by predicted cost, a large sync copy between host memory may be
+ * split to a device path and a host path running at the same time.
  */
 class HostComposeDataOp : public DataOperator {
 public:
@@ -40,9 +48,29 @@ public:
                          const ExtOptions &options) noexcept override;
     Result Wait(int32_t waitId) noexcept override;
 
+    /**
+     * @brief Set the function giving data op types which reach a remote rank, used by copies of auto direction
+     */
+    void SetReachFunc(std::function<hybm_data_op_type(uint32_t)> reachFunc) noexcept;
+
 private:
     using DataOperators = std::vector<std::pair<hybm_data_op_type, DataOperatorPtr>>;
-    DataOperators GetPrioritedDataOperators(const ExtOptions &options) noexcept;
+    DataOperators GetPrioritedDataOperators(const ExtOptions &options, hybm_data_copy_direction direction) noexcept;
+    DataOperators GetRoutedDataOperators(const ExtOptions &options, hybm_data_copy_direction direction,
+                                         uint64_t size) noexcept;
+    uint32_t PeerRank(const ExtOptions &options) const noexcept;
+    Result SequentialDataCopy(const DataOperators &ops, hybm_copy_params &params, hybm_data_copy_direction direction,
+                              const ExtOptions &options) noexcept;
+    Result SplitDataCopy(const DataOperators &ops, hybm_copy_params &params, hybm_data_copy_direction direction,
+                         const ExtOptions &options) noexcept;
+    Result TimedDataCopy(const std::pair<hybm_data_op_type, DataOperatorPtr> &op, hybm_copy_params &params,
+                         hybm_data_copy_direction direction, const ExtOptions &options) noexcept;
+    void ShmBatchDataCopy(hybm_batch_copy_params &params, hybm_data_copy_direction direction,
+                          ExtOptions &remains) noexcept;
+    static Result GroupDataCopy(const DataOperatorPtr &op, hybm_batch_copy_params &params,
+                                hybm_data_copy_direction direction, const ExtOptions &options,
+                                const std::pair<uint32_t, uint32_t> &p2pInfo,
+                                const std::vector<uint32_t> &indices) noexcept;
 
 private:
     const hybm_options options_;
@@ -51,6 +79,10 @@ private:
     DataOperatorPtr sdmaDataOperator_;
     DataOperatorPtr devRdmaDataOperator_;
     DataOperatorPtr hostRdmaDataOperator_;
+    DataOperatorPtr simDataOperator_;
+    std::shared_ptr<HostDataOpShm> shmDataOperator_;
+    std::function<hybm_data_op_type(uint32_t)> reachFunc_;
+    DataOpCostModel costModel_;
 };
 } // namespace mf
 } // namespace ock
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025-2025. All rights reserved.
+ * MemFabric_Hybrid is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *          http://license.coscl.org.cn/MulanPSL2
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ */
+#include "hybm_data_op_cost_model.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace ock {
+namespace mf {
+DataOpCostModel::DataOpCostModel() noexcept
+    : paths_{
+          {5000.0, 20.0},   /* MTE */
+          {20000.0, 25.0},  /* SDMA */
+          {30000.0, 20.0},  /* DEVICE_RDMA */
+          {15000.0, 10.0},  /* HOST_RDMA */
+          {100000.0, 1.0},  /* HOST_TCP */
+          {15000.0, 10.0},  /* HOST_URMA */
+          {5000.0, 5.0},    /* HOST_SIM */
+          {2000.0, 20.0},   /* HOST_SHM, memcpy by copy workers, not slower than the NIC loopback */
+      }
+{}
+
+void DataOpCostModel::Record(hybm_data_op_type type, uint64_t size, uint64_t costNs) noexcept
+{
+    auto index = PathIndex(type);
+    if (index >= PATH_COUNT || costNs == 0) {
+        return;
+    }
+
+    std::unique_lock<std::mutex> uniqueLock{mutex_};
+    auto &path = paths_[index];
+    if (size <= LATENCY_SAMPLE_MAX) {
+        path.latencyNs += EWMA_WEIGHT * (static_cast<double>(costNs) - path.latencyNs);
+    } else if (size >= BANDWIDTH_SAMPLE_MIN) {
+        // latency is taken off, but not more than half, a noisy latency should not blow up the bandwidth
+        auto transferNs = std::max(static_cast<double>(costNs) - path.latencyNs, static_cast<double>(costNs) / 2.0);
+        path.bytesPerNs += EWMA_WEIGHT * (static_cast<double>(size) / transferNs - path.bytesPerNs);
+    }
+}
+
+double DataOpCostModel::Predict(hybm_data_op_type type, uint64_t size) const noexcept
+{
+    auto index = PathIndex(type);
+    if (index >= PATH_COUNT) {
+        return std::numeric_limits<double>::max();
+    }
+
+    std::unique_lock<std::mutex> uniqueLock{mutex_};
+    return paths_[index].latencyNs + static_cast<double>(size) / paths_[index].bytesPerNs;
+}
+
+double DataOpCostModel::Bandwidth(hybm_data_op_type type) const noexcept
+{
+    auto index = PathIndex(type);
+    if (index >= PATH_COUNT) {
+        return 0;
+    }
+
+    std::unique_lock<std::mutex> uniqueLock{mutex_};
+    return paths_[index].bytesPerNs;
+}
+
+uint64_t DataOpCostModel::SplitSize(hybm_data_op_type first, hybm_data_op_type second, uint64_t size) const noexcept
+{
+    auto firstIndex = PathIndex(first);
+    auto secondIndex = PathIndex(second);
+    if (firstIndex >= PATH_COUNT || secondIndex >= PATH_COUNT || firstIndex == secondIndex) {
+        return 0;
+    }
+
+    PathCost a;
+    PathCost b;
+    {
+        std::unique_lock<std::mutex> uniqueLock{mutex_};
+        a = paths_[firstIndex];
+        b = paths_[secondIndex];
+    }
+
+    // both parts are predicted to finish at the same time: latA + x / bwA == latB + (size - x) / bwB
+    auto total = static_cast<double>(size);
+    auto x = (b.latencyNs - a.latencyNs + total / b.bytesPerNs) / (1.0 / a.bytesPerNs + 1.0 / b.bytesPerNs);
+    if (x <= 0 || x >= total) {
+        return 0;
+    }
+
+    auto firstSize = static_cast<uint64_t>(x) / SPLIT_ALIGN * SPLIT_ALIGN;
+    if (firstSize == 0 || firstSize >= size) {
+        return 0;
+    }
+
+    auto splitNs = std::max(a.latencyNs + static_cast<double>(firstSize) / a.bytesPerNs,
+                            b.latencyNs + static_cast<double>(size - firstSize) / b.bytesPerNs);
+    auto singleNs = std::min(a.latencyNs + total / a.bytesPerNs, b.latencyNs + total / b.bytesPerNs);
+    return splitNs < singleNs * SPLIT_GAIN_MIN ? firstSize : 0;
+}
+
+uint32_t DataOpCostModel::ProbeIndex(uint32_t pathCount, uint64_t size) noexcept
+{
+    // probes are kept small, a large copy on a slow path costs more than a wrong estimate
+    if (pathCount < 2U || size > PROBE_SIZE_MAX) {
+        return 0;
+    }
+
+    auto count = probeCount_.fetch_add(1UL, std::memory_order_relaxed) + 1UL;
+    if (count % PROBE_INTERVAL != 0) {
+        return 0;
+    }
+    return 1U + static_cast<uint32_t>((count / PROBE_INTERVAL - 1UL) % (pathCount - 1U));
+}
+
+uint32_t DataOpCostModel::PathIndex(hybm_data_op_type type) noexcept
+{
+    auto value = static_cast<uint32_t>(type);
+    // one path per data op type bit
+    if (value == 0 || (value & (value - 1U)) != 0) {
+        return PATH_COUNT;
+    }
+    return static_cast<uint32_t>(__builtin_ctz(value));
+}
+} // namespace mf
+} // namespace ock
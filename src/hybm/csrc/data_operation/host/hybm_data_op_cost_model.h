@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025-2025. All rights reserved.
+ * MemFabric_Hybrid is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *          http://license.coscl.org.cn/MulanPSL2
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ */
+#ifndef MEMFABRIC_HYBRID_HYBM_DATA_OP_COST_MODEL_H
+#define MEMFABRIC_HYBRID_HYBM_DATA_OP_COST_MODEL_H
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include "hybm_def.h"
+
+namespace ock {
+namespace mf {
+/**
+ * @brief Predicted cost of copying by each data operator, used to route copies of auto direction
+ *
+ * Cost of a path is modeled as latency + size / bandwidth. Both start from a prior of the path kind and follow
+ * the measured copy times by EWMA: small copies update the latency, large copies update the bandwidth. Paths not
+ * chosen are probed from time to time, or a pessimistic estimate would never be corrected.
+ */
+class DataOpCostModel {
+public:
+    DataOpCostModel() noexcept;
+
+    /**
+     * @brief Add a measured sync copy of size bytes which took costNs
+     */
+    void Record(hybm_data_op_type type, uint64_t size, uint64_t costNs) noexcept;
+
+    /**
+     * @brief Predicted nanoseconds to copy size bytes by the path
+     */
+    double Predict(hybm_data_op_type type, uint64_t size) const noexcept;
+
+    /**
+     * @brief Predicted bytes per nanosecond (GB/s) of the path
+     */
+    double Bandwidth(hybm_data_op_type type) const noexcept;
+
+    /**
+     * @brief Bytes of size for the first path when copied by two paths at the same time, page aligned
+     *
+     * @return 0 if splitting is not predicted to be faster than the first path alone
+     */
+    uint64_t SplitSize(hybm_data_op_type first, hybm_data_op_type second, uint64_t size) const noexcept;
+
+    /**
+     * @brief Index of the routed path to copy by instead of the predicted best one, called once per measured copy
+     *
+     * @return 0 for the best path; once every PROBE_INTERVAL copies of at most PROBE_SIZE_MAX bytes, one of the
+     *         other paths in turn
+     */
+    uint32_t ProbeIndex(uint32_t pathCount, uint64_t size) noexcept;
+
+private:
+    struct PathCost {
+        double latencyNs;
+        double bytesPerNs;
+    };
+
+    static uint32_t PathIndex(hybm_data_op_type type) noexcept;
+
+private:
+    static constexpr uint32_t PATH_COUNT = 8U;
+    static constexpr uint64_t LATENCY_SAMPLE_MAX = 64UL * 1024UL;
+    static constexpr uint64_t BANDWIDTH_SAMPLE_MIN = 1024UL * 1024UL;
+    static constexpr uint64_t SPLIT_ALIGN = 4096UL;
+    static constexpr double EWMA_WEIGHT = 0.2;
+    static constexpr double SPLIT_GAIN_MIN = 0.9;
+    static constexpr uint64_t PROBE_INTERVAL = 64UL;
+    static constexpr uint64_t PROBE_SIZE_MAX = 4UL * 1024UL * 1024UL;
+
+    mutable std::mutex mutex_;
+    PathCost paths_[PATH_COUNT];
+    std::atomic<uint64_t> probeCount_{0};
+};
+} // namespace mf
+} // namespace ock
+#endif // MEMFABRIC_HYBRID_HYBM_DATA_OP_COST_MODEL_H
@@ -12,6 +12,9 @@
 #include "hybm_data_op_sdma.h"
 #include "hybm_data_op_device_rdma.h"
 #include "hybm_data_op_host_rdma.h"
+#include "hybm_data_op_sim.h"
+#include "hybm_data_op_shm.h"
+#include "compose_transport_manager.h"
 #include "hybm_data_op_factory.h"
 
 namespace ock {
@@ -30,5 +33,20 @@ DataOperatorPtr DataOperatorFactory::CreateHostRdmaDataOperator(uint32_t rankId,
 {
     return std::make_shared<HostDataOpRDMA>(rankId, tm);
 }
+
+DataOperatorPtr DataOperatorFactory::CreateSimDataOperator(uint32_t rankId, const transport::TransManagerPtr &tm)
+{
+    return std::make_shared<HostDataOpSim>(rankId, tm);
+}
+
+std::shared_ptr<HostDataOpShm> DataOperatorFactory::CreateShmDataOperator(uint32_t rankId,
+                                                                          const transport::TransManagerPtr &tm)
+{
+    auto compose = std::dynamic_pointer_cast<transport::ComposeTransportManager>(tm);
+    if (compose == nullptr || compose->GetShmTransport() == nullptr) {
+        return nullptr;
+    }
+    return std::make_shared<HostDataOpShm>(rankId, compose->GetShmTransport());
+}
 } // namespace mf
 } // namespace ock
\ No newline at end of file
@@ -18,11 +18,16 @@
 
 namespace ock {
 namespace mf {
+class HostDataOpShm;
+
 class DataOperatorFactory {
 public:
     static DataOperatorPtr CreateSdmaDataOperator();
     static DataOperatorPtr CreateDevRdmaDataOperator(uint32_t rankId, const transport::TransManagerPtr &tm);
     static DataOperatorPtr CreateHostRdmaDataOperator(uint32_t rankId, const transport::TransManagerPtr &tm);
+    static DataOperatorPtr CreateSimDataOperator(uint32_t rankId, const transport::TransManagerPtr &tm);
+    /* nullptr if the compose transport has no shm transport */
+    static std::shared_ptr<HostDataOpShm> CreateShmDataOperator(uint32_t rankId, const transport::TransManagerPtr &tm);
 };
 } // namespace mf
 } // namespace ock
@@ -18,6 +18,8 @@
 #include "hybm_va_manager.h"
 #include "hcom_service_c_define.h"
 #include "hybm_data_op_host_rdma.h"
+#include "hybm_host_page_mapper.h"
+#include "hybm_host_copy_engine.h"
 
 using namespace ock::mf;
 
@@ -34,14 +36,14 @@ Result HostDataOpRDMA::Initialize() noexcept
     if (inited_) {
         return BM_OK;
     }
-    rdmaSwapBaseAddr_ =
-        mmap(nullptr, RDMA_SWAP_SPACE_SIZE, PROT_READ | PROT_WRITE, MAP_ANONYMOUS | MAP_HUGETLB | MAP_PRIVATE, -1, 0);
-    if (rdmaSwapBaseAddr_ == MAP_FAILED) {
-        BM_LOG_ERROR("Failed to alloc size:" << RDMA_SWAP_SPACE_SIZE << " error:" << errno << ", "
-                                             << SafeStrError(errno));
+    HostPageMapping mapping;
+    if (HostPageMapper::Map(nullptr, RDMA_SWAP_SPACE_SIZE, -1, 0, HOST_PAGE_HUGETLB_1G, mapping) != BM_OK) {
+        BM_LOG_ERROR("Failed to alloc size:" << RDMA_SWAP_SPACE_SIZE);
         return BM_ERROR;
     }
-    BM_LOG_INFO("Allocated memory for swap buffer, buffer size : " << RDMA_SWAP_SPACE_SIZE);
+    rdmaSwapBaseAddr_ = mapping.address;
+    BM_LOG_INFO("Allocated memory for swap buffer, buffer size : " << RDMA_SWAP_SPACE_SIZE << " page: "
+                                                                  << HostPageMapper::KindName(mapping.kind));
     transport::TransportMemoryRegion input;
     input.addr = reinterpret_cast<uint64_t>(rdmaSwapBaseAddr_);
     input.size = RDMA_SWAP_SPACE_SIZE;
@@ -50,7 +52,7 @@ Result HostDataOpRDMA::Initialize() noexcept
         auto ret = transportManager_->RegisterMemoryRegion(input);
         if (ret != BM_OK) {
             BM_LOG_ERROR("Failed to register rdma swap memory, size: " << RDMA_SWAP_SPACE_SIZE);
-            free(rdmaSwapBaseAddr_);
+            munmap(rdmaSwapBaseAddr_, RDMA_SWAP_SPACE_SIZE);
             rdmaSwapBaseAddr_ = nullptr;
             return BM_MALLOC_FAILED;
         }
@@ -165,7 +167,8 @@ Result HostDataOpRDMA::Wait(int32_t waitId) noexcept
 Result HostDataOpRDMA::CopyHost2Gva(const void *srcVA, void *destVA, uint64_t length, const ExtOptions &options)
 {
     if (options.destRankId == rankId_) {
-        return DlHybridApi::Memcpy(destVA, length, srcVA, length, ACL_MEMCPY_HOST_TO_HOST);
+        HostCopyEngine::Instance().Copy(destVA, srcVA, length);
+        return BM_OK;
     }
 
     if (transportManager_ != nullptr) {
@@ -179,7 +182,8 @@ Result HostDataOpRDMA::CopyHost2Gva(const void *srcVA, void *destVA, uint64_t le
 Result HostDataOpRDMA::CopyGva2Host(const void *srcVA, void *destVA, uint64_t length, const ExtOptions &options)
 {
     if (options.srcRankId == rankId_) {
-        return DlHybridApi::Memcpy(destVA, length, srcVA, length, ACL_MEMCPY_HOST_TO_HOST);
+        HostCopyEngine::Instance().Copy(destVA, srcVA, length);
+        return BM_OK;
     }
 
     if (transportManager_ != nullptr) {
@@ -253,7 +257,7 @@ Result ock::mf::HostDataOpRDMA::SafePut(const void *srcVA,
         const void *currentSrc = reinterpret_cast<const void *>(srcBase + offset);
         void *currentDest = reinterpret_cast<void *>(destBase + offset);
         if (isLocalHost) {
-            ret = DlHybridApi::Memcpy(tmpHost, currentChunkSize, currentSrc, currentChunkSize, ACL_MEMCPY_HOST_TO_HOST);
+            HostCopyEngine::Instance().Copy(tmpHost, currentSrc, currentChunkSize);
         } else {
             ret =
                 DlHybridApi::Memcpy(tmpHost, currentChunkSize, currentSrc, currentChunkSize, ACL_MEMCPY_DEVICE_TO_HOST);
@@ -303,8 +307,7 @@ Result ock::mf::HostDataOpRDMA::SafeGet(const void *srcVA, void *destVA, uint64_
             return ret;
         }
         if (isLocalHost) {
-            ret =
-                DlHybridApi::Memcpy(currentDest, currentChunkSize, tmpHost, currentChunkSize, ACL_MEMCPY_HOST_TO_HOST);
+            HostCopyEngine::Instance().Copy(currentDest, tmpHost, currentChunkSize);
         } else {
             ret = DlHybridApi::Memcpy(currentDest, currentChunkSize, tmpHost, currentChunkSize,
                                       ACL_MEMCPY_HOST_TO_DEVICE);
@@ -697,15 +700,8 @@ Result HostDataOpRDMA::BatchCopyGH2LD(void **destinations, void **sources, const
 Result HostDataOpRDMA::BatchCopyLH2LH(void **destAddrs, void **srcAddrs, const uint64_t *counts,
                                       uint32_t batchSize) noexcept
 {
-    Result ret = BM_OK;
-    for (uint32_t i = 0; i < batchSize; ++i) {
-        ret = DlHybridApi::Memcpy(destAddrs[i], counts[i], srcAddrs[i], counts[i], ACL_MEMCPY_HOST_TO_HOST);
-        if (ret != 0) {
-            BM_LOG_ERROR("Failed to copy local host to local host ret: " << ret);
-            return ret;
-        }
-    }
-    return 0;
+    HostCopyEngine::Instance().BatchCopy(destAddrs, srcAddrs, counts, batchSize);
+    return BM_OK;
 }
 
 Result HostDataOpRDMA::InnerBatchReadRH2LH(const CopyDescriptor &rmtCopyDescriptor, const ExtOptions &options,
@@ -881,13 +877,7 @@ Result HostDataOpRDMA::BatchCopyLH2GH(void **gvaAddrs, void **hostAddrs, const u
 {
     Result ret = BM_OK;
     if (options.destRankId == rankId_) {
-        for (auto i = 0U; i < batchSize; i++) {
-            auto ret = DlHybridApi::Memcpy(gvaAddrs[i], counts[i], hostAddrs[i], counts[i], ACL_MEMCPY_HOST_TO_HOST);
-            if (ret != 0) {
-                BM_LOG_ERROR("copy local host to GVA failed: " << ret);
-                return ret;
-            }
-        }
+        ret = BatchCopyLH2LH(gvaAddrs, hostAddrs, counts, batchSize);
     } else {
         bool registered = true;
         for (uint32_t i = 0U; i < batchSize; i++) {
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025-2025. All rights reserved.
+ * MemFabric_Hybrid is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *          http://license.coscl.org.cn/MulanPSL2
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ */
+#include "hybm_logger.h"
+#include "hybm_data_op_shm.h"
+
+using namespace ock::mf;
+
+Result HostDataOpShm::Initialize() noexcept
+{
+    BM_ASSERT_LOG_AND_RETURN(transportManager_ != nullptr, "no shm transport.", BM_INVALID_PARAM);
+    inited_ = true;
+    return BM_OK;
+}
+
+void HostDataOpShm::UnInitialize() noexcept
+{
+    inited_ = false;
+}
+
+Result HostDataOpShm::DataCopy(hybm_copy_params &params, hybm_data_copy_direction direction,
+                               const ExtOptions &options) noexcept
+{
+    BM_ASSERT_RETURN(inited_, BM_NOT_INITIALIZED);
+    return CopyOne(params.src, params.dest, params.dataSize, direction, options);
+}
+
+Result HostDataOpShm::DataCopyAsync(hybm_copy_params &params, hybm_data_copy_direction direction,
+                                    const ExtOptions &options) noexcept
+{
+    BM_ASSERT_RETURN(inited_, BM_NOT_INITIALIZED);
+    return CopyOne(params.src, params.dest, params.dataSize, direction, options);
+}
+
+Result HostDataOpShm::BatchDataCopy(hybm_batch_copy_params &params, hybm_data_copy_direction direction,
+                                    const ExtOptions &options) noexcept
+{
+    BM_ASSERT_RETURN(inited_, BM_NOT_INITIALIZED);
+    auto peer = PeerRank(direction, options);
+    if (peer == UINT32_MAX) {
+        BM_LOG_ERROR("shm data operator not support batch direction: " << direction << " from rank "
+                                                                        << options.srcRankId << " to rank "
+                                                                        << options.destRankId);
+        return BM_NOT_SUPPORTED;
+    }
+
+    // the whole group goes to the transport, its entries are scheduled together by the copy engine
+    auto isWrite = IsWrite(direction, options);
+    CopyDescriptor descriptor;
+    descriptor.localAddrs.reserve(params.batchSize);
+    descriptor.globalAddrs.reserve(params.batchSize);
+    descriptor.counts.reserve(params.batchSize);
+    for (uint32_t i = 0; i < params.batchSize; i++) {
+        descriptor.localAddrs.push_back(isWrite ? params.sources[i] : params.destinations[i]);
+        descriptor.globalAddrs.push_back(isWrite ? params.destinations[i] : params.sources[i]);
+        descriptor.counts.push_back(params.dataSizes[i]);
+    }
+
+    auto ret = isWrite ? transportManager_->WriteRemoteBatchAsync(peer, descriptor)
+                       : transportManager_->ReadRemoteBatchAsync(peer, descriptor);
+    if (ret != BM_OK) {
+        BM_LOG_ERROR("shm batch copy size " << params.batchSize << " with rank " << peer << " failed " << ret);
+    }
+    return ret;
+}
+
+Result HostDataOpShm::Wait(int32_t waitId) noexcept
+{
+    return BM_OK;
+}
+
+bool HostDataOpShm::Reaches(hybm_data_copy_direction direction, const ExtOptions &options) const noexcept
+{
+    auto peer = PeerRank(direction, options);
+    return peer != UINT32_MAX && transportManager_->Reaches(peer);
+}
+
+uint32_t HostDataOpShm::PeerRank(hybm_data_copy_direction direction, const ExtOptions &options) const noexcept
+{
+    switch (direction) {
+        case HYBM_LOCAL_HOST_TO_GLOBAL_HOST:
+            return options.destRankId == rankId_ ? UINT32_MAX : options.destRankId;
+        case HYBM_GLOBAL_HOST_TO_LOCAL_HOST:
+            return options.srcRankId == rankId_ ? UINT32_MAX : options.srcRankId;
+        case HYBM_GLOBAL_HOST_TO_GLOBAL_HOST:
+            if (options.srcRankId == rankId_ && options.destRankId != rankId_) {
+                return options.destRankId;
+            }
+            if (options.destRankId == rankId_ && options.srcRankId != rankId_) {
+                return options.srcRankId;
+            }
+            return UINT32_MAX;
+        default:
+            return UINT32_MAX;
+    }
+}
+
+bool HostDataOpShm::IsWrite(hybm_data_copy_direction direction, const ExtOptions &options) const noexcept
+{
+    return (direction == HYBM_LOCAL_HOST_TO_GLOBAL_HOST) ||
+           (direction == HYBM_GLOBAL_HOST_TO_GLOBAL_HOST && options.srcRankId == rankId_);
+}
+
+Result HostDataOpShm::CopyOne(const void *srcVA, void *destVA, uint64_t length, hybm_data_copy_direction direction,
+                              const ExtOptions &options) noexcept
+{
+    auto peer = PeerRank(direction, options);
+    if (peer == UINT32_MAX) {
+        BM_LOG_ERROR("shm data operator not support direction: " << direction << " from rank " << options.srcRankId
+                                                                  << " to rank " << options.destRankId);
+        return BM_NOT_SUPPORTED;
+    }
+
+    auto src = reinterpret_cast<uint64_t>(srcVA);
+    auto dest = reinterpret_cast<uint64_t>(destVA);
+    if (IsWrite(direction, options)) {
+        return transportManager_->WriteRemote(peer, src, dest, length);
+    }
+    return transportManager_->ReadRemote(peer, dest, src, length);
+}
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025-2025. All rights reserved.
+ * MemFabric_Hybrid is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *          http://license.coscl.org.cn/MulanPSL2
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ */
+#ifndef MF_HYBRID_HYBM_DATA_OP_SHM_H
+#define MF_HYBRID_HYBM_DATA_OP_SHM_H
+
+#include "hybm_data_operator.h"
+#include "shm_transport_manager.h"
+
+namespace ock {
+namespace mf {
+/**
+ * @brief Data operator between host DRAM of co-located ranks, copies by CPU through the share memory transport.
+ *
+ * Only host memory directions with one side on the local rank are handled, other copies are left to the next
+ * data operator. All copies are synchronous, async copies complete before return.
+ */
+class HostDataOpShm : public DataOperator {
+public:
+    HostDataOpShm(uint32_t rankId, std::shared_ptr<transport::shm::ShmTransportManager> transportManager) noexcept
+        : rankId_(rankId), transportManager_{std::move(transportManager)} {};
+
+    ~HostDataOpShm() override = default;
+
+    Result Initialize() noexcept override;
+    void UnInitialize() noexcept override;
+
+    Result DataCopy(hybm_copy_params &params, hybm_data_copy_direction direction,
+                    const ExtOptions &options) noexcept override;
+    Result DataCopyAsync(hybm_copy_params &params, hybm_data_copy_direction direction,
+                         const ExtOptions &options) noexcept override;
+    Result BatchDataCopy(hybm_batch_copy_params &params, hybm_data_copy_direction direction,
+                         const ExtOptions &options) noexcept override;
+    Result Wait(int32_t waitId) noexcept override;
+
+    /**
+     * @brief Whether the copy is between local rank and a co-located rank reachable by share memory
+     */
+    bool Reaches(hybm_data_copy_direction direction, const ExtOptions &options) const noexcept;
+
+private:
+    uint32_t PeerRank(hybm_data_copy_direction direction, const ExtOptions &options) const noexcept;
+    bool IsWrite(hybm_data_copy_direction direction, const ExtOptions &options) const noexcept;
+    Result CopyOne(const void *srcVA, void *destVA, uint64_t length, hybm_data_copy_direction direction,
+                   const ExtOptions &options) noexcept;
+
+    bool inited_{false};
+    const uint32_t rankId_;
+    const std::shared_ptr<transport::shm::ShmTransportManager> transportManager_;
+};
+} // namespace mf
+} // namespace ock
+#endif // MF_HYBRID_HYBM_DATA_OP_SHM_H
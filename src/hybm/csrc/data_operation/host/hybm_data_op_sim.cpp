@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025-2025. All rights reserved.
+ * MemFabric_Hybrid is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *          http://license.coscl.org.cn/MulanPSL2
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ */
+#include <cstring>
+#include <vector>
+#include "hybm_logger.h"
+#include "hybm_data_op.h"
+#include "hybm_data_op_sim.h"
+
+using namespace ock::mf;
+
+Result HostDataOpSim::Initialize() noexcept
+{
+    if (transportManager_ == nullptr) {
+        BM_LOG_INFO("no sim transport, sim data operator only copies within local rank.");
+    }
+    inited_ = true;
+    return BM_OK;
+}
+
+void HostDataOpSim::UnInitialize() noexcept
+{
+    Wait(0);
+    inited_ = false;
+}
+
+Result HostDataOpSim::DataCopy(hybm_copy_params &params, hybm_data_copy_direction direction,
+                               const ExtOptions &options) noexcept
+{
+    BM_ASSERT_RETURN(inited_, BM_NOT_INITIALIZED);
+    if (options.flags & ASYNC_COPY_FLAG) {
+        return DataCopyAsync(params, direction, options);
+    }
+    return CopyOne(params.src, params.dest, params.dataSize, direction, options, nullptr);
+}
+
+Result HostDataOpSim::DataCopyAsync(hybm_copy_params &params, hybm_data_copy_direction direction,
+                                    const ExtOptions &options) noexcept
+{
+    BM_ASSERT_RETURN(inited_, BM_NOT_INITIALIZED);
+    std::set<uint32_t> ranks;
+    auto ret = CopyOne(params.src, params.dest, params.dataSize, direction, options, &ranks);
+    AddPendingRanks(ranks);
+    return ret;
+}
+
+Result HostDataOpSim::BatchDataCopy(hybm_batch_copy_params &params, hybm_data_copy_direction direction,
+                                    const ExtOptions &options) noexcept
+{
+    BM_ASSERT_RETURN(inited_, BM_NOT_INITIALIZED);
+    /* all copies are issued async to pipeline the links, a sync batch waits only for the ranks it touched */
+    std::set<uint32_t> ranks;
+    Result ret = BM_OK;
+    for (uint32_t i = 0; i < params.batchSize && ret == BM_OK; i++) {
+        ret = CopyOne(params.sources[i], params.destinations[i], params.dataSizes[i], direction, options, &ranks);
+        if (ret != BM_OK) {
+            BM_LOG_ERROR("sim batch copy index " << i << " of " << params.batchSize << " failed " << ret);
+        }
+    }
+
+    if (options.flags & ASYNC_COPY_FLAG) {
+        AddPendingRanks(ranks);
+        return ret;
+    }
+
+    auto syncRet = SynchronizeRanks(ranks);
+    return ret != BM_OK ? ret : syncRet;
+}
+
+Result HostDataOpSim::Wait(int32_t waitId) noexcept
+{
+    BM_ASSERT_RETURN(inited_, BM_NOT_INITIALIZED);
+    std::set<uint32_t> ranks;
+    {
+        std::lock_guard<std::mutex> guard(pendingMutex_);
+        ranks.swap(pendingRanks_);
+    }
+    return SynchronizeRanks(ranks);
+}
+
+Result HostDataOpSim::CopyOne(const void *srcVA, void *destVA, uint64_t length, hybm_data_copy_direction direction,
+                              const ExtOptions &options, std::set<uint32_t> *issuedRanks) noexcept
+{
+    switch (direction) {
+        case HYBM_LOCAL_HOST_TO_GLOBAL_HOST:
+            return Put(srcVA, destVA, length, options.destRankId, issuedRanks);
+        case HYBM_GLOBAL_HOST_TO_LOCAL_HOST:
+            return Get(srcVA, destVA, length, options.srcRankId, issuedRanks);
+        case HYBM_GLOBAL_HOST_TO_GLOBAL_HOST:
+            if (options.srcRankId == rankId_) {
+                return Put(srcVA, destVA, length, options.destRankId, issuedRanks);
+            }
+            if (options.destRankId == rankId_) {
+                return Get(srcVA, destVA, length, options.srcRankId, issuedRanks);
+            }
+            BM_LOG_ERROR("Not support remote gva to remote gva");
+            return BM_INVALID_PARAM;
+        default:
+            BM_LOG_ERROR("sim data operator only copies host memory, invalid direction: " << direction);
+            return BM_NOT_SUPPORTED;
+    }
+}
+
+Result HostDataOpSim::Put(const void *srcVA, void *destVA, uint64_t length, uint32_t destRankId,
+                          std::set<uint32_t> *issuedRanks) noexcept
+{
+    if (destRankId == rankId_) {
+        std::memcpy(destVA, srcVA, length);
+        return BM_OK;
+    }
+
+    BM_ASSERT_LOG_AND_RETURN(transportManager_ != nullptr, "no transport to other ranks.", BM_ERROR);
+    auto lAddr = reinterpret_cast<uint64_t>(srcVA);
+    auto rAddr = reinterpret_cast<uint64_t>(destVA);
+    if (issuedRanks == nullptr) {
+        return transportManager_->WriteRemote(destRankId, lAddr, rAddr, length);
+    }
+
+    auto ret = transportManager_->WriteRemoteAsync(destRankId, lAddr, rAddr, length);
+    if (ret == BM_OK) {
+        issuedRanks->emplace(destRankId);
+    }
+    return ret;
+}
+
+Result HostDataOpSim::Get(const void *srcVA, void *destVA, uint64_t length, uint32_t srcRankId,
+                          std::set<uint32_t> *issuedRanks) noexcept
+{
+    if (srcRankId == rankId_) {
+        std::memcpy(destVA, srcVA, length);
+        return BM_OK;
+    }
+
+    BM_ASSERT_LOG_AND_RETURN(transportManager_ != nullptr, "no transport to other ranks.", BM_ERROR);
+    auto lAddr = reinterpret_cast<uint64_t>(destVA);
+    auto rAddr = reinterpret_cast<uint64_t>(srcVA);
+    if (issuedRanks == nullptr) {
+        return transportManager_->ReadRemote(srcRankId, lAddr, rAddr, length);
+    }
+
+    auto ret = transportManager_->ReadRemoteAsync(srcRankId, lAddr, rAddr, length);
+    if (ret == BM_OK) {
+        issuedRanks->emplace(srcRankId);
+    }
+    return ret;
+}
+
+void HostDataOpSim::AddPendingRanks(const std::set<uint32_t> &ranks) noexcept
+{
+    if (ranks.empty()) {
+        return;
+    }
+    std::lock_guard<std::mutex> guard(pendingMutex_);
+    pendingRanks_.insert(ranks.begin(), ranks.end());
+}
+
+Result HostDataOpSim::SynchronizeRanks(const std::set<uint32_t> &ranks) noexcept
+{
+    Result result = BM_OK;
+    for (auto rankId : ranks) {
+        auto ret = transportManager_->Synchronize(rankId);
+        if (ret != BM_OK) {
+            BM_LOG_ERROR("sim synchronize with rank " << rankId << " failed " << ret);
+            result = ret;
+        }
+    }
+    return result;
+}
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025-2025. All rights reserved.
+ * MemFabric_Hybrid is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *          http://license.coscl.org.cn/MulanPSL2
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ */
+#ifndef MF_HYBRID_HYBM_DATA_OP_SIM_H
+#define MF_HYBRID_HYBM_DATA_OP_SIM_H
+
+#include <mutex>
+#include <set>
+#include "hybm_data_operator.h"
+#include "hybm_transport_manager.h"
+
+namespace ock {
+namespace mf {
+/**
+ * @brief Hardware-free data operator over the simulation transport, moves host memory only.
+ *
+ * Copies within the local rank are plain memcpy, copies with other ranks go through the transport which applies
+ * the latency and bandwidth model. Async copies are issued to the transport and waited for all ranks in Wait,
+ * a sync batch waits only for the ranks it copied with.
+ */
+class HostDataOpSim : public DataOperator {
+public:
+    HostDataOpSim(uint32_t rankId, transport::TransManagerPtr transportManager) noexcept
+        : rankId_(rankId), transportManager_{std::move(transportManager)} {};
+
+    ~HostDataOpSim() override = default;
+
+    Result Initialize() noexcept override;
+    void UnInitialize() noexcept override;
+
+    Result DataCopy(hybm_copy_params &params, hybm_data_copy_direction direction,
+                    const ExtOptions &options) noexcept override;
+    Result DataCopyAsync(hybm_copy_params &params, hybm_data_copy_direction direction,
+                         const ExtOptions &options) noexcept override;
+    Result BatchDataCopy(hybm_batch_copy_params &params, hybm_data_copy_direction direction,
+                         const ExtOptions &options) noexcept override;
+    Result Wait(int32_t waitId) noexcept override;
+
+private:
+    /* issuedRanks is null for a sync copy, otherwise the copy is issued async and its remote rank is added */
+    Result CopyOne(const void *srcVA, void *destVA, uint64_t length, hybm_data_copy_direction direction,
+                   const ExtOptions &options, std::set<uint32_t> *issuedRanks) noexcept;
+    Result Put(const void *srcVA, void *destVA, uint64_t length, uint32_t destRankId,
+               std::set<uint32_t> *issuedRanks) noexcept;
+    Result Get(const void *srcVA, void *destVA, uint64_t length, uint32_t srcRankId,
+               std::set<uint32_t> *issuedRanks) noexcept;
+    void AddPendingRanks(const std::set<uint32_t> &ranks) noexcept;
+    Result SynchronizeRanks(const std::set<uint32_t> &ranks) noexcept;
+
+    bool inited_{false};
+    const uint32_t rankId_;
+    const transport::TransManagerPtr transportManager_;
+    std::mutex pendingMutex_;
+    std::set<uint32_t> pendingRanks_;
+};
+} // namespace mf
+} // namespace ock
+#endif // MF_HYBRID_HYBM_DATA_OP_SIM_H
@@ -13,6 +13,8 @@
 #define MEM_FABRIC_HYBRID_HYBM_DATA_ACTION_H
 
 #include <ostream>
+#include <unordered_map>
+#include <vector>
 #include "hybm_common_include.h"
 #include "hybm_big_mem.h"
 
@@ -33,6 +35,9 @@ struct PairEqual {
     }
 };
 
+/* internal flag of copies with auto direction, the data operators are ordered by cost instead of fixed priority */
+constexpr uint32_t COPY_AUTO_ROUTE_FLAG = 1U << 31;
+
 struct ExtOptions {
     uint32_t srcRankId;
     uint32_t destRankId;
@@ -78,6 +78,10 @@ Result MemEntityDefault::InitTagManager()
         compatibleInfo << localTag << ":" << HybmEntityTagInfo::GetOpTypeStr(HYBM_DOP_TYPE_HOST_URMA) << ":" << localTag
                        << ",";
     }
+    if (options_.bmDataOpType & HYBM_DOP_TYPE_HOST_SIM) {
+        compatibleInfo << localTag << ":" << HybmEntityTagInfo::GetOpTypeStr(HYBM_DOP_TYPE_HOST_SIM) << ":" << localTag
+                       << ",";
+    }
     BM_ASSERT_LOG_AND_RETURN(tagManager_->AddTagOpInfo(compatibleInfo.str()) == BM_OK,
                              "Failed to add tagOpInfo:" << compatibleInfo.str(), BM_INVALID_PARAM);
     options_.bmDataOpType = static_cast<hybm_data_op_type>(tagManager_->GetAllOpType());
@@ -201,6 +205,11 @@ int32_t MemEntityDefault::AllocLocalMemory(uint64_t size, hybm_mem_type mType, u
     info.addr = realSlice->vAddress_;
     info.flags =
         segment->GetMemoryType() == HYBM_MEM_TYPE_DEVICE ? transport::REG_MR_FLAG_HBM : transport::REG_MR_FLAG_DRAM;
+    if (segment == dramSegment_ && options_.dramShmFd >= 0) {
+        info.flags |= transport::REG_MR_FLAG_SHM;
+        info.shmOffset = realSlice->vAddress_ - reinterpret_cast<uint64_t>(dramGva_) -
+                         options_.rankId * options_.maxDRAMSize;
+    }
     if (transportManager_ != nullptr && size > 0) {
         info.flags |= transport::REG_MR_FLAG_SELF;
         ret = transportManager_->RegisterMemoryRegion(info);
@@ -334,12 +343,9 @@ int32_t MemEntityDefault::ExportExchangeInfo(ExchangeInfoWriter &desc, uint32_t
         return BM_ERROR;
     }
 
-    if (options_.scene == HYBM_SCENE_TRANS) {
-        // 当前仅有trans的hbm使用的user_dev_legacy segment需要导出、导入hal相关信息才能使能p2p(sdma)相关功能
-        if (hbmSegment_ == nullptr) {
-            BM_LOG_ERROR("hbm segment is null, failed to export segment info in trans scene");
-            return BM_ERROR;
-        }
+    // 当前仅有trans的hbm使用的user_dev_legacy segment需要导出、导入hal相关信息才能使能p2p(sdma)相关功能，
+    // 仅host内存的trans实例没有hbm segment，无需导出
+    if (options_.scene == HYBM_SCENE_TRANS && hbmSegment_ != nullptr) {
         std::string segInfo;
         ret = hbmSegment_->Export(segInfo);
         if (ret != BM_OK) {
@@ -416,6 +422,10 @@ int32_t MemEntityDefault::ExportExchangeInfo(hybm_mem_slice_t slice, ExchangeInf
         BM_LOG_ERROR("export to string failed: " << ret);
         return ret;
     }
+    {
+        std::unique_lock<std::mutex> uniqueLock{importMutex_};
+        exportedSliceInfos_.emplace(info);
+    }
 
     SliceExportTransportKey transportKey{exportMagic, options_.rankId, realSlice->vAddress_};
     if (transportManager_ != nullptr) {
@@ -490,15 +500,43 @@ int32_t MemEntityDefault::ImportExchangeInfo(const ExchangeInfoReader desc[], ui
         infos.emplace_back(desc[i].LeftToString());
     }
 
+    /* without output addresses, slices imported before are skipped, so a joining rank costs O(1) to others */
+    std::vector<std::string> newInfos;
+    if (addresses == nullptr && !FilterImportedSlices(infos, newInfos)) {
+        BM_LOG_INFO("all " << count << " slices imported before, skip it.");
+        return BM_OK;
+    }
+
     ret = currentSegment->Import(infos, addresses);
     if (ret != BM_OK) {
         BM_LOG_ERROR("segment import infos failed: " << ret);
         return ret;
     }
 
+    std::unique_lock<std::mutex> uniqueLock{importMutex_};
+    importedSliceInfos_.insert(newInfos.begin(), newInfos.end());
     return BM_OK;
 }
 
+bool MemEntityDefault::FilterImportedSlices(std::vector<std::string> &infos, std::vector<std::string> &newInfos)
+{
+    std::vector<std::string> remains;
+    std::unique_lock<std::mutex> uniqueLock{importMutex_};
+    for (auto &info : infos) {
+        if (exportedSliceInfos_.find(info) != exportedSliceInfos_.end()) {
+            // local slice is always kept, some segments set access of peers by it
+            remains.emplace_back(std::move(info));
+        } else if (importedSliceInfos_.find(info) == importedSliceInfos_.end()) {
+            newInfos.emplace_back(info);
+            remains.emplace_back(std::move(info));
+        }
+    }
+    uniqueLock.unlock();
+
+    infos = std::move(remains);
+    return !newInfos.empty();
+}
+
 int32_t MemEntityDefault::ImportForTagManager()
 {
     for (const auto &item : importedRanks_) {
@@ -572,11 +610,7 @@ int32_t MemEntityDefault::ImportEntityExchangeInfo(const ExchangeInfoReader desc
     BM_ASSERT_LOG_AND_RETURN(ImportForTagManager() == BM_OK, "Failed import for tag manager", BM_ERROR);
     BM_ASSERT_LOG_AND_RETURN(ImportForTransportManager() == BM_OK, "Failed import for transport manager", BM_ERROR);
 
-    if (options_.scene == HYBM_SCENE_TRANS) {
-        if (hbmSegment_ == nullptr) {
-            BM_LOG_ERROR("hbm segment is null, failed to import segment info in trans scene");
-            return BM_ERROR;
-        }
+    if (options_.scene == HYBM_SCENE_TRANS && hbmSegment_ != nullptr) {
         auto ret = hbmSegment_->Import({desc->LeftToString()}, nullptr);
         if (ret != BM_OK) {
             BM_LOG_ERROR("failed to import segment info in trans scene, ret: " << ret);
@@ -697,6 +731,12 @@ int32_t MemEntityDefault::RemoveImported(const std::vector<uint32_t> &ranks) noe
         dataOperator_->CleanUp();
     }
 
+    {
+        // rank of segment info is unknown here, re-import of the others is reentrant
+        std::unique_lock<std::mutex> uniqueLock{importMutex_};
+        importedSliceInfos_.clear();
+    }
+
     if (transportManager_ != nullptr) {
         std::unique_lock<std::mutex> uniqueLock{importMutex_};
         for (auto rank : ranks) {
@@ -1094,6 +1134,7 @@ Result MemEntityDefault::InitDramSegment()
     segmentOptions.dataOpType = options_.bmDataOpType;
     segmentOptions.flags = options_.flags;
     segmentOptions.shmFd = options_.dramShmFd;
+    segmentOptions.transUrl.assign(options_.transUrl, strnlen(options_.transUrl, sizeof(options_.transUrl)));
     if (options_.bmDataOpType & HYBM_DOP_TYPE_DEVICE_RDMA) {
         segmentOptions.shared = false;
     }
@@ -1112,7 +1153,8 @@ Result MemEntityDefault::InitTransManager()
         return BM_OK;
     }
 
-    auto hostTransFlags = HYBM_DOP_TYPE_HOST_RDMA | HYBM_DOP_TYPE_HOST_URMA | HYBM_DOP_TYPE_HOST_TCP;
+    auto hostTransFlags =
+        HYBM_DOP_TYPE_HOST_RDMA | HYBM_DOP_TYPE_HOST_URMA | HYBM_DOP_TYPE_HOST_TCP | HYBM_DOP_TYPE_HOST_SIM;
     auto composeTransFlags = HYBM_DOP_TYPE_DEVICE_RDMA | hostTransFlags;
     if ((options_.bmDataOpType & composeTransFlags) == 0) {
         BM_LOG_DEBUG("NO RDMA Data Operator transport skip init.");
@@ -1130,6 +1172,8 @@ Result MemEntityDefault::InitTransManager()
     options.initialType = options_.bmType;
     options.nic = options_.transUrl;
     options.tlsOption = options_.tlsOption;
+    options.dramShmFd = options_.dramShmFd;
+    options.dramSpaceSize = options_.maxDRAMSize;
     auto ret = transportManager_->OpenDevice(options);
     if (ret != 0) {
         BM_LOG_ERROR("Failed to open device, ret: " << ret);
@@ -1146,8 +1190,10 @@ Result MemEntityDefault::InitDataOperator()
         return BM_OK;
     }
 
-    // use composeDataOperator
-    dataOperator_ = std::make_shared<HostComposeDataOp>(options_, transportManager_, tagManager_);
+    // use composeDataOperator, copies of auto direction skip the paths not reaching the remote rank
+    auto composeDataOperator = std::make_shared<HostComposeDataOp>(options_, transportManager_, tagManager_);
+    composeDataOperator->SetReachFunc([this](uint32_t rank) { return CanReachDataOperators(rank); });
+    dataOperator_ = composeDataOperator;
     auto ret = dataOperator_->Initialize();
     if (ret != BM_OK) {
         BM_LOG_ERROR("Failed to init data operator ret:" << ret);
@@ -1187,6 +1233,10 @@ hybm_data_op_type MemEntityDefault::CanReachDataOperators(uint32_t remoteRank) c
     if (options_.bmDataOpType & HYBM_DOP_TYPE_HOST_URMA) {
         supportDataOp |= HYBM_DOP_TYPE_HOST_URMA;
     }
+
+    if (options_.bmDataOpType & HYBM_DOP_TYPE_HOST_SIM) {
+        supportDataOp |= HYBM_DOP_TYPE_HOST_SIM;
+    }
     return static_cast<hybm_data_op_type>(supportDataOp);
 }
 
@@ -1229,6 +1279,11 @@ void MemEntityDefault::ReleaseResources()
     hbmSegment_.reset();
     dramSegment_.reset();
     dataOperator_.reset();
+    {
+        std::unique_lock<std::mutex> uniqueLock{importMutex_};
+        exportedSliceInfos_.clear();
+        importedSliceInfos_.clear();
+    }
     if (transportManager_ != nullptr) {
         transportManager_->CloseDevice();
         transportManager_.reset();
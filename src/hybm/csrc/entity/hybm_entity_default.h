@@ -14,6 +14,7 @@
 
 #include <map>
 #include <mutex>
+#include <unordered_set>
 #include "hybm_common_include.h"
 #include "hybm_dev_legacy_segment.h"
 #include "hybm_data_operator.h"
@@ -30,7 +31,7 @@ struct EntityExportInfo {
     uint16_t rankId{0};
     uint16_t role{0};
     uint32_t reserved{0};
-    char nic[64]{};
+    char nic[128]{};
     char tag[32]{};
 };
 struct SliceExportTransportKey {
@@ -109,6 +110,7 @@ private:
     int32_t ImportForTagManager();
     int32_t ImportForTransportManager();
     int32_t ImportForTransportPrecheck(const ExchangeInfoReader *desc, uint32_t &count, bool &importInfoEntity);
+    bool FilterImportedSlices(std::vector<std::string> &infos, std::vector<std::string> &newInfos);
 
 private:
     static thread_local bool isSetDevice_;
@@ -125,6 +127,8 @@ private:
     transport::TransManagerPtr transportManager_;
     std::unordered_map<uint32_t, EntityExportInfo> importedRanks_;
     std::unordered_map<uint32_t, std::vector<transport::TransportMemoryKey>> importedMemories_;
+    std::unordered_set<std::string> exportedSliceInfos_; /* segment info of local slices */
+    std::unordered_set<std::string> importedSliceInfos_; /* segment info of remote slices already imported */
     HybmEntityTagInfoPtr tagManager_;
 };
 using EngineImplPtr = std::shared_ptr<MemEntityDefault>;
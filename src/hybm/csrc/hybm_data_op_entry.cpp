@@ -15,6 +15,7 @@
 #include "mf_num_util.h"
 #include "hybm_entity_factory.h"
 #include "hybm_data_op.h"
+#include "hybm_data_operator.h"
 #include "hybm_va_manager.h"
 
 using namespace ock::mf;
@@ -50,6 +51,7 @@ HYBM_API int32_t hybm_data_copy(hybm_entity_t e, hybm_copy_params *params, hybm_
                          ", dest=0x" << reinterpret_cast<uint64_t>(params->dest));
             return BM_INVALID_PARAM;
         }
+        flags |= COPY_AUTO_ROUTE_FLAG;
     }
 
     auto entity = MemEntityFactory::Instance().FindEngineByPtr(e);
@@ -104,6 +106,7 @@ HYBM_API int32_t hybm_data_batch_copy(hybm_entity_t e, hybm_batch_copy_params *p
                          std::hex << reinterpret_cast<uint64_t>(params->destinations[0]));
             return BM_INVALID_PARAM;
         }
+        flags |= COPY_AUTO_ROUTE_FLAG;
     }
 
     bool addressValid = true;
@@ -18,6 +18,7 @@
 
 #include "hybm_logger.h"
 #include "hybm_ex_info_transfer.h"
+#include "hybm_mem_prefault.h"
 #include "hybm_va_manager.h"
 
 using namespace ock::mf;
@@ -65,6 +66,8 @@ Result HybmConnBasedSegment::ReserveMemorySpace(void **address) noexcept
     localVirtualBase_ = globalVirtualAddress_ + options_.maxSize * options_.rankId;
     allocatedSize_ = 0UL;
     sliceCount_ = 0;
+    numaPolicy_ = HostNumaPolicy::Create(options_.flags, options_.transUrl);
+    BM_LOG_INFO("reserve dram space size:" << totalSize << " numa policy:" << numaPolicy_.ToString());
     *address = globalVirtualAddress_;
     return BM_OK;
 }
@@ -76,21 +79,6 @@ Result HybmConnBasedSegment::UnReserveMemorySpace() noexcept
     return BM_OK;
 }
 
-void HybmConnBasedSegment::LvaShmReservePhysicalMemory(void *mappedAddress, uint64_t size) noexcept
-{
-    BM_ASSERT_RET_VOID(mappedAddress != nullptr);
-    auto *pos = static_cast<uint8_t *>(mappedAddress);
-    uint64_t setLength = 0;
-    while (setLength < size) {
-        *pos = 0;
-        setLength += HYBM_LARGE_PAGE_SIZE;
-        pos += HYBM_LARGE_PAGE_SIZE;
-    }
-
-    pos = static_cast<uint8_t *>(mappedAddress) + (size - 1L);
-    *pos = 0;
-}
-
 Result HybmConnBasedSegment::AllocLocalMemory(uint64_t size, MemSlicePtr &slice) noexcept
 {
     if ((size % HYBM_LARGE_PAGE_SIZE) != 0UL || size + allocatedSize_ > options_.maxSize) {
@@ -100,21 +88,24 @@ Result HybmConnBasedSegment::AllocLocalMemory(uint64_t size, MemSlicePtr &slice)
     }
 
     void *sliceAddr = localVirtualBase_ + allocatedSize_;
-    void *mapped = nullptr;
-    auto ret = MapSlice(allocatedSize_, size);
+    HostPageMapping mapping;
+    auto ret = MapSlice(allocatedSize_, size, mapping);
     if (ret != BM_OK) {
         return ret;
     }
     allocatedSize_ += size;
     slice = std::make_shared<MemSlice>(sliceCount_++, MEM_TYPE_HOST_DRAM, MEM_PT_TYPE_SVM,
                                        reinterpret_cast<uint64_t>(sliceAddr), size);
+    slice->pageSize_ = mapping.pageSize;
     slices_.emplace(slice->index_, slice);
-    BM_LOG_DEBUG("allocate slice(idx:" << slice->index_ << ", size:" << slice->size_ << " va:" << sliceAddr << ").");
+    BM_LOG_DEBUG("allocate slice(idx:" << slice->index_ << ", size:" << slice->size_ << " va:" << sliceAddr
+                                       << " page size:" << slice->pageSize_ << ").");
     ret = HybmVaManager::GetInstance().AddVaInfo({slice->vAddress_, size, HYBM_MEM_TYPE_HOST, slice->vAddress_},
                                                  options_.rankId);
     if (ret != 0) {
         BM_LOG_ERROR("AddVaInfo failed, size: " << size << " ret: " << ret);
-        mmap(mapped, size, PROT_NONE, MAP_FIXED | MAP_ANONYMOUS | MAP_NORESERVE | MAP_PRIVATE, -1, 0);
+        UnmapSlice(sliceAddr, size);
+        allocatedSize_ -= size;
         slices_.erase(slice->index_);
         return ret;
     }
@@ -178,6 +169,9 @@ Result HybmConnBasedSegment::Import(const std::vector<std::string> &allExInfo, v
             BM_LOG_ERROR("deserialize imported info(" << i << ") failed.");
             return BM_INVALID_PARAM;
         }
+        if (addresses != nullptr) {
+            addresses[i] = reinterpret_cast<void *>(deserializedInfos[i].vAddress);
+        }
     }
 
     try {
@@ -308,35 +302,53 @@ Result HybmConnBasedSegment::PrepareShareMemoryFd() const noexcept
     return BM_OK;
 }
 
-Result HybmConnBasedSegment::MapSlice(uint64_t lvOffset, uint64_t size) noexcept
+Result HybmConnBasedSegment::MapSlice(uint64_t lvOffset, uint64_t size, HostPageMapping &mapping) noexcept
 {
     if (size == 0) {
         return BM_OK;
     }
 
-    void *addr = nullptr;
     auto sliceAddr = localVirtualBase_ + allocatedSize_;
-    auto prot = PROT_READ | PROT_WRITE;
-    auto flags = MAP_FIXED;
 #ifndef UT_ENABLED
-    flags |= MAP_HUGETLB;
+    auto firstKind = HOST_PAGE_HUGETLB_1G;
+#else
+    auto firstKind = HOST_PAGE_THP;
 #endif
-    if (options_.shmFd < 0) {
-        addr = mmap(sliceAddr, size, prot, flags | MAP_ANONYMOUS | MAP_PRIVATE, -1, 0);
-    } else {
-        addr = mmap(sliceAddr, size, prot, flags | MAP_SHARED, options_.shmFd, lvOffset);
+    auto ret = HostPageMapper::Map(sliceAddr, size, options_.shmFd, lvOffset, firstKind, mapping);
+    if (ret != BM_OK) {
+        BM_LOG_ERROR("Failed to alloc size:" << size << " addr:" << static_cast<void *>(sliceAddr) << " ret:" << ret);
+        UnmapSlice(sliceAddr, size);
+        return ret;
     }
 
-    if (addr == MAP_FAILED || addr != sliceAddr) {
-        BM_LOG_ERROR("Failed to alloc size:" << size << " addr:" << sliceAddr << " ret:" << addr << " error:" << errno
-                                             << ", " << SafeStrError(errno));
-        return BM_ERROR;
+    // policy must be set before the first touch
+    ret = numaPolicy_.Apply(sliceAddr, size);
+    PrefaultStat stat;
+    if (ret == BM_OK) {
+        // a THP range may still be backed by small pages where kernel has no free hugepage
+        auto touchStride = mapping.kind == HOST_PAGE_THP ? static_cast<uint64_t>(getpagesize()) : mapping.pageSize;
+        ret = MemPrefault::Populate(sliceAddr, size, touchStride, stat);
     }
-
-    LvaShmReservePhysicalMemory(sliceAddr, size);
+    if (ret != BM_OK) {
+        BM_LOG_ERROR("Failed to prefault size:" << size << " addr:" << static_cast<void *>(sliceAddr)
+                                                 << " ret:" << ret);
+        UnmapSlice(sliceAddr, size);
+        return ret;
+    }
+    auto placement = HostNumaPolicy::Placement(sliceAddr, size, mapping.pageSize);
+    BM_LOG_INFO("prefault slice size:" << size << " addr:" << static_cast<void *>(sliceAddr) << " page:"
+                                       << HostPageMapper::KindName(mapping.kind) << " by " << stat.method << " with "
+                                       << stat.workers << " workers cost " << stat.costUs << "us, placement "
+                                       << HostNumaPolicy::PlacementString(placement));
     return BM_OK;
 }
 
+void HybmConnBasedSegment::UnmapSlice(void *sliceAddr, uint64_t size) noexcept
+{
+    // give the range back to the PROT_NONE reservation
+    mmap(sliceAddr, size, PROT_NONE, MAP_FIXED | MAP_ANONYMOUS | MAP_NORESERVE | MAP_PRIVATE, -1, 0);
+}
+
 Result HybmConnBasedSegment::RemoveImported(const std::vector<uint32_t> &ranks) noexcept
 {
     for (auto &rank : ranks) {
@@ -15,6 +15,8 @@
 #include <set>
 #include "hybm_mem_segment.h"
 #include "hybm_mem_common.h"
+#include "hybm_host_page_mapper.h"
+#include "hybm_numa_policy.h"
 
 namespace ock {
 namespace mf {
@@ -62,8 +64,8 @@ public:
 private:
     void FreeMemory() noexcept;
     Result PrepareShareMemoryFd() const noexcept;
-    Result MapSlice(uint64_t lvOffset, uint64_t size) noexcept;
-    static void LvaShmReservePhysicalMemory(void *mappedAddress, uint64_t size) noexcept;
+    Result MapSlice(uint64_t lvOffset, uint64_t size, HostPageMapping &mapping) noexcept;
+    static void UnmapSlice(void *sliceAddr, uint64_t size) noexcept;
 
 private:
     uint8_t *globalVirtualAddress_{nullptr};
@@ -75,6 +77,7 @@ private:
     std::map<uint16_t, std::string> exportMap_;
     std::vector<HostExportInfo> imports_;
     std::set<uint64_t> mappedMem_;
+    HostNumaPolicy numaPolicy_;
 };
 } // namespace mf
 } // namespace ock
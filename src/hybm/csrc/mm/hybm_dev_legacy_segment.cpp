@@ -24,6 +24,8 @@
 #include "hybm_gva.h"
 #include "hybm_logger.h"
 #include "hybm_networks_common.h"
+#include "hybm_ptracer.h"
+#include "hybm_rank_task_pool.h"
 #include "hybm_va_manager.h"
 
 namespace ock {
@@ -285,7 +287,6 @@ Result HybmDevLegacySegment::GetExportSliceSize(size_t &size) noexcept
 // import可重入
 Result HybmDevLegacySegment::Import(const std::vector<std::string> &allExInfo, void *addresses[]) noexcept
 {
-    std::map<uint16_t, HbmExportInfo> importMap;
     LiteralExInfoTranslater<HbmExportInfo> translator;
     std::vector<HbmExportInfo> desInfos{};
     uint32_t localIdx = UINT32_MAX;
@@ -303,60 +304,75 @@ Result HybmDevLegacySegment::Import(const std::vector<std::string> &allExInfo, v
         if (info.rankId == options_.rankId) {
             localIdx = desInfos.size();
         }
-        importMap.emplace(info.rankId, info);
+        // ranks imported before may be absent in incremental import, so merge instead of replacing
+        importMap_[info.rankId] = info;
         desInfos.push_back(std::move(info));
     }
-    importMap_ = std::move(importMap);
     BM_ASSERT_RETURN(localIdx < desInfos.size(), BM_INVALID_PARAM);
 
-    for (auto i = 0U; i < desInfos.size(); i++) {
-        if (desInfos[i].rankId == options_.rankId) {
-            continue;
-        }
-        if (CanLocalHostReaches(desInfos[i].superPodId, desInfos[i].serverId, desInfos[i].logicDeviceId)
-            && deviceId_ != static_cast<int>(desInfos[i].logicDeviceId)) {
-            auto ret = DlAclApi::RtEnableP2P(deviceId_, desInfos[i].logicDeviceId, 0);
-            if (ret != 0) {
-                BM_LOG_ERROR("enable device access failed:" << ret << " local_device:" << deviceId_
-                                                            << " remote_device:" << (int)desInfos[i].deviceId
-                                                            << " logic_device:" << logicDeviceId_
-                                                            << " remote_logic_device:" << desInfos[i].logicDeviceId);
-                return BM_DL_FUNCTION_FAILED;
-            }
-        }
-
-        if (!CanSdmaReaches(desInfos[i].superPodId, desInfos[i].serverId, desInfos[i].logicDeviceId)) {
+    std::vector<RankTask> tasks;
+    for (const auto &info : desInfos) {
+        if (info.rankId == options_.rankId) {
             continue;
         }
-
-        if (options_.size > 0) {
-            auto ret =
-                DlAclApi::RtSetIpcMemorySuperPodPid(desInfos[localIdx].shmName, desInfos[i].sdid, &desInfos[i].pid, 1);
-            if (ret != 0) {
-                BM_LOG_ERROR("enable white list for rank(" << desInfos[i].rankId << ") failed: " << ret
-                                                           << ", local rank = " << options_.rankId
-                                                           << ", shmName=" << desInfos[localIdx].shmName);
-                return BM_DL_FUNCTION_FAILED;
-            }
-        }
+        const auto &local = desInfos[localIdx];
+        tasks.push_back({info.rankId, [this, &local, &info]() { return ImportRank(local, info); }, nullptr});
     }
+    auto ret = RankTaskPool::Run("HbmLegacyImportRank", TP_HYBM_SEGMENT_IMPORT_RANK, tasks, PrepareRankWorker);
+    if (ret != BM_OK) {
+        return ret;
+    }
+
     for (const auto &info : desInfos) {
         if (info.rankId == options_.rankId) {
             continue;
         }
-        auto ret = HybmVaManager::GetInstance().AddVaInfoFromExternal(
+        ret = HybmVaManager::GetInstance().AddVaInfoFromExternal(
             {info.vAddress, info.size, HYBM_MEM_TYPE_DEVICE, 0}, options_.rankId, info.rankId);
         BM_ASSERT_RETURN(ret == BM_OK, ret);
     }
     return SafeCopy(desInfos.begin(), desInfos.end(), std::back_inserter(imports_));
 }
 
+Result HybmDevLegacySegment::ImportRank(const HbmExportInfo &local, const HbmExportInfo &info) noexcept
+{
+    if (CanLocalHostReaches(info.superPodId, info.serverId, info.logicDeviceId)
+        && deviceId_ != static_cast<int>(info.logicDeviceId)) {
+        auto ret = DlAclApi::RtEnableP2P(deviceId_, info.logicDeviceId, 0);
+        if (ret != 0) {
+            BM_LOG_ERROR("enable device access failed:" << ret << " local_device:" << deviceId_
+                                                        << " remote_device:" << (int)info.deviceId
+                                                        << " logic_device:" << logicDeviceId_
+                                                        << " remote_logic_device:" << info.logicDeviceId);
+            return BM_DL_FUNCTION_FAILED;
+        }
+    }
+
+    if (!CanSdmaReaches(info.superPodId, info.serverId, info.logicDeviceId)) {
+        return BM_OK;
+    }
+
+    if (options_.size > 0) {
+        auto pid = info.pid;
+        auto ret = DlAclApi::RtSetIpcMemorySuperPodPid(local.shmName, info.sdid, &pid, 1);
+        if (ret != 0) {
+            BM_LOG_ERROR("enable white list for rank(" << info.rankId << ") failed: " << ret
+                                                       << ", local rank = " << options_.rankId
+                                                       << ", shmName=" << local.shmName);
+            return BM_DL_FUNCTION_FAILED;
+        }
+    }
+    return BM_OK;
+}
+
 Result HybmDevLegacySegment::Mmap() noexcept
 {
     if (imports_.empty()) {
         return BM_OK;
     }
 
+    std::set<uint64_t> addresses;
+    std::vector<RankTask> tasks;
     for (auto &im : imports_) {
         if (im.rankId == options_.rankId) {
             continue;
@@ -367,25 +383,36 @@ Result HybmDevLegacySegment::Mmap() noexcept
             continue;
         }
 
-        auto remoteAddress = im.vAddress;
-        if (mappedMem_.find((uint64_t)remoteAddress) != mappedMem_.end()) {
-            BM_LOG_INFO("remote slice on rank(" << im.rankId << ") has maped");
+        if (!CanSdmaReaches(im.superPodId, im.serverId, im.logicDeviceId)) {
             continue;
         }
 
-        if (!CanSdmaReaches(im.superPodId, im.serverId, im.logicDeviceId)) {
+        auto remoteAddress = im.vAddress;
+        if (mappedMem_.find((uint64_t)remoteAddress) != mappedMem_.end() ||
+            !addresses.emplace((uint64_t)remoteAddress).second) {
+            BM_LOG_INFO("remote slice on rank(" << im.rankId << ") has maped");
             continue;
         }
 
         BM_LOG_INFO("remote slice on rank(" << im.rankId << ") should map addr:" << std::hex << (void *)remoteAddress
                                             << ", size = " << im.size);
-        auto ret = drv::HalGvaOpen((uint64_t)remoteAddress, im.shmName, im.size, 0);
-        if (ret != BM_OK) {
-            BM_LOG_ERROR("HalGvaOpen memory failed:" << ret);
-            return -1;
-        }
-        mappedMem_.insert((uint64_t)remoteAddress);
+        auto open = [&im, remoteAddress]() -> Result {
+            auto ret = drv::HalGvaOpen((uint64_t)remoteAddress, im.shmName, im.size, 0);
+            if (ret != BM_OK) {
+                BM_LOG_ERROR("HalGvaOpen memory failed:" << ret);
+                return -1;
+            }
+            return BM_OK;
+        };
+        tasks.push_back({im.rankId, open, [remoteAddress]() { (void)drv::HalGvaClose((uint64_t)remoteAddress, 0); }});
+    }
+
+    /* nothing of this round is kept mapped if any rank failed */
+    auto ret = RankTaskPool::Run("HbmLegacyMmapRank", TP_HYBM_SEGMENT_MMAP_RANK, tasks, PrepareRankWorker);
+    if (ret != BM_OK) {
+        return -1;
     }
+    mappedMem_.insert(addresses.begin(), addresses.end());
     imports_.clear();
     return BM_OK;
 }
@@ -423,6 +450,7 @@ Result HybmDevLegacySegment::RemoveImported(const std::vector<uint32_t> &ranks)
         if (st != it) {
             mappedMem_.erase(st, it);
         }
+        importMap_.erase(static_cast<uint16_t>(rank));
     }
     return 0;
 }
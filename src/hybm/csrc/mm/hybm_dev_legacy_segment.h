@@ -82,6 +82,7 @@ public:
 
 protected:
     void FreeMemory() noexcept;
+    Result ImportRank(const HbmExportInfo &local, const HbmExportInfo &info) noexcept;
 
 protected:
     uint8_t *globalVirtualAddress_{nullptr};
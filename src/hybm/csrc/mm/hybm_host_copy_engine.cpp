@@ -0,0 +1,260 @@
+/*
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025-2025. All rights reserved.
+ * MemFabric_Hybrid is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *          http://license.coscl.org.cn/MulanPSL2
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+*/
+#include "hybm_host_copy_engine.h"
+
+#include <sched.h>
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+#include "hybm_logger.h"
+#include "mf_str_util.h"
+
+namespace ock {
+namespace mf {
+namespace {
+const char *COPY_THREADS_ENV = "MEMFABRIC_HYBRID_COPY_THREADS";
+
+#if defined(__x86_64__)
+constexpr uintptr_t STREAM_ALIGN = 32U;
+constexpr uint64_t STREAM_BLOCK = 128U;
+
+__attribute__((target("avx"))) void StreamCopyAvx(uint8_t *dest, const uint8_t *src, uint64_t size)
+{
+    // align destination for streaming stores, source is loaded unaligned
+    auto misalign = reinterpret_cast<uintptr_t>(dest) & (STREAM_ALIGN - 1U);
+    auto head = std::min(static_cast<uint64_t>((STREAM_ALIGN - misalign) & (STREAM_ALIGN - 1U)), size);
+    std::memcpy(dest, src, head);
+    dest += head;
+    src += head;
+    size -= head;
+
+    auto blocks = size / STREAM_BLOCK;
+    for (uint64_t i = 0; i < blocks; i++) {
+        auto s = reinterpret_cast<const __m256i *>(src);
+        auto d = reinterpret_cast<__m256i *>(dest);
+        auto v0 = _mm256_loadu_si256(s);
+        auto v1 = _mm256_loadu_si256(s + 1);
+        auto v2 = _mm256_loadu_si256(s + 2);
+        auto v3 = _mm256_loadu_si256(s + 3);
+        _mm256_stream_si256(d, v0);
+        _mm256_stream_si256(d + 1, v1);
+        _mm256_stream_si256(d + 2, v2);
+        _mm256_stream_si256(d + 3, v3);
+        src += STREAM_BLOCK;
+        dest += STREAM_BLOCK;
+    }
+    _mm_sfence();
+    std::memcpy(dest, src, size - blocks * STREAM_BLOCK);
+}
+#endif
+}
+
+HostCopyEngine &HostCopyEngine::Instance() noexcept
+{
+    static HostCopyEngine instance;
+    return instance;
+}
+
+HostCopyEngine::~HostCopyEngine()
+{
+    {
+        std::unique_lock<std::mutex> uniqueLock{mutex_};
+        stop_ = true;
+    }
+    cond_.notify_all();
+    for (auto &t : workers_) {
+        t.join();
+    }
+}
+
+void HostCopyEngine::Copy(void *dest, const void *src, uint64_t size) noexcept
+{
+    auto workerCount = WorkerCount(size);
+    if (workerCount <= 1U) {
+        CopyPart(dest, src, size, size >= COPY_PARALLEL_MIN);
+        return;
+    }
+
+    auto partSize = (size + workerCount - 1U) / workerCount;
+    partSize = (partSize + COPY_PART_ALIGN - 1U) / COPY_PART_ALIGN * COPY_PART_ALIGN;
+    auto partCount = static_cast<uint32_t>((size + partSize - 1U) / partSize);
+    RunParallel(partCount, [dest, src, size, partSize](uint32_t index) {
+        auto offset = partSize * index;
+        CopyPart(static_cast<uint8_t *>(dest) + offset, static_cast<const uint8_t *>(src) + offset,
+                 std::min(partSize, size - offset), true);
+    });
+}
+
+void HostCopyEngine::BatchCopy(void *const dests[], const void *const srcs[], const uint64_t sizes[],
+                               uint32_t count) noexcept
+{
+    // large entries are split by themselves, the small ones are grouped to parts of about the same bytes
+    uint64_t smallTotal = 0;
+    std::vector<uint32_t> smallEntries;
+    smallEntries.reserve(count);
+    for (auto i = 0U; i < count; i++) {
+        if (sizes[i] >= COPY_PARALLEL_MIN) {
+            Copy(dests[i], srcs[i], sizes[i]);
+        } else {
+            smallEntries.emplace_back(i);
+            smallTotal += sizes[i];
+        }
+    }
+
+    auto workerCount = std::min(WorkerCount(smallTotal), static_cast<uint32_t>(smallEntries.size()));
+    if (workerCount <= 1U) {
+        for (auto i : smallEntries) {
+            CopyPart(dests[i], srcs[i], sizes[i], false);
+        }
+        return;
+    }
+
+    std::vector<uint32_t> partEnds; /* end position in smallEntries of each part */
+    auto bytesPerPart = (smallTotal + workerCount - 1U) / workerCount;
+    uint64_t bytes = 0;
+    for (auto pos = 0U; pos < smallEntries.size(); pos++) {
+        bytes += sizes[smallEntries[pos]];
+        if (bytes >= bytesPerPart || pos + 1U == smallEntries.size()) {
+            partEnds.emplace_back(pos + 1U);
+            bytes = 0;
+        }
+    }
+
+    RunParallel(static_cast<uint32_t>(partEnds.size()), [&](uint32_t index) {
+        auto begin = index == 0 ? 0U : partEnds[index - 1U];
+        for (auto pos = begin; pos < partEnds[index]; pos++) {
+            auto i = smallEntries[pos];
+            CopyPart(dests[i], srcs[i], sizes[i], false);
+        }
+    });
+}
+
+void HostCopyEngine::CopyPart(void *dest, const void *src, uint64_t size, bool stream) noexcept
+{
+#if defined(__x86_64__)
+    if (stream && StreamSupported()) {
+        StreamCopyAvx(static_cast<uint8_t *>(dest), static_cast<const uint8_t *>(src), size);
+        return;
+    }
+#endif
+    std::memcpy(dest, src, size);
+}
+
+uint32_t HostCopyEngine::WorkerCount(uint64_t size) noexcept
+{
+    if (size < COPY_PARALLEL_MIN) {
+        return 1U;
+    }
+
+    uint32_t count = 0;
+    auto env = std::getenv(COPY_THREADS_ENV);
+    if (env != nullptr && StrUtil::String2Uint(env, count) && count > 0) {
+        return std::min(count, COPY_WORKER_MAX);
+    }
+
+    cpu_set_t cpus;
+    CPU_ZERO(&cpus);
+    auto cpuCount = sched_getaffinity(0, sizeof(cpus), &cpus) == 0 ? static_cast<uint32_t>(CPU_COUNT(&cpus)) : 1U;
+    auto bySize = static_cast<uint32_t>(std::min(size / COPY_SIZE_PER_WORKER_MIN, uint64_t{COPY_WORKER_MAX}));
+    return std::max(std::min({bySize, cpuCount, COPY_WORKER_MAX}), 1U);
+}
+
+void HostCopyEngine::RunParallel(uint32_t partCount, std::function<void(uint32_t)> part) noexcept
+{
+    if (partCount <= 1U) {
+        if (partCount == 1U) {
+            part(0);
+        }
+        return;
+    }
+
+    auto job = std::make_shared<CopyJob>();
+    job->part = std::move(part);
+    job->partCount = partCount;
+    EnsureWorkers(partCount - 1U);
+    {
+        std::unique_lock<std::mutex> uniqueLock{mutex_};
+        for (auto i = 1U; i < partCount; i++) {
+            jobs_.emplace_back(job);
+        }
+    }
+    cond_.notify_all();
+
+    // caller takes parts too, all parts are done by caller if workers are busy or not started
+    RunParts(*job);
+    std::unique_lock<std::mutex> jobLock{job->mutex};
+    job->cond.wait(jobLock, [&job]() { return job->done.load() == job->partCount; });
+}
+
+void HostCopyEngine::RunParts(CopyJob &job) noexcept
+{
+    while (true) {
+        auto index = job.next.fetch_add(1U);
+        if (index >= job.partCount) {
+            return;
+        }
+        job.part(index);
+        if (job.done.fetch_add(1U) + 1U == job.partCount) {
+            std::unique_lock<std::mutex> jobLock{job.mutex};
+            job.cond.notify_all();
+        }
+    }
+}
+
+void HostCopyEngine::EnsureWorkers(uint32_t count) noexcept
+{
+    std::unique_lock<std::mutex> uniqueLock{mutex_};
+    auto target = std::min(count, COPY_WORKER_MAX - 1U);
+    while (workers_.size() < target) {
+        try {
+            workers_.emplace_back(&HostCopyEngine::WorkerLoop, this);
+        } catch (...) {
+            BM_LOG_WARN("start copy worker(" << workers_.size() << ") failed, copy with " << workers_.size()
+                                             << " workers.");
+            return;
+        }
+    }
+}
+
+void HostCopyEngine::WorkerLoop() noexcept
+{
+    while (true) {
+        CopyJobPtr job;
+        {
+            std::unique_lock<std::mutex> uniqueLock{mutex_};
+            cond_.wait(uniqueLock, [this]() { return stop_ || !jobs_.empty(); });
+            if (stop_) {
+                return;
+            }
+            job = std::move(jobs_.front());
+            jobs_.pop_front();
+        }
+        RunParts(*job);
+    }
+}
+
+bool HostCopyEngine::StreamSupported() noexcept
+{
+#if defined(__x86_64__)
+    static const bool supported = __builtin_cpu_supports("avx");
+    return supported;
+#else
+    return false;
+#endif
+}
+} // namespace mf
+} // namespace ock
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025-2025. All rights reserved.
+ * MemFabric_Hybrid is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *          http://license.coscl.org.cn/MulanPSL2
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+*/
+#ifndef MEM_FABRIC_HYBRID_HYBM_HOST_COPY_ENGINE_H
+#define MEM_FABRIC_HYBRID_HYBM_HOST_COPY_ENGINE_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "hybm_common_include.h"
+
+namespace ock {
+namespace mf {
+/**
+ * @brief CPU copy between host memory of this process, for local and share memory paths
+ *
+ * One core copies far below memory bandwidth, a large copy is split into page aligned parts copied by a pool of
+ * worker threads together with the caller. Each part of a large copy looks small to libc memcpy, which would go
+ * through the cache, so parts are written with non-temporal stores (AVX on x86) instead. A batch of small copies
+ * is spread over the workers by bytes, each worker copies whole entries. Worker count can be set by env
+ * MEMFABRIC_HYBRID_COPY_THREADS.
+ */
+class HostCopyEngine {
+public:
+    static HostCopyEngine &Instance() noexcept;
+
+    /**
+     * @brief Copy size bytes, ranges must not overlap
+     */
+    void Copy(void *dest, const void *src, uint64_t size) noexcept;
+
+    /**
+     * @brief Copy count entries, entries larger than the parallel threshold are split as Copy
+     */
+    void BatchCopy(void *const dests[], const void *const srcs[], const uint64_t sizes[], uint32_t count) noexcept;
+
+    /**
+     * @brief Copy in the calling thread only
+     *
+     * @param stream   [in] write by non-temporal stores if supported, for data not read again soon
+     */
+    static void CopyPart(void *dest, const void *src, uint64_t size, bool stream) noexcept;
+
+    static uint32_t WorkerCount(uint64_t size) noexcept;
+
+    ~HostCopyEngine();
+
+private:
+    /* one parallel copy, parts are taken by caller and workers until all are done */
+    struct CopyJob {
+        std::function<void(uint32_t)> part;
+        uint32_t partCount{0};
+        std::atomic<uint32_t> next{0};
+        std::atomic<uint32_t> done{0};
+        std::mutex mutex;
+        std::condition_variable cond;
+    };
+    using CopyJobPtr = std::shared_ptr<CopyJob>;
+
+    HostCopyEngine() = default;
+    void RunParallel(uint32_t partCount, std::function<void(uint32_t)> part) noexcept;
+    static void RunParts(CopyJob &job) noexcept;
+    void EnsureWorkers(uint32_t count) noexcept;
+    void WorkerLoop() noexcept;
+    static bool StreamSupported() noexcept;
+
+private:
+    static constexpr uint32_t COPY_WORKER_MAX = 16U;
+    static constexpr uint64_t COPY_PARALLEL_MIN = 16UL * 1024UL * 1024UL;
+    static constexpr uint64_t COPY_SIZE_PER_WORKER_MIN = 8UL * 1024UL * 1024UL;
+    static constexpr uint64_t COPY_PART_ALIGN = 4096UL;
+
+    std::mutex mutex_;
+    std::condition_variable cond_;
+    std::deque<CopyJobPtr> jobs_;
+    std::vector<std::thread> workers_;
+    bool stop_{false};
+};
+} // namespace mf
+} // namespace ock
+
+#endif // MEM_FABRIC_HYBRID_HYBM_HOST_COPY_ENGINE_H
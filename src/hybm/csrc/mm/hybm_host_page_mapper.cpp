@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025-2025. All rights reserved.
+ * MemFabric_Hybrid is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *          http://license.coscl.org.cn/MulanPSL2
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+*/
+#include "hybm_host_page_mapper.h"
+
+#include <linux/magic.h>
+#include <linux/mman.h>
+#include <sys/mman.h>
+#include <sys/vfs.h>
+#include <cerrno>
+#include <fstream>
+#include <string>
+
+#include "hybm_logger.h"
+#include "hybm_functions.h"
+
+namespace ock {
+namespace mf {
+namespace {
+constexpr uint64_t PAGE_SIZE_1G = 1024UL * 1024UL * 1024UL;
+constexpr uint64_t PAGE_SIZE_2M = 2UL * 1024UL * 1024UL;
+constexpr uint64_t PAGE_SIZE_4K = 4096UL;
+const char *THP_ENABLED_PATH = "/sys/kernel/mm/transparent_hugepage/enabled";
+const char *THP_SHMEM_ENABLED_PATH = "/sys/kernel/mm/transparent_hugepage/shmem_enabled";
+
+uint64_t KindPageSize(HostPageKind kind)
+{
+    switch (kind) {
+        case HOST_PAGE_HUGETLB_1G:
+            return PAGE_SIZE_1G;
+        case HOST_PAGE_HUGETLB_2M:
+        case HOST_PAGE_THP:
+            return PAGE_SIZE_2M;
+        default:
+            return PAGE_SIZE_4K;
+    }
+}
+
+/* selected mode is in brackets, e.g. "always [madvise] never" */
+bool ThpModeAllows(const char *path)
+{
+    std::ifstream file(path);
+    std::string modes;
+    if (!std::getline(file, modes)) {
+        return false;
+    }
+    auto begin = modes.find('[');
+    auto end = modes.find(']');
+    if (begin == std::string::npos || end == std::string::npos || end < begin) {
+        return false;
+    }
+    auto selected = modes.substr(begin + 1U, end - begin - 1U);
+    return selected != "never" && selected != "deny";
+}
+} // namespace
+
+Result HostPageMapper::Map(void *fixed, uint64_t size, int fd, uint64_t offset, HostPageKind first,
+                           HostPageMapping &mapping) noexcept
+{
+    BM_ASSERT_RETURN(size > 0, BM_INVALID_PARAM);
+    if (fd >= 0) {
+        return MapFile(fixed, size, fd, offset, mapping);
+    }
+
+    for (auto kind = first; kind <= HOST_PAGE_NORMAL; kind = static_cast<HostPageKind>(kind + 1)) {
+        auto pageSize = KindPageSize(kind);
+        if (size % pageSize != 0 || reinterpret_cast<uint64_t>(fixed) % pageSize != 0) {
+            continue;
+        }
+
+        auto address = MapKind(fixed, size, kind);
+        if (address == MAP_FAILED) {
+            BM_LOG_INFO("map size:" << size << " with " << KindName(kind) << " failed: " << errno << ", "
+                                    << SafeStrError(errno) << ", try next page size.");
+            continue;
+        }
+
+        if (kind == HOST_PAGE_THP && !AdviseHugePage(address, size, false)) {
+            kind = HOST_PAGE_NORMAL;
+        }
+        if (kind == HOST_PAGE_NORMAL) {
+            BM_LOG_WARN("map size:" << size << " with 4KB pages as hugepage is not available, TLB and MTT miss more.");
+        }
+        mapping.address = address;
+        mapping.size = size;
+        mapping.kind = kind;
+        mapping.pageSize = KindPageSize(kind);
+        return BM_OK;
+    }
+
+    BM_LOG_ERROR("Failed to map size:" << size << " addr:" << fixed << " with any page size.");
+    return BM_MALLOC_FAILED;
+}
+
+const char *HostPageMapper::KindName(HostPageKind kind) noexcept
+{
+    switch (kind) {
+        case HOST_PAGE_HUGETLB_1G:
+            return "hugetlb-1G";
+        case HOST_PAGE_HUGETLB_2M:
+            return "hugetlb-2M";
+        case HOST_PAGE_THP:
+            return "thp";
+        default:
+            return "4K";
+    }
+}
+
+void *HostPageMapper::MapKind(void *fixed, uint64_t size, HostPageKind kind) noexcept
+{
+    auto flags = MAP_ANONYMOUS | MAP_PRIVATE;
+    if (fixed != nullptr) {
+        flags |= MAP_FIXED;
+    }
+    if (kind == HOST_PAGE_HUGETLB_1G) {
+        flags |= MAP_HUGETLB | MAP_HUGE_1GB;
+    } else if (kind == HOST_PAGE_HUGETLB_2M) {
+        flags |= MAP_HUGETLB | MAP_HUGE_2MB;
+    }
+    return mmap(fixed, size, PROT_READ | PROT_WRITE, flags, -1, 0);
+}
+
+Result HostPageMapper::MapFile(void *fixed, uint64_t size, int fd, uint64_t offset, HostPageMapping &mapping) noexcept
+{
+    struct statfs fs {};
+    if (fstatfs(fd, &fs) != 0) {
+        BM_LOG_ERROR("share mem fd: " << fd << " statfs failed: " << errno << ", " << SafeStrError(errno));
+        return BM_INVALID_PARAM;
+    }
+
+    auto flags = MAP_SHARED | (fixed != nullptr ? MAP_FIXED : 0);
+    auto address = mmap(fixed, size, PROT_READ | PROT_WRITE, flags, fd, static_cast<off_t>(offset));
+    if (address == MAP_FAILED) {
+        BM_LOG_ERROR("Failed to map share mem fd: " << fd << " size:" << size << " addr:" << fixed
+                                                    << " error:" << errno << ", " << SafeStrError(errno));
+        return BM_MALLOC_FAILED;
+    }
+
+    mapping.address = address;
+    mapping.size = size;
+    if (static_cast<uint64_t>(fs.f_type) == HUGETLBFS_MAGIC) {
+        mapping.pageSize = static_cast<uint64_t>(fs.f_bsize);
+        mapping.kind = mapping.pageSize >= PAGE_SIZE_1G ? HOST_PAGE_HUGETLB_1G : HOST_PAGE_HUGETLB_2M;
+    } else if (AdviseHugePage(address, size, true)) {
+        mapping.kind = HOST_PAGE_THP;
+        mapping.pageSize = PAGE_SIZE_2M;
+    } else {
+        mapping.kind = HOST_PAGE_NORMAL;
+        mapping.pageSize = PAGE_SIZE_4K;
+        BM_LOG_WARN("share mem fd: " << fd << " is backed by 4KB pages, TLB and MTT miss more.");
+    }
+    return BM_OK;
+}
+
+bool HostPageMapper::AdviseHugePage(void *address, uint64_t size, bool shmem) noexcept
+{
+    if (!ThpModeAllows(shmem ? THP_SHMEM_ENABLED_PATH : THP_ENABLED_PATH)) {
+        return false;
+    }
+    if (madvise(address, size, MADV_HUGEPAGE) != 0) {
+        BM_LOG_INFO("madvise hugepage size:" << size << " failed: " << errno << ", " << SafeStrError(errno));
+        return false;
+    }
+    return true;
+}
+} // namespace mf
+} // namespace ock
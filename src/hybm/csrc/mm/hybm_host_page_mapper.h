@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025-2025. All rights reserved.
+ * MemFabric_Hybrid is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *          http://license.coscl.org.cn/MulanPSL2
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+*/
+#ifndef MEM_FABRIC_HYBRID_HYBM_HOST_PAGE_MAPPER_H
+#define MEM_FABRIC_HYBRID_HYBM_HOST_PAGE_MAPPER_H
+
+#include "hybm_common_include.h"
+
+namespace ock {
+namespace mf {
+enum HostPageKind : uint8_t {
+    HOST_PAGE_HUGETLB_1G, /* from 1GB hugetlb pool */
+    HOST_PAGE_HUGETLB_2M, /* from 2MB hugetlb pool */
+    HOST_PAGE_THP,        /* transparent hugepage, kernel may still back part of it by 4KB pages */
+    HOST_PAGE_NORMAL,     /* 4KB pages */
+};
+
+struct HostPageMapping {
+    void *address{nullptr};
+    uint64_t size{0};
+    HostPageKind kind{HOST_PAGE_NORMAL};
+    uint64_t pageSize{0};
+};
+
+/**
+ * @brief Map host memory with the largest page size available
+ *
+ * Hugetlb pools of shared nodes are often short or fragmented, the mapping falls back along
+ * 1GB hugetlb -> 2MB hugetlb -> THP(MADV_HUGEPAGE) -> 4KB, so that allocation succeeds while keeping TLB and MTT
+ * entries as few as possible. Private hugetlb mapping reserves pages at mmap, a short pool fails here instead of
+ * at page fault. Mapping of a share memory fd takes the page size of the file.
+ */
+class HostPageMapper {
+public:
+    /**
+     * @brief Map a range
+     *
+     * @param fixed   [in] address to map at with MAP_FIXED, or nullptr to let kernel choose
+     * @param size    [in] size of range
+     * @param fd      [in] share memory fd mapped with MAP_SHARED, or -1 for anonymous private memory
+     * @param offset  [in] offset in fd
+     * @param first   [in] first kind to try
+     * @param mapping [out] mapped range and the chosen page kind
+     * @return BM_OK if mapped, BM_MALLOC_FAILED if all kinds failed
+     */
+    static Result Map(void *fixed, uint64_t size, int fd, uint64_t offset, HostPageKind first,
+                      HostPageMapping &mapping) noexcept;
+
+    static const char *KindName(HostPageKind kind) noexcept;
+
+private:
+    static void *MapKind(void *fixed, uint64_t size, HostPageKind kind) noexcept;
+    static Result MapFile(void *fixed, uint64_t size, int fd, uint64_t offset, HostPageMapping &mapping) noexcept;
+    static bool AdviseHugePage(void *address, uint64_t size, bool shmem) noexcept;
+};
+} // namespace mf
+} // namespace ock
+
+#endif // MEM_FABRIC_HYBRID_HYBM_HOST_PAGE_MAPPER_H
@@ -12,6 +12,7 @@
 #ifndef MEM_FABRIC_HYBRID_HYBM_MM_COMMON_H
 #define MEM_FABRIC_HYBRID_HYBM_MM_COMMON_H
 
+#include <string>
 #include "hybm_common_include.h"
 
 namespace ock {
@@ -76,6 +77,7 @@ struct MemSegmentOptions {
     uint32_t rankCnt = 0; // total rank count
     uint32_t flags = 0;
     int shmFd = -1;
+    std::string transUrl; // for NIC local numa placement of host DRAM
 };
 } // namespace mf
 } // namespace ock
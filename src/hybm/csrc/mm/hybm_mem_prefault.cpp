@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025-2025. All rights reserved.
+ * MemFabric_Hybrid is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *          http://license.coscl.org.cn/MulanPSL2
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+*/
+#include "hybm_mem_prefault.h"
+
+#include <sched.h>
+#include <sys/mman.h>
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+#include "hybm_logger.h"
+#include "hybm_functions.h"
+#include "hybm_ptracer.h"
+#include "mf_str_util.h"
+
+#ifndef MADV_POPULATE_WRITE
+#define MADV_POPULATE_WRITE 23
+#endif
+
+namespace ock {
+namespace mf {
+namespace {
+const char *PREFAULT_THREADS_ENV = "MEMFABRIC_HYBRID_PREFAULT_THREADS";
+}
+
+std::atomic<bool> MemPrefault::madvisePopulate_{true};
+
+Result MemPrefault::Populate(void *address, uint64_t size, uint64_t pageSize, PrefaultStat &stat) noexcept
+{
+    BM_ASSERT_RETURN(address != nullptr && pageSize > 0, BM_INVALID_PARAM);
+    if (size == 0) {
+        return BM_OK;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    auto workerCount = WorkerCount(size);
+    auto pageCount = (size + pageSize - 1U) / pageSize;
+    auto partSize = (pageCount + workerCount - 1U) / workerCount * pageSize;
+    auto base = static_cast<uint8_t *>(address);
+    std::vector<Result> results(workerCount, BM_OK);
+    auto worker = [&](uint32_t index) {
+        auto offset = partSize * index;
+        if (offset < size) {
+            results[index] = PopulatePart(base + offset, std::min(partSize, size - offset), pageSize);
+        }
+    };
+
+    // caller thread populates the first part
+    std::vector<std::thread> workers;
+    for (auto i = 1U; i < workerCount; i++) {
+        try {
+            workers.emplace_back(worker, i);
+        } catch (...) {
+            BM_LOG_WARN("start prefault worker(" << i << ") failed, populate the part in caller.");
+            worker(i);
+        }
+    }
+    worker(0);
+    for (auto &t : workers) {
+        t.join();
+    }
+
+    auto cost = std::chrono::steady_clock::now() - start;
+    stat.workers = workerCount;
+    stat.method = madvisePopulate_.load(std::memory_order_relaxed) ? "madvise" : "touch";
+    stat.costUs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(cost).count());
+    auto failed = std::find_if(results.begin(), results.end(), [](Result ret) { return ret != BM_OK; });
+    auto ret = failed == results.end() ? BM_OK : *failed;
+    auto costNs = std::chrono::duration_cast<std::chrono::nanoseconds>(cost).count();
+    TP_TRACE_RECORD(TP_HYBM_SEGMENT_PREFAULT, static_cast<uint64_t>(costNs), ret);
+    return ret;
+}
+
+uint32_t MemPrefault::WorkerCount(uint64_t size) noexcept
+{
+    uint32_t count = 0;
+    auto env = std::getenv(PREFAULT_THREADS_ENV);
+    if (env != nullptr && StrUtil::String2Uint(env, count) && count > 0) {
+        return std::min(count, PREFAULT_WORKER_MAX);
+    }
+
+    cpu_set_t cpus;
+    CPU_ZERO(&cpus);
+    auto cpuCount = sched_getaffinity(0, sizeof(cpus), &cpus) == 0 ? static_cast<uint32_t>(CPU_COUNT(&cpus)) : 1U;
+    auto bySize = static_cast<uint32_t>(std::min(size / PREFAULT_SIZE_PER_WORKER_MIN, uint64_t{PREFAULT_WORKER_MAX}));
+    return std::max(std::min({bySize, cpuCount, PREFAULT_WORKER_MAX}), 1U);
+}
+
+Result MemPrefault::PopulatePart(uint8_t *address, uint64_t size, uint64_t pageSize) noexcept
+{
+    if (madvisePopulate_.load(std::memory_order_relaxed)) {
+        if (madvise(address, size, MADV_POPULATE_WRITE) == 0) {
+            return BM_OK;
+        }
+
+        auto err = errno;
+        if (err != EINVAL) {
+            BM_LOG_ERROR("populate size:" << size << " addr:" << static_cast<void *>(address) << " failed:" << err
+                                          << ", " << SafeStrError(err));
+            return BM_MALLOC_FAILED;
+        }
+        if (madvisePopulate_.exchange(false)) {
+            BM_LOG_INFO("MADV_POPULATE_WRITE not supported, prefault by touching pages.");
+        }
+    }
+
+    TouchPart(address, size, pageSize);
+    return BM_OK;
+}
+
+void MemPrefault::TouchPart(uint8_t *address, uint64_t size, uint64_t pageSize) noexcept
+{
+    for (uint64_t offset = 0; offset < size; offset += pageSize) {
+        address[offset] = 0;
+    }
+    address[size - 1U] = 0;
+}
+} // namespace mf
+} // namespace ock
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025-2025. All rights reserved.
+ * MemFabric_Hybrid is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *          http://license.coscl.org.cn/MulanPSL2
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+*/
+#ifndef MEM_FABRIC_HYBRID_HYBM_MEM_PREFAULT_H
+#define MEM_FABRIC_HYBRID_HYBM_MEM_PREFAULT_H
+
+#include <atomic>
+
+#include "hybm_common_include.h"
+
+namespace ock {
+namespace mf {
+/**
+ * @brief result of one prefault, shown in create log
+ */
+struct PrefaultStat {
+    uint32_t workers{0};
+    const char *method{""};
+    uint64_t costUs{0};
+};
+
+/**
+ * @brief Commit physical pages of a mapped host range before it is exposed to remote ranks
+ *
+ * Committing hundreds of GB page by page in one thread takes tens of seconds, the range is split into page aligned
+ * parts populated by a bounded set of threads. Each part is populated by madvise(MADV_POPULATE_WRITE) if kernel
+ * supports it (5.14+), which reports a short hugepage pool as error instead of SIGBUS, otherwise by writing one
+ * byte of each page. Workers inherit cpu affinity and memory policy of the caller, the placement is the same as
+ * touching in the caller. Worker count can be set by env MEMFABRIC_HYBRID_PREFAULT_THREADS.
+ */
+class MemPrefault {
+public:
+    /**
+     * @brief Populate pages of [address, address + size)
+     *
+     * @param address  [in] start of the range, aligned to pageSize
+     * @param size     [in] size of the range, multiple of pageSize
+     * @param pageSize [in] page size of the mapping
+     * @param stat     [out] workers, method and time cost
+     * @return BM_OK if all pages are committed, BM_MALLOC_FAILED if kernel is out of (huge) pages
+     */
+    static Result Populate(void *address, uint64_t size, uint64_t pageSize, PrefaultStat &stat) noexcept;
+
+    static uint32_t WorkerCount(uint64_t size) noexcept;
+
+private:
+    static Result PopulatePart(uint8_t *address, uint64_t size, uint64_t pageSize) noexcept;
+    static void TouchPart(uint8_t *address, uint64_t size, uint64_t pageSize) noexcept;
+
+private:
+    static constexpr uint32_t PREFAULT_WORKER_MAX = 16U;
+    static constexpr uint64_t PREFAULT_SIZE_PER_WORKER_MIN = 1024UL * 1024UL * 1024UL;
+    static std::atomic<bool> madvisePopulate_;
+};
+} // namespace mf
+} // namespace ock
+
+#endif // MEM_FABRIC_HYBRID_HYBM_MEM_PREFAULT_H
@@ -219,6 +219,17 @@ bool MemSegment::CanSdmaReaches(uint32_t superPodId, uint32_t serverId, uint32_t
     return superPodId == superPodId_;
 }
 
+Result MemSegment::PrepareRankWorker() noexcept
+{
+    // runtime operations of ranks in worker threads need device of the segment
+    auto ret = DlAclApi::AclrtSetDevice(deviceId_);
+    if (ret != BM_OK) {
+        BM_LOG_ERROR("set device(" << deviceId_ << ") for rank worker failed: " << ret);
+        return ret;
+    }
+    return BM_OK;
+}
+
 void MemSegment::FillSysBootIdInfo() noexcept
 {
     std::string bootIdPath("/proc/sys/kernel/random/boot_id");
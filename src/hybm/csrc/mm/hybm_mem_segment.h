@@ -140,6 +140,7 @@ protected:
     static bool CanLocalHostReaches(uint32_t superPodId, uint32_t serverId, uint32_t deviceId) noexcept;
     static bool CanSdmaReaches(uint32_t superPodId, uint32_t serverId, uint32_t deviceId) noexcept;
     static void FillSysBootIdInfo() noexcept;
+    static Result PrepareRankWorker() noexcept;
 
 protected:
     const MemSegmentOptions options_;
@@ -33,6 +33,7 @@ struct MemSlice {
     const uint64_t memPageTblType_ : 2; /* use CANN SVM page table or HyBM page table */
     const uint64_t vAddress_;           /* address of memory */
     const uint64_t size_;
+    uint64_t pageSize_{0}; /* size of pages backing the memory, 0 if unknown */
 };
 } // namespace mf
 } // namespace ock
@@ -0,0 +1,225 @@
+/*
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025-2025. All rights reserved.
+ * MemFabric_Hybrid is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *          http://license.coscl.org.cn/MulanPSL2
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+*/
+#include "hybm_numa_policy.h"
+
+#include <arpa/inet.h>
+#include <ifaddrs.h>
+#include <linux/mempolicy.h>
+#include <netinet/in.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+#include "hybm_logger.h"
+#include "hybm_functions.h"
+#include "mf_num_util.h"
+
+namespace ock {
+namespace mf {
+namespace {
+constexpr uint32_t NUMA_NODE_MAX = 1024U;
+constexpr uint32_t BITS_PER_MASK_WORD = sizeof(unsigned long) * 8U;
+constexpr uint64_t PLACEMENT_BATCH_PAGES = 4096UL;
+constexpr uint64_t BYTES_PER_MB = 1024UL * 1024UL;
+
+std::string UrlHost(const std::string &url)
+{
+    auto begin = url.find("://");
+    begin = (begin == std::string::npos) ? 0 : begin + strlen("://");
+    auto end = url.rfind(':');
+    if (end == std::string::npos || end < begin) {
+        end = url.size();
+    }
+    auto host = url.substr(begin, end - begin);
+    if (host.size() > 1U && host.front() == '[' && host.back() == ']') {
+        host = host.substr(1U, host.size() - 2U);
+    }
+    return host;
+}
+
+std::string InterfaceOfIp(const std::string &ip)
+{
+    struct ifaddrs *addrs = nullptr;
+    if (getifaddrs(&addrs) != 0) {
+        return "";
+    }
+
+    std::string name;
+    char text[INET6_ADDRSTRLEN] = {0};
+    for (auto ifa = addrs; ifa != nullptr && name.empty(); ifa = ifa->ifa_next) {
+        if (ifa->ifa_addr == nullptr) {
+            continue;
+        }
+        const void *addr = nullptr;
+        if (ifa->ifa_addr->sa_family == AF_INET) {
+            addr = &reinterpret_cast<struct sockaddr_in *>(ifa->ifa_addr)->sin_addr;
+        } else if (ifa->ifa_addr->sa_family == AF_INET6) {
+            addr = &reinterpret_cast<struct sockaddr_in6 *>(ifa->ifa_addr)->sin6_addr;
+        } else {
+            continue;
+        }
+        if (inet_ntop(ifa->ifa_addr->sa_family, addr, text, sizeof(text)) != nullptr && ip == text) {
+            name = ifa->ifa_name;
+        }
+    }
+    freeifaddrs(addrs);
+    return name;
+}
+} // namespace
+
+HostNumaPolicy HostNumaPolicy::Create(uint32_t flags, const std::string &transUrl) noexcept
+{
+    HostNumaPolicy policy;
+    if ((flags & HYBM_FLAG_DRAM_NUMA_INTERLEAVE) != 0) {
+        auto nodes = AllowedNodes();
+        if (nodes.size() > 1U) {
+            policy.type_ = HOST_NUMA_POLICY_INTERLEAVE;
+            policy.nodes_ = std::move(nodes);
+        }
+        return policy;
+    }
+
+    auto performance = NumUtil::ExtractBits(flags, HYBM_PERFORMANCE_MODE_FLAG_INDEX, HYBM_PERFORMANCE_MODE_FLAG_LEN);
+    if (performance == UINT32_MAX || performance == 0) {
+        return policy;
+    }
+
+    auto numaIndex = NumUtil::ExtractBits(flags, HYBM_BIND_NUMA_FLAG_INDEX, HYBM_BIND_NUMA_FLAG_LEN);
+    if (numaIndex == UINT32_MAX) {
+        return policy;
+    }
+    if (numaIndex == HYBM_BIND_NUMA_AUTO_AFFINITY_FLAG) {
+        auto node = NicNumaNode(transUrl);
+        if (node < 0) {
+            BM_LOG_WARN("numa node of nic(" << transUrl << ") not found, dram placed by first touch.");
+            return policy;
+        }
+        numaIndex = static_cast<uint32_t>(node);
+    }
+    policy.type_ = HOST_NUMA_POLICY_BIND;
+    policy.nodes_.push_back(numaIndex);
+    return policy;
+}
+
+int32_t HostNumaPolicy::NicNumaNode(const std::string &transUrl) noexcept
+{
+    auto host = UrlHost(transUrl);
+    auto name = host.empty() ? "" : InterfaceOfIp(host);
+    if (name.empty()) {
+        return -1;
+    }
+
+    // virtual interfaces have no device, and a nic without affinity reports -1
+    std::ifstream file("/sys/class/net/" + name + "/device/numa_node");
+    int32_t node = -1;
+    if (!(file >> node)) {
+        return -1;
+    }
+    return node;
+}
+
+std::vector<uint32_t> HostNumaPolicy::AllowedNodes() noexcept
+{
+    std::vector<unsigned long> mask(NUMA_NODE_MAX / BITS_PER_MASK_WORD, 0UL);
+    std::vector<uint32_t> nodes;
+    if (syscall(SYS_get_mempolicy, nullptr, mask.data(), NUMA_NODE_MAX, nullptr, MPOL_F_MEMS_ALLOWED) != 0) {
+        BM_LOG_WARN("get allowed numa nodes failed: " << errno << ", " << SafeStrError(errno));
+        return nodes;
+    }
+    for (auto node = 0U; node < NUMA_NODE_MAX; node++) {
+        if ((mask[node / BITS_PER_MASK_WORD] & (1UL << (node % BITS_PER_MASK_WORD))) != 0) {
+            nodes.push_back(node);
+        }
+    }
+    return nodes;
+}
+
+Result HostNumaPolicy::Apply(void *address, uint64_t size) const noexcept
+{
+    if (type_ == HOST_NUMA_POLICY_NONE) {
+        return BM_OK;
+    }
+
+    std::vector<unsigned long> mask(NUMA_NODE_MAX / BITS_PER_MASK_WORD, 0UL);
+    for (auto node : nodes_) {
+        if (node >= NUMA_NODE_MAX) {
+            BM_LOG_ERROR("invalid numa node: " << node);
+            return BM_INVALID_PARAM;
+        }
+        mask[node / BITS_PER_MASK_WORD] |= (1UL << (node % BITS_PER_MASK_WORD));
+    }
+    auto mode = (type_ == HOST_NUMA_POLICY_BIND) ? MPOL_BIND : MPOL_INTERLEAVE;
+    if (syscall(SYS_mbind, address, size, mode, mask.data(), NUMA_NODE_MAX + 1U, 0) != 0) {
+        BM_LOG_ERROR("mbind " << ToString() << " size:" << size << " addr:" << address << " failed: " << errno
+                              << ", " << SafeStrError(errno));
+        return BM_ERROR;
+    }
+    return BM_OK;
+}
+
+std::map<int32_t, uint64_t> HostNumaPolicy::Placement(const void *address, uint64_t size, uint64_t pageSize) noexcept
+{
+    std::map<int32_t, uint64_t> placement;
+    auto base = static_cast<const uint8_t *>(address);
+    std::vector<void *> pages;
+    std::vector<int> status;
+    for (uint64_t offset = 0; offset < size; offset += pageSize * PLACEMENT_BATCH_PAGES) {
+        pages.clear();
+        for (auto pos = offset; pos < size && pages.size() < PLACEMENT_BATCH_PAGES; pos += pageSize) {
+            pages.push_back(const_cast<uint8_t *>(base + pos));
+        }
+        status.assign(pages.size(), -1);
+        if (syscall(SYS_move_pages, 0, pages.size(), pages.data(), nullptr, status.data(), 0) != 0) {
+            std::fill(status.begin(), status.end(), -1);
+        }
+        for (auto i = 0U; i < pages.size(); i++) {
+            auto bytes = std::min(pageSize, size - (offset + pageSize * i));
+            placement[std::max(status[i], -1)] += bytes;
+        }
+    }
+    return placement;
+}
+
+std::string HostNumaPolicy::PlacementString(const std::map<int32_t, uint64_t> &placement) noexcept
+{
+    std::ostringstream oss;
+    for (auto &item : placement) {
+        oss << (oss.tellp() > 0 ? " " : "");
+        if (item.first < 0) {
+            oss << "unknown:";
+        } else {
+            oss << "node" << item.first << ":";
+        }
+        oss << item.second / BYTES_PER_MB << "MB";
+    }
+    return oss.str();
+}
+
+std::string HostNumaPolicy::ToString() const noexcept
+{
+    std::ostringstream oss;
+    oss << (type_ == HOST_NUMA_POLICY_NONE ? "none" : (type_ == HOST_NUMA_POLICY_BIND ? "bind" : "interleave"));
+    if (!nodes_.empty()) {
+        oss << "(";
+        for (auto i = 0U; i < nodes_.size(); i++) {
+            oss << (i > 0 ? "," : "") << nodes_[i];
+        }
+        oss << ")";
+    }
+    return oss.str();
+}
+} // namespace mf
+} // namespace ock
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025-2025. All rights reserved.
+ * MemFabric_Hybrid is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *          http://license.coscl.org.cn/MulanPSL2
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+*/
+#ifndef MEM_FABRIC_HYBRID_HYBM_NUMA_POLICY_H
+#define MEM_FABRIC_HYBRID_HYBM_NUMA_POLICY_H
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "hybm_common_include.h"
+
+namespace ock {
+namespace mf {
+enum HostNumaPolicyType : uint8_t {
+    HOST_NUMA_POLICY_NONE,       /* first touch */
+    HOST_NUMA_POLICY_BIND,       /* all pages on the nodes */
+    HOST_NUMA_POLICY_INTERLEAVE, /* pages round robin on the nodes */
+};
+
+/**
+ * @brief NUMA placement of host DRAM slices, applied by mbind before the slice is populated
+ *
+ * Parsed from the same flags as HBM segment: with performance mode flag set, bind numa bits select the node,
+ * HYBM_BIND_NUMA_AUTO_AFFINITY_FLAG selects the node of the NIC in trans url. HYBM_FLAG_DRAM_NUMA_INTERLEAVE
+ * interleaves pages across all nodes allowed for the process.
+ */
+class HostNumaPolicy {
+public:
+    /**
+     * @brief Parse the policy from segment flags
+     *
+     * @param flags    [in] segment flags
+     * @param transUrl [in] url of host transport, e.g. tcp://ip:port, for NIC local policy
+     * @return policy, none if NIC local node can not be found
+     */
+    static HostNumaPolicy Create(uint32_t flags, const std::string &transUrl) noexcept;
+
+    /**
+     * @brief Get numa node of the network interface having the ip in url
+     *
+     * @return node id, or -1 if not found
+     */
+    static int32_t NicNumaNode(const std::string &transUrl) noexcept;
+
+    /**
+     * @brief Count bytes of each numa node in a populated range, -1 for pages not present
+     */
+    static std::map<int32_t, uint64_t> Placement(const void *address, uint64_t size, uint64_t pageSize) noexcept;
+
+    static std::string PlacementString(const std::map<int32_t, uint64_t> &placement) noexcept;
+
+    /**
+     * @brief Set policy of the mapped range, before any page is touched
+     */
+    Result Apply(void *address, uint64_t size) const noexcept;
+
+    HostNumaPolicyType Type() const noexcept
+    {
+        return type_;
+    }
+
+    const std::vector<uint32_t> &Nodes() const noexcept
+    {
+        return nodes_;
+    }
+
+    std::string ToString() const noexcept;
+
+private:
+    static std::vector<uint32_t> AllowedNodes() noexcept;
+
+private:
+    HostNumaPolicyType type_{HOST_NUMA_POLICY_NONE};
+    std::vector<uint32_t> nodes_;
+};
+} // namespace mf
+} // namespace ock
+
+#endif // MEM_FABRIC_HYBRID_HYBM_NUMA_POLICY_H
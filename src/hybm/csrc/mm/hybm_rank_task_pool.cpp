@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025-2025. All rights reserved.
+ * MemFabric_Hybrid is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *          http://license.coscl.org.cn/MulanPSL2
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+*/
+#include "hybm_rank_task_pool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include "ptracer.h"
+
+namespace ock {
+namespace mf {
+Result RankTaskPool::Run(const char *name, uint32_t traceId, const std::vector<RankTask> &tasks,
+                         const std::function<Result()> &prepare) noexcept
+{
+    if (tasks.empty()) {
+        return BM_OK;
+    }
+
+    std::vector<Result> results(tasks.size(), BM_OK);
+    std::vector<uint64_t> costUs(tasks.size(), 0UL);
+    std::atomic<size_t> next{0};
+    auto worker = [&](bool inCaller) {
+        auto prepared = (inCaller || prepare == nullptr) ? BM_OK : prepare();
+        for (auto i = next.fetch_add(1UL); i < tasks.size(); i = next.fetch_add(1UL)) {
+            if (prepared != BM_OK) {
+                results[i] = prepared;
+                continue;
+            }
+
+            auto start = std::chrono::steady_clock::now();
+            results[i] = tasks[i].run();
+            auto cost = std::chrono::steady_clock::now() - start;
+            costUs[i] = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(cost).count());
+            if (g_tracer.enabled) {
+                g_tracer.trace_begin(traceId, name);
+                auto costNs = std::chrono::duration_cast<std::chrono::nanoseconds>(cost).count();
+                g_tracer.trace_end(traceId, static_cast<uint64_t>(costNs), results[i]);
+            }
+        }
+    };
+
+    // caller thread works too, it is ready for operations already
+    std::vector<std::thread> workers;
+    auto workerCount = WorkerCount(tasks.size());
+    for (auto i = 1U; i < workerCount; i++) {
+        try {
+            workers.emplace_back(worker, false);
+        } catch (...) {
+            BM_LOG_WARN(name << " start worker(" << i << ") failed, run with fewer workers.");
+            break;
+        }
+    }
+    worker(true);
+    for (auto &t : workers) {
+        t.join();
+    }
+
+    auto slowest = std::max_element(costUs.begin(), costUs.end()) - costUs.begin();
+    BM_LOG_INFO(name << " " << tasks.size() << " ranks with " << (workers.size() + 1U) << " workers, slowest rank("
+                     << tasks[slowest].rankId << ") cost " << costUs[slowest] << "us.");
+
+    auto failed = std::find_if(results.begin(), results.end(), [](Result ret) { return ret != BM_OK; });
+    if (failed == results.end()) {
+        return BM_OK;
+    }
+
+    auto failedIdx = failed - results.begin();
+    BM_LOG_ERROR(name << " for rank(" << tasks[failedIdx].rankId << ") failed: " << *failed << ", roll back others.");
+    for (auto i = tasks.size(); i > 0; i--) {
+        auto &task = tasks[i - 1U];
+        if (results[i - 1U] == BM_OK && task.rollback != nullptr) {
+            task.rollback();
+        }
+    }
+    return *failed;
+}
+
+uint32_t RankTaskPool::WorkerCount(size_t taskCount) noexcept
+{
+    auto count = taskCount / RANK_TASK_PER_WORKER_MIN;
+    return static_cast<uint32_t>(std::max(std::min(count, static_cast<size_t>(RANK_TASK_WORKER_MAX)), 1UL));
+}
+} // namespace mf
+} // namespace ock
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025-2025. All rights reserved.
+ * MemFabric_Hybrid is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *          http://license.coscl.org.cn/MulanPSL2
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+*/
+#ifndef MEM_FABRIC_HYBRID_HYBM_RANK_TASK_POOL_H
+#define MEM_FABRIC_HYBRID_HYBM_RANK_TASK_POOL_H
+
+#include <functional>
+#include <vector>
+
+#include "hybm_common_include.h"
+
+namespace ock {
+namespace mf {
+/**
+ * @brief import or map memory of one remote rank
+ */
+struct RankTask {
+    uint32_t rankId{0};
+    std::function<Result()> run;    /* operation on memory of the rank */
+    std::function<void()> rollback; /* undo of the succeed run, can be empty */
+};
+
+/**
+ * @brief Bounded worker pool running operations of remote ranks concurrently
+ *
+ * Driver operations of different ranks are independent, a large world spends much time in doing them one by one.
+ * Time cost of each task is recorded in ptracer and the slowest rank is logged, to find out the stragglers.
+ */
+class RankTaskPool {
+public:
+    /**
+     * @brief Run all tasks, roll back the succeed ones in reverse order if any task failed
+     *
+     * @param name    [in] name of the operation, shown in log and ptracer
+     * @param traceId [in] ptracer id of the operation
+     * @param tasks   [in] tasks of ranks
+     * @param prepare [in] called once in each worker thread before running tasks, e.g. set device of thread
+     * @return BM_OK if all succeed, or result of the first failed task in order
+     */
+    static Result Run(const char *name, uint32_t traceId, const std::vector<RankTask> &tasks,
+                      const std::function<Result()> &prepare = nullptr) noexcept;
+
+private:
+    static uint32_t WorkerCount(size_t taskCount) noexcept;
+
+private:
+    static constexpr uint32_t RANK_TASK_WORKER_MAX = 16U;
+    static constexpr uint32_t RANK_TASK_PER_WORKER_MIN = 2U;
+};
+} // namespace mf
+} // namespace ock
+
+#endif // MEM_FABRIC_HYBRID_HYBM_RANK_TASK_POOL_H
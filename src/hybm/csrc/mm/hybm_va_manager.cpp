@@ -19,6 +19,12 @@
 namespace ock {
 namespace mf {
 static constexpr uint64_t MB_OFFSET = 20UL;
+
+HybmVaManager::HybmVaManager() noexcept
+{
+    ResetFreeSpace();
+}
+
 Result HybmVaManager::Initialize(AscendSocType socType) noexcept
 {
 #if defined(ASCEND_NPU)
@@ -60,7 +66,8 @@ Result HybmVaManager::AddVaInfo(const AllocatedGvaInfo &info)
     }
     allocatedLookupMapByGva_[info.base.gva] = info;
     allocatedLookupMapByLva_[info.base.lva] = info;
-    allocatedLookupMapByMemType_[info.base.memType].push_back(info);
+    allocatedLookupMapByMemType_[info.base.memType][info.base.gva] = info;
+    InvalidateAllocatedSnapshot();
     return BM_OK;
 }
 
@@ -112,15 +119,13 @@ void HybmVaManager::RemoveOneVaInfo(uint64_t va)
     }
     auto typeIt = allocatedLookupMapByMemType_.find(info.base.memType);
     if (typeIt != allocatedLookupMapByMemType_.end()) {
-        auto &typeList = typeIt->second;
-        typeList.erase(std::remove_if(typeList.begin(), typeList.end(),
-                                      [gva](const AllocatedGvaInfo &item) { return item.base.gva == gva; }),
-                       typeList.end());
-        if (typeList.empty()) {
+        typeIt->second.erase(gva);
+        if (typeIt->second.empty()) {
             allocatedLookupMapByMemType_.erase(typeIt);
         }
     }
     allocatedLookupMapByGva_.erase(it);
+    InvalidateAllocatedSnapshot();
     BM_LOG_INFO("RemoveOneVaInfo success: gva=" << VaToStr(gva));
 }
 
@@ -147,17 +152,14 @@ uint64_t HybmVaManager::GetGvaByLva(uint64_t lva)
 uint64_t HybmVaManager::GetLvaByGva(uint64_t gva)
 {
     BM_ASSERT_RETURN(gva > 0, 0);
-    std::shared_lock<std::shared_mutex> lock(mutex_);
-    auto it = allocatedLookupMapByGva_.upper_bound(gva);
-    if (it != allocatedLookupMapByGva_.begin()) {
-        --it;
-        if (it->second.Contains(gva)) {
-            uint64_t offset = gva - it->second.base.gva;
-            uint64_t lva = it->second.base.lva + offset;
-            BM_LOG_DEBUG("GetLvaByGva: gva=" << VaToStr(gva) << " -> lva=" << VaToStr(lva)
-                                             << " (offset=" << VaToStr(offset) << ")");
-            return lva;
-        }
+    auto snapshot = LoadAllocatedSnapshot();
+    auto info = LookupSnapshot(*snapshot, gva);
+    if (info != nullptr) {
+        uint64_t offset = gva - info->base.gva;
+        uint64_t lva = info->base.lva + offset;
+        BM_LOG_DEBUG("GetLvaByGva: gva=" << VaToStr(gva) << " -> lva=" << VaToStr(lva)
+                                         << " (offset=" << VaToStr(offset) << ")");
+        return lva;
     }
     BM_LOG_DEBUG("GetLvaByGva: no mapping found for gva=" << VaToStr(gva));
     return 0;
@@ -166,12 +168,8 @@ uint64_t HybmVaManager::GetLvaByGva(uint64_t gva)
 bool HybmVaManager::IsGva(uint64_t va)
 {
     BM_ASSERT_RETURN(va > 0, false);
-    std::shared_lock<std::shared_mutex> lock(mutex_);
-    auto it = allocatedLookupMapByGva_.upper_bound(va);
-    if (it != allocatedLookupMapByGva_.begin()) {
-        --it;
-    }
-    if (it->second.Contains(va)) {
+    auto snapshot = LoadAllocatedSnapshot();
+    if (LookupSnapshot(*snapshot, va) != nullptr) {
         BM_LOG_DEBUG("IsGva: va=" << VaToStr(va) << " is a valid GVA");
         return true;
     }
@@ -241,14 +239,11 @@ std::pair<uint32_t, bool> HybmVaManager::GetRank(uint64_t gva)
         BM_LOG_WARN("GetRank: va=0 is invalid");
         return {0, false};
     }
-    std::shared_lock<std::shared_mutex> lock(mutex_);
-    auto it = allocatedLookupMapByGva_.upper_bound(gva);
-    if (it != allocatedLookupMapByGva_.begin()) {
-        --it;
-    }
-    if (it->second.Contains(gva)) {
-        BM_LOG_DEBUG("GetRank: va=" << VaToStr(gva) << " localRankId=" << it->second.RankId());
-        return {it->second.RankId(), true};
+    auto snapshot = LoadAllocatedSnapshot();
+    auto info = LookupSnapshot(*snapshot, gva);
+    if (info != nullptr) {
+        BM_LOG_DEBUG("GetRank: va=" << VaToStr(gva) << " localRankId=" << info->RankId());
+        return {info->RankId(), true};
     }
     BM_LOG_DEBUG("GetRank: va=" << VaToStr(gva) << " not found");
     return {0, false};
@@ -269,11 +264,7 @@ ReservedGvaInfo HybmVaManager::AllocReserveGva(uint32_t localRankId, uint64_t si
         return result;
     }
     std::unique_lock<std::shared_mutex> lock(mutex_);
-    uint64_t startAddr = reserveStart_;
-    uint64_t endAddr = reserveEnd_;
-    BM_LOG_DEBUG("AllocReserveGva: searching in HOST range " << VaToStr(startAddr) << "-" << VaToStr(endAddr));
-    // Find free space
-    auto [freeAddr, found] = FindFreeSpace(startAddr, endAddr, size);
+    auto [freeAddr, found] = TakeFreeSpace(size);
     if (!found) {
         BM_LOG_ERROR("AllocReserveGva failed: no free space found for size=" << VaToStr(size));
         return result;
@@ -301,6 +292,7 @@ void HybmVaManager::FreeReserveGva(uint64_t addr)
     }
     const ReservedGvaInfo &info = it->second;
     BM_LOG_INFO("FreeReserveGva: " << info);
+    ReturnFreeSpace(info.start, info.size);
     reservedLookupMapByGva_.erase(it);
     BM_LOG_DEBUG("FreeReserveGva success: addr=" << VaToStr(addr));
 }
@@ -361,70 +353,129 @@ std::pair<bool, AllocatedGvaInfo> HybmVaManager::CheckOverlap(const uint64_t gva
 {
     const uint64_t end = gva + size;
     auto typeIt = allocatedLookupMapByMemType_.find(memType);
-    if (typeIt != allocatedLookupMapByMemType_.end()) {
-        for (const auto &info : typeIt->second) {
-            if ((gva >= info.base.gva && gva < info.End()) || (gva <= info.base.gva && end > info.base.gva)) {
-                BM_LOG_INFO("CheckOverlap: overlap with allocated space " << info);
-                return {true, info};
-            }
+    if (typeIt == allocatedLookupMapByMemType_.end()) {
+        return {false, {}};
+    }
+    // ranges of the same type never overlap, only the neighbours around gva can intersect [gva, end)
+    const auto &ranges = typeIt->second;
+    auto next = ranges.upper_bound(gva);
+    if (next != ranges.begin()) {
+        const auto &prev = std::prev(next)->second;
+        if (prev.End() > gva) {
+            BM_LOG_INFO("CheckOverlap: overlap with allocated space " << prev);
+            return {true, prev};
         }
     }
+    if (next != ranges.end() && next->second.base.gva < end) {
+        BM_LOG_INFO("CheckOverlap: overlap with allocated space " << next->second);
+        return {true, next->second};
+    }
     return {false, {}};
 }
 
-std::pair<uint64_t, bool> HybmVaManager::FindFreeSpace(uint64_t start, uint64_t end, uint64_t size) const
+void HybmVaManager::ResetFreeSpace()
+{
+    freeAddressTree_.clear();
+    freeSizeTree_.clear();
+    if (reserveEnd_ > reserveStart_) {
+        freeAddressTree_.emplace(reserveStart_, reserveEnd_ - reserveStart_);
+        freeSizeTree_.emplace(reserveStart_, reserveEnd_ - reserveStart_);
+    }
+}
+
+std::pair<uint64_t, bool> HybmVaManager::TakeFreeSpace(uint64_t size)
 {
-    if (size == 0 || start >= end || size > (end - start)) {
-        BM_LOG_ERROR("FindFreeSpace: invalid parameters. start=" << VaToStr(start) << ", end=" << VaToStr(end)
-                                                                 << ", size=" << VaToStr(size));
+    auto sizePos = freeSizeTree_.lower_bound(SpaceRange{0, size});
+    if (sizePos == freeSizeTree_.end()) {
+        BM_LOG_ERROR("TakeFreeSpace: no suitable free space found, size: " << VaToStr(size)
+                                                                           << ", free ranges: " << freeSizeTree_.size());
         return {0, false};
     }
-    std::vector<std::pair<uint64_t, uint64_t>> usedRanges;
-    for (const auto &pair : reservedLookupMapByGva_) {
-        const ReservedGvaInfo &info = pair.second;
-        if (info.start >= start && info.start < end) {
-            usedRanges.emplace_back(info.start, info.End());
-        }
+    auto start = sizePos->offset;
+    auto rangeSize = sizePos->size;
+    auto addrPos = freeAddressTree_.find(start);
+    if (addrPos == freeAddressTree_.end()) {
+        BM_LOG_ERROR("TakeFreeSpace: range " << VaToStr(start) << " in size tree, not in address tree.");
+        return {0, false};
     }
-    BM_LOG_DEBUG("FindFreeSpace: found " << usedRanges.size() << " used ranges in target area");
-    if (usedRanges.empty()) {
-        BM_LOG_DEBUG("FindFreeSpace: no used ranges, using start address " << VaToStr(start));
-        return {start, true};
-    }
-    std::sort(usedRanges.begin(), usedRanges.end());
-    uint64_t current = start;
-    for (const auto &range : usedRanges) {
-        if (range.first > current) {
-            uint64_t freeSize = range.first - current;
-            if (freeSize >= size) {
-                BM_LOG_DEBUG("FindFreeSpace: found free space at " << VaToStr(current)
-                                                                   << ", size=" << VaToStr(freeSize));
-                return {current, true};
-            }
-            BM_LOG_DEBUG("FindFreeSpace: free space at " << VaToStr(current) << " too small (size=" << VaToStr(freeSize)
-                                                         << ", needed=" << VaToStr(size) << ")");
-        }
-        if (range.second > current) {
-            current = range.second;
+    freeSizeTree_.erase(sizePos);
+    freeAddressTree_.erase(addrPos);
+    if (rangeSize > size) {
+        freeAddressTree_.emplace(start + size, rangeSize - size);
+        freeSizeTree_.emplace(start + size, rangeSize - size);
+    }
+    BM_LOG_DEBUG("TakeFreeSpace: found free space at " << VaToStr(start) << ", size=" << VaToStr(rangeSize));
+    return {start, true};
+}
+
+void HybmVaManager::ReturnFreeSpace(uint64_t start, uint64_t size)
+{
+    uint64_t finalStart = start;
+    uint64_t finalSize = size;
+    auto nextPos = freeAddressTree_.lower_bound(start);
+    if (nextPos != freeAddressTree_.begin()) {
+        auto prevPos = std::prev(nextPos);
+        if (prevPos->first + prevPos->second == start) {
+            finalStart = prevPos->first;
+            finalSize += prevPos->second;
+            freeSizeTree_.erase(SpaceRange{prevPos->first, prevPos->second});
+            freeAddressTree_.erase(prevPos);
         }
     }
-    if (end - current >= size) {
-        BM_LOG_DEBUG("FindFreeSpace: found free space at end, addr=" << VaToStr(current));
-        return {current, true};
+    if (nextPos != freeAddressTree_.end() && nextPos->first == start + size) {
+        finalSize += nextPos->second;
+        freeSizeTree_.erase(SpaceRange{nextPos->first, nextPos->second});
+        freeAddressTree_.erase(nextPos);
     }
-    BM_LOG_ERROR("FindFreeSpace: no suitable free space found, size: " << VaToStr(size));
-    return {0, false};
+    freeAddressTree_.emplace(finalStart, finalSize);
+    freeSizeTree_.emplace(finalStart, finalSize);
 }
 
-std::pair<AllocatedGvaInfo, bool> HybmVaManager::FindAllocByGva(uint64_t gva) const
+void HybmVaManager::InvalidateAllocatedSnapshot()
 {
+    std::atomic_store(&allocatedSnapshotByGva_, std::shared_ptr<const AllocatedGvaSnapshot>());
+}
+
+std::shared_ptr<const HybmVaManager::AllocatedGvaSnapshot> HybmVaManager::LoadAllocatedSnapshot() const
+{
+    auto snapshot = std::atomic_load(&allocatedSnapshotByGva_);
+    if (snapshot != nullptr) {
+        return snapshot;
+    }
+
+    // rebuilt once by the first reader after writes, published under the lock so a later writer invalidates it
     std::shared_lock<std::shared_mutex> lock(mutex_);
-    auto it = allocatedLookupMapByGva_.upper_bound(gva);
-    if (it != allocatedLookupMapByGva_.begin()) {
-        --it;
+    snapshot = std::atomic_load(&allocatedSnapshotByGva_);
+    if (snapshot != nullptr) {
+        return snapshot;
     }
-    if (it->second.Contains(gva)) {
-        return {it->second, true};
+    auto rebuilt = std::make_shared<AllocatedGvaSnapshot>();
+    rebuilt->reserve(allocatedLookupMapByGva_.size());
+    for (const auto &pair : allocatedLookupMapByGva_) {
+        rebuilt->emplace_back(pair.second);
+    }
+    snapshot = std::move(rebuilt);
+    std::atomic_store(&allocatedSnapshotByGva_, snapshot);
+    return snapshot;
+}
+
+const AllocatedGvaInfo *HybmVaManager::LookupSnapshot(const AllocatedGvaSnapshot &snapshot, uint64_t gva)
+{
+    auto it = std::upper_bound(snapshot.begin(), snapshot.end(), gva,
+                               [](uint64_t va, const AllocatedGvaInfo &info) { return va < info.base.gva; });
+    if (it == snapshot.begin()) {
+        return nullptr;
+    }
+    --it;
+    return it->Contains(gva) ? &(*it) : nullptr;
+}
+
+std::pair<AllocatedGvaInfo, bool> HybmVaManager::FindAllocByGva(uint64_t gva) const
+{
+    auto snapshot = LoadAllocatedSnapshot();
+    auto info = LookupSnapshot(*snapshot, gva);
+    if (info != nullptr) {
+        return {*info, true};
     }
     return {AllocatedGvaInfo{}, false};
 }
@@ -480,6 +531,8 @@ void HybmVaManager::ClearAll()
     allocatedLookupMapByLva_.clear();
     reservedLookupMapByGva_.clear();
     allocatedLookupMapByMemType_.clear();
+    ResetFreeSpace();
+    InvalidateAllocatedSnapshot();
 }
 } // namespace mf
 } // namespace ock
\ No newline at end of file
@@ -13,6 +13,7 @@
 #define MEM_FABRIC_HYBRID_HYBM_VA_MANAGER_H
 
 #include <map>
+#include <set>
 #include <mutex>
 #include <shared_mutex>
 #include <vector>
@@ -21,6 +22,7 @@
 #include <unordered_map>
 #include <iomanip>
 #include "hybm_common_include.h"
+#include "hybm_rbtree_range_pool.h"
 
 namespace ock {
 namespace mf {
@@ -217,25 +219,39 @@ public:
     void ClearAll();
 
 private:
-    HybmVaManager() = default;
+    using AllocatedGvaSnapshot = std::vector<AllocatedGvaInfo>;
+
+    HybmVaManager() noexcept;
 
     ~HybmVaManager() = default;
 
     std::pair<bool, AllocatedGvaInfo> CheckOverlap(uint64_t gva, uint64_t size, hybm_mem_type memType);
 
-    std::pair<uint64_t, bool> FindFreeSpace(uint64_t start, uint64_t end, uint64_t size) const;
+    // Free range index of [reserveStart_, reserveEnd_), caller must hold mutex_ exclusively.
+    void ResetFreeSpace();
+    std::pair<uint64_t, bool> TakeFreeSpace(uint64_t size);
+    void ReturnFreeSpace(uint64_t start, uint64_t size);
 
     std::pair<ReservedGvaInfo, bool> FindReservedByAddr(uint64_t addr) const;
 
+    // Readers of GVA lookups go through an immutable snapshot. Writers only drop it under mutex_, the first
+    // reader after a batch of writes rebuilds it, so imports stay O(log n) each.
+    void InvalidateAllocatedSnapshot();
+    std::shared_ptr<const AllocatedGvaSnapshot> LoadAllocatedSnapshot() const;
+    static const AllocatedGvaInfo *LookupSnapshot(const AllocatedGvaSnapshot &snapshot, uint64_t gva);
+
 private:
     mutable std::shared_mutex mutex_{};
 
     std::map<uint64_t, AllocatedGvaInfo> allocatedLookupMapByGva_{};
     std::map<uint64_t, AllocatedGvaInfo> allocatedLookupMapByLva_{};
+    mutable std::shared_ptr<const AllocatedGvaSnapshot> allocatedSnapshotByGva_{};
 
     std::map<uint64_t, ReservedGvaInfo> reservedLookupMapByGva_{};
+    std::map<uint64_t, uint64_t> freeAddressTree_{};
+    std::set<SpaceRange, RangeSizeFirst> freeSizeTree_{};
 
-    std::map<hybm_mem_type, std::vector<AllocatedGvaInfo>> allocatedLookupMapByMemType_{};
+    std::map<hybm_mem_type, std::map<uint64_t, AllocatedGvaInfo>> allocatedLookupMapByMemType_{};
 
     uint64_t reserveStart_{HYBM_GVM_START_ADDR};
     uint64_t reserveEnd_{HYBM_GVM_END_ADDR};
@@ -16,6 +16,8 @@
 #include "hybm_vmm_based_segment.h"
 #include "dl_acl_api.h"
 #include "hybm_types.h"
+#include "hybm_ptracer.h"
+#include "hybm_rank_task_pool.h"
 #include "hybm_va_manager.h"
 #include "mf_num_util.h"
 
@@ -439,33 +441,24 @@ Result HybmVmmBasedSegment::Import(const std::vector<std::string> &allExInfo, vo
             BM_LOG_ERROR("import info(" << i << ") magic(" << info.magic << ") invalid.");
             return BM_INVALID_PARAM;
         }
-        if (options_.segType == HYBM_MST_HBM && info.rankId != options_.rankId &&
-            CanLocalHostReaches(info.superPodId, info.serverId,
-                                info.devId)) {
-            ret = DlAclApi::RtEnableP2P(deviceId_, info.devId, 0);
-            if (ret != 0) {
-                BM_LOG_ERROR("enable device access failed:" << ret << " local_device:" << deviceId_
-                                                            << " remote_device:" << (int)info.devId);
-                return BM_DL_FUNCTION_FAILED;
-            }
-        }
         if (addresses != nullptr) {
             addresses[i] = reinterpret_cast<void *>(info.vAddress);
         }
         deserializedInfos.emplace_back(info);
     }
 
-    for (const auto &info: deserializedInfos) {
+    std::vector<RankTask> tasks;
+    for (const auto &info : deserializedInfos) {
         if (options_.segType == HYBM_MST_HBM && info.rankId != options_.rankId &&
-            CanLocalHostReaches(info.superPodId, info.serverId,
-                                info.devId) && deviceId_ != static_cast<int>(info.devId)) {
-            ret = DlAclApi::RtEnableP2P(deviceId_, info.devId, 0);
-            if (ret != 0) {
-                BM_LOG_ERROR("enable device access failed:" << ret << " local_device:" << deviceId_
-                                                            << " remote_device:" << (int)info.devId);
-                return BM_DL_FUNCTION_FAILED;
-            }
+            CanLocalHostReaches(info.superPodId, info.serverId, info.devId)) {
+            tasks.push_back({info.rankId, [this, &info]() { return EnableP2P(info); }, nullptr});
         }
+    }
+    ret = RankTaskPool::Run("VmmImportRank", TP_HYBM_SEGMENT_IMPORT_RANK, tasks, PrepareRankWorker);
+    if (ret != BM_OK) {
+        return ret;
+    }
+    for (const auto &info : deserializedInfos) {
         BM_LOG_INFO("Success to import rank:" << info.rankId << " superPodId:" << info.superPodId << " serverId:"
               << info.serverId << " devId:" << info.devId << " segType:" << options_.segType  << " size:" << info.size);
     }
@@ -488,6 +481,39 @@ Result HybmVmmBasedSegment::Import(const std::vector<std::string> &allExInfo, vo
     return BM_OK;
 }
 
+Result HybmVmmBasedSegment::EnableP2P(const HostSdmaExportInfo &info) noexcept
+{
+    auto ret = DlAclApi::RtEnableP2P(deviceId_, info.devId, 0);
+    if (ret != 0) {
+        BM_LOG_ERROR("enable device access failed:" << ret << " local_device:" << deviceId_
+                                                    << " remote_device:" << (int)info.devId);
+        return BM_DL_FUNCTION_FAILED;
+    }
+    return BM_OK;
+}
+
+Result HybmVmmBasedSegment::MapRank(HostSdmaExportInfo &im, drv_mem_handle_t *&handle) noexcept
+{
+    auto remoteAddress = im.vAddress;
+    BM_LOG_INFO("Try to mmap rank:" << im.rankId << " superPodId:" << im.superPodId << " serverId:"
+                                    << im.serverId << " devId:" << im.devId << " segType:" << options_.segType
+                                    << " size:" << im.size << " addr:" << std::hex << remoteAddress);
+    auto ret = DlHalApi::HalMemImport(MEM_HANDLE_TYPE_FABRIC, &im.shareHandle, logicDeviceId_, &handle);
+    BM_VALIDATE_RETURN(
+        ret == BM_OK, "HalMemImport memory failed:" << ret << " local sdid:" << sdid_ << " remote ssid:" << im.sdid,
+        BM_ERROR);
+
+    ret = DlHalApi::HalMemMap(reinterpret_cast<void *>(remoteAddress), im.size, 0, handle, 0);
+    if (ret != BM_OK) {
+        BM_LOG_ERROR("HalMemMap memory failed:" << ret << " addr:" << std::hex << remoteAddress
+            << " size:" << im.size);
+        DlHalApi::HalMemRelease(handle);
+        handle = nullptr;
+        return BM_ERROR;
+    }
+    return BM_OK;
+}
+
 Result HybmVmmBasedSegment::Mmap() noexcept
 {
     if (!options_.shared) {
@@ -498,6 +524,9 @@ Result HybmVmmBasedSegment::Mmap() noexcept
     if (imports_.empty()) {
         return BM_OK;
     }
+
+    std::map<uint64_t, drv_mem_handle_t *> handles;
+    std::vector<RankTask> tasks;
     for (auto &im : imports_) {
         if (im.rankId == options_.rankId) {
             continue;
@@ -518,27 +547,26 @@ Result HybmVmmBasedSegment::Mmap() noexcept
         }
 
         auto remoteAddress = im.vAddress;
-        if (mappedMem_.find(remoteAddress) != mappedMem_.end()) {
+        if (mappedMem_.find(remoteAddress) != mappedMem_.end() || handles.find(remoteAddress) != handles.end()) {
             BM_LOG_INFO("remote slice on rank(" << im.rankId << ") has maped: " << (void *)remoteAddress);
             continue;
         }
-        BM_LOG_INFO("Try to mmap rank:" << im.rankId << " superPodId:" << im.superPodId << " serverId:"
-                                        << im.serverId << " devId:" << im.devId << " segType:" << options_.segType
-                                        << " size:" << im.size << " addr:" << std::hex << remoteAddress);
-        drv_mem_handle_t *handle = nullptr;
-        auto ret = DlHalApi::HalMemImport(MEM_HANDLE_TYPE_FABRIC, &im.shareHandle, logicDeviceId_, &handle);
-        BM_VALIDATE_RETURN(
-            ret == BM_OK, "HalMemImport memory failed:" << ret << " local sdid:" << sdid_ << " remote ssid:" << im.sdid,
-            BM_ERROR);
-
-        ret = DlHalApi::HalMemMap(reinterpret_cast<void *>(remoteAddress), im.size, 0, handle, 0);
-        if (ret != BM_OK) {
-            BM_LOG_ERROR("HalMemMap memory failed:" << ret << " addr:" << std::hex << remoteAddress
-                << " size:" << im.size);
+
+        auto &handle = handles[remoteAddress];
+        auto unmap = [remoteAddress, &handle]() {
+            DlHalApi::HalMemUnmap(reinterpret_cast<void *>(remoteAddress));
             DlHalApi::HalMemRelease(handle);
-            return BM_ERROR;
-        }
-        mappedMem_.emplace(remoteAddress, handle);
+        };
+        tasks.push_back({im.rankId, [this, &im, &handle]() { return MapRank(im, handle); }, unmap});
+    }
+
+    /* nothing of this round is kept mapped if any rank failed */
+    auto ret = RankTaskPool::Run("VmmMmapRank", TP_HYBM_SEGMENT_MMAP_RANK, tasks, PrepareRankWorker);
+    if (ret != BM_OK) {
+        return BM_ERROR;
+    }
+    for (auto &it : handles) {
+        mappedMem_.emplace(it.first, it.second);
     }
     imports_.clear();
     return BM_OK;
@@ -71,6 +71,8 @@ private:
     Result MallocEmptySlice(MemSlicePtr &slice) noexcept;
     Result MallocFromHost(size_t size, uint32_t devId, drv_mem_handle_t **handle) noexcept;
     Result MallocFromDevice(size_t size, uint32_t devId, drv_mem_handle_t **handle) noexcept;
+    Result EnableP2P(const HostSdmaExportInfo &info) noexcept;
+    Result MapRank(HostSdmaExportInfo &im, drv_mem_handle_t *&handle) noexcept;
 
     std::vector<HostSdmaExportInfo> imports_;
     uint8_t *globalVirtualAddress_{nullptr};
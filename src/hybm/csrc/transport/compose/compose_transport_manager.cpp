@@ -17,6 +17,8 @@
 #include "hybm_logger.h"
 #include "host_hcom_transport_manager.h"
 #include "device_rdma_transport_manager.h"
+#include "sim_transport_manager.h"
+#include "shm_transport_manager.h"
 #include "mf_str_util.h"
 
 using namespace ock::mf;
@@ -26,7 +28,10 @@ namespace {
 const char NIC_DELIMITER = ';';
 const std::string HOST_TRANSPORT_TYPE = "host#";
 const std::string DEVICE_TRANSPORT_TYPE = "device#";
-const uint32_t HOST_PROTOCOL = HYBM_DOP_TYPE_HOST_TCP | HYBM_DOP_TYPE_HOST_RDMA | HYBM_DOP_TYPE_HOST_URMA;
+const std::string SHM_TRANSPORT_TYPE = "shm#";
+const uint32_t HOST_PROTOCOL =
+    HYBM_DOP_TYPE_HOST_TCP | HYBM_DOP_TYPE_HOST_RDMA | HYBM_DOP_TYPE_HOST_URMA | HYBM_DOP_TYPE_HOST_SIM;
+const uint32_t SHM_PROTOCOL = HYBM_DOP_TYPE_HOST_TCP | HYBM_DOP_TYPE_HOST_RDMA | HYBM_DOP_TYPE_HOST_URMA;
 } // namespace
 
 Result ComposeTransportManager::OpenHostTransport(const TransportOptions &options)
@@ -35,7 +40,12 @@ Result ComposeTransportManager::OpenHostTransport(const TransportOptions &option
         BM_LOG_ERROR("Failed to open host transport is opened");
         return BM_ERROR;
     }
-    hostTransportManager_ = host::HcomTransportManager::GetInstance();
+    // simulation replaces the real host transport, it moves bytes between local processes without any NIC
+    if (options.protocol & HYBM_DOP_TYPE_HOST_SIM) {
+        hostTransportManager_ = std::make_shared<sim::SimTransportManager>();
+    } else {
+        hostTransportManager_ = host::HcomTransportManager::GetInstance();
+    }
     return hostTransportManager_->OpenDevice(options);
 }
 
@@ -49,6 +59,17 @@ Result ComposeTransportManager::OpenDeviceTransport(const TransportOptions &opti
     return deviceTransportManager_->OpenDevice(options);
 }
 
+void ComposeTransportManager::OpenShmTransport(const TransportOptions &options)
+{
+    // co-located ranks bypass the NIC, host transport is still used for others and as fallback
+    shmTransportManager_ = std::make_shared<shm::ShmTransportManager>();
+    auto ret = shmTransportManager_->OpenDevice(options);
+    if (ret != BM_OK) {
+        BM_LOG_WARN("Failed to open shm transport ret:" << ret << ", co-located ranks use host transport.");
+        shmTransportManager_ = nullptr;
+    }
+}
+
 Result ComposeTransportManager::OpenDevice(const TransportOptions &options)
 {
     options_ = options;
@@ -71,6 +92,10 @@ Result ComposeTransportManager::OpenDevice(const TransportOptions &options)
         }
     }
 
+    if ((options_.protocol & SHM_PROTOCOL) && options_.dramShmFd >= 0) {
+        OpenShmTransport(options);
+    }
+
     std::stringstream ss;
     if ((options_.protocol & HOST_PROTOCOL)) {
         if (hostTransportManager_ == nullptr) {
@@ -88,6 +113,9 @@ Result ComposeTransportManager::OpenDevice(const TransportOptions &options)
         }
         ss << DEVICE_TRANSPORT_TYPE << deviceTransportManager_->GetNic() << NIC_DELIMITER;
     }
+    if (shmTransportManager_ != nullptr) {
+        ss << SHM_TRANSPORT_TYPE << shmTransportManager_->GetNic() << NIC_DELIMITER;
+    }
     nicInfo_ = ss.str();
     BM_LOG_INFO("Success to open device rankId:" << options_.rankId
         << " protocol:" << options_.protocol << " nic:" << nicInfo_);
@@ -104,6 +132,10 @@ Result ComposeTransportManager::CloseDevice()
         hostTransportManager_->CloseDevice();
     }
 
+    if (shmTransportManager_) {
+        shmTransportManager_->CloseDevice();
+    }
+
     return BM_OK;
 }
 
@@ -123,6 +155,13 @@ Result ComposeTransportManager::RegisterMemoryRegion(const TransportMemoryRegion
             return ret;
         }
     }
+    if (shmTransportManager_) {
+        Result ret = shmTransportManager_->RegisterMemoryRegion(mr);
+        if (ret != BM_OK) {
+            BM_LOG_ERROR("Failed to register memory region " << mr);
+            return ret;
+        }
+    }
     ComposeMemoryRegion cmr{mr.addr, mr.size, TT_COMPOSE};
     std::unique_lock<std::mutex> uniqueLock{mrsMutex_};
     mrs_.emplace(mr.addr, cmr);
@@ -251,6 +290,23 @@ void ComposeTransportManager::GetDevicePrepareOptions(const HybmTransPrepareOpti
     }
 }
 
+void ComposeTransportManager::GetShmPrepareOptions(const HybmTransPrepareOptions &param,
+                                                   HybmTransPrepareOptions &shmOptions)
+{
+    for (const auto &item : param.options) {
+        TransportRankPrepareInfo info{};
+        std::vector<std::string> nicVec = StrUtil::Split(item.second.nic, NIC_DELIMITER);
+        for (const auto &nic : nicVec) {
+            if (StrUtil::StartWith(nic, SHM_TRANSPORT_TYPE)) {
+                info.nic = nic.substr(SHM_TRANSPORT_TYPE.length());
+            }
+        }
+        if (!info.nic.empty()) {
+            shmOptions.options.emplace(item.first, info);
+        }
+    }
+}
+
 Result ComposeTransportManager::Prepare(const HybmTransPrepareOptions &options)
 {
     Result ret = BM_OK;
@@ -272,6 +328,15 @@ Result ComposeTransportManager::Prepare(const HybmTransPrepareOptions &options)
             return ret;
         }
     }
+    if (shmTransportManager_) {
+        HybmTransPrepareOptions shmOptions{};
+        GetShmPrepareOptions(options, shmOptions);
+        ret = shmTransportManager_->Prepare(shmOptions);
+        if (ret != BM_OK) {
+            BM_LOG_ERROR("Failed to prepare shm ret: " << ret);
+            return ret;
+        }
+    }
     return BM_OK;
 }
 
@@ -294,6 +359,14 @@ Result ComposeTransportManager::RemoveRanks(const std::vector<uint32_t> &removed
         }
     }
 
+    if (shmTransportManager_) {
+        auto ret = shmTransportManager_->RemoveRanks(removedRanks);
+        if (ret != BM_OK) {
+            BM_LOG_ERROR("Failed for shm transport manager remove ranks ret: " << ret);
+            lastResult = ret;
+        }
+    }
+
     return lastResult;
 }
 
@@ -538,5 +611,14 @@ Result ComposeTransportManager::UpdateRankOptions(const HybmTransPrepareOptions
             BM_LOG_ERROR("Failed to prepare host ret: " << ret);
         }
     }
+    if (shmTransportManager_) {
+        HybmTransPrepareOptions shmOptions{};
+        GetShmPrepareOptions(options, shmOptions);
+        auto shmRet = shmTransportManager_->UpdateRankOptions(shmOptions);
+        if (shmRet != BM_OK) {
+            BM_LOG_ERROR("Failed to update shm rank options ret: " << shmRet);
+            ret = shmRet;
+        }
+    }
     return ret;
 }
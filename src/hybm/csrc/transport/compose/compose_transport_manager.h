@@ -15,6 +15,7 @@
 
 #include "hybm_transport_manager.h"
 #include "hybm_entity_tag_info.h"
+#include "shm_transport_manager.h"
 
 #include <mutex>
 
@@ -75,16 +76,28 @@ public:
     Result WriteRemoteBatchAsync(uint32_t rankId, const CopyDescriptor &descriptor) override;
 
     Result ReadRemoteBatchAsync(uint32_t rankId, const CopyDescriptor &descriptor) override;
+
+    /**
+     * @brief Intra-node transport to co-located ranks, nullptr if not opened
+     */
+    const std::shared_ptr<shm::ShmTransportManager> &GetShmTransport() const noexcept
+    {
+        return shmTransportManager_;
+    }
+
 private:
     Result OpenHostTransport(const TransportOptions &options);
+    void OpenShmTransport(const TransportOptions &options);
 
     Result OpenDeviceTransport(const TransportOptions &options);
     void GetHostPrepareOptions(const HybmTransPrepareOptions &param, HybmTransPrepareOptions &hostOptions);
     void GetDevicePrepareOptions(const HybmTransPrepareOptions &param, HybmTransPrepareOptions &DeviceOptions);
+    void GetShmPrepareOptions(const HybmTransPrepareOptions &param, HybmTransPrepareOptions &shmOptions);
 
 private:
     std::shared_ptr<TransportManager> deviceTransportManager_{nullptr};
     std::shared_ptr<TransportManager> hostTransportManager_{nullptr};
+    std::shared_ptr<shm::ShmTransportManager> shmTransportManager_{nullptr};
 
     std::string nicInfo_;
     std::mutex mrsMutex_;
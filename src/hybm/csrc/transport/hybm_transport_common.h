@@ -31,6 +31,7 @@ constexpr uint32_t REG_MR_FLAG_DRAM = 0x1U;
 constexpr uint32_t REG_MR_FLAG_HBM = 0x2U;
 constexpr uint32_t REG_MR_FLAG_SELF = 0x4U;
 constexpr uint32_t REG_MR_FLAG_ACL_DRAM = 0x8U;
+constexpr uint32_t REG_MR_FLAG_SHM = 0x10U;
 
 constexpr int32_t REG_MR_ACCESS_FLAG_LOCAL_WRITE = 0x1;
 constexpr int32_t REG_MR_ACCESS_FLAG_REMOTE_WRITE = 0x2;
@@ -53,6 +54,8 @@ struct TransportOptions {
     hybm_role_type role;
     std::string nic;
     hybm_tls_config tlsOption;
+    int dramShmFd = -1;         /* share memory fd of local DRAM, -1 if none */
+    uint64_t dramSpaceSize = 0; /* DRAM space size of each rank */
 };
 
 static inline std::ostream &operator<<(std::ostream &output, const TransportOptions &options)
@@ -67,6 +70,7 @@ struct TransportMemoryRegion {
     uint64_t size = 0;                                   /* size of memory to be registered */
     int32_t access = REG_MR_ACCESS_FLAG_BOTH_READ_WRITE; /* access right by local and remote */
     uint32_t flags = 0;                                  /* optional flags: 加一个flag标识是DRAM还是HBM */
+    uint64_t shmOffset = 0;                              /* offset in dram share memory fd, with REG_MR_FLAG_SHM */
 };
 
 static inline std::ostream &operator<<(std::ostream &output, const TransportMemoryRegion &mr)
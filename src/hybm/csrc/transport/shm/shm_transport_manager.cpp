@@ -0,0 +1,381 @@
+/*
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025-2025. All rights reserved.
+ * MemFabric_Hybrid is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *          http://license.coscl.org.cn/MulanPSL2
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+*/
+#include "shm_transport_manager.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+
+#include "hybm_logger.h"
+#include "hybm_functions.h"
+#include "hybm_host_copy_engine.h"
+#include "mf_str_util.h"
+
+using namespace ock::mf;
+using namespace ock::mf::transport;
+using namespace ock::mf::transport::shm;
+
+namespace {
+const char SHM_NIC_DELIMITER = ':';
+constexpr uint32_t SHM_NIC_FIELD_COUNT = 6;
+} // namespace
+
+ShmTransportManager::ShmPeer::~ShmPeer()
+{
+    if (address != nullptr) {
+        munmap(address, size);
+    }
+}
+
+Result ShmTransportManager::OpenDevice(const TransportOptions &options)
+{
+    options_ = options;
+    hostId_ = LoadHostId();
+    pidNamespace_ = LoadPidNamespace();
+    struct stat buf {};
+    auto fd = options.dramShmFd;
+    if (fd >= 0 && fstat(fd, &buf) != 0) {
+        BM_LOG_WARN("stat shm fd:" << fd << " failed: " << errno << ", " << SafeStrError(errno)
+                                   << ", shm transport disabled.");
+        fd = -1;
+    }
+    nic_ = hostId_ + SHM_NIC_DELIMITER + std::to_string(pidNamespace_) + SHM_NIC_DELIMITER +
+           std::to_string(getpid()) + SHM_NIC_DELIMITER + std::to_string(fd) + SHM_NIC_DELIMITER +
+           std::to_string(buf.st_dev) + SHM_NIC_DELIMITER + std::to_string(buf.st_ino);
+    BM_LOG_INFO("Success to open shm transport rankId:" << options.rankId << " nic:" << nic_);
+    return BM_OK;
+}
+
+Result ShmTransportManager::CloseDevice()
+{
+    std::unique_lock<std::mutex> uniqueLock{mutex_};
+    peers_.clear();
+    slotKnown_ = false;
+    return BM_OK;
+}
+
+Result ShmTransportManager::RegisterMemoryRegion(const TransportMemoryRegion &mr)
+{
+    // only the local DRAM slot backed by the share memory fd is relevant
+    if ((mr.flags & REG_MR_FLAG_SHM) == 0 || options_.dramSpaceSize == 0) {
+        return BM_OK;
+    }
+
+    auto slotOffset = static_cast<uint64_t>(options_.rankId) * options_.dramSpaceSize;
+    if (mr.addr < mr.shmOffset + slotOffset) {
+        BM_LOG_ERROR("Failed to register shm memory region " << mr << " offset:" << mr.shmOffset);
+        return BM_INVALID_PARAM;
+    }
+
+    std::unique_lock<std::mutex> uniqueLock{mutex_};
+    gvaBase_ = mr.addr - mr.shmOffset - slotOffset;
+    slotKnown_ = true;
+    return BM_OK;
+}
+
+Result ShmTransportManager::UnregisterMemoryRegion(uint64_t addr)
+{
+    return BM_OK;
+}
+
+bool ShmTransportManager::QueryHasRegistered(uint64_t addr, uint64_t size)
+{
+    return false;
+}
+
+Result ShmTransportManager::QueryMemoryKey(uint64_t addr, TransportMemoryKey &key)
+{
+    // peers locate the memory by nic and slot layout, no key needed
+    key = TransportMemoryKey{};
+    return BM_OK;
+}
+
+Result ShmTransportManager::Prepare(const HybmTransPrepareOptions &options)
+{
+    return UpdatePeers(options);
+}
+
+Result ShmTransportManager::RemoveRanks(const std::vector<uint32_t> &removedRanks)
+{
+    std::unique_lock<std::mutex> uniqueLock{mutex_};
+    for (auto rankId : removedRanks) {
+        peers_.erase(rankId);
+    }
+    return BM_OK;
+}
+
+Result ShmTransportManager::Connect()
+{
+    return BM_OK;
+}
+
+Result ShmTransportManager::AsyncConnect()
+{
+    return BM_OK;
+}
+
+Result ShmTransportManager::WaitForConnected(int64_t timeoutNs)
+{
+    return BM_OK;
+}
+
+Result ShmTransportManager::UpdateRankOptions(const HybmTransPrepareOptions &options)
+{
+    return UpdatePeers(options);
+}
+
+const std::string &ShmTransportManager::GetNic() const
+{
+    return nic_;
+}
+
+Result ShmTransportManager::ReadRemote(uint32_t rankId, uint64_t lAddr, uint64_t rAddr, uint64_t size)
+{
+    return Transfer(rankId, lAddr, rAddr, size, true);
+}
+
+Result ShmTransportManager::WriteRemote(uint32_t rankId, uint64_t lAddr, uint64_t rAddr, uint64_t size)
+{
+    return Transfer(rankId, lAddr, rAddr, size, false);
+}
+
+Result ShmTransportManager::ReadRemoteAsync(uint32_t rankId, uint64_t lAddr, uint64_t rAddr, uint64_t size)
+{
+    return Transfer(rankId, lAddr, rAddr, size, true);
+}
+
+Result ShmTransportManager::WriteRemoteAsync(uint32_t rankId, uint64_t lAddr, uint64_t rAddr, uint64_t size)
+{
+    return Transfer(rankId, lAddr, rAddr, size, false);
+}
+
+Result ShmTransportManager::Synchronize(uint32_t rankId)
+{
+    return BM_OK;
+}
+
+Result ShmTransportManager::WriteRemoteBatchAsync(uint32_t rankId, const CopyDescriptor &descriptor)
+{
+    return BatchTransfer(rankId, descriptor, false);
+}
+
+Result ShmTransportManager::ReadRemoteBatchAsync(uint32_t rankId, const CopyDescriptor &descriptor)
+{
+    return BatchTransfer(rankId, descriptor, true);
+}
+
+bool ShmTransportManager::Reaches(uint32_t rankId) const noexcept
+{
+    std::unique_lock<std::mutex> uniqueLock{mutex_};
+    return slotKnown_ && peers_.find(rankId) != peers_.end();
+}
+
+Result ShmTransportManager::UpdatePeers(const HybmTransPrepareOptions &options)
+{
+    for (const auto &item : options.options) {
+        if (item.first == options_.rankId) {
+            continue;
+        }
+
+        ShmFileId id;
+        if (!ParseNic(item.first, item.second.nic, id)) {
+            std::unique_lock<std::mutex> uniqueLock{mutex_};
+            peers_.erase(item.first);
+            continue;
+        }
+
+        {
+            std::unique_lock<std::mutex> uniqueLock{mutex_};
+            auto pos = peers_.find(item.first);
+            if (pos != peers_.end() && pos->second->id == id) {
+                continue;
+            }
+        }
+
+        auto peer = MapPeer(item.first, id);
+        std::unique_lock<std::mutex> uniqueLock{mutex_};
+        if (peer == nullptr) {
+            peers_.erase(item.first);
+            continue;
+        }
+        peers_[item.first] = std::move(peer);
+    }
+    return BM_OK;
+}
+
+bool ShmTransportManager::ParseNic(uint32_t rankId, const std::string &nic, ShmFileId &id) const noexcept
+{
+    auto fields = StrUtil::Split(nic, SHM_NIC_DELIMITER);
+    ino_t pidNamespace = 0;
+    if (fields.size() != SHM_NIC_FIELD_COUNT || !StrUtil::String2Uint(fields[1], pidNamespace) ||
+        !StrUtil::String2Uint(fields[2], id.pid) || !StrUtil::String2Int(fields[3], id.fd) ||
+        !StrUtil::String2Uint(fields[4], id.dev) || !StrUtil::String2Uint(fields[5], id.ino)) {
+        BM_LOG_WARN("shm peer rank:" << rankId << " invalid nic:" << nic << ", skip it.");
+        return false;
+    }
+    // pid of another pid namespace names a different process in our /proc
+    if (hostId_.empty() || fields[0] != hostId_ || pidNamespace_ == 0 || pidNamespace != pidNamespace_ ||
+        id.fd < 0) {
+        BM_LOG_DEBUG("shm peer rank:" << rankId << " nic:" << nic << " not reachable.");
+        return false;
+    }
+    return true;
+}
+
+ShmTransportManager::ShmPeerPtr ShmTransportManager::MapPeer(uint32_t rankId, const ShmFileId &id) noexcept
+{
+    // the fd of another process can be opened by /proc if we are allowed to ptrace it (same user)
+    auto path = "/proc/" + std::to_string(id.pid) + "/fd/" + std::to_string(id.fd);
+    auto localFd = open(path.c_str(), O_RDWR | O_CLOEXEC);
+    if (localFd < 0) {
+        BM_LOG_WARN("open shm of rank:" << rankId << " path:" << path << " failed: " << errno << ", "
+                                        << SafeStrError(errno) << ", use other transport.");
+        return nullptr;
+    }
+
+    struct stat buf {};
+    if (fstat(localFd, &buf) != 0 || buf.st_dev != id.dev || buf.st_ino != id.ino) {
+        // the pid exited and was reused, or its fd was closed and reused for another file
+        BM_LOG_WARN("shm of rank:" << rankId << " path:" << path << " is not the published file dev:" << id.dev
+                                   << " ino:" << id.ino << ", use other transport.");
+        close(localFd);
+        return nullptr;
+    }
+
+    void *address = MAP_FAILED;
+    if (buf.st_size > 0) {
+        address = mmap(nullptr, static_cast<size_t>(buf.st_size), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_NORESERVE,
+                       localFd, 0);
+    }
+    auto err = errno;
+    close(localFd);
+    if (address == MAP_FAILED) {
+        BM_LOG_WARN("map shm of rank:" << rankId << " path:" << path << " size:" << buf.st_size << " failed: " << err
+                                       << ", " << SafeStrError(err) << ", use other transport.");
+        return nullptr;
+    }
+
+    auto peer = std::make_shared<ShmPeer>();
+    peer->id = id;
+    peer->address = static_cast<uint8_t *>(address);
+    peer->size = static_cast<uint64_t>(buf.st_size);
+    BM_LOG_INFO("Success to map shm of rank:" << rankId << " pid:" << id.pid << " fd:" << id.fd
+                                               << " size:" << peer->size);
+    return peer;
+}
+
+Result ShmTransportManager::FindPeer(uint32_t rankId, ShmPeerPtr &peer, uint64_t &slotBase) const
+{
+    std::unique_lock<std::mutex> uniqueLock{mutex_};
+    auto pos = peers_.find(rankId);
+    if (!slotKnown_ || pos == peers_.end()) {
+        uniqueLock.unlock();
+        BM_LOG_ERROR("Failed to transfer, shm peer rank:" << rankId << " not reachable.");
+        return BM_NOT_SUPPORTED;
+    }
+    peer = pos->second;
+    slotBase = gvaBase_ + static_cast<uint64_t>(rankId) * options_.dramSpaceSize;
+    return BM_OK;
+}
+
+Result ShmTransportManager::Translate(uint32_t rankId, const ShmPeer &peer, uint64_t slotBase, uint64_t rAddr,
+                                      uint64_t size, uint8_t *&remote) noexcept
+{
+    auto offset = rAddr - slotBase;
+    if (rAddr < slotBase || size > peer.size || offset > peer.size - size) {
+        BM_LOG_ERROR("Failed to transfer, rank:" << rankId << " remote addr:" << std::hex << rAddr << " size:" << size
+                                                 << " out of shm size:" << peer.size);
+        return BM_INVALID_PARAM;
+    }
+    remote = peer.address + offset;
+    return BM_OK;
+}
+
+Result ShmTransportManager::Transfer(uint32_t rankId, uint64_t lAddr, uint64_t rAddr, uint64_t size, bool isRead)
+{
+    ShmPeerPtr peer;
+    uint64_t slotBase = 0;
+    uint8_t *remote = nullptr;
+    auto ret = FindPeer(rankId, peer, slotBase);
+    if (ret != BM_OK || (ret = Translate(rankId, *peer, slotBase, rAddr, size, remote)) != BM_OK) {
+        return ret;
+    }
+
+    auto local = reinterpret_cast<uint8_t *>(lAddr);
+    if (isRead) {
+        HostCopyEngine::Instance().Copy(local, remote, size);
+    } else {
+        HostCopyEngine::Instance().Copy(remote, local, size);
+    }
+    return BM_OK;
+}
+
+Result ShmTransportManager::BatchTransfer(uint32_t rankId, const CopyDescriptor &descriptor, bool isRead)
+{
+    ShmPeerPtr peer;
+    uint64_t slotBase = 0;
+    auto ret = FindPeer(rankId, peer, slotBase);
+    if (ret != BM_OK) {
+        return ret;
+    }
+
+    auto count = descriptor.counts.size();
+    std::vector<void *> remotes(count);
+    for (size_t i = 0; i < count; i++) {
+        uint8_t *remote = nullptr;
+        ret = Translate(rankId, *peer, slotBase, reinterpret_cast<uint64_t>(descriptor.globalAddrs[i]),
+                        descriptor.counts[i], remote);
+        if (ret != BM_OK) {
+            return ret;
+        }
+        remotes[i] = remote;
+    }
+
+    // entries of a batch are scheduled together, small ones are spread over copy workers
+    auto batchSize = static_cast<uint32_t>(count);
+    if (isRead) {
+        HostCopyEngine::Instance().BatchCopy(descriptor.localAddrs.data(), remotes.data(), descriptor.counts.data(),
+                                             batchSize);
+    } else {
+        HostCopyEngine::Instance().BatchCopy(remotes.data(), descriptor.localAddrs.data(), descriptor.counts.data(),
+                                             batchSize);
+    }
+    return BM_OK;
+}
+
+std::string ShmTransportManager::LoadHostId() noexcept
+{
+    // head of boot id identifies the host, as segments do for sdma reachability
+    std::ifstream input("/proc/sys/kernel/random/boot_id");
+    std::string bootId;
+    if (!(input >> bootId)) {
+        BM_LOG_WARN("read boot id failed, shm transport disabled.");
+        return "";
+    }
+    return bootId.substr(0, bootId.find('-'));
+}
+
+ino_t ShmTransportManager::LoadPidNamespace() noexcept
+{
+    struct stat buf {};
+    if (stat("/proc/self/ns/pid", &buf) != 0) {
+        BM_LOG_WARN("stat pid namespace failed: " << errno << ", " << SafeStrError(errno)
+                                                  << ", shm transport disabled.");
+        return 0;
+    }
+    return buf.st_ino;
+}
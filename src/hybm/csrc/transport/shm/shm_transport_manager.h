@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025-2025. All rights reserved.
+ * MemFabric_Hybrid is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *          http://license.coscl.org.cn/MulanPSL2
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+*/
+
+#ifndef MF_HYBRID_SHM_TRANSPORT_MANAGER_H
+#define MF_HYBRID_SHM_TRANSPORT_MANAGER_H
+
+#include <sys/types.h>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "hybm_transport_manager.h"
+
+namespace ock {
+namespace mf {
+namespace transport {
+namespace shm {
+/**
+ * @brief Intra-node transport over the share memory fd of host DRAM segments.
+ *
+ * A rank created with a dram share memory fd publishes host id (boot id), pid namespace, pid, fd and the device and
+ * inode of the file in its nic. Ranks on the same host and in the same pid namespace open the fd by
+ * /proc/<pid>/fd/<fd>, check it is the published file and map the whole file, then move bytes by HostCopyEngine
+ * without going through the NIC. DRAM slots of all ranks have the same layout, the file offset of a remote address
+ * is its offset in the slot of the remote rank, the slot base is learned from the local DRAM region registered
+ * with REG_MR_FLAG_SHM. All transfers complete before return.
+ */
+class ShmTransportManager : public TransportManager {
+public:
+    ShmTransportManager() noexcept = default;
+    ~ShmTransportManager() override = default;
+
+    Result OpenDevice(const TransportOptions &options) override;
+
+    Result CloseDevice() override;
+
+    Result RegisterMemoryRegion(const TransportMemoryRegion &mr) override;
+
+    Result UnregisterMemoryRegion(uint64_t addr) override;
+
+    bool QueryHasRegistered(uint64_t addr, uint64_t size) override;
+
+    Result QueryMemoryKey(uint64_t addr, TransportMemoryKey &key) override;
+
+    Result Prepare(const HybmTransPrepareOptions &options) override;
+
+    Result RemoveRanks(const std::vector<uint32_t> &removedRanks) override;
+
+    Result Connect() override;
+
+    Result AsyncConnect() override;
+
+    Result WaitForConnected(int64_t timeoutNs) override;
+
+    Result UpdateRankOptions(const HybmTransPrepareOptions &options) override;
+
+    const std::string &GetNic() const override;
+
+    Result ReadRemote(uint32_t rankId, uint64_t lAddr, uint64_t rAddr, uint64_t size) override;
+
+    Result WriteRemote(uint32_t rankId, uint64_t lAddr, uint64_t rAddr, uint64_t size) override;
+
+    Result ReadRemoteAsync(uint32_t rankId, uint64_t lAddr, uint64_t rAddr, uint64_t size) override;
+
+    Result WriteRemoteAsync(uint32_t rankId, uint64_t lAddr, uint64_t rAddr, uint64_t size) override;
+
+    Result Synchronize(uint32_t rankId) override;
+
+    Result WriteRemoteBatchAsync(uint32_t rankId, const CopyDescriptor &descriptor) override;
+
+    Result ReadRemoteBatchAsync(uint32_t rankId, const CopyDescriptor &descriptor) override;
+
+    /**
+     * @brief Whether DRAM of the rank is mapped, i.e. it is on the same host and has a share memory fd
+     */
+    bool Reaches(uint32_t rankId) const noexcept;
+
+private:
+    /* share memory file of a rank as published in its nic */
+    struct ShmFileId {
+        pid_t pid = 0;
+        int fd = -1;
+        dev_t dev = 0;
+        ino_t ino = 0;
+        bool operator==(const ShmFileId &other) const noexcept
+        {
+            return pid == other.pid && fd == other.fd && dev == other.dev && ino == other.ino;
+        }
+    };
+
+    /* mapping of a peer file, unmapped when the last transfer using it is done */
+    struct ShmPeer {
+        ShmFileId id;
+        uint8_t *address = nullptr;
+        uint64_t size = 0;
+        ~ShmPeer();
+    };
+    using ShmPeerPtr = std::shared_ptr<ShmPeer>;
+
+    Result UpdatePeers(const HybmTransPrepareOptions &options);
+    bool ParseNic(uint32_t rankId, const std::string &nic, ShmFileId &id) const noexcept;
+    static ShmPeerPtr MapPeer(uint32_t rankId, const ShmFileId &id) noexcept;
+    Result FindPeer(uint32_t rankId, ShmPeerPtr &peer, uint64_t &slotBase) const;
+    static Result Translate(uint32_t rankId, const ShmPeer &peer, uint64_t slotBase, uint64_t rAddr, uint64_t size,
+                            uint8_t *&remote) noexcept;
+    Result Transfer(uint32_t rankId, uint64_t lAddr, uint64_t rAddr, uint64_t size, bool isRead);
+    Result BatchTransfer(uint32_t rankId, const CopyDescriptor &descriptor, bool isRead);
+    static std::string LoadHostId() noexcept;
+    static ino_t LoadPidNamespace() noexcept;
+
+private:
+    TransportOptions options_{};
+    std::string hostId_;
+    ino_t pidNamespace_{0};
+    std::string nic_;
+    mutable std::mutex mutex_;
+    bool slotKnown_{false};
+    uint64_t gvaBase_{0}; /* address of rank 0 DRAM slot */
+    std::unordered_map<uint32_t, ShmPeerPtr> peers_;
+};
+} // namespace shm
+} // namespace transport
+} // namespace mf
+} // namespace ock
+
+#endif // MF_HYBRID_SHM_TRANSPORT_MANAGER_H
@@ -0,0 +1,405 @@
+/*
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025-2025. All rights reserved.
+ * MemFabric_Hybrid is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *          http://license.coscl.org.cn/MulanPSL2
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+*/
+#include "sim_transport_manager.h"
+
+#include <sys/uio.h>
+#include <signal.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+
+#include "hybm_logger.h"
+#include "hybm_functions.h"
+#include "mf_str_util.h"
+
+using namespace ock::mf;
+using namespace ock::mf::transport;
+using namespace ock::mf::transport::sim;
+
+namespace {
+const std::string SIM_NIC_PREFIX = "sim://";
+const char *SIM_LATENCY_ENV = "MEMFABRIC_HYBRID_SIM_LATENCY_US";
+const char *SIM_BANDWIDTH_ENV = "MEMFABRIC_HYBRID_SIM_BANDWIDTH_MBPS";
+constexpr uint64_t SIM_KEY_MAGIC = 0x53494d4b4559ULL; /* "SIMKEY" */
+constexpr uint32_t SIM_KEY_MAGIC_INDEX = 0;
+constexpr uint32_t SIM_KEY_PID_INDEX = 1;
+constexpr uint32_t SIM_KEY_ADDR_INDEX = 2;
+constexpr uint32_t SIM_KEY_SIZE_INDEX = 3;
+constexpr uint64_t NS_PER_US = 1000ULL;
+constexpr uint64_t BYTES_PER_MB = 1000ULL * 1000ULL;
+constexpr double NS_PER_SECOND = 1e9;
+/* sleep only when the deadline is far, spin the rest to keep small latencies accurate */
+constexpr auto SIM_SPIN_THRESHOLD = std::chrono::microseconds(100);
+constexpr auto SIM_CONNECT_POLL_INTERVAL = std::chrono::milliseconds(1);
+} // namespace
+
+Result SimTransportManager::OpenDevice(const TransportOptions &options)
+{
+    options_ = options;
+    model_ = LoadLinkModel();
+    nic_ = SIM_NIC_PREFIX + std::to_string(getpid());
+    BM_LOG_INFO("Success to open sim transport rankId:" << options.rankId << " nic:" << nic_ << " latency:"
+                                                        << model_.latencyNs << "ns bandwidth:"
+                                                        << model_.bytesPerSecond << "B/s");
+    return BM_OK;
+}
+
+Result SimTransportManager::CloseDevice()
+{
+    std::unique_lock<std::mutex> uniqueLock{mutex_};
+    localRegions_.clear();
+    peers_.clear();
+    return BM_OK;
+}
+
+Result SimTransportManager::RegisterMemoryRegion(const TransportMemoryRegion &mr)
+{
+    if (mr.addr == 0 || mr.size == 0) {
+        BM_LOG_ERROR("Failed to register sim memory region " << mr);
+        return BM_INVALID_PARAM;
+    }
+
+    std::unique_lock<std::mutex> uniqueLock{mutex_};
+    localRegions_[mr.addr] = mr.size;
+    return BM_OK;
+}
+
+Result SimTransportManager::UnregisterMemoryRegion(uint64_t addr)
+{
+    std::unique_lock<std::mutex> uniqueLock{mutex_};
+    if (localRegions_.erase(addr) == 0) {
+        uniqueLock.unlock();
+        BM_LOG_ERROR("input address not register!");
+        return BM_INVALID_PARAM;
+    }
+    return BM_OK;
+}
+
+bool SimTransportManager::QueryHasRegistered(uint64_t addr, uint64_t size)
+{
+    std::unique_lock<std::mutex> uniqueLock{mutex_};
+    return RegionContains(localRegions_, addr, size);
+}
+
+Result SimTransportManager::QueryMemoryKey(uint64_t addr, TransportMemoryKey &key)
+{
+    std::unique_lock<std::mutex> uniqueLock{mutex_};
+    auto pos = localRegions_.upper_bound(addr);
+    if (pos == localRegions_.begin() || addr >= std::prev(pos)->first + std::prev(pos)->second) {
+        uniqueLock.unlock();
+        BM_LOG_ERROR("Failed to query sim memory key, addr not registered:" << std::hex << addr);
+        return BM_INVALID_PARAM;
+    }
+    --pos;
+    key = TransportMemoryKey{};
+    key.keys[SIM_KEY_MAGIC_INDEX] = SIM_KEY_MAGIC;
+    key.keys[SIM_KEY_PID_INDEX] = static_cast<uint64_t>(getpid());
+    key.keys[SIM_KEY_ADDR_INDEX] = pos->first;
+    key.keys[SIM_KEY_SIZE_INDEX] = pos->second;
+    return BM_OK;
+}
+
+Result SimTransportManager::Prepare(const HybmTransPrepareOptions &options)
+{
+    return UpdatePeers(options);
+}
+
+Result SimTransportManager::RemoveRanks(const std::vector<uint32_t> &removedRanks)
+{
+    std::unique_lock<std::mutex> uniqueLock{mutex_};
+    for (auto rankId : removedRanks) {
+        peers_.erase(rankId);
+    }
+    return BM_OK;
+}
+
+Result SimTransportManager::Connect()
+{
+    return BM_OK;
+}
+
+Result SimTransportManager::AsyncConnect()
+{
+    return BM_OK;
+}
+
+Result SimTransportManager::WaitForConnected(int64_t timeoutNs)
+{
+    auto deadline = Clock::now() + std::chrono::nanoseconds(std::max(timeoutNs, int64_t(0)));
+    while (true) {
+        std::vector<uint32_t> waitingRanks;
+        {
+            std::unique_lock<std::mutex> uniqueLock{mutex_};
+            for (const auto &item : peers_) {
+                auto ret = ProbePeer(item.second.pid);
+                if (ret == BM_TIMEOUT) {
+                    waitingRanks.push_back(item.first);
+                    continue;
+                }
+                if (ret != BM_OK) {
+                    uniqueLock.unlock();
+                    BM_LOG_ERROR("Failed to connect sim peer rank:" << item.first << " pid:" << item.second.pid);
+                    return ret;
+                }
+            }
+        }
+        if (waitingRanks.empty()) {
+            return BM_OK;
+        }
+        if (Clock::now() >= deadline) {
+            BM_LOG_ERROR("Wait for sim peers connected timeout, first waiting rank:" << waitingRanks.front()
+                                                                                     << " count:"
+                                                                                     << waitingRanks.size());
+            return BM_TIMEOUT;
+        }
+        std::this_thread::sleep_for(SIM_CONNECT_POLL_INTERVAL);
+    }
+}
+
+Result SimTransportManager::UpdateRankOptions(const HybmTransPrepareOptions &options)
+{
+    return UpdatePeers(options);
+}
+
+const std::string &SimTransportManager::GetNic() const
+{
+    return nic_;
+}
+
+Result SimTransportManager::ReadRemote(uint32_t rankId, uint64_t lAddr, uint64_t rAddr, uint64_t size)
+{
+    return Transfer(rankId, lAddr, rAddr, size, true, false);
+}
+
+Result SimTransportManager::WriteRemote(uint32_t rankId, uint64_t lAddr, uint64_t rAddr, uint64_t size)
+{
+    return Transfer(rankId, lAddr, rAddr, size, false, false);
+}
+
+Result SimTransportManager::ReadRemoteAsync(uint32_t rankId, uint64_t lAddr, uint64_t rAddr, uint64_t size)
+{
+    return Transfer(rankId, lAddr, rAddr, size, true, true);
+}
+
+Result SimTransportManager::WriteRemoteAsync(uint32_t rankId, uint64_t lAddr, uint64_t rAddr, uint64_t size)
+{
+    return Transfer(rankId, lAddr, rAddr, size, false, true);
+}
+
+Result SimTransportManager::Synchronize(uint32_t rankId)
+{
+    Clock::time_point deadline;
+    {
+        std::unique_lock<std::mutex> uniqueLock{mutex_};
+        auto pos = peers_.find(rankId);
+        if (pos == peers_.end()) {
+            uniqueLock.unlock();
+            BM_LOG_ERROR("Failed to synchronize, sim peer rank:" << rankId << " not prepared.");
+            return BM_INVALID_PARAM;
+        }
+        deadline = pos->second.lastComplete;
+    }
+    WaitUntil(deadline);
+    return BM_OK;
+}
+
+Result SimTransportManager::WriteRemoteBatchAsync(uint32_t rankId, const CopyDescriptor &descriptor)
+{
+    for (size_t i = 0; i < descriptor.counts.size(); i++) {
+        auto ret = Transfer(rankId, reinterpret_cast<uint64_t>(descriptor.localAddrs[i]),
+                            reinterpret_cast<uint64_t>(descriptor.globalAddrs[i]), descriptor.counts[i], false, true);
+        if (ret != BM_OK) {
+            return ret;
+        }
+    }
+    return BM_OK;
+}
+
+Result SimTransportManager::ReadRemoteBatchAsync(uint32_t rankId, const CopyDescriptor &descriptor)
+{
+    for (size_t i = 0; i < descriptor.counts.size(); i++) {
+        auto ret = Transfer(rankId, reinterpret_cast<uint64_t>(descriptor.localAddrs[i]),
+                            reinterpret_cast<uint64_t>(descriptor.globalAddrs[i]), descriptor.counts[i], true, true);
+        if (ret != BM_OK) {
+            return ret;
+        }
+    }
+    return BM_OK;
+}
+
+Result SimTransportManager::UpdatePeers(const HybmTransPrepareOptions &options)
+{
+    std::unique_lock<std::mutex> uniqueLock{mutex_};
+    for (const auto &item : options.options) {
+        if (item.first == options_.rankId) {
+            continue;
+        }
+
+        pid_t pid = 0;
+        if (!StrUtil::StartWith(item.second.nic, SIM_NIC_PREFIX) ||
+            !StrUtil::String2Uint(item.second.nic.substr(SIM_NIC_PREFIX.length()), pid)) {
+            uniqueLock.unlock();
+            BM_LOG_ERROR("Failed to prepare sim peer rank:" << item.first << " invalid nic:" << item.second.nic);
+            return BM_INVALID_PARAM;
+        }
+
+        auto &peer = peers_[item.first];
+        if (peer.pid != pid) {
+            peer = SimPeer{};
+            peer.pid = pid;
+        }
+        for (const auto &key : item.second.memKeys) {
+            if (key.keys[SIM_KEY_MAGIC_INDEX] != SIM_KEY_MAGIC || key.keys[SIM_KEY_PID_INDEX] != uint64_t(pid)) {
+                continue;
+            }
+            peer.regions[key.keys[SIM_KEY_ADDR_INDEX]] = key.keys[SIM_KEY_SIZE_INDEX];
+        }
+        BM_LOG_INFO("Success to prepare sim peer rank:" << item.first << " pid:" << pid
+                                                         << " regions:" << peer.regions.size());
+    }
+    return BM_OK;
+}
+
+Result SimTransportManager::Transfer(uint32_t rankId, uint64_t lAddr, uint64_t rAddr, uint64_t size, bool isRead,
+                                     bool async)
+{
+    pid_t pid;
+    Clock::time_point complete;
+    {
+        std::unique_lock<std::mutex> uniqueLock{mutex_};
+        auto pos = peers_.find(rankId);
+        if (pos == peers_.end()) {
+            uniqueLock.unlock();
+            BM_LOG_ERROR("Failed to transfer, sim peer rank:" << rankId << " not prepared.");
+            return BM_INVALID_PARAM;
+        }
+        if (!RegionContains(pos->second.regions, rAddr, size)) {
+            uniqueLock.unlock();
+            BM_LOG_ERROR("Failed to transfer, rank:" << rankId << " remote addr:" << std::hex << rAddr
+                                                     << " size:" << size << " not registered.");
+            return BM_INVALID_PARAM;
+        }
+        pid = pos->second.pid;
+        complete = Schedule(pos->second, size);
+    }
+
+    auto ret = MoveBytes(pid, lAddr, rAddr, size, isRead);
+    if (ret != BM_OK) {
+        BM_LOG_ERROR("Failed to " << (isRead ? "read from" : "write to") << " sim peer rank:" << rankId
+                                  << " size:" << size << " ret:" << ret);
+        return ret;
+    }
+
+    if (!async) {
+        WaitUntil(complete);
+    }
+    return BM_OK;
+}
+
+SimTransportManager::Clock::time_point SimTransportManager::Schedule(SimPeer &peer, uint64_t size) const noexcept
+{
+    auto now = Clock::now();
+    auto start = std::max(now, peer.busyUntil);
+    uint64_t transmitNs = 0;
+    if (model_.bytesPerSecond > 0) {
+        transmitNs = static_cast<uint64_t>(static_cast<double>(size) * NS_PER_SECOND /
+                                           static_cast<double>(model_.bytesPerSecond));
+    }
+    peer.busyUntil = start + std::chrono::nanoseconds(transmitNs);
+    auto complete = peer.busyUntil + std::chrono::nanoseconds(model_.latencyNs);
+    peer.lastComplete = std::max(peer.lastComplete, complete);
+    return complete;
+}
+
+bool SimTransportManager::RegionContains(const std::map<uint64_t, uint64_t> &regions, uint64_t addr,
+                                         uint64_t size) noexcept
+{
+    auto pos = regions.upper_bound(addr);
+    if (pos == regions.begin()) {
+        return false;
+    }
+    --pos;
+    return addr + size >= addr && addr + size <= pos->first + pos->second;
+}
+
+Result SimTransportManager::MoveBytes(pid_t pid, uint64_t lAddr, uint64_t rAddr, uint64_t size, bool isRead) noexcept
+{
+    if (pid == getpid()) {
+        if (isRead) {
+            std::memcpy(reinterpret_cast<void *>(lAddr), reinterpret_cast<const void *>(rAddr), size);
+        } else {
+            std::memcpy(reinterpret_cast<void *>(rAddr), reinterpret_cast<const void *>(lAddr), size);
+        }
+        return BM_OK;
+    }
+
+    uint64_t offset = 0;
+    while (offset < size) {
+        struct iovec local {
+            reinterpret_cast<void *>(lAddr + offset), size - offset
+        };
+        struct iovec remote {
+            reinterpret_cast<void *>(rAddr + offset), size - offset
+        };
+        auto moved = isRead ? process_vm_readv(pid, &local, 1, &remote, 1, 0)
+                            : process_vm_writev(pid, &local, 1, &remote, 1, 0);
+        if (moved <= 0) {
+            BM_LOG_ERROR("Failed to move bytes with pid:" << pid << " error:" << errno << ", " << SafeStrError(errno)
+                                                          << ", peer processes must be allowed to ptrace each other");
+            return BM_ERROR;
+        }
+        offset += static_cast<uint64_t>(moved);
+    }
+    return BM_OK;
+}
+
+Result SimTransportManager::ProbePeer(pid_t pid) noexcept
+{
+    if (pid == getpid() || kill(pid, 0) == 0) {
+        return BM_OK;
+    }
+    if (errno == ESRCH) {
+        return BM_TIMEOUT;
+    }
+    BM_LOG_ERROR("Failed to probe sim peer pid:" << pid << " error:" << errno << ", " << SafeStrError(errno)
+                                                 << ", peer processes must be allowed to ptrace each other");
+    return BM_ERROR;
+}
+
+void SimTransportManager::WaitUntil(Clock::time_point deadline) noexcept
+{
+    auto now = Clock::now();
+    if (deadline > now + SIM_SPIN_THRESHOLD) {
+        std::this_thread::sleep_until(deadline - SIM_SPIN_THRESHOLD);
+    }
+    while (Clock::now() < deadline) {
+        std::this_thread::yield();
+    }
+}
+
+SimLinkModel SimTransportManager::LoadLinkModel() noexcept
+{
+    SimLinkModel model;
+    uint64_t value = 0;
+    auto latency = std::getenv(SIM_LATENCY_ENV);
+    if (latency != nullptr && StrUtil::String2Uint(latency, value)) {
+        model.latencyNs = value * NS_PER_US;
+    }
+    auto bandwidth = std::getenv(SIM_BANDWIDTH_ENV);
+    if (bandwidth != nullptr && StrUtil::String2Uint(bandwidth, value)) {
+        model.bytesPerSecond = value * BYTES_PER_MB;
+    }
+    return model;
+}
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025-2025. All rights reserved.
+ * MemFabric_Hybrid is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *          http://license.coscl.org.cn/MulanPSL2
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+*/
+
+#ifndef MF_HYBRID_SIM_TRANSPORT_MANAGER_H
+#define MF_HYBRID_SIM_TRANSPORT_MANAGER_H
+
+#include <sys/types.h>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "hybm_transport_manager.h"
+
+namespace ock {
+namespace mf {
+namespace transport {
+namespace sim {
+/**
+ * @brief Latency and bandwidth of one simulated link, zero means no limit.
+ */
+struct SimLinkModel {
+    uint64_t latencyNs = 0;
+    uint64_t bytesPerSecond = 0;
+};
+
+/**
+ * @brief Hardware-free transport between local processes.
+ *
+ * Bytes are moved by memcpy inside one process and by process_vm_readv/process_vm_writev between processes, so
+ * the peers must be allowed to ptrace each other (same user, kernel.yama.ptrace_scope 0). Each remote rank is a
+ * link with its own timeline: a transfer occupies the link for size / bandwidth and completes latency later,
+ * synchronous transfers return at completion, asynchronous ones are waited by Synchronize. A peer is connected
+ * once its process is alive and can be accessed.
+ */
+class SimTransportManager : public TransportManager {
+public:
+    SimTransportManager() noexcept = default;
+    ~SimTransportManager() override = default;
+
+    Result OpenDevice(const TransportOptions &options) override;
+
+    Result CloseDevice() override;
+
+    Result RegisterMemoryRegion(const TransportMemoryRegion &mr) override;
+
+    Result UnregisterMemoryRegion(uint64_t addr) override;
+
+    bool QueryHasRegistered(uint64_t addr, uint64_t size) override;
+
+    Result QueryMemoryKey(uint64_t addr, TransportMemoryKey &key) override;
+
+    Result Prepare(const HybmTransPrepareOptions &options) override;
+
+    Result RemoveRanks(const std::vector<uint32_t> &removedRanks) override;
+
+    Result Connect() override;
+
+    Result AsyncConnect() override;
+
+    Result WaitForConnected(int64_t timeoutNs) override;
+
+    Result UpdateRankOptions(const HybmTransPrepareOptions &options) override;
+
+    const std::string &GetNic() const override;
+
+    Result ReadRemote(uint32_t rankId, uint64_t lAddr, uint64_t rAddr, uint64_t size) override;
+
+    Result WriteRemote(uint32_t rankId, uint64_t lAddr, uint64_t rAddr, uint64_t size) override;
+
+    Result ReadRemoteAsync(uint32_t rankId, uint64_t lAddr, uint64_t rAddr, uint64_t size) override;
+
+    Result WriteRemoteAsync(uint32_t rankId, uint64_t lAddr, uint64_t rAddr, uint64_t size) override;
+
+    Result Synchronize(uint32_t rankId) override;
+
+    Result WriteRemoteBatchAsync(uint32_t rankId, const CopyDescriptor &descriptor) override;
+
+    Result ReadRemoteBatchAsync(uint32_t rankId, const CopyDescriptor &descriptor) override;
+
+    const SimLinkModel &GetLinkModel() const noexcept
+    {
+        return model_;
+    }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct SimPeer {
+        pid_t pid = 0;
+        std::map<uint64_t, uint64_t> regions; /* remote registered address => size */
+        Clock::time_point busyUntil{};
+        Clock::time_point lastComplete{};
+    };
+
+    Result UpdatePeers(const HybmTransPrepareOptions &options);
+    Result Transfer(uint32_t rankId, uint64_t lAddr, uint64_t rAddr, uint64_t size, bool isRead, bool async);
+    Clock::time_point Schedule(SimPeer &peer, uint64_t size) const noexcept;
+    static bool RegionContains(const std::map<uint64_t, uint64_t> &regions, uint64_t addr, uint64_t size) noexcept;
+    /* BM_OK if peer process is alive, BM_TIMEOUT if not started yet, BM_ERROR if it cannot be accessed */
+    static Result ProbePeer(pid_t pid) noexcept;
+    static Result MoveBytes(pid_t pid, uint64_t lAddr, uint64_t rAddr, uint64_t size, bool isRead) noexcept;
+    static void WaitUntil(Clock::time_point deadline) noexcept;
+    static SimLinkModel LoadLinkModel() noexcept;
+
+private:
+    TransportOptions options_{};
+    SimLinkModel model_{};
+    std::string nic_;
+    std::mutex mutex_;
+    std::map<uint64_t, uint64_t> localRegions_; /* local registered address => size */
+    std::unordered_map<uint32_t, SimPeer> peers_;
+};
+} // namespace sim
+} // namespace transport
+} // namespace mf
+} // namespace ock
+
+#endif // MF_HYBRID_SIM_TRANSPORT_MANAGER_H
@@ -27,6 +27,7 @@ typedef void *hybm_mem_slice_t;
 #define HYBM_TLS_PATH_SIZE 256
 #define HYBM_FLAG_INIT_SHMEM_META (1ULL << 63)
 #define HYBM_FLAG_CREATE_WITH_SHM (1U << 8)
+#define HYBM_FLAG_DRAM_NUMA_INTERLEAVE (1U << 9) ///< interleave host DRAM pages across allowed numa nodes
 
 #define HYBM_PRE_REG_SIZE_THRES (8192U * 1024) // local buffer larger than 8MB maybe preregister to mr
 
@@ -50,6 +51,8 @@ typedef enum {
     HYBM_DOP_TYPE_HOST_RDMA = 1U << 3,
     HYBM_DOP_TYPE_HOST_TCP = 1U << 4,
     HYBM_DOP_TYPE_HOST_URMA = 1U << 5,
+    HYBM_DOP_TYPE_HOST_SIM = 1U << 6,
+    HYBM_DOP_TYPE_HOST_SHM = 1U << 7, /* co-located ranks by share memory, selected automatically with host dop */
 
     HYBM_DOP_TYPE_BUTT
 } hybm_data_op_type;
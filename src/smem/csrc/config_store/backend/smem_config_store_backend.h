@@ -23,6 +23,7 @@
 
 #include "smem_ref.h"
 #include "config_store_errno.h"
+#include "smem_config_store_value.h"
 #include "smem_types.h"
 
 namespace ock {
@@ -94,6 +95,37 @@ public:
         const std::vector<uint8_t> data(value.begin(), value.end());
         return Put(key, data, ttlSeconds);
     }
+    /**
+     * @brief Retrieve shared value associated with key without copying
+     *
+     * @param key       [in]  Key to look up
+     * @param outValue  [out] Immutable value if found, valid even if the key is updated later
+     * @return SUCCESS if key exists, NOT_EXIST otherwise
+     */
+    [[nodiscard]] virtual StoreErrorCode GetValue(const std::string &key, StoreValuePtr &outValue) const noexcept = 0;
+
+    /**
+     * @brief Store shared value without copying
+     *
+     * @param key         [in] Key to store
+     * @param value       [in] Immutable value to store
+     * @param ttlSeconds  [in] Time-to-live in seconds (0 = no expiration)
+     * @return SUCCESS on success, ERROR on failure
+     */
+    [[nodiscard]] virtual StoreErrorCode PutValue(const std::string &key, StoreValuePtr value,
+                                                  int64_t ttlSeconds) noexcept = 0;
+
+    /**
+     * @brief Append data to value of key, create the key if not exist
+     *
+     * @param key       [in]  Key to append
+     * @param data      [in]  Data to append, moved into store
+     * @param newValue  [out] Value after append
+     * @return SUCCESS on success, ERROR on failure
+     */
+    [[nodiscard]] virtual StoreErrorCode AppendValue(const std::string &key, std::vector<uint8_t> &&data,
+                                                     StoreValuePtr &newValue) noexcept = 0;
+
     /**
      * @brief Delete key-value pair
      *
@@ -102,6 +134,16 @@ public:
      */
     [[nodiscard]] virtual StoreErrorCode Delete(const std::string &key) noexcept = 0;
 
+    /**
+     * @brief Set time-to-live of existing key, keeping its value
+     *
+     * @param key         [in] Key to expire
+     * @param ttlSeconds  [in] Time-to-live in seconds (0 = no expiration)
+     * @return SUCCESS if set, NOT_EXIST if key doesn't exist
+     * @note Only valid when SupportsTTL() is true
+     */
+    [[nodiscard]] virtual StoreErrorCode Expire(const std::string &key, int64_t ttlSeconds) noexcept = 0;
+
     /**
      * @brief Check if key exists in store
      *
@@ -115,6 +157,14 @@ public:
      */
     virtual void Clear() noexcept = 0;
 
+    /**
+     * @brief Delete all keys starting with prefix
+     *
+     * @param prefix  [in] Key prefix to match
+     * @return count of keys deleted
+     */
+    virtual uint64_t DeletePrefix(const std::string &prefix) noexcept = 0;
+
     // -------------------------------------------------------------------------
     // Capability queries
     // -------------------------------------------------------------------------
@@ -133,6 +183,13 @@ public:
      */
     [[nodiscard]] virtual bool SupportsTTL() const noexcept = 0;
 
+    /**
+     * @brief Check if backend keeps data across restart of the store server process
+     *
+     * @return true if data is reloaded on Initialize, false otherwise
+     */
+    [[nodiscard]] virtual bool IsPersistent() const noexcept = 0;
+
     // -------------------------------------------------------------------------
     // Distributed Lock
     // Note: These are logical locks for distributed coordination, not mutex-style locks.
@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025-2025. All rights reserved.
+ * MemFabric_Hybrid is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *          http://license.coscl.org.cn/MulanPSL2
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+*/
+
+#ifndef SMEM_CONFIG_STORE_EXPIRY_H
+#define SMEM_CONFIG_STORE_EXPIRY_H
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <queue>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace ock {
+namespace smem {
+
+/**
+ * @brief Deadlines of keys with time-to-live, for backends keeping key space in memory
+ *
+ * Expired keys are hidden from reads by Expired, and erased by Collect which backends call before every
+ * modification, so memory of expired keys is reclaimed without a timer thread.
+ * Not thread safe, protected by the lock of backend user as the key space is.
+ */
+class StoreKeyExpiry {
+public:
+    /**
+     * @brief Set or clear time-to-live of key
+     *
+     * @param key         [in] key
+     * @param ttlSeconds  [in] time-to-live in seconds, no expiration if not positive
+     */
+    void Set(const std::string &key, int64_t ttlSeconds) noexcept
+    {
+        if (ttlSeconds <= 0) {
+            Remove(key);
+            return;
+        }
+
+        auto deadline = NowMs() + ttlSeconds * MS_PER_SECOND;
+        deadlines_[key] = deadline;
+        queue_.emplace(deadline, key);
+    }
+
+    void Remove(const std::string &key) noexcept
+    {
+        if (!deadlines_.empty()) {
+            deadlines_.erase(key);
+        }
+    }
+
+    bool Expired(const std::string &key) const noexcept
+    {
+        if (deadlines_.empty()) {
+            return false;
+        }
+
+        auto pos = deadlines_.find(key);
+        return pos != deadlines_.end() && pos->second <= NowMs();
+    }
+
+    /**
+     * @brief Erase all expired keys
+     *
+     * @param erase  [in] erase one expired key from key space
+     * @return count of keys erased
+     */
+    uint64_t Collect(const std::function<void(const std::string &)> &erase) noexcept
+    {
+        if (queue_.empty()) {
+            return 0;
+        }
+
+        uint64_t count = 0;
+        auto now = NowMs();
+        while (!queue_.empty() && queue_.top().first <= now) {
+            auto entry = queue_.top();
+            queue_.pop();
+            // entry is stale if the key is removed or its deadline is reset later
+            auto pos = deadlines_.find(entry.second);
+            if (pos == deadlines_.end() || pos->second != entry.first) {
+                continue;
+            }
+            deadlines_.erase(pos);
+            erase(entry.second);
+            count++;
+        }
+        return count;
+    }
+
+    void Clear() noexcept
+    {
+        deadlines_.clear();
+        queue_ = ExpireQueue{};
+    }
+
+private:
+    static int64_t NowMs() noexcept
+    {
+        auto now = std::chrono::steady_clock::now().time_since_epoch();
+        return std::chrono::duration_cast<std::chrono::milliseconds>(now).count();
+    }
+
+private:
+    static constexpr int64_t MS_PER_SECOND = 1000L;
+    using ExpireEntry = std::pair<int64_t, std::string>;
+    using ExpireQueue = std::priority_queue<ExpireEntry, std::vector<ExpireEntry>, std::greater<ExpireEntry>>;
+
+    std::unordered_map<std::string, int64_t> deadlines_;
+    ExpireQueue queue_;
+};
+} // namespace smem
+} // namespace ock
+#endif // SMEM_CONFIG_STORE_EXPIRY_H
@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025-2025. All rights reserved.
+ * MemFabric_Hybrid is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *          http://license.coscl.org.cn/MulanPSL2
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+*/
+
+#ifndef SMEM_CONFIG_STORE_VALUE_H
+#define SMEM_CONFIG_STORE_VALUE_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace ock {
+namespace smem {
+
+class StoreValue;
+using StoreValuePtr = std::shared_ptr<const StoreValue>;
+using StoreValueChunk = std::shared_ptr<const std::vector<uint8_t>>;
+
+/**
+ * @brief Immutable value of config store, composed of ref-counted chunks
+ *
+ * A value is never modified after created. Append creates a new value which shares the chunks of the
+ * old one, so the value can be referenced by replies in flight while the key is updated concurrently.
+ * Chunk sizes are kept strictly decreasing by merging the tail chunks, so a value appended N times has
+ * at most log2(N) chunks and every byte is copied at most log2(N) times.
+ * Every value created gets a new generation, so a reader can tell a key was updated between two reads even
+ * if the new value has the same size.
+ */
+class StoreValue {
+public:
+    static StoreValuePtr Create(std::vector<uint8_t> data) noexcept
+    {
+        auto value = std::make_shared<StoreValue>();
+        value->generation_ = NextGeneration();
+        value->size_ = data.size();
+        if (!data.empty()) {
+            value->chunks_.emplace_back(std::make_shared<const std::vector<uint8_t>>(std::move(data)));
+        }
+        return value;
+    }
+
+    static StoreValuePtr Create(const uint8_t *data, uint64_t size) noexcept
+    {
+        std::vector<uint8_t> bytes;
+        bytes.reserve(size);
+        bytes.insert(bytes.end(), data, data + size);
+        return Create(std::move(bytes));
+    }
+
+    /**
+     * @brief Create a new value with data appended, current value is not changed
+     *
+     * @param data  [in] data to append
+     * @return new value
+     */
+    StoreValuePtr Append(std::vector<uint8_t> data) const noexcept
+    {
+        auto value = std::make_shared<StoreValue>(*this);
+        value->generation_ = NextGeneration();
+        if (data.empty()) {
+            return value;
+        }
+
+        value->size_ += data.size();
+        value->chunks_.emplace_back(std::make_shared<const std::vector<uint8_t>>(std::move(data)));
+        auto &chunks = value->chunks_;
+        while (chunks.size() > 1U && chunks[chunks.size() - 1U]->size() >= chunks[chunks.size() - 2U]->size()) {
+            auto &front = *chunks[chunks.size() - 2U];
+            auto &back = *chunks[chunks.size() - 1U];
+            std::vector<uint8_t> merged;
+            merged.reserve(front.size() + back.size());
+            merged.insert(merged.end(), front.begin(), front.end());
+            merged.insert(merged.end(), back.begin(), back.end());
+            chunks.pop_back();
+            chunks.back() = std::make_shared<const std::vector<uint8_t>>(std::move(merged));
+        }
+        return value;
+    }
+
+    uint64_t Size() const noexcept
+    {
+        return size_;
+    }
+
+    uint64_t Generation() const noexcept
+    {
+        return generation_;
+    }
+
+    const std::vector<StoreValueChunk> &Chunks() const noexcept
+    {
+        return chunks_;
+    }
+
+    /**
+     * @brief Copy whole value into a contiguous buffer
+     */
+    void CopyTo(std::vector<uint8_t> &out) const noexcept
+    {
+        out.clear();
+        out.reserve(size_);
+        for (auto &chunk : chunks_) {
+            out.insert(out.end(), chunk->begin(), chunk->end());
+        }
+    }
+
+private:
+    static uint64_t NextGeneration() noexcept
+    {
+        static std::atomic<uint64_t> generation{0};
+        return generation.fetch_add(1UL, std::memory_order_relaxed) + 1UL;
+    }
+
+private:
+    std::vector<StoreValueChunk> chunks_;
+    uint64_t size_{0};
+    uint64_t generation_{0};
+};
+
+} // namespace smem
+} // namespace ock
+
+#endif // SMEM_CONFIG_STORE_VALUE_H
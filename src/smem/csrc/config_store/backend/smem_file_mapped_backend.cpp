@@ -0,0 +1,588 @@
+/*
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025-2025. All rights reserved.
+ * MemFabric_Hybrid is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *          http://license.coscl.org.cn/MulanPSL2
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+*/
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include "config_store_log.h"
+#include "smem_file_mapped_backend.h"
+
+namespace ock {
+namespace smem {
+
+SmemFileMappedBackend::SmemFileMappedBackend() noexcept = default;
+
+SmemFileMappedBackend::~SmemFileMappedBackend() noexcept
+{
+    CloseLog();
+}
+
+StoreErrorCode SmemFileMappedBackend::Initialize(const std::string &backendUrl, const std::string &userName,
+                                                 const std::string &password)
+{
+    (void)userName;
+    (void)password;
+    STORE_VALIDATE_RETURN(!backendUrl.empty(), "log file path is empty", StoreErrorCode::ERROR);
+    STORE_VALIDATE_RETURN(fd_ < 0, "backend already initialized with " << logPath_, StoreErrorCode::ERROR);
+
+    logPath_ = backendUrl;
+    auto ret = OpenLog();
+    if (ret != StoreErrorCode::SUCCESS) {
+        CloseLog();
+        return ret;
+    }
+    STORE_LOG_INFO("file mapped backend(" << logPath_ << ") loaded keys: " << kvStore_.size()
+                                          << ", log size: " << tail_);
+    return StoreErrorCode::SUCCESS;
+}
+
+std::string SmemFileMappedBackend::BackendName() const noexcept
+{
+    return "FileMapped";
+}
+
+StoreErrorCode SmemFileMappedBackend::Get(const std::string &key, std::vector<uint8_t> &outValue) const noexcept
+{
+    auto iter = kvStore_.find(key);
+    if (iter == kvStore_.end() || expiry_.Expired(key)) {
+        return StoreErrorCode::NOT_EXIST;
+    }
+    iter->second->CopyTo(outValue);
+    return StoreErrorCode::SUCCESS;
+}
+
+StoreErrorCode SmemFileMappedBackend::Put(const std::string &key, const std::vector<uint8_t> &value,
+                                          int64_t ttlSeconds) noexcept
+{
+    return PutValue(key, StoreValue::Create(value), ttlSeconds);
+}
+
+StoreErrorCode SmemFileMappedBackend::GetValue(const std::string &key, StoreValuePtr &outValue) const noexcept
+{
+    auto iter = kvStore_.find(key);
+    if (iter == kvStore_.end() || expiry_.Expired(key)) {
+        return StoreErrorCode::NOT_EXIST;
+    }
+    outValue = iter->second;
+    return StoreErrorCode::SUCCESS;
+}
+
+StoreErrorCode SmemFileMappedBackend::PutValue(const std::string &key, StoreValuePtr value,
+                                               int64_t ttlSeconds) noexcept
+{
+    if (value == nullptr) {
+        return StoreErrorCode::ERROR;
+    }
+
+    CollectExpired();
+
+    auto ret = AppendRecord(LOG_OP_PUT, key, value->Size(), [&value](uint8_t *address) {
+        WriteValue(address, *value);
+    });
+    if (ret != StoreErrorCode::SUCCESS) {
+        return ret;
+    }
+
+    auto iter = kvStore_.find(key);
+    if (iter != kvStore_.end()) {
+        liveBytes_ -= RecordSize(key.size(), iter->second->Size());
+        iter->second = std::move(value);
+    } else {
+        iter = kvStore_.emplace(key, std::move(value)).first;
+    }
+    liveBytes_ += RecordSize(key.size(), iter->second->Size());
+    expiry_.Set(key, ttlSeconds);
+    CompactIfNeeded();
+    return StoreErrorCode::SUCCESS;
+}
+
+StoreErrorCode SmemFileMappedBackend::AppendValue(const std::string &key, std::vector<uint8_t> &&data,
+                                                  StoreValuePtr &newValue) noexcept
+{
+    CollectExpired();
+    auto ret = AppendRecord(LOG_OP_APPEND, key, data.size(), [&data](uint8_t *address) {
+        if (!data.empty()) {
+            std::copy(data.begin(), data.end(), address);
+        }
+    });
+    if (ret != StoreErrorCode::SUCCESS) {
+        return ret;
+    }
+
+    auto iter = kvStore_.find(key);
+    if (iter == kvStore_.end()) {
+        newValue = StoreValue::Create(std::move(data));
+        kvStore_.emplace(key, newValue);
+    } else {
+        liveBytes_ -= RecordSize(key.size(), iter->second->Size());
+        newValue = iter->second->Append(std::move(data));
+        iter->second = newValue;
+    }
+    liveBytes_ += RecordSize(key.size(), newValue->Size());
+    CompactIfNeeded();
+    return StoreErrorCode::SUCCESS;
+}
+
+StoreErrorCode SmemFileMappedBackend::Delete(const std::string &key) noexcept
+{
+    CollectExpired();
+    auto ret = EraseKey(key);
+    if (ret == StoreErrorCode::SUCCESS) {
+        expiry_.Remove(key);
+    }
+    return ret;
+}
+
+StoreErrorCode SmemFileMappedBackend::Expire(const std::string &key, int64_t ttlSeconds) noexcept
+{
+    CollectExpired();
+    if (kvStore_.find(key) == kvStore_.end()) {
+        return StoreErrorCode::NOT_EXIST;
+    }
+    expiry_.Set(key, ttlSeconds);
+    return StoreErrorCode::SUCCESS;
+}
+
+StoreErrorCode SmemFileMappedBackend::EraseKey(const std::string &key) noexcept
+{
+    auto iter = kvStore_.find(key);
+    if (iter == kvStore_.end()) {
+        return StoreErrorCode::NOT_EXIST;
+    }
+
+    auto ret = AppendRecord(LOG_OP_DELETE, key, 0, nullptr);
+    if (ret != StoreErrorCode::SUCCESS) {
+        return ret;
+    }
+
+    liveBytes_ -= RecordSize(key.size(), iter->second->Size());
+    kvStore_.erase(iter);
+    CompactIfNeeded();
+    return StoreErrorCode::SUCCESS;
+}
+
+StoreErrorCode SmemFileMappedBackend::Exist(const std::string &key) const noexcept
+{
+    if (expiry_.Expired(key)) {
+        return StoreErrorCode::NOT_EXIST;
+    }
+    return kvStore_.find(key) != kvStore_.end() ? StoreErrorCode::SUCCESS : StoreErrorCode::NOT_EXIST;
+}
+
+void SmemFileMappedBackend::Clear() noexcept
+{
+    kvStore_.clear();
+    expiry_.Clear();
+    liveBytes_ = 0;
+    if (fd_ < 0) {
+        return;
+    }
+
+    // truncate then extend again, records after the file header are all zeros which means end of log
+    tail_ = sizeof(LogFileHeader);
+    if (ftruncate(fd_, static_cast<off_t>(tail_)) != 0 || ReserveLog(mappedSize_) != StoreErrorCode::SUCCESS) {
+        STORE_LOG_ERROR("clear log file(" << logPath_ << ") failed, errno: " << errno);
+    }
+}
+
+uint64_t SmemFileMappedBackend::DeletePrefix(const std::string &prefix) noexcept
+{
+    std::vector<std::string> keys;
+    for (auto &it : kvStore_) {
+        if (it.first.compare(0, prefix.size(), prefix) == 0) {
+            keys.emplace_back(it.first);
+        }
+    }
+
+    uint64_t count = 0;
+    for (auto &key : keys) {
+        if (Delete(key) == StoreErrorCode::SUCCESS) {
+            count++;
+        }
+    }
+    return count;
+}
+
+bool SmemFileMappedBackend::IsDistributed() const noexcept
+{
+    return false;
+}
+
+bool SmemFileMappedBackend::SupportsTTL() const noexcept
+{
+    return true;
+}
+
+bool SmemFileMappedBackend::IsPersistent() const noexcept
+{
+    return true;
+}
+
+StoreErrorCode SmemFileMappedBackend::AcquireDistributedLock(const std::string &name) noexcept
+{
+    STORE_LOG_ERROR("Not implemented yet");
+    return StoreErrorCode::ERROR;
+}
+
+StoreErrorCode SmemFileMappedBackend::ReleaseDistributedLock(const std::string &name) noexcept
+{
+    STORE_LOG_ERROR("Not implemented yet");
+    return StoreErrorCode::ERROR;
+}
+
+StoreErrorCode SmemFileMappedBackend::TryAcquireDistributedLock(const std::string &name, int64_t timeoutMs) noexcept
+{
+    STORE_LOG_ERROR("Not implemented yet");
+    return StoreErrorCode::ERROR;
+}
+
+void SmemFileMappedBackend::UnInitialize()
+{
+    CloseLog();
+    kvStore_.clear();
+    expiry_.Clear();
+    liveBytes_ = 0;
+}
+
+StoreErrorCode SmemFileMappedBackend::Compact() noexcept
+{
+    STORE_VALIDATE_RETURN(fd_ >= 0, "backend not initialized", StoreErrorCode::ERROR);
+
+    auto compactPath = logPath_ + ".compact";
+    auto newSize = std::max(LOG_INIT_SIZE, (sizeof(LogFileHeader) + liveBytes_) * 2UL);
+    auto newFd = open(compactPath.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, S_IRUSR | S_IWUSR);
+    if (newFd < 0) {
+        STORE_LOG_ERROR("open compact file(" << compactPath << ") failed, errno: " << errno);
+        return StoreErrorCode::IO_ERROR;
+    }
+
+    uint8_t *newMapped = nullptr;
+    auto ret = flock(newFd, LOCK_EX | LOCK_NB) != 0 ? errno : posix_fallocate(newFd, 0, static_cast<off_t>(newSize));
+    if (ret != 0 || MapLogFile(newFd, newSize, newMapped) != StoreErrorCode::SUCCESS) {
+        STORE_LOG_ERROR("prepare compact file(" << compactPath << ") size: " << newSize << " failed: " << ret);
+        close(newFd);
+        unlink(compactPath.c_str());
+        return StoreErrorCode::IO_ERROR;
+    }
+
+    LogFileHeader fileHeader{LOG_FILE_MAGIC, LOG_FILE_VERSION, 0};
+    std::copy_n(reinterpret_cast<const uint8_t *>(&fileHeader), sizeof(fileHeader), newMapped);
+    uint64_t newTail = sizeof(LogFileHeader);
+    for (auto &it : kvStore_) {
+        auto &value = *it.second;
+        newTail += WriteRecord(newMapped + newTail, LOG_OP_PUT, it.first, value.Size(),
+                               [&value](uint8_t *address) { WriteValue(address, value); });
+    }
+
+    // compact file replaces the log by rename, it must be complete on disk before that
+    if (msync(newMapped, newTail, MS_SYNC) != 0 || rename(compactPath.c_str(), logPath_.c_str()) != 0) {
+        STORE_LOG_ERROR("commit compact file(" << compactPath << ") failed, errno: " << errno);
+        munmap(newMapped, newSize);
+        close(newFd);
+        unlink(compactPath.c_str());
+        return StoreErrorCode::IO_ERROR;
+    }
+
+    STORE_LOG_INFO("compact log file(" << logPath_ << ") from " << tail_ << " to " << newTail << " bytes");
+    CloseLog();
+    fd_ = newFd;
+    mapped_ = newMapped;
+    mappedSize_ = newSize;
+    tail_ = newTail;
+    return StoreErrorCode::SUCCESS;
+}
+
+uint64_t SmemFileMappedBackend::RecordSize(uint64_t keyLen, uint64_t valueLen) noexcept
+{
+    auto size = sizeof(LogRecordHeader) + keyLen + valueLen;
+    return (size + LOG_RECORD_ALIGN - 1UL) & ~(LOG_RECORD_ALIGN - 1UL);
+}
+
+StoreErrorCode SmemFileMappedBackend::MapLogFile(int fd, uint64_t size, uint8_t *&address) noexcept
+{
+    auto mapped = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (mapped == MAP_FAILED) {
+        STORE_LOG_ERROR("mmap log file size: " << size << " failed, errno: " << errno);
+        return StoreErrorCode::IO_ERROR;
+    }
+    address = static_cast<uint8_t *>(mapped);
+    return StoreErrorCode::SUCCESS;
+}
+
+uint64_t SmemFileMappedBackend::WriteRecord(uint8_t *address, LogOp op, const std::string &key, uint64_t valueLen,
+                                            const ValueWriter &writer) noexcept
+{
+    LogRecordHeader header{};
+    header.op = op;
+    header.keyLen = static_cast<uint32_t>(key.size());
+    header.valueLen = valueLen;
+    std::copy_n(reinterpret_cast<const uint8_t *>(&header), sizeof(header), address);
+    std::copy(key.begin(), key.end(), address + sizeof(header));
+    if (writer != nullptr) {
+        writer(address + sizeof(header) + key.size());
+    }
+
+    // magic is written at last, makes the record visible in replay only when it's complete
+    __atomic_store_n(reinterpret_cast<uint32_t *>(address), LOG_RECORD_MAGIC, __ATOMIC_RELEASE);
+    return RecordSize(key.size(), valueLen);
+}
+
+void SmemFileMappedBackend::WriteValue(uint8_t *address, const StoreValue &value) noexcept
+{
+    for (auto &chunk : value.Chunks()) {
+        address = std::copy(chunk->begin(), chunk->end(), address);
+    }
+}
+
+StoreErrorCode SmemFileMappedBackend::OpenLog() noexcept
+{
+    struct stat fileStat {};
+    auto ret = LockLogFile(fileStat);
+    if (ret != StoreErrorCode::SUCCESS) {
+        return ret;
+    }
+
+    auto fileSize = static_cast<uint64_t>(fileStat.st_size);
+    if (fileSize == 0) {
+        auto result = posix_fallocate(fd_, 0, static_cast<off_t>(LOG_INIT_SIZE));
+        if (result != 0) {
+            STORE_LOG_ERROR("allocate log file(" << logPath_ << ") failed: " << result);
+            return StoreErrorCode::IO_ERROR;
+        }
+        STORE_ASSERT_RETURN(MapLogFile(fd_, LOG_INIT_SIZE, mapped_) == StoreErrorCode::SUCCESS,
+                            StoreErrorCode::IO_ERROR);
+        mappedSize_ = LOG_INIT_SIZE;
+        LogFileHeader fileHeader{LOG_FILE_MAGIC, LOG_FILE_VERSION, 0};
+        std::copy_n(reinterpret_cast<const uint8_t *>(&fileHeader), sizeof(fileHeader), mapped_);
+        tail_ = sizeof(LogFileHeader);
+        return StoreErrorCode::SUCCESS;
+    }
+
+    STORE_VALIDATE_RETURN(fileSize >= sizeof(LogFileHeader), "invalid log file(" << logPath_ << ") size: " << fileSize,
+                          StoreErrorCode::IO_ERROR);
+    STORE_ASSERT_RETURN(MapLogFile(fd_, fileSize, mapped_) == StoreErrorCode::SUCCESS, StoreErrorCode::IO_ERROR);
+    mappedSize_ = fileSize;
+
+    LogFileHeader fileHeader{};
+    std::copy_n(mapped_, sizeof(fileHeader), reinterpret_cast<uint8_t *>(&fileHeader));
+    STORE_VALIDATE_RETURN(fileHeader.magic == LOG_FILE_MAGIC && fileHeader.version == LOG_FILE_VERSION,
+                          "file(" << logPath_ << ") is not a config store log", StoreErrorCode::IO_ERROR);
+
+    ret = Replay();
+    if (ret != StoreErrorCode::SUCCESS) {
+        return ret;
+    }
+
+    // drop the torn record left by crash, otherwise its remains may look like a record after later appends
+    if (tail_ < mappedSize_ &&
+        (ftruncate(fd_, static_cast<off_t>(tail_)) != 0 || ReserveLog(mappedSize_) != StoreErrorCode::SUCCESS)) {
+        STORE_LOG_ERROR("reset log file(" << logPath_ << ") tail: " << tail_ << " failed, errno: " << errno);
+        return StoreErrorCode::IO_ERROR;
+    }
+    return StoreErrorCode::SUCCESS;
+}
+
+StoreErrorCode SmemFileMappedBackend::LockLogFile(struct stat &fileStat) noexcept
+{
+    // the file may be replaced by compaction of other server between open and lock, check it's still the same one
+    for (auto i = 0U; i < LOG_LOCK_RETRY_TIMES; i++) {
+        fd_ = open(logPath_.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, S_IRUSR | S_IWUSR);
+        if (fd_ < 0) {
+            STORE_LOG_ERROR("open log file(" << logPath_ << ") failed, errno: " << errno);
+            return StoreErrorCode::IO_ERROR;
+        }
+
+        if (flock(fd_, LOCK_EX | LOCK_NB) != 0) {
+            auto lockErrno = errno;
+            close(fd_);
+            fd_ = -1;
+            if (lockErrno == EWOULDBLOCK) {
+                STORE_LOG_INFO("log file(" << logPath_ << ") is in use by other store server");
+                return StoreErrorCode::IN_USE;
+            }
+            STORE_LOG_ERROR("lock log file(" << logPath_ << ") failed, errno: " << lockErrno);
+            return StoreErrorCode::IO_ERROR;
+        }
+
+        struct stat pathStat {};
+        if (fstat(fd_, &fileStat) != 0 || stat(logPath_.c_str(), &pathStat) != 0) {
+            STORE_LOG_ERROR("stat log file(" << logPath_ << ") failed, errno: " << errno);
+            return StoreErrorCode::IO_ERROR;
+        }
+        if (fileStat.st_dev == pathStat.st_dev && fileStat.st_ino == pathStat.st_ino) {
+            return StoreErrorCode::SUCCESS;
+        }
+        close(fd_);
+        fd_ = -1;
+    }
+
+    STORE_LOG_ERROR("log file(" << logPath_ << ") keeps changing, lock failed");
+    return StoreErrorCode::IO_ERROR;
+}
+
+void SmemFileMappedBackend::CloseLog() noexcept
+{
+    if (mapped_ != nullptr) {
+        munmap(mapped_, mappedSize_);
+        mapped_ = nullptr;
+    }
+    if (fd_ >= 0) {
+        close(fd_);
+        fd_ = -1;
+    }
+    mappedSize_ = 0;
+    tail_ = 0;
+}
+
+StoreErrorCode SmemFileMappedBackend::Replay() noexcept
+{
+    // count records by headers only at first, avoid rehash of the map while loading
+    uint64_t recordCount = 0;
+    for (uint64_t offset = sizeof(LogFileHeader); offset + sizeof(LogRecordHeader) <= mappedSize_;) {
+        LogRecordHeader header{};
+        std::copy_n(mapped_ + offset, sizeof(header), reinterpret_cast<uint8_t *>(&header));
+        if (header.magic != LOG_RECORD_MAGIC || header.valueLen > mappedSize_) {
+            break;
+        }
+        offset += RecordSize(header.keyLen, header.valueLen);
+        recordCount++;
+    }
+    kvStore_.reserve(recordCount);
+
+    uint64_t offset = sizeof(LogFileHeader);
+    while (offset + sizeof(LogRecordHeader) <= mappedSize_) {
+        LogRecordHeader header{};
+        header.magic = __atomic_load_n(reinterpret_cast<const uint32_t *>(mapped_ + offset), __ATOMIC_ACQUIRE);
+        if (header.magic != LOG_RECORD_MAGIC) {
+            break;
+        }
+        std::copy_n(mapped_ + offset, sizeof(header), reinterpret_cast<uint8_t *>(&header));
+        auto size = RecordSize(header.keyLen, header.valueLen);
+        if (header.valueLen > mappedSize_ || offset + size > mappedSize_) {
+            STORE_LOG_WARN("log file(" << logPath_ << ") record at " << offset << " exceeds file, drop it");
+            break;
+        }
+
+        auto keyAddress = reinterpret_cast<const char *>(mapped_ + offset + sizeof(header));
+        auto valueAddress = mapped_ + offset + sizeof(header) + header.keyLen;
+        std::string key{keyAddress, header.keyLen};
+        auto iter = kvStore_.find(key);
+        switch (header.op) {
+            case LOG_OP_PUT:
+                if (iter != kvStore_.end()) {
+                    iter->second = StoreValue::Create(valueAddress, header.valueLen);
+                } else {
+                    kvStore_.emplace(std::move(key), StoreValue::Create(valueAddress, header.valueLen));
+                }
+                break;
+            case LOG_OP_APPEND:
+                if (iter != kvStore_.end()) {
+                    iter->second =
+                        iter->second->Append(std::vector<uint8_t>(valueAddress, valueAddress + header.valueLen));
+                } else {
+                    kvStore_.emplace(std::move(key), StoreValue::Create(valueAddress, header.valueLen));
+                }
+                break;
+            case LOG_OP_DELETE:
+                if (iter != kvStore_.end()) {
+                    kvStore_.erase(iter);
+                }
+                break;
+            default:
+                STORE_LOG_ERROR("log file(" << logPath_ << ") record at " << offset << " invalid op: "
+                                            << static_cast<uint32_t>(header.op));
+                return StoreErrorCode::IO_ERROR;
+        }
+        offset += size;
+    }
+
+    tail_ = offset;
+    liveBytes_ = 0;
+    for (auto &it : kvStore_) {
+        liveBytes_ += RecordSize(it.first.size(), it.second->Size());
+    }
+    return StoreErrorCode::SUCCESS;
+}
+
+StoreErrorCode SmemFileMappedBackend::ReserveLog(uint64_t size) noexcept
+{
+    // allocate blocks in advance, or writing to mapped pages gets SIGBUS when disk is full
+    auto ret = posix_fallocate(fd_, 0, static_cast<off_t>(size));
+    if (ret != 0) {
+        STORE_LOG_ERROR("allocate log file(" << logPath_ << ") size: " << size << " failed: " << ret);
+        return StoreErrorCode::IO_ERROR;
+    }
+    if (size == mappedSize_) {
+        return StoreErrorCode::SUCCESS;
+    }
+
+    auto mapped = mremap(mapped_, mappedSize_, size, MREMAP_MAYMOVE);
+    if (mapped == MAP_FAILED) {
+        STORE_LOG_ERROR("remap log file(" << logPath_ << ") size: " << size << " failed, errno: " << errno);
+        return StoreErrorCode::IO_ERROR;
+    }
+    mapped_ = static_cast<uint8_t *>(mapped);
+    mappedSize_ = size;
+    return StoreErrorCode::SUCCESS;
+}
+
+StoreErrorCode SmemFileMappedBackend::AppendRecord(LogOp op, const std::string &key, uint64_t valueLen,
+                                                   const ValueWriter &writer) noexcept
+{
+    STORE_VALIDATE_RETURN(fd_ >= 0, "backend not initialized", StoreErrorCode::ERROR);
+    STORE_VALIDATE_RETURN(key.size() <= UINT32_MAX, "key too long: " << key.size(), StoreErrorCode::INVALID_KEY);
+
+    auto size = RecordSize(key.size(), valueLen);
+    if (tail_ + size > mappedSize_) {
+        auto ret = ReserveLog(std::max(mappedSize_ * 2UL, tail_ + size));
+        if (ret != StoreErrorCode::SUCCESS) {
+            return ret;
+        }
+    }
+
+    tail_ += WriteRecord(mapped_ + tail_, op, key, valueLen, writer);
+    return StoreErrorCode::SUCCESS;
+}
+
+void SmemFileMappedBackend::CompactIfNeeded() noexcept
+{
+    if (tail_ < compactCheckSize_ || tail_ <= (sizeof(LogFileHeader) + liveBytes_) * 2UL) {
+        return;
+    }
+
+    auto ret = Compact();
+    if (ret != StoreErrorCode::SUCCESS) {
+        compactCheckSize_ = tail_ * 2UL;
+        STORE_LOG_WARN("compact log file(" << logPath_ << ") failed: " << ret << ", retry when log size reach "
+                                           << compactCheckSize_);
+        return;
+    }
+    compactCheckSize_ = LOG_COMPACT_MIN_SIZE;
+}
+
+void SmemFileMappedBackend::CollectExpired() noexcept
+{
+    (void)expiry_.Collect([this](const std::string &key) {
+        auto ret = EraseKey(key);
+        if (ret != StoreErrorCode::SUCCESS && ret != StoreErrorCode::NOT_EXIST) {
+            STORE_LOG_WARN("erase expired key(" << key << ") failed: " << ret);
+        }
+    });
+}
+
+} // namespace smem
+} // namespace ock
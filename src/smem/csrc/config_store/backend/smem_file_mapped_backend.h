@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025-2025. All rights reserved.
+ * MemFabric_Hybrid is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *          http://license.coscl.org.cn/MulanPSL2
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+*/
+
+#ifndef SMEM_FILE_MAPPED_CONFIG_STORE_BACKEND_H
+#define SMEM_FILE_MAPPED_CONFIG_STORE_BACKEND_H
+
+#include <sys/stat.h>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "smem_config_store_backend.h"
+#include "smem_config_store_expiry.h"
+
+namespace ock {
+namespace smem {
+
+/**
+ * @brief Durable implementation of ConfigStoreBackend, for warm restart of store server
+ *
+ * Key space is kept in memory as local memory backend does, and every modification is appended as a record
+ * into a memory-mapped log file. Initialize replays the log, so a restarted store server serves the same key
+ * space again. The log is rewritten with live keys only when it grows beyond twice of the live data.
+ *
+ * A record becomes valid only after its magic is written, so a record torn by process crash is dropped on
+ * replay. Records are not flushed to disk synchronously, data survives process restart but not power loss.
+ * The log file is locked exclusively, only one store server can use it at the same time.
+ * Time-to-live of keys is kept in memory only, keys reloaded after restart never expire. Expired keys are
+ * logged as deleted when collected.
+ */
+class SmemFileMappedBackend final : public ConfigStoreBackend {
+public:
+    SmemFileMappedBackend() noexcept;
+    ~SmemFileMappedBackend() noexcept override;
+
+    SmemFileMappedBackend(const SmemFileMappedBackend &) = delete;
+    SmemFileMappedBackend &operator=(const SmemFileMappedBackend &) = delete;
+    SmemFileMappedBackend(SmemFileMappedBackend &&) = delete;
+    SmemFileMappedBackend &operator=(SmemFileMappedBackend &&) = delete;
+
+    /**
+     * @brief Open or create the log file and reload key space from it
+     *
+     * @param backendUrl  [in] path of log file
+     */
+    [[nodiscard]] StoreErrorCode Initialize(const std::string &backendUrl, const std::string &userName,
+                                            const std::string &password) override;
+
+    [[nodiscard]] std::string BackendName() const noexcept override;
+
+    [[nodiscard]] StoreErrorCode Get(const std::string &key, std::vector<uint8_t> &outValue) const noexcept override;
+
+    [[nodiscard]] StoreErrorCode Put(const std::string &key, const std::vector<uint8_t> &value,
+                                     int64_t ttlSeconds) noexcept override;
+
+    [[nodiscard]] StoreErrorCode GetValue(const std::string &key, StoreValuePtr &outValue) const noexcept override;
+
+    [[nodiscard]] StoreErrorCode PutValue(const std::string &key, StoreValuePtr value,
+                                          int64_t ttlSeconds) noexcept override;
+
+    [[nodiscard]] StoreErrorCode AppendValue(const std::string &key, std::vector<uint8_t> &&data,
+                                             StoreValuePtr &newValue) noexcept override;
+
+    [[nodiscard]] StoreErrorCode Delete(const std::string &key) noexcept override;
+
+    [[nodiscard]] StoreErrorCode Expire(const std::string &key, int64_t ttlSeconds) noexcept override;
+
+    [[nodiscard]] StoreErrorCode Exist(const std::string &key) const noexcept override;
+
+    void Clear() noexcept override;
+
+    uint64_t DeletePrefix(const std::string &prefix) noexcept override;
+
+    [[nodiscard]] bool IsDistributed() const noexcept override;
+
+    [[nodiscard]] bool SupportsTTL() const noexcept override;
+
+    [[nodiscard]] bool IsPersistent() const noexcept override;
+
+    [[nodiscard]] StoreErrorCode AcquireDistributedLock(const std::string &name) noexcept override;
+
+    [[nodiscard]] StoreErrorCode ReleaseDistributedLock(const std::string &name) noexcept override;
+
+    [[nodiscard]] StoreErrorCode TryAcquireDistributedLock(const std::string &name,
+                                                           int64_t timeoutMs) noexcept override;
+
+    void UnInitialize() override;
+
+    /**
+     * @brief Rewrite the log with live keys only
+     */
+    StoreErrorCode Compact() noexcept;
+
+    uint64_t LogSize() const noexcept
+    {
+        return tail_;
+    }
+
+private:
+    enum LogOp : uint8_t {
+        LOG_OP_PUT = 1,
+        LOG_OP_APPEND = 2,
+        LOG_OP_DELETE = 3,
+    };
+
+    struct LogFileHeader {
+        uint64_t magic;
+        uint32_t version;
+        uint32_t reserved;
+    };
+
+    struct LogRecordHeader {
+        uint32_t magic;
+        uint8_t op;
+        uint8_t reserved[3];
+        uint32_t keyLen;
+        uint32_t reserved2;
+        uint64_t valueLen;
+    };
+
+    using ValueWriter = std::function<void(uint8_t *)>;
+
+    static uint64_t RecordSize(uint64_t keyLen, uint64_t valueLen) noexcept;
+    static StoreErrorCode MapLogFile(int fd, uint64_t size, uint8_t *&address) noexcept;
+    static uint64_t WriteRecord(uint8_t *address, LogOp op, const std::string &key, uint64_t valueLen,
+                                const ValueWriter &writer) noexcept;
+    static void WriteValue(uint8_t *address, const StoreValue &value) noexcept;
+
+    StoreErrorCode OpenLog() noexcept;
+    StoreErrorCode LockLogFile(struct stat &fileStat) noexcept;
+    void CloseLog() noexcept;
+    StoreErrorCode Replay() noexcept;
+    StoreErrorCode EraseKey(const std::string &key) noexcept;
+    void CollectExpired() noexcept;
+    StoreErrorCode ReserveLog(uint64_t size) noexcept;
+    StoreErrorCode AppendRecord(LogOp op, const std::string &key, uint64_t valueLen,
+                                const ValueWriter &writer) noexcept;
+    void CompactIfNeeded() noexcept;
+
+private:
+    static constexpr uint64_t LOG_FILE_MAGIC = 0x474F4C45524F5453UL; /* "STORELOG" */
+    static constexpr uint32_t LOG_FILE_VERSION = 1U;
+    static constexpr uint32_t LOG_RECORD_MAGIC = 0x4D454D53U; /* "SMEM" */
+    static constexpr uint64_t LOG_RECORD_ALIGN = 8UL;
+    static constexpr uint64_t LOG_INIT_SIZE = 4UL * 1024UL * 1024UL;
+    static constexpr uint64_t LOG_COMPACT_MIN_SIZE = 64UL * 1024UL * 1024UL;
+    static constexpr uint32_t LOG_LOCK_RETRY_TIMES = 3U;
+
+    std::unordered_map<std::string, StoreValuePtr> kvStore_;
+    StoreKeyExpiry expiry_;
+    std::string logPath_;
+    int fd_{-1};
+    uint8_t *mapped_{nullptr};
+    uint64_t mappedSize_{0};
+    uint64_t tail_{0};
+    uint64_t liveBytes_{0};
+    uint64_t compactCheckSize_{LOG_COMPACT_MIN_SIZE};
+};
+using FileMappedBackendPtr = SmRef<SmemFileMappedBackend>;
+} // namespace smem
+} // namespace ock
+#endif // SMEM_FILE_MAPPED_CONFIG_STORE_BACKEND_H
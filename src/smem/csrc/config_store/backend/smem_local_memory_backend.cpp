@@ -38,29 +38,79 @@ std::string SmemLocalMemoryBackend::BackendName() const noexcept
 StoreErrorCode SmemLocalMemoryBackend::Get(const std::string &key, std::vector<uint8_t> &outValue) const noexcept
 {
     auto iter = kvStore_.find(key);
-    if (iter == kvStore_.end()) {
+    if (iter == kvStore_.end() || expiry_.Expired(key)) {
         return StoreErrorCode::NOT_EXIST;
     }
-    outValue = iter->second;
+    iter->second->CopyTo(outValue);
     return StoreErrorCode::SUCCESS;
 }
 
 StoreErrorCode SmemLocalMemoryBackend::Put(const std::string &key, const std::vector<uint8_t> &value,
                                            int64_t ttlSeconds) noexcept
 {
-    (void)ttlSeconds; // TTL not supported in local memory backend
-    kvStore_[key] = value;
+    return PutValue(key, StoreValue::Create(value), ttlSeconds);
+}
+
+StoreErrorCode SmemLocalMemoryBackend::GetValue(const std::string &key, StoreValuePtr &outValue) const noexcept
+{
+    auto iter = kvStore_.find(key);
+    if (iter == kvStore_.end() || expiry_.Expired(key)) {
+        return StoreErrorCode::NOT_EXIST;
+    }
+    outValue = iter->second;
+    return StoreErrorCode::SUCCESS;
+}
+
+StoreErrorCode SmemLocalMemoryBackend::PutValue(const std::string &key, StoreValuePtr value,
+                                                int64_t ttlSeconds) noexcept
+{
+    if (value == nullptr) {
+        return StoreErrorCode::ERROR;
+    }
+    CollectExpired();
+    kvStore_[key] = std::move(value);
+    expiry_.Set(key, ttlSeconds);
+    return StoreErrorCode::SUCCESS;
+}
+
+StoreErrorCode SmemLocalMemoryBackend::AppendValue(const std::string &key, std::vector<uint8_t> &&data,
+                                                   StoreValuePtr &newValue) noexcept
+{
+    CollectExpired();
+    auto iter = kvStore_.find(key);
+    if (iter == kvStore_.end()) {
+        newValue = StoreValue::Create(std::move(data));
+        kvStore_.emplace(key, newValue);
+        return StoreErrorCode::SUCCESS;
+    }
+    newValue = iter->second->Append(std::move(data));
+    iter->second = newValue;
     return StoreErrorCode::SUCCESS;
 }
 
 StoreErrorCode SmemLocalMemoryBackend::Delete(const std::string &key) noexcept
 {
+    CollectExpired();
     auto erased = kvStore_.erase(key);
+    expiry_.Remove(key);
     return erased > 0 ? StoreErrorCode::SUCCESS : StoreErrorCode::NOT_EXIST;
 }
 
+StoreErrorCode SmemLocalMemoryBackend::Expire(const std::string &key, int64_t ttlSeconds) noexcept
+{
+    CollectExpired();
+    if (kvStore_.find(key) == kvStore_.end()) {
+        return StoreErrorCode::NOT_EXIST;
+    }
+    expiry_.Set(key, ttlSeconds);
+    return StoreErrorCode::SUCCESS;
+}
+
 StoreErrorCode SmemLocalMemoryBackend::Exist(const std::string &key) const noexcept
 {
+    if (expiry_.Expired(key)) {
+        return StoreErrorCode::NOT_EXIST;
+    }
     return kvStore_.find(key) != kvStore_.end() ? StoreErrorCode::SUCCESS : StoreErrorCode::NOT_EXIST;
 }
 
@@ -70,6 +120,11 @@ bool SmemLocalMemoryBackend::IsDistributed() const noexcept
 }
 
 bool SmemLocalMemoryBackend::SupportsTTL() const noexcept
+{
+    return true;
+}
+
+bool SmemLocalMemoryBackend::IsPersistent() const noexcept
 {
     return false;
 }
@@ -97,6 +152,27 @@ void SmemLocalMemoryBackend::UnInitialize() {}
 void SmemLocalMemoryBackend::Clear() noexcept
 {
     kvStore_.clear();
+    expiry_.Clear();
+}
+
+uint64_t SmemLocalMemoryBackend::DeletePrefix(const std::string &prefix) noexcept
+{
+    uint64_t count = 0;
+    for (auto it = kvStore_.begin(); it != kvStore_.end();) {
+        if (it->first.compare(0, prefix.size(), prefix) == 0) {
+            expiry_.Remove(it->first);
+            it = kvStore_.erase(it);
+            count++;
+        } else {
+            ++it;
+        }
+    }
+    return count;
+}
+
+void SmemLocalMemoryBackend::CollectExpired() noexcept
+{
+    (void)expiry_.Collect([this](const std::string &key) { kvStore_.erase(key); });
 }
 
 } // namespace smem
@@ -21,6 +21,7 @@
 #include <vector>
 
 #include "smem_config_store_backend.h"
+#include "smem_config_store_expiry.h"
 
 namespace ock {
 namespace smem {
@@ -46,16 +47,30 @@ public:
     [[nodiscard]] StoreErrorCode Put(const std::string &key, const std::vector<uint8_t> &value,
                                      int64_t ttlSeconds) noexcept override;
 
+    [[nodiscard]] StoreErrorCode GetValue(const std::string &key, StoreValuePtr &outValue) const noexcept override;
+
+    [[nodiscard]] StoreErrorCode PutValue(const std::string &key, StoreValuePtr value,
+                                          int64_t ttlSeconds) noexcept override;
+
+    [[nodiscard]] StoreErrorCode AppendValue(const std::string &key, std::vector<uint8_t> &&data,
+                                             StoreValuePtr &newValue) noexcept override;
+
     [[nodiscard]] StoreErrorCode Delete(const std::string &key) noexcept override;
 
+    [[nodiscard]] StoreErrorCode Expire(const std::string &key, int64_t ttlSeconds) noexcept override;
+
     [[nodiscard]] StoreErrorCode Exist(const std::string &key) const noexcept override;
 
     void Clear() noexcept override;
 
+    uint64_t DeletePrefix(const std::string &prefix) noexcept override;
+
     [[nodiscard]] bool IsDistributed() const noexcept override;
 
     [[nodiscard]] bool SupportsTTL() const noexcept override;
 
+    [[nodiscard]] bool IsPersistent() const noexcept override;
+
     [[nodiscard]] StoreErrorCode AcquireDistributedLock(const std::string &name) noexcept override;
 
     [[nodiscard]] StoreErrorCode ReleaseDistributedLock(const std::string &name) noexcept override;
@@ -66,7 +81,11 @@ public:
     void UnInitialize() override;
 
 private:
-    std::unordered_map<std::string, std::vector<uint8_t>> kvStore_;
+    void CollectExpired() noexcept;
+
+private:
+    std::unordered_map<std::string, StoreValuePtr> kvStore_;
+    StoreKeyExpiry expiry_;
 };
 using LocalMemoryBackendPtr = SmRef<SmemLocalMemoryBackend>;
 } // namespace smem
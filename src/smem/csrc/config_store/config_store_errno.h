@@ -25,8 +25,10 @@ enum StoreErrorCode : int16_t {
     INVALID_KEY = -401,
     NOT_EXIST = -404,
     RESTORE = -405,
+    VALUE_TOO_LARGE = -413,
     TIMEOUT = -601,
-    IO_ERROR = -602
+    IO_ERROR = -602,
+    IN_USE = -603
 };
 
 } // namespace smem
@@ -123,6 +123,68 @@ Result HaConfigStore::Write(const std::string &key, const std::vector<uint8_t> &
     return clientDelegate_->Write(key, value, offset);
 }
 
+Result HaConfigStore::Barrier(const std::string &key, uint32_t size, int64_t timeoutMs) noexcept
+{
+    std::shared_lock<std::shared_mutex> lock(delegateRwLock_);
+    STORE_ASSERT_RETURN(clientDelegate_ != nullptr, SM_ERROR);
+    return clientDelegate_->Barrier(key, size, timeoutMs);
+}
+
+Result HaConfigStore::GetRange(const std::string &key, uint64_t offset, uint64_t length,
+                               std::vector<uint8_t> &value, uint64_t &totalSize) noexcept
+{
+    std::shared_lock<std::shared_mutex> lock(delegateRwLock_);
+    STORE_ASSERT_RETURN(clientDelegate_ != nullptr, SM_ERROR);
+    return clientDelegate_->GetRange(key, offset, length, value, totalSize);
+}
+
+Result HaConfigStore::BitmapAlloc(const std::string &key, uint32_t bitCount, uint32_t &index) noexcept
+{
+    std::shared_lock<std::shared_mutex> lock(delegateRwLock_);
+    STORE_ASSERT_RETURN(clientDelegate_ != nullptr, SM_ERROR);
+    return clientDelegate_->BitmapAlloc(key, bitCount, index);
+}
+
+Result HaConfigStore::BitmapRelease(const std::string &key, uint32_t index) noexcept
+{
+    std::shared_lock<std::shared_mutex> lock(delegateRwLock_);
+    STORE_ASSERT_RETURN(clientDelegate_ != nullptr, SM_ERROR);
+    return clientDelegate_->BitmapRelease(key, index);
+}
+
+Result HaConfigStore::SetAsync(const std::string &key, const std::vector<uint8_t> &value,
+                               const ConfigStoreSetCallback &callback) noexcept
+{
+    std::shared_lock<std::shared_mutex> lock(delegateRwLock_);
+    STORE_ASSERT_RETURN(clientDelegate_ != nullptr, SM_ERROR);
+    return clientDelegate_->SetAsync(key, value, callback);
+}
+
+Result HaConfigStore::GetAsync(const std::string &key, int64_t timeoutMs,
+                               const ConfigStoreGetCallback &callback) noexcept
+{
+    std::shared_lock<std::shared_mutex> lock(delegateRwLock_);
+    STORE_ASSERT_RETURN(clientDelegate_ != nullptr, SM_ERROR);
+    return clientDelegate_->GetAsync(key, timeoutMs, callback);
+}
+
+Result HaConfigStore::AddAsync(const std::string &key, int64_t increment,
+                               const ConfigStoreAddCallback &callback) noexcept
+{
+    std::shared_lock<std::shared_mutex> lock(delegateRwLock_);
+    STORE_ASSERT_RETURN(clientDelegate_ != nullptr, SM_ERROR);
+    return clientDelegate_->AddAsync(key, increment, callback);
+}
+
+Result HaConfigStore::SetWithTTLAsync(const std::string &key, const std::vector<uint8_t> &value, int64_t ttlSeconds,
+                                      const std::vector<std::string> &expireKeys,
+                                      const ConfigStoreSetCallback &callback) noexcept
+{
+    std::shared_lock<std::shared_mutex> lock(delegateRwLock_);
+    STORE_ASSERT_RETURN(clientDelegate_ != nullptr, SM_ERROR);
+    return clientDelegate_->SetWithTTLAsync(key, value, ttlSeconds, expireKeys, callback);
+}
+
 std::string HaConfigStore::GetCompleteKey(const std::string &key) noexcept
 {
     std::shared_lock<std::shared_mutex> lock(delegateRwLock_);
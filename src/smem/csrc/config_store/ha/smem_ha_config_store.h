@@ -45,6 +45,18 @@ public:
                  uint32_t &wid) noexcept override;
     Result Unwatch(uint32_t wid) noexcept override;
     Result Write(const std::string &key, const std::vector<uint8_t> &value, const uint32_t offset) noexcept override;
+    Result Barrier(const std::string &key, uint32_t size, int64_t timeoutMs) noexcept override;
+    Result GetRange(const std::string &key, uint64_t offset, uint64_t length, std::vector<uint8_t> &value,
+                    uint64_t &totalSize) noexcept override;
+    Result BitmapAlloc(const std::string &key, uint32_t bitCount, uint32_t &index) noexcept override;
+    Result BitmapRelease(const std::string &key, uint32_t index) noexcept override;
+    Result SetAsync(const std::string &key, const std::vector<uint8_t> &value,
+                    const ConfigStoreSetCallback &callback) noexcept override;
+    Result GetAsync(const std::string &key, int64_t timeoutMs, const ConfigStoreGetCallback &callback) noexcept override;
+    Result AddAsync(const std::string &key, int64_t increment, const ConfigStoreAddCallback &callback) noexcept override;
+    Result SetWithTTLAsync(const std::string &key, const std::vector<uint8_t> &value, int64_t ttlSeconds,
+                           const std::vector<std::string> &expireKeys,
+                           const ConfigStoreSetCallback &callback) noexcept override;
 
     std::string GetCompleteKey(const std::string &key) noexcept override;
     std::string GetCommonPrefix() noexcept override;
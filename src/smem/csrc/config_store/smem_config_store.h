@@ -18,6 +18,8 @@
 #include <string>
 #include <unordered_map>
 #include <memory>
+#include <mutex>
+#include <condition_variable>
 #include <functional>
 
 #include "smem_types.h"
@@ -41,6 +43,10 @@ using ConfigStoreServerOpHandler =
     std::function<int32_t(const uint32_t, const std::string &, std::vector<uint8_t> &, const StoreBackendPtr &)>;
 using ConfigStoreServerBrokenHandler = std::function<void(const uint32_t, StoreBackendPtr &)>;
 
+using ConfigStoreSetCallback = std::function<void(Result result)>;
+using ConfigStoreGetCallback = std::function<void(Result result, std::vector<uint8_t> &value)>;
+using ConfigStoreAddCallback = std::function<void(Result result, int64_t value)>;
+
 class ConfigStore : public SmReferable {
 public:
     ~ConfigStore() override = default;
@@ -121,7 +127,8 @@ public:
     Result Append(const std::string &key, const std::string &value, uint64_t &newSize) noexcept;
 
     /**
-     * @brief Append char/int8 vector to a key with char/int8 value
+     * @brief Append char/int8 vector to a key with char/int8 value, a vector larger than one message is streamed
+     * in chunks and appended at once when all chunks arrived
      *
      * @param key          [in] key to be appended
      * @param value        [in] value to be appended
@@ -207,6 +214,108 @@ public:
      */
     virtual Result Write(const std::string &key, const std::vector<uint8_t> &value, const uint32_t offset) noexcept = 0;
 
+    /**
+     * @brief Wait until size callers arrive at the barrier of key, counted and released by server in one round trip
+     *
+     * @param key          [in] barrier key, unique for each round, separated from keys of values
+     * @param size         [in] count of callers expected, same for all callers
+     * @param timeoutMs    [in] timeout, -1 means wait forever
+     * @return 0 if all callers arrived, TIMEOUT if not within timeout
+     */
+    virtual Result Barrier(const std::string &key, uint32_t size, int64_t timeoutMs) noexcept = 0;
+
+    /**
+     * @brief Get part of a value, values larger than one message are got in chunks of ranges
+     *
+     * @param key          [in] key to be got
+     * @param offset       [in] offset of the first byte to get, no more than size of value
+     * @param length       [in] count of bytes to get, at most the chunk size of the store, VALUE_CHUNK_SIZE by default
+     * @param value        [out] bytes got, shorter than length at the end of value
+     * @param totalSize    [out] size of the whole value
+     * @return 0 if successfully done, NOT_EXIST if key not exists
+     */
+    virtual Result GetRange(const std::string &key, uint64_t offset, uint64_t length, std::vector<uint8_t> &value,
+                            uint64_t &totalSize) noexcept = 0;
+
+    /**
+     * @brief Allocate the lowest free bit of bitmap in key, searched and set by server in one round trip
+     *
+     * @param key          [in] bitmap key, bit i is bit (i % 8) of byte (i / 8), created if not exist
+     * @param bitCount     [in] count of bits in bitmap
+     * @param index        [out] index of the bit allocated
+     * @return 0 if allocated, IN_USE if all bits are allocated
+     */
+    virtual Result BitmapAlloc(const std::string &key, uint32_t bitCount, uint32_t &index) noexcept = 0;
+
+    /**
+     * @brief Release bit of bitmap in key allocated by BitmapAlloc
+     *
+     * @param key          [in] bitmap key
+     * @param index        [in] index of the bit to release
+     * @return 0 if released, NOT_EXIST if the bit is free already
+     */
+    virtual Result BitmapRelease(const std::string &key, uint32_t index) noexcept = 0;
+
+    /**
+     * @brief Set vector value without waiting for response, many requests can be in flight on one link
+     *
+     * @param key          [in] key to be set
+     * @param value        [in] value to be set
+     * @param callback     [in] invoked once with result, when response received or link broken
+     * @return 0 if request sent, callback will not be invoked if non-zero returned
+     */
+    virtual Result SetAsync(const std::string &key, const std::vector<uint8_t> &value,
+                            const ConfigStoreSetCallback &callback) noexcept = 0;
+
+    /**
+     * @brief Get vector value with key without waiting for response
+     *
+     * @param key          [in] key to be got
+     * @param timeoutMs    [in] timeout
+     * @param callback     [in] invoked once with result and value, when response received or link broken
+     * @return 0 if request sent, callback will not be invoked if non-zero returned
+     */
+    virtual Result GetAsync(const std::string &key, int64_t timeoutMs,
+                            const ConfigStoreGetCallback &callback) noexcept = 0;
+
+    /**
+     * @brief Add integer value without waiting for response
+     *
+     * @param key          [in] key to be increased
+     * @param increment    [in] value to be increased
+     * @param callback     [in] invoked once with result and value after increased, when response received or link
+     *                          broken
+     * @return 0 if request sent, callback will not be invoked if non-zero returned
+     */
+    virtual Result AddAsync(const std::string &key, int64_t increment,
+                            const ConfigStoreAddCallback &callback) noexcept = 0;
+
+    /**
+     * @brief Set vector value with time-to-live without waiting for response, key is removed by server when expired
+     *
+     * @param key          [in] key to be set
+     * @param value        [in] value to be set
+     * @param ttlSeconds   [in] time-to-live in seconds of key and expireKeys, 0 means never expire
+     * @param expireKeys   [in] other existing keys to be expired after the same time, at most MAX_KEY_COUNT - 1
+     * @param callback     [in] invoked once with result, when response received or link broken
+     * @return 0 if request sent, callback will not be invoked if non-zero returned
+     */
+    virtual Result SetWithTTLAsync(const std::string &key, const std::vector<uint8_t> &value, int64_t ttlSeconds,
+                                   const std::vector<std::string> &expireKeys,
+                                   const ConfigStoreSetCallback &callback) noexcept = 0;
+
+    /**
+     * @brief Set vector value with time-to-live, key is removed by server when expired
+     *
+     * @param key          [in] key to be set
+     * @param value        [in] value to be set
+     * @param ttlSeconds   [in] time-to-live in seconds of key and expireKeys, 0 means never expire
+     * @param expireKeys   [in] other existing keys to be expired after the same time
+     * @return 0 if successfully done
+     */
+    Result SetWithTTL(const std::string &key, const std::vector<uint8_t> &value, int64_t ttlSeconds,
+                      const std::vector<std::string> &expireKeys = {}) noexcept;
+
     /**
      * @brief Get error string by code
      *
@@ -227,6 +336,64 @@ protected:
 };
 using StorePtr = SmRef<ConfigStore>;
 
+/**
+ * @brief Wait for a batch of asynchronous requests of config store to be finished
+ *
+ * Call Begin before each request sent, and Finish in its callback, or directly if the request is not sent.
+ * Callbacks are invoked in the receiving thread of store client, they should not block or wait.
+ */
+class ConfigStoreAsyncWaiter {
+public:
+    void Begin() noexcept
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        pending_++;
+    }
+
+    void Finish(Result result) noexcept
+    {
+        // notify under lock, waiter may be destroyed as soon as the lock released
+        std::lock_guard<std::mutex> guard(mutex_);
+        if (result != SM_OK && result_ == SM_OK) {
+            result_ = result;
+        }
+        if (--pending_ == 0) {
+            cond_.notify_all();
+        }
+    }
+
+    /**
+     * @brief Wait for all requests finished
+     * @return 0 if all requests succeed, or result of the first failed one
+     */
+    Result Wait() noexcept
+    {
+        std::unique_lock<std::mutex> locker(mutex_);
+        cond_.wait(locker, [this]() { return pending_ == 0; });
+        return result_;
+    }
+
+private:
+    std::mutex mutex_;
+    std::condition_variable cond_;
+    uint32_t pending_{0};
+    Result result_{SM_OK};
+};
+
+inline Result ConfigStore::SetWithTTL(const std::string &key, const std::vector<uint8_t> &value, int64_t ttlSeconds,
+                                      const std::vector<std::string> &expireKeys) noexcept
+{
+    ConfigStoreAsyncWaiter waiter;
+    waiter.Begin();
+    auto ret = SetWithTTLAsync(key, value, ttlSeconds, expireKeys, [&waiter](Result result) {
+        waiter.Finish(result);
+    });
+    if (ret != SM_OK) {
+        return ret;
+    }
+    return waiter.Wait();
+}
+
 class ConfigStoreManager : public ConfigStore {
 public:
     ~ConfigStoreManager() override = default;
@@ -360,6 +527,8 @@ inline const char *ConfigStore::ErrStr(int16_t errCode)
             return "socket error";
         case RESTORE:
             return "restore";
+        case VALUE_TOO_LARGE:
+            return "value too large for one message";
         default:
             return "unknown error";
     }
@@ -14,6 +14,7 @@
 #include "smem_tcp_config_store.h"
 #include "smem_prefix_config_store.h"
 #include "smem_local_memory_backend.h"
+#include "smem_file_mapped_backend.h"
 #include "smem_store_factory.h"
 
 namespace ock {
@@ -22,6 +23,7 @@ static __thread int failedReason_ = 0;
 std::mutex StoreFactory::storesMutex_;
 std::unordered_map<std::string, StorePtr> StoreFactory::storesMap_;
 smem_tls_config StoreFactory::tlsOption_{};
+std::string StoreFactory::persistDir_;
 
 StorePtr StoreFactory::CreateStore(const std::string &ip, uint16_t port, bool isServer, uint32_t worldSize,
                                    int32_t rankId, int32_t connMaxRetry) noexcept
@@ -33,11 +35,11 @@ StorePtr StoreFactory::CreateStore(const std::string &ip, uint16_t port, bool is
     if (pos != storesMap_.end()) {
         return pos->second;
     }
-    auto storeBackendPtr = SmMakeRef<SmemLocalMemoryBackend>();
-    STORE_ASSERT_RETURN(storeBackendPtr != nullptr, nullptr);
-    STORE_ASSERT_RETURN(storeBackendPtr->Initialize(ip, "", "") == SUCCESS, nullptr);
-    auto store = SmMakeRef<TcpConfigStore>(Convert<SmemLocalMemoryBackend, ConfigStoreBackend>(storeBackendPtr), ip,
-                                           port, isServer, worldSize, rankId);
+    auto storeBackendPtr = CreateBackend(port, isServer);
+    if (storeBackendPtr == nullptr) {
+        return nullptr;
+    }
+    auto store = SmMakeRef<TcpConfigStore>(storeBackendPtr, ip, port, isServer, worldSize, rankId);
     STORE_ASSERT_RETURN(store != nullptr, nullptr);
 
     auto ret = store->Startup(tlsOption_, connMaxRetry);
@@ -70,11 +72,11 @@ StorePtr StoreFactory::CreateStoreServer(const std::string &ip, uint16_t port, u
     if (pos != storesMap_.end()) {
         return pos->second;
     }
-    auto storeBackendPtr = SmMakeRef<SmemLocalMemoryBackend>();
-    STORE_ASSERT_RETURN(storeBackendPtr != nullptr, nullptr);
-    STORE_ASSERT_RETURN(storeBackendPtr->Initialize(ip, "", "") == SUCCESS, nullptr);
-    auto store = SmMakeRef<TcpConfigStore>(Convert<SmemLocalMemoryBackend, ConfigStoreBackend>(storeBackendPtr), ip,
-                                           port, true, worldSize, rankId);
+    auto storeBackendPtr = CreateBackend(port, true);
+    if (storeBackendPtr == nullptr) {
+        return nullptr;
+    }
+    auto store = SmMakeRef<TcpConfigStore>(storeBackendPtr, ip, port, true, worldSize, rankId);
     STORE_ASSERT_RETURN(store != nullptr, nullptr);
 
     auto ret = store->ServerStart(tlsOption_, connMaxRetry);
@@ -107,11 +109,11 @@ StorePtr StoreFactory::CreateStoreClient(const std::string &ip, uint16_t port, u
     if (pos != storesMap_.end()) {
         return pos->second;
     }
-    auto storeBackendPtr = SmMakeRef<SmemLocalMemoryBackend>();
-    STORE_ASSERT_RETURN(storeBackendPtr != nullptr, nullptr);
-    STORE_ASSERT_RETURN(storeBackendPtr->Initialize(ip, "", "") == SUCCESS, nullptr);
-    auto store = SmMakeRef<TcpConfigStore>(Convert<SmemLocalMemoryBackend, ConfigStoreBackend>(storeBackendPtr), ip,
-                                           port, false, worldSize, rankId);
+    auto storeBackendPtr = CreateBackend(port, false);
+    if (storeBackendPtr == nullptr) {
+        return nullptr;
+    }
+    auto store = SmMakeRef<TcpConfigStore>(storeBackendPtr, ip, port, false, worldSize, rankId);
     STORE_ASSERT_RETURN(store != nullptr, nullptr);
 
     auto ret = store->ClientStart(tlsOption_, connMaxRetry);
@@ -170,5 +172,46 @@ void StoreFactory::SetTlsInfo(const smem_tls_config &tlsOption) noexcept
     tlsOption_ = tlsOption;
 }
 
+void StoreFactory::SetPersistDir(const std::string &dir) noexcept
+{
+    std::unique_lock<std::mutex> lockGuard{storesMutex_};
+    persistDir_ = dir;
+}
+
+StoreBackendPtr StoreFactory::CreateBackend(uint16_t port, bool isServer) noexcept
+{
+    // only server side keeps the key space, client side backend is never used
+    if (!isServer || persistDir_.empty()) {
+        auto localBackend = SmMakeRef<SmemLocalMemoryBackend>();
+        if (localBackend == nullptr) {
+            STORE_LOG_ERROR("create local memory backend failed");
+            failedReason_ = SM_NEW_OBJECT_FAILED;
+            return nullptr;
+        }
+        STORE_ASSERT_RETURN(localBackend->Initialize("", "", "") == SUCCESS, nullptr);
+        return Convert<SmemLocalMemoryBackend, ConfigStoreBackend>(localBackend);
+    }
+
+    auto logPath = persistDir_ + "/config_store_" + std::to_string(port) + ".log";
+    auto fileBackend = SmMakeRef<SmemFileMappedBackend>();
+    if (fileBackend == nullptr) {
+        STORE_LOG_ERROR("create file mapped backend failed");
+        failedReason_ = SM_NEW_OBJECT_FAILED;
+        return nullptr;
+    }
+    auto ret = fileBackend->Initialize(logPath, "", "");
+    if (ret == IN_USE) {
+        STORE_LOG_INFO("persist file: " << logPath << " in use by other store server");
+        failedReason_ = SM_RESOURCE_IN_USE;
+        return nullptr;
+    }
+    if (ret != SUCCESS) {
+        STORE_LOG_ERROR("initialize persist backend with file: " << logPath << " failed: " << ret);
+        failedReason_ = ret;
+        return nullptr;
+    }
+    return Convert<SmemFileMappedBackend, ConfigStoreBackend>(fileBackend);
+}
+
 } // namespace smem
 } // namespace ock
\ No newline at end of file
@@ -19,6 +19,7 @@
 
 #include "smem_bm_def.h"
 #include "smem_config_store.h"
+#include "smem_config_store_backend.h"
 
 namespace ock {
 namespace smem {
@@ -63,6 +64,15 @@ public:
 
     static void SetTlsInfo(const smem_tls_config &tlsOption) noexcept;
 
+    /**
+     * @brief Set directory to persist key space of store server, empty means keeping in memory only
+     * @param dir directory of log files, one file for each server port
+     */
+    static void SetPersistDir(const std::string &dir) noexcept;
+
+private:
+    static StoreBackendPtr CreateBackend(uint16_t port, bool isServer) noexcept;
+
 private:
     static std::mutex storesMutex_;
     static std::unordered_map<std::string, StorePtr> storesMap_;
@@ -71,6 +81,7 @@ private:
     static std::string tlsInfo;
     static std::string tlsPkInfo;
     static std::string tlsPkPwdInfo;
+    static std::string persistDir_;
 };
 } // namespace smem
 } // namespace ock
@@ -46,6 +46,25 @@ std::vector<uint8_t> SmemMessagePacker::Pack(const SmemMessage &message) noexcep
     return result;
 }
 
+std::vector<uint8_t> SmemMessagePacker::PackValuePrefix(MessageType mt, uint64_t valueSize, int64_t userDef,
+                                                        const std::vector<uint8_t> &head) noexcept
+{
+    // size + userDef + mt + keyN + vN + [head size + head] + value size
+    auto prefixSize = 5U * sizeof(uint64_t) + sizeof(MessageType) + (head.empty() ? 0 : sizeof(uint64_t) + head.size());
+    std::vector<uint8_t> result;
+    result.reserve(prefixSize);
+    PackValue(result, prefixSize + valueSize);
+    PackValue(result, userDef);
+    PackValue(result, mt);
+    PackValue(result, static_cast<uint64_t>(0));
+    PackValue(result, static_cast<uint64_t>(head.empty() ? 1 : 2));
+    if (!head.empty()) {
+        PackBytes(result, head);
+    }
+    PackValue(result, valueSize);
+    return result;
+}
+
 bool SmemMessagePacker::Full(const uint8_t *buffer, const uint64_t bufferLen) noexcept
 {
     constexpr uint64_t baseSize = 4U * sizeof(uint64_t) + sizeof(MessageType);
@@ -67,6 +86,27 @@ int64_t SmemMessagePacker::MessageSize(const std::vector<uint8_t> &buffer) noexc
 }
 
 int64_t SmemMessagePacker::Unpack(const uint8_t *buffer, const uint64_t bufferLen, SmemMessage &message) noexcept
+{
+    SmemMessageView view;
+    auto totalSize = Unpack(buffer, bufferLen, view);
+    if (totalSize < 0) {
+        return totalSize;
+    }
+
+    message.mt = view.mt;
+    message.userDef = view.userDef;
+    message.keys.reserve(view.keys.size());
+    for (auto &key : view.keys) {
+        message.keys.emplace_back(key);
+    }
+    message.values.reserve(view.values.size());
+    for (auto &value : view.values) {
+        message.values.emplace_back(value.ToVector());
+    }
+    return totalSize;
+}
+
+int64_t SmemMessagePacker::Unpack(const uint8_t *buffer, const uint64_t bufferLen, SmemMessageView &message) noexcept
 {
     SM_CHECK_CONDITION_RET(buffer == nullptr, -1);
     SM_CHECK_CONDITION_RET(!Full(buffer, bufferLen), -1);
@@ -87,9 +127,11 @@ int64_t SmemMessagePacker::Unpack(const uint8_t *buffer, const uint64_t bufferLe
     SM_CHECK_CONDITION_RET(keyCount > MAX_KEY_COUNT, -1);
 
     length += sizeof(uint64_t);
+    message.keys.clear();
     message.keys.reserve(keyCount);
 
     for (auto i = 0UL; i < keyCount; i++) {
+        SM_CHECK_CONDITION_RET(length + sizeof(uint64_t) > bufferLen, -1);
         uint64_t keySize = 0;
         std::copy_n(reinterpret_cast<const uint64_t *>(buffer + length), 1, &keySize);
         length += sizeof(uint64_t);
@@ -99,20 +141,23 @@ int64_t SmemMessagePacker::Unpack(const uint8_t *buffer, const uint64_t bufferLe
         length += keySize;
     }
 
+    SM_CHECK_CONDITION_RET(length + sizeof(uint64_t) > bufferLen, -1);
     uint64_t valueCount = 0;
     std::copy_n(reinterpret_cast<const uint64_t *>(buffer + length), 1, &valueCount);
     SM_CHECK_CONDITION_RET(valueCount > MAX_VALUE_COUNT, -1);
 
     length += sizeof(uint64_t);
+    message.values.clear();
     message.values.reserve(valueCount);
 
     for (auto i = 0UL; i < valueCount; i++) {
+        SM_CHECK_CONDITION_RET(length + sizeof(uint64_t) > bufferLen, -1);
         uint64_t valueSize = 0;
         std::copy_n(reinterpret_cast<const uint64_t *>(buffer + length), 1, &valueSize);
         length += sizeof(uint64_t);
         SM_CHECK_CONDITION_RET(valueSize > MAX_VALUE_SIZE || length + valueSize > bufferLen, -1);
 
-        message.values.emplace_back(buffer + length, buffer + length + valueSize);
+        message.values.push_back(SmemBytesView{buffer + length, valueSize});
         length += valueSize;
     }
     SM_CHECK_CONDITION_RET(totalSize != length, -1);
@@ -13,8 +13,10 @@
 #ifndef SMEM_SMEM_MESSAGE_PACKER_H
 #define SMEM_SMEM_MESSAGE_PACKER_H
 
+#include <algorithm>
 #include <cstdint>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace ock {
@@ -30,7 +32,30 @@ const uint64_t MAX_KEY_COUNT = 10ULL;
 const uint64_t MAX_KEY_SIZE = 2048ULL;
 const uint64_t MAX_VALUE_COUNT = 10ULL;
 const uint64_t MAX_VALUE_SIZE = 64 * 1024 * 1024ULL;
-enum MessageType : int16_t { SET, GET, ADD, REMOVE, APPEND, CAS, WRITE, WATCH_RANK_STATE, HEARTBEAT, INVALID_MSG };
+/* values larger than single message size are transferred in chunks by GET_RANGE and APPEND_STREAM,
+ * single message size keeps the whole message under the link's receive limit (MAX_RECV_BODY_LEN, 10MB) */
+constexpr uint64_t MAX_SINGLE_VALUE_SIZE = 8 * 1024 * 1024ULL;
+constexpr uint64_t VALUE_CHUNK_SIZE = 4 * 1024 * 1024ULL;
+const uint64_t MAX_STREAM_VALUE_SIZE = 4 * 1024 * 1024 * 1024ULL;
+enum MessageType : int16_t {
+    SET,
+    GET,
+    ADD,
+    REMOVE,
+    APPEND,
+    CAS,
+    WRITE,
+    WATCH_RANK_STATE,
+    HEARTBEAT,
+    SET_TTL, /* SET keys[0] with time-to-live userDef seconds, and expire other keys after the same time */
+    BARRIER, /* wait until values[0] ranks arrive at keys[0], with timeout userDef ms */
+    BITMAP_ALLOC,   /* allocate the lowest free bit of bitmap keys[0] with values[0] bits, reply index */
+    BITMAP_RELEASE, /* release bit values[0] of bitmap keys[0] */
+    GET_RANGE,      /* get bytes SmemValueRange values[0] of keys[0], reply SmemRangeHead values[0] and bytes values[1],
+                       reply userDef is the whole value size */
+    APPEND_STREAM,  /* chunk values[1] at SmemStreamHead values[0] of a value appended to keys[0] once completed */
+    INVALID_MSG
+};
 
 struct SmemMessage {
     SmemMessage() noexcept : mt{MessageType::INVALID_MSG} {}
@@ -76,16 +101,110 @@ struct SmemMessage {
     std::vector<std::vector<uint8_t>> values;
 };
 
+struct SmemValueRange {
+    uint64_t offset;
+    uint64_t length;
+};
+
+/* value the range is read from, ranges of different generations belong to different values */
+struct SmemRangeHead {
+    uint64_t generation;
+};
+
+/* sizes of splitting large values, client and server of one store must use the same limits */
+struct SmemValueSizeLimits {
+    uint64_t maxSingleValueSize{MAX_SINGLE_VALUE_SIZE}; /* larger values are not sent in one message */
+    uint64_t valueChunkSize{VALUE_CHUNK_SIZE};          /* bytes of each GET_RANGE or APPEND_STREAM message */
+};
+
+/* chunks of a stream are sent in order on one link, stream id is unique in the client */
+struct SmemStreamHead {
+    uint64_t streamId;
+    uint64_t offset;
+    uint64_t total;
+};
+
+/**
+ * @brief Bytes in a buffer owned by someone else
+ */
+struct SmemBytesView {
+    const uint8_t *data{nullptr};
+    uint64_t size{0};
+
+    bool Empty() const noexcept
+    {
+        return size == 0;
+    }
+
+    std::string_view AsString() const noexcept
+    {
+        return std::string_view{reinterpret_cast<const char *>(data), size};
+    }
+
+    std::vector<uint8_t> ToVector() const noexcept
+    {
+        return std::vector<uint8_t>{data, data + size};
+    }
+
+    bool Equals(const std::vector<uint8_t> &other) const noexcept
+    {
+        return size == other.size() && std::equal(other.begin(), other.end(), data);
+    }
+
+    template<class T>
+    bool ToPod(T &pod) const noexcept
+    {
+        if (size != sizeof(T)) {
+            return false;
+        }
+        std::copy_n(data, sizeof(T), reinterpret_cast<uint8_t *>(&pod));
+        return true;
+    }
+};
+
+/**
+ * @brief Message decoded in place, keys and values point into the buffer it is unpacked from
+ *
+ * Nothing is copied or owned, the view is valid only while that buffer is alive and unchanged. A request on
+ * the store server points into the receive buffer of its link, which is reused once the handler returns,
+ * so a handler copies the parts it keeps.
+ */
+struct SmemMessageView {
+    MessageType mt{MessageType::INVALID_MSG};
+    int64_t userDef{-1L};
+    std::vector<std::string_view> keys;
+    std::vector<SmemBytesView> values;
+};
+
 class SmemMessagePacker {
 public:
     static std::vector<uint8_t> Pack(const SmemMessage &message) noexcept;
 
+    /**
+     * @brief Pack everything of a message with no key and one value except the value bytes,
+     * the value bytes can be sent right after the prefix to compose a complete message
+     *
+     * @param head      [in] if not empty, packed as values[0] ahead of the value sent after the prefix
+     */
+    static std::vector<uint8_t> PackValuePrefix(MessageType mt, uint64_t valueSize, int64_t userDef = -1L,
+                                                const std::vector<uint8_t> &head = {}) noexcept;
+
     static bool Full(const uint8_t *buffer, const uint64_t bufferLen) noexcept;
 
     static int64_t MessageSize(const std::vector<uint8_t> &buffer) noexcept;
 
     static int64_t Unpack(const uint8_t *buffer, const uint64_t bufferLen, SmemMessage &message) noexcept;
 
+    /**
+     * @brief Unpack a message without copying keys and values out of the buffer
+     *
+     * @param buffer    [in] buffer holding a full message, must outlive the view
+     * @param bufferLen [in] length of the buffer
+     * @param message   [out] view into the buffer
+     * @return size of the message, or -1 if the buffer is not a valid message
+     */
+    static int64_t Unpack(const uint8_t *buffer, const uint64_t bufferLen, SmemMessageView &message) noexcept;
+
     template<class T>
     static std::vector<uint8_t> PackPod(const T &v) noexcept
     {
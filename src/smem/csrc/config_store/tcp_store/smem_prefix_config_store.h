@@ -89,6 +89,64 @@ public:
         return baseStore_->Write(std::string(keyPrefix_).append(key), value, offset);
     }
 
+    Result Barrier(const std::string &key, uint32_t size, int64_t timeoutMs) noexcept override
+    {
+        STORE_ASSERT_RETURN(baseStore_ != nullptr, SM_MALLOC_FAILED);
+        return baseStore_->Barrier(std::string(keyPrefix_).append(key), size, timeoutMs);
+    }
+
+    Result GetRange(const std::string &key, uint64_t offset, uint64_t length, std::vector<uint8_t> &value,
+                    uint64_t &totalSize) noexcept override
+    {
+        STORE_ASSERT_RETURN(baseStore_ != nullptr, SM_MALLOC_FAILED);
+        return baseStore_->GetRange(std::string(keyPrefix_).append(key), offset, length, value, totalSize);
+    }
+
+    Result BitmapAlloc(const std::string &key, uint32_t bitCount, uint32_t &index) noexcept override
+    {
+        STORE_ASSERT_RETURN(baseStore_ != nullptr, SM_MALLOC_FAILED);
+        return baseStore_->BitmapAlloc(std::string(keyPrefix_).append(key), bitCount, index);
+    }
+
+    Result BitmapRelease(const std::string &key, uint32_t index) noexcept override
+    {
+        STORE_ASSERT_RETURN(baseStore_ != nullptr, SM_MALLOC_FAILED);
+        return baseStore_->BitmapRelease(std::string(keyPrefix_).append(key), index);
+    }
+
+    Result SetAsync(const std::string &key, const std::vector<uint8_t> &value,
+                    const ConfigStoreSetCallback &callback) noexcept override
+    {
+        STORE_ASSERT_RETURN(baseStore_ != nullptr, SM_MALLOC_FAILED);
+        return baseStore_->SetAsync(std::string(keyPrefix_).append(key), value, callback);
+    }
+
+    Result GetAsync(const std::string &key, int64_t timeoutMs, const ConfigStoreGetCallback &callback) noexcept override
+    {
+        STORE_ASSERT_RETURN(baseStore_ != nullptr, SM_MALLOC_FAILED);
+        return baseStore_->GetAsync(std::string(keyPrefix_).append(key), timeoutMs, callback);
+    }
+
+    Result AddAsync(const std::string &key, int64_t increment, const ConfigStoreAddCallback &callback) noexcept override
+    {
+        STORE_ASSERT_RETURN(baseStore_ != nullptr, SM_MALLOC_FAILED);
+        return baseStore_->AddAsync(std::string(keyPrefix_).append(key), increment, callback);
+    }
+
+    Result SetWithTTLAsync(const std::string &key, const std::vector<uint8_t> &value, int64_t ttlSeconds,
+                           const std::vector<std::string> &expireKeys,
+                           const ConfigStoreSetCallback &callback) noexcept override
+    {
+        STORE_ASSERT_RETURN(baseStore_ != nullptr, SM_MALLOC_FAILED);
+        std::vector<std::string> fullExpireKeys;
+        fullExpireKeys.reserve(expireKeys.size());
+        for (auto &k : expireKeys) {
+            fullExpireKeys.emplace_back(std::string(keyPrefix_).append(k));
+        }
+        return baseStore_->SetWithTTLAsync(std::string(keyPrefix_).append(key), value, ttlSeconds, fullExpireKeys,
+                                           callback);
+    }
+
     std::string GetCompleteKey(const std::string &key) noexcept override
     {
         return std::string(keyPrefix_).append(key);
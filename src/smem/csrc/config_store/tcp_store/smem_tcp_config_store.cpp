@@ -122,11 +122,46 @@ public:
         return onlyOneTime_;
     }
 
+    bool IsWatch() const noexcept override
+    {
+        return true;
+    }
+
 private:
     const std::function<void(int result, const std::vector<uint8_t> &)> notify_;
     const bool onlyOneTime_;
 };
 
+class ClientAsyncContext : public ClientCommonContext {
+public:
+    explicit ClientAsyncContext(std::function<void(Result, const ock::acc::AccTcpRequestContext *)> handler) noexcept
+        : handler_{std::move(handler)}
+    {}
+
+    std::shared_ptr<ock::acc::AccTcpRequestContext> WaitFinished() noexcept override
+    {
+        return nullptr;
+    }
+
+    void SetFinished(const ock::acc::AccTcpRequestContext &response) noexcept override
+    {
+        handler_(SUCCESS, &response);
+    }
+
+    void SetFailedFinish() noexcept override
+    {
+        handler_(IO_ERROR, nullptr);
+    }
+
+    bool Blocking() const noexcept override
+    {
+        return false;
+    }
+
+private:
+    const std::function<void(Result, const ock::acc::AccTcpRequestContext *)> handler_;
+};
+
 std::atomic<uint32_t> TcpConfigStore::reqSeqGen_{0};
 TcpConfigStore::TcpConfigStore(StoreBackendPtr backend, std::string ip, uint16_t port, bool isServer,
                                uint32_t worldSize, int32_t rankId) noexcept
@@ -216,6 +251,7 @@ Result TcpConfigStore::ServerStart(const smem_tls_config &tlsConfig, int reconne
         Shutdown();
         return SM_NEW_OBJECT_FAILED;
     }
+    accServer_->SetValueSizeLimits(valueLimits_);
 
     if ((result = accServer_->Startup(tlsConfig)) != SM_OK) {
         Shutdown();
@@ -224,6 +260,20 @@ Result TcpConfigStore::ServerStart(const smem_tls_config &tlsConfig, int reconne
     return result;
 }
 
+Result TcpConfigStore::SetValueSizeLimits(const SmemValueSizeLimits &limits) noexcept
+{
+    STORE_VALIDATE_RETURN(limits.valueChunkSize > 0 && limits.maxSingleValueSize <= MAX_VALUE_SIZE,
+                          "invalid value size limits, single: " << limits.maxSingleValueSize
+                                                                << ", chunk: " << limits.valueChunkSize,
+                          SM_INVALID_PARAM);
+    std::lock_guard<std::mutex> guard(mutex_);
+    valueLimits_ = limits;
+    if (accServer_ != nullptr) {
+        accServer_->SetValueSizeLimits(limits);
+    }
+    return SM_OK;
+}
+
 void TcpConfigStore::Shutdown(bool afterFork) noexcept
 {
     isRunning_.store(false);
@@ -292,6 +342,16 @@ Result TcpConfigStore::GetReal(const std::string &key, std::vector<uint8_t> &val
     }
 
     auto responseCode = response->Header().result;
+    if (responseCode == VALUE_TOO_LARGE) {
+        int64_t totalSize = 0;
+        auto ret = ParseIntegerValue(*response, totalSize);
+        if (ret != SM_OK || totalSize < 0) {
+            STORE_LOG_ERROR("send get for key: " << key << ", invalid value size of large value");
+            return StoreErrorCode::ERROR;
+        }
+        return GetByRanges(key, static_cast<uint64_t>(totalSize), value);
+    }
+
     if (responseCode != 0 && responseCode != RESTORE) {
         if (responseCode != NOT_EXIST) {
             STORE_LOG_WARN("send get for key: " << key << ", resp code: " << responseCode << " timeout:" << timeoutMs);
@@ -299,22 +359,134 @@ Result TcpConfigStore::GetReal(const std::string &key, std::vector<uint8_t> &val
         return responseCode;
     }
 
-    auto data = reinterpret_cast<const uint8_t *>(response->DataPtr());
-    STORE_ASSERT_RETURN(data != nullptr, SM_MALLOC_FAILED);
-    SmemMessage responseBody;
-    auto ret = SmemMessagePacker::Unpack(data, response->DataLen(), responseBody);
-    if (ret < 0) {
-        STORE_LOG_ERROR("unpack response body failed, result: " << ret);
-        return -1;
+    auto ret = UnpackFirstValue(*response, value);
+    if (ret != SM_OK) {
+        return ret;
     }
+    return static_cast<Result>(responseCode);
+}
 
-    if (responseBody.values.empty()) {
-        STORE_LOG_ERROR("response body has no value");
-        return -1;
+Result TcpConfigStore::GetRange(const std::string &key, uint64_t offset, uint64_t length,
+                                std::vector<uint8_t> &value, uint64_t &totalSize) noexcept
+{
+    if (key.empty() || key.length() > MAX_KEY_LEN_CLIENT) {
+        STORE_LOG_ERROR("key length is invalid");
+        return StoreErrorCode::INVALID_KEY;
+    }
+    if (length > valueLimits_.valueChunkSize) {
+        STORE_LOG_ERROR("get range for key: " << key << ", length " << length << " exceeds "
+                                              << valueLimits_.valueChunkSize);
+        return StoreErrorCode::INVALID_MESSAGE;
     }
 
-    value = std::move(responseBody.values[0]);
-    return static_cast<Result>(responseCode);
+    SmemMessage request{MessageType::GET_RANGE, key, SmemMessagePacker::PackPod(SmemValueRange{offset, length})};
+    auto packedRequest = SmemMessagePacker::Pack(request);
+    auto response = SendMessageBlocked(packedRequest);
+    if (response == nullptr) {
+        STORE_LOG_ERROR("send get range for key: " << key << ", get null response");
+        return StoreErrorCode::IO_ERROR;
+    }
+
+    auto responseCode = response->Header().result;
+    if (responseCode != 0) {
+        if (responseCode != NOT_EXIST) {
+            STORE_LOG_ERROR("send get range for key: " << key << ", get response code: " << responseCode);
+        }
+        return responseCode;
+    }
+
+    SmemBytesView bytes;
+    uint64_t generation = 0;
+    auto ret = UnpackRange(*response, bytes, totalSize, generation);
+    if (ret != SM_OK) {
+        return ret;
+    }
+    value = bytes.ToVector();
+    return SM_OK;
+}
+
+Result TcpConfigStore::GetByRanges(const std::string &key, uint64_t totalSize, std::vector<uint8_t> &value) noexcept
+{
+    for (uint32_t i = 0; i <= GET_RANGES_RETRY_MAX; i++) {
+        bool changed = false;
+        auto ret = GetRangesOnce(key, totalSize, value, changed);
+        if (ret != SM_OK || !changed) {
+            return ret;
+        }
+        STORE_LOG_INFO("value of key: " << key << " replaced while getting by ranges, get again, size: " << totalSize);
+    }
+
+    STORE_LOG_ERROR("get key: " << key << " by ranges failed, value keeps being replaced");
+    value.clear();
+    return StoreErrorCode::ERROR;
+}
+
+Result TcpConfigStore::GetRangesOnce(const std::string &key, uint64_t &totalSize, std::vector<uint8_t> &value,
+                                     bool &changed) noexcept
+{
+    STORE_VALIDATE_RETURN(totalSize <= MAX_STREAM_VALUE_SIZE, "value of key: " << key << " too large: " << totalSize,
+                          StoreErrorCode::VALUE_TOO_LARGE);
+    STORE_LOG_DEBUG("get key: " << key << " by ranges, size: " << totalSize);
+    value.resize(totalSize);
+
+    // each range reply tells the value it is read from, written by the receiving thread and read after waiting
+    struct RangeOrigin {
+        uint64_t generation{0};
+        uint64_t totalSize{0};
+    };
+    auto chunkSize = valueLimits_.valueChunkSize;
+    std::vector<RangeOrigin> origins((totalSize + chunkSize - 1UL) / chunkSize);
+
+    // ranges are pipelined under async slots, each response is copied to its place in the receiving thread
+    ConfigStoreAsyncWaiter waiter;
+    for (uint64_t offset = 0; offset < totalSize; offset += chunkSize) {
+        auto length = std::min(chunkSize, totalSize - offset);
+        SmemMessage request{MessageType::GET_RANGE, key, SmemMessagePacker::PackPod(SmemValueRange{offset, length})};
+        auto packedRequest = SmemMessagePacker::Pack(request);
+        auto dest = value.data() + offset;
+        auto origin = &origins[offset / chunkSize];
+        waiter.Begin();
+        auto handler = [&waiter, dest, length, origin](Result result, const ock::acc::AccTcpRequestContext *response) {
+            SmemBytesView bytes;
+            if (response != nullptr) {
+                result = response->Header().result;
+                if (result == 0) {
+                    result = UnpackRange(*response, bytes, origin->totalSize, origin->generation);
+                }
+            }
+            // a range of a shorter value is not copied, it is found replaced by its size after all replied
+            if (result == 0 && bytes.size == length) {
+                std::copy_n(bytes.data, length, dest);
+            }
+            waiter.Finish(result);
+        };
+        auto ret = SendMessageAsync(packedRequest, handler);
+        if (ret != SM_OK) {
+            waiter.Finish(ret);
+            break;
+        }
+    }
+
+    auto ret = waiter.Wait();
+    if (ret != SM_OK) {
+        STORE_LOG_ERROR("get key: " << key << " by ranges failed, result: " << ret);
+        value.clear();
+        return ret;
+    }
+
+    // generation grows with every value created, get again the latest one if ranges come from different values
+    for (auto &origin : origins) {
+        if (origin.generation != origins.front().generation || origin.totalSize != totalSize) {
+            changed = true;
+        }
+    }
+    if (changed) {
+        auto latest = std::max_element(origins.begin(), origins.end(), [](const RangeOrigin &a, const RangeOrigin &b) {
+            return a.generation < b.generation;
+        });
+        totalSize = latest->totalSize;
+    }
+    return SM_OK;
 }
 
 Result TcpConfigStore::Add(const std::string &key, int64_t increment, int64_t &value) noexcept
@@ -341,17 +513,7 @@ Result TcpConfigStore::Add(const std::string &key, int64_t increment, int64_t &v
         STORE_LOG_ERROR("send add for key: " << key << ", get response code: " << responseCode);
         return responseCode;
     }
-    STORE_ASSERT_RETURN(response->DataPtr() != nullptr, IO_ERROR);
-    std::string data(reinterpret_cast<char *>(response->DataPtr()), response->DataLen());
-
-    value = 0;
-    auto ret = mf::StrUtil::String2Int<int64_t>(data, value);
-    STORE_ASSERT_RETURN(errno != ERANGE, IO_ERROR);
-    if ((value == 0 && data != "0") || !ret) {
-        STORE_LOG_ERROR("data=" << data);
-        return StoreErrorCode::ERROR;
-    }
-    return StoreErrorCode::SUCCESS;
+    return ParseIntegerValue(*response, value);
 }
 
 Result TcpConfigStore::Remove(const std::string &key, bool printKeyNotExist) noexcept
@@ -391,6 +553,10 @@ Result TcpConfigStore::Append(const std::string &key, const std::vector<uint8_t>
         return StoreErrorCode::INVALID_KEY;
     }
 
+    if (value.size() > valueLimits_.maxSingleValueSize) {
+        return AppendStream(key, value, newSize);
+    }
+
     SmemMessage request{MessageType::APPEND};
     request.keys.push_back(key);
     request.values.push_back(value);
@@ -418,6 +584,51 @@ Result TcpConfigStore::Append(const std::string &key, const std::vector<uint8_t>
     return StoreErrorCode::SUCCESS;
 }
 
+Result TcpConfigStore::AppendStream(const std::string &key, const std::vector<uint8_t> &value,
+                                    uint64_t &newSize) noexcept
+{
+    STORE_VALIDATE_RETURN(value.size() <= MAX_STREAM_VALUE_SIZE, "append too large value: " << value.size(),
+                          StoreErrorCode::VALUE_TOO_LARGE);
+    STORE_LOG_DEBUG("append key: " << key << " by stream, size: " << value.size());
+
+    // chunks are pipelined in order on the link, server appends the whole value once the last chunk arrives
+    SmemStreamHead head{streamIdGen_.fetch_add(1UL), 0, value.size()};
+    ConfigStoreAsyncWaiter waiter;
+    int64_t appendedSize = 0;
+    for (; head.offset < head.total; head.offset += valueLimits_.valueChunkSize) {
+        auto length = std::min(valueLimits_.valueChunkSize, head.total - head.offset);
+        auto chunkBegin = value.begin() + static_cast<std::ptrdiff_t>(head.offset);
+        SmemMessage request{MessageType::APPEND_STREAM, key, SmemMessagePacker::PackPod(head),
+                            std::vector<uint8_t>(chunkBegin, chunkBegin + static_cast<std::ptrdiff_t>(length))};
+        auto packedRequest = SmemMessagePacker::Pack(request);
+        auto last = head.offset + length == head.total;
+        waiter.Begin();
+        auto handler = [&waiter, &appendedSize, last](Result result,
+                                                      const ock::acc::AccTcpRequestContext *response) {
+            if (response != nullptr) {
+                result = response->Header().result;
+                if (result == 0 && last) {
+                    result = ParseIntegerValue(*response, appendedSize);
+                }
+            }
+            waiter.Finish(result);
+        };
+        auto ret = SendMessageAsync(packedRequest, handler);
+        if (ret != SM_OK) {
+            waiter.Finish(ret);
+            break;
+        }
+    }
+
+    auto ret = waiter.Wait();
+    if (ret != SM_OK) {
+        STORE_LOG_ERROR("append key: " << key << " by stream failed, result: " << ret);
+        return ret;
+    }
+    newSize = static_cast<uint64_t>(appendedSize);
+    return StoreErrorCode::SUCCESS;
+}
+
 Result TcpConfigStore::Write(const std::string &key, const std::vector<uint8_t> &value, const uint32_t offset) noexcept
 {
     if (key.empty() || key.length() > MAX_KEY_LEN_CLIENT) {
@@ -447,6 +658,98 @@ Result TcpConfigStore::Write(const std::string &key, const std::vector<uint8_t>
     return responseCode;
 }
 
+Result TcpConfigStore::Barrier(const std::string &key, uint32_t size, int64_t timeoutMs) noexcept
+{
+    if (key.empty() || key.length() > MAX_KEY_LEN_CLIENT) {
+        STORE_LOG_ERROR("key length is invalid");
+        return StoreErrorCode::INVALID_KEY;
+    }
+    STORE_VALIDATE_RETURN(size > 0, "invalid barrier size: " << size, StoreErrorCode::INVALID_MESSAGE);
+
+    SmemMessage request{MessageType::BARRIER};
+    auto sizeStr = std::to_string(size);
+    request.keys.push_back(key);
+    request.values.emplace_back(sizeStr.begin(), sizeStr.end());
+    request.userDef = timeoutMs;
+
+    auto packedRequest = SmemMessagePacker::Pack(request);
+    auto response = SendMessageBlocked(packedRequest);
+    if (response == nullptr) {
+        STORE_LOG_ERROR("send barrier for key: " << key << ", get null response");
+        return IO_ERROR;
+    }
+
+    auto responseCode = response->Header().result;
+    if (responseCode != 0) {
+        STORE_LOG_ERROR("send barrier for key: " << key << ", size: " << size << ", get response code: "
+                                                 << responseCode << " timeout:" << timeoutMs);
+    }
+
+    return responseCode;
+}
+
+Result TcpConfigStore::BitmapAlloc(const std::string &key, uint32_t bitCount, uint32_t &index) noexcept
+{
+    if (key.empty() || key.length() > MAX_KEY_LEN_CLIENT) {
+        STORE_LOG_ERROR("key length is invalid");
+        return StoreErrorCode::INVALID_KEY;
+    }
+    STORE_VALIDATE_RETURN(bitCount > 0, "invalid bitmap size: " << bitCount, StoreErrorCode::INVALID_MESSAGE);
+
+    SmemMessage request{MessageType::BITMAP_ALLOC};
+    auto countStr = std::to_string(bitCount);
+    request.keys.push_back(key);
+    request.values.emplace_back(countStr.begin(), countStr.end());
+
+    auto packedRequest = SmemMessagePacker::Pack(request);
+    auto response = SendMessageBlocked(packedRequest);
+    if (response == nullptr) {
+        STORE_LOG_ERROR("send bitmap alloc for key: " << key << ", get null response");
+        return StoreErrorCode::IO_ERROR;
+    }
+
+    auto responseCode = response->Header().result;
+    if (responseCode != 0) {
+        STORE_LOG_ERROR("send bitmap alloc for key: " << key << ", get response code: " << responseCode);
+        return responseCode;
+    }
+
+    int64_t value = 0;
+    auto ret = ParseIntegerValue(*response, value);
+    if (ret != StoreErrorCode::SUCCESS || value < 0 || value >= bitCount) {
+        STORE_LOG_ERROR("bitmap alloc for key: " << key << ", get invalid index: " << value);
+        return StoreErrorCode::ERROR;
+    }
+    index = static_cast<uint32_t>(value);
+    return StoreErrorCode::SUCCESS;
+}
+
+Result TcpConfigStore::BitmapRelease(const std::string &key, uint32_t index) noexcept
+{
+    if (key.empty() || key.length() > MAX_KEY_LEN_CLIENT) {
+        STORE_LOG_ERROR("key length is invalid");
+        return StoreErrorCode::INVALID_KEY;
+    }
+
+    SmemMessage request{MessageType::BITMAP_RELEASE};
+    auto indexStr = std::to_string(index);
+    request.keys.push_back(key);
+    request.values.emplace_back(indexStr.begin(), indexStr.end());
+
+    auto packedRequest = SmemMessagePacker::Pack(request);
+    auto response = SendMessageBlocked(packedRequest);
+    if (response == nullptr) {
+        STORE_LOG_ERROR("send bitmap release for key: " << key << ", get null response");
+        return StoreErrorCode::IO_ERROR;
+    }
+
+    auto responseCode = response->Header().result;
+    if (responseCode != 0 && responseCode != StoreErrorCode::NOT_EXIST) {
+        STORE_LOG_ERROR("send bitmap release for key: " << key << ", get response code: " << responseCode);
+    }
+    return responseCode;
+}
+
 Result TcpConfigStore::Cas(const std::string &key, const std::vector<uint8_t> &expect,
                            const std::vector<uint8_t> &value, std::vector<uint8_t> &exists) noexcept
 {
@@ -491,6 +794,124 @@ Result TcpConfigStore::Cas(const std::string &key, const std::vector<uint8_t> &e
     return 0;
 }
 
+Result TcpConfigStore::SetAsync(const std::string &key, const std::vector<uint8_t> &value,
+                                const ConfigStoreSetCallback &callback) noexcept
+{
+    if (key.empty() || key.length() > MAX_KEY_LEN_CLIENT) {
+        STORE_LOG_ERROR("key length is invalid");
+        return StoreErrorCode::INVALID_KEY;
+    }
+
+    SmemMessage request{MessageType::SET};
+    request.keys.push_back(key);
+    request.values.push_back(value);
+
+    auto packedRequest = SmemMessagePacker::Pack(request);
+    return SendMessageAsync(packedRequest, [key, callback](Result result,
+                                                           const ock::acc::AccTcpRequestContext *response) {
+        if (response != nullptr) {
+            result = response->Header().result;
+        }
+        if (result != 0) {
+            STORE_LOG_ERROR("send async set for key: " << key << ", get result: " << result);
+        }
+        callback(result);
+    });
+}
+
+Result TcpConfigStore::SetWithTTLAsync(const std::string &key, const std::vector<uint8_t> &value, int64_t ttlSeconds,
+                                       const std::vector<std::string> &expireKeys,
+                                       const ConfigStoreSetCallback &callback) noexcept
+{
+    STORE_VALIDATE_RETURN(ttlSeconds >= 0, "invalid ttl: " << ttlSeconds, StoreErrorCode::INVALID_MESSAGE);
+    STORE_VALIDATE_RETURN(expireKeys.size() < MAX_KEY_COUNT, "too many expire keys: " << expireKeys.size(),
+                          StoreErrorCode::INVALID_MESSAGE);
+    SmemMessage request{MessageType::SET_TTL};
+    request.keys.push_back(key);
+    request.keys.insert(request.keys.end(), expireKeys.begin(), expireKeys.end());
+    for (auto &k : request.keys) {
+        if (k.empty() || k.length() > MAX_KEY_LEN_CLIENT) {
+            STORE_LOG_ERROR("key length is invalid");
+            return StoreErrorCode::INVALID_KEY;
+        }
+    }
+    request.values.push_back(value);
+    request.userDef = ttlSeconds;
+
+    auto packedRequest = SmemMessagePacker::Pack(request);
+    return SendMessageAsync(packedRequest, [key, callback](Result result,
+                                                           const ock::acc::AccTcpRequestContext *response) {
+        if (response != nullptr) {
+            result = response->Header().result;
+        }
+        if (result != 0) {
+            STORE_LOG_ERROR("send set with ttl for key: " << key << ", get result: " << result);
+        }
+        callback(result);
+    });
+}
+
+Result TcpConfigStore::GetAsync(const std::string &key, int64_t timeoutMs,
+                                const ConfigStoreGetCallback &callback) noexcept
+{
+    if (key.empty() || key.length() > MAX_KEY_LEN_CLIENT) {
+        STORE_LOG_ERROR("key length is invalid");
+        return StoreErrorCode::INVALID_KEY;
+    }
+
+    SmemMessage request{MessageType::GET};
+    request.keys.push_back(key);
+    request.userDef = timeoutMs;
+
+    // a get waiting for the key is answered only when the key is set or timeout, it does not take an async slot
+    auto packedRequest = SmemMessagePacker::Pack(request);
+    auto handler = [key, timeoutMs, callback](Result result, const ock::acc::AccTcpRequestContext *response) {
+        std::vector<uint8_t> value;
+        if (response != nullptr) {
+            result = response->Header().result;
+            if (result == 0 || result == RESTORE) {
+                auto ret = UnpackFirstValue(*response, value);
+                result = (ret == SM_OK ? result : ret);
+            }
+        }
+        if (result != 0 && result != RESTORE && result != NOT_EXIST) {
+            STORE_LOG_WARN("send async get for key: " << key << ", result: " << result << " timeout:" << timeoutMs);
+        }
+        callback(result, value);
+    };
+    return SendMessageAsync(packedRequest, handler, timeoutMs == 0);
+}
+
+Result TcpConfigStore::AddAsync(const std::string &key, int64_t increment,
+                                const ConfigStoreAddCallback &callback) noexcept
+{
+    if (key.empty() || key.length() > MAX_KEY_LEN_CLIENT) {
+        STORE_LOG_ERROR("key length is invalid");
+        return StoreErrorCode::INVALID_KEY;
+    }
+
+    SmemMessage request{MessageType::ADD};
+    request.keys.push_back(key);
+    std::string inc = std::to_string(increment);
+    request.values.push_back(std::vector<uint8_t>(inc.begin(), inc.end()));
+
+    auto packedRequest = SmemMessagePacker::Pack(request);
+    return SendMessageAsync(packedRequest, [key, callback](Result result,
+                                                           const ock::acc::AccTcpRequestContext *response) {
+        int64_t value = 0;
+        if (response != nullptr) {
+            result = response->Header().result;
+            if (result == 0) {
+                result = ParseIntegerValue(*response, value);
+            }
+        }
+        if (result != 0) {
+            STORE_LOG_ERROR("send async add for key: " << key << ", get result: " << result);
+        }
+        callback(result, value);
+    });
+}
+
 Result
 TcpConfigStore::Watch(const std::string &key,
                       const std::function<void(int result, const std::string &, const std::vector<uint8_t> &)> &notify,
@@ -550,7 +971,7 @@ Result TcpConfigStore::Unwatch(uint32_t wid) noexcept
 
     std::unique_lock<std::mutex> msgCtxLocker{msgCtxMutex_};
     auto pos = msgClientContext_.find(wid);
-    if (pos != msgClientContext_.end() && !pos->second->Blocking()) {
+    if (pos != msgClientContext_.end() && pos->second->IsWatch()) {
         watchContext = std::move(pos->second);
         msgClientContext_.erase(pos);
     }
@@ -588,6 +1009,121 @@ TcpConfigStore::SendMessageBlocked(const std::vector<uint8_t> &reqBody) noexcept
     return response;
 }
 
+Result TcpConfigStore::SendMessageAsync(const std::vector<uint8_t> &reqBody, const AsyncResponseHandler &handler,
+                                        bool limited) noexcept
+{
+    STORE_ASSERT_RETURN(accClientLink_ != nullptr, SM_NOT_INITIALIZED);
+    auto dataBuf = ock::acc::AccDataBuffer::Create(reqBody.data(), reqBody.size());
+    STORE_ASSERT_RETURN(dataBuf != nullptr, SM_MALLOC_FAILED);
+    // slot is released before handler invoked, so handler can send next asynchronous request
+    auto asyncContext = std::make_shared<ClientAsyncContext>(
+        [this, handler, limited](Result result, const ock::acc::AccTcpRequestContext *response) {
+            if (limited) {
+                ReleaseAsyncSlot();
+            }
+            handler(result, response);
+        });
+    STORE_ASSERT_RETURN(asyncContext != nullptr, SM_MALLOC_FAILED);
+
+    if (limited) {
+        AcquireAsyncSlot();
+    }
+    auto seqNo = reqSeqGen_.fetch_add(1U);
+    std::unique_lock<std::mutex> msgCtxLocker{msgCtxMutex_};
+    msgClientContext_.emplace(seqNo, std::move(asyncContext));
+    msgCtxLocker.unlock();
+    auto ret = LocalNonBlockSend(0, seqNo, dataBuf, nullptr);
+    if (ret == SM_OK) {
+        return SM_OK;
+    }
+
+    msgCtxLocker.lock();
+    auto removed = msgClientContext_.erase(seqNo);
+    msgCtxLocker.unlock();
+    if (removed == 0) {
+        // already taken by link broken handler, failure is reported by handler
+        return SM_OK;
+    }
+
+    if (limited) {
+        ReleaseAsyncSlot();
+    }
+    STORE_LOG_ERROR("send async message failed, result: " << ret);
+    return ret;
+}
+
+void TcpConfigStore::AcquireAsyncSlot() noexcept
+{
+    std::unique_lock<std::mutex> locker{asyncMutex_};
+    asyncCond_.wait(locker, [this]() { return asyncInflight_ < ASYNC_INFLIGHT_MAX; });
+    asyncInflight_++;
+}
+
+void TcpConfigStore::ReleaseAsyncSlot() noexcept
+{
+    std::unique_lock<std::mutex> locker{asyncMutex_};
+    asyncInflight_--;
+    locker.unlock();
+
+    asyncCond_.notify_one();
+}
+
+Result TcpConfigStore::UnpackFirstValue(const ock::acc::AccTcpRequestContext &response,
+                                        std::vector<uint8_t> &value) noexcept
+{
+    auto data = reinterpret_cast<const uint8_t *>(response.DataPtr());
+    STORE_ASSERT_RETURN(data != nullptr, SM_MALLOC_FAILED);
+    SmemMessage responseBody;
+    auto ret = SmemMessagePacker::Unpack(data, response.DataLen(), responseBody);
+    if (ret < 0) {
+        STORE_LOG_ERROR("unpack response body failed, result: " << ret);
+        return -1;
+    }
+
+    if (responseBody.values.empty()) {
+        STORE_LOG_ERROR("response body has no value");
+        return -1;
+    }
+
+    value = std::move(responseBody.values[0]);
+    return SM_OK;
+}
+
+Result TcpConfigStore::ParseIntegerValue(const ock::acc::AccTcpRequestContext &response, int64_t &value) noexcept
+{
+    STORE_ASSERT_RETURN(response.DataPtr() != nullptr, IO_ERROR);
+    std::string data(reinterpret_cast<char *>(response.DataPtr()), response.DataLen());
+
+    value = 0;
+    auto ret = mf::StrUtil::String2Int<int64_t>(data, value);
+    STORE_ASSERT_RETURN(errno != ERANGE, IO_ERROR);
+    if ((value == 0 && data != "0") || !ret) {
+        STORE_LOG_ERROR("data=" << data);
+        return StoreErrorCode::ERROR;
+    }
+    return StoreErrorCode::SUCCESS;
+}
+
+Result TcpConfigStore::UnpackRange(const ock::acc::AccTcpRequestContext &response, SmemBytesView &bytes,
+                                   uint64_t &totalSize, uint64_t &generation) noexcept
+{
+    auto data = reinterpret_cast<const uint8_t *>(response.DataPtr());
+    STORE_ASSERT_RETURN(data != nullptr, SM_MALLOC_FAILED);
+    SmemMessageView responseBody;
+    SmemRangeHead head{};
+    auto ret = SmemMessagePacker::Unpack(data, response.DataLen(), responseBody);
+    if (ret < 0 || responseBody.values.size() != 2U || responseBody.userDef < 0 ||
+        !responseBody.values[0].ToPod(head)) {
+        STORE_LOG_ERROR("unpack range response body failed, result: " << ret);
+        return -1;
+    }
+
+    bytes = responseBody.values[1];
+    totalSize = static_cast<uint64_t>(responseBody.userDef);
+    generation = head.generation;
+    return SM_OK;
+}
+
 Result TcpConfigStore::ReConnectAfterBroken(int reconnectRetryTimes) noexcept
 {
     auto retryMaxTimes = reconnectRetryTimes < 0 ? CONNECT_RETRY_MAX_TIMES : reconnectRetryTimes;
@@ -600,7 +1136,9 @@ Result TcpConfigStore::ReConnectAfterBroken(int reconnectRetryTimes) noexcept
         STORE_LOG_ERROR_LIMIT("Reconnect to server failed, result.");
         return result;
     }
-    STORE_LOG_INFO("Reconnect to server successful.");
+    auto tlsStat = accClient_->GetTlsHandshakeStat();
+    STORE_LOG_INFO("Reconnect to server successful, tls handshakes full: "
+                   << tlsStat.fullHandshakes << ", resumed: " << tlsStat.resumedHandshakes);
     if (reconnectHandler) {
         (void)reconnectHandler();
     }
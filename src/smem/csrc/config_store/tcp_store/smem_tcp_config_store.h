@@ -36,6 +36,10 @@ public:
     {
         return true;
     }
+    virtual bool IsWatch() const noexcept
+    {
+        return false;
+    }
 };
 
 class TcpConfigStore : public ConfigStoreManager {
@@ -49,6 +53,12 @@ public:
     Result ServerStart(const smem_tls_config &tlsConfig, int reconnectRetryTimes = -1) noexcept;
     void Shutdown(bool afterFork = false) noexcept;
 
+    /**
+     * @brief Change the sizes large values are split by, both client and server of the store must be changed,
+     * set before any large value is transferred
+     */
+    Result SetValueSizeLimits(const SmemValueSizeLimits &limits) noexcept;
+
     Result Set(const std::string &key, const std::vector<uint8_t> &value) noexcept override;
     Result Add(const std::string &key, int64_t increment, int64_t &value) noexcept override;
     Result Remove(const std::string &key, bool printKeyNotExist) noexcept override;
@@ -62,6 +72,18 @@ public:
                  uint32_t &wid) noexcept override;
     Result Unwatch(uint32_t wid) noexcept override;
     Result Write(const std::string &key, const std::vector<uint8_t> &value, const uint32_t offset) noexcept override;
+    Result Barrier(const std::string &key, uint32_t size, int64_t timeoutMs) noexcept override;
+    Result GetRange(const std::string &key, uint64_t offset, uint64_t length, std::vector<uint8_t> &value,
+                    uint64_t &totalSize) noexcept override;
+    Result BitmapAlloc(const std::string &key, uint32_t bitCount, uint32_t &index) noexcept override;
+    Result BitmapRelease(const std::string &key, uint32_t index) noexcept override;
+    Result SetAsync(const std::string &key, const std::vector<uint8_t> &value,
+                    const ConfigStoreSetCallback &callback) noexcept override;
+    Result GetAsync(const std::string &key, int64_t timeoutMs, const ConfigStoreGetCallback &callback) noexcept override;
+    Result AddAsync(const std::string &key, int64_t increment, const ConfigStoreAddCallback &callback) noexcept override;
+    Result SetWithTTLAsync(const std::string &key, const std::vector<uint8_t> &value, int64_t ttlSeconds,
+                           const std::vector<std::string> &expireKeys,
+                           const ConfigStoreSetCallback &callback) noexcept override;
     std::string GetCompleteKey(const std::string &key) noexcept override
     {
         return key;
@@ -100,7 +122,22 @@ protected:
     Result GetReal(const std::string &key, std::vector<uint8_t> &value, int64_t timeoutMs) noexcept override;
 
 private:
+    using AsyncResponseHandler = std::function<void(Result result, const ock::acc::AccTcpRequestContext *response)>;
+
     std::shared_ptr<ock::acc::AccTcpRequestContext> SendMessageBlocked(const std::vector<uint8_t> &reqBody) noexcept;
+    Result SendMessageAsync(const std::vector<uint8_t> &reqBody, const AsyncResponseHandler &handler,
+                            bool limited = true) noexcept;
+    void AcquireAsyncSlot() noexcept;
+    void ReleaseAsyncSlot() noexcept;
+    static Result UnpackFirstValue(const ock::acc::AccTcpRequestContext &response,
+                                   std::vector<uint8_t> &value) noexcept;
+    static Result ParseIntegerValue(const ock::acc::AccTcpRequestContext &response, int64_t &value) noexcept;
+    static Result UnpackRange(const ock::acc::AccTcpRequestContext &response, SmemBytesView &bytes,
+                              uint64_t &totalSize, uint64_t &generation) noexcept;
+    Result GetByRanges(const std::string &key, uint64_t totalSize, std::vector<uint8_t> &value) noexcept;
+    Result GetRangesOnce(const std::string &key, uint64_t &totalSize, std::vector<uint8_t> &value,
+                         bool &changed) noexcept;
+    Result AppendStream(const std::string &key, const std::vector<uint8_t> &value, uint64_t &newSize) noexcept;
     Result LinkBrokenHandler(const ock::acc::AccTcpLinkComplexPtr &link) noexcept;
     Result ReceiveResponseHandler(const ock::acc::AccTcpRequestContext &context) noexcept;
     Result SendWatchRequest(const std::vector<uint8_t> &reqBody,
@@ -127,6 +164,19 @@ private:
     std::mutex msgCtxMutex_;
     std::unordered_map<uint32_t, std::shared_ptr<ClientCommonContext>> msgClientContext_;
     static std::atomic<uint32_t> reqSeqGen_;
+    std::atomic<uint64_t> streamIdGen_{0};
+    SmemValueSizeLimits valueLimits_;
+
+    /*
+     * responses are queued on server link, in flight asynchronous requests are limited under its queue size,
+     * gets waiting for keys are not limited, they may hold the slots long and stall all other requests
+     */
+    static constexpr uint32_t ASYNC_INFLIGHT_MAX = 32U;
+    /* gets by ranges restarted when the value is replaced in the middle, then give up */
+    static constexpr uint32_t GET_RANGES_RETRY_MAX = 3U;
+    std::mutex asyncMutex_;
+    std::condition_variable asyncCond_;
+    uint32_t asyncInflight_{0};
 
     std::mutex mutex_;
     const std::string serverIp_;
@@ -36,7 +36,13 @@ AccStoreServer::AccStoreServer(std::string ip, uint16_t port, uint32_t worldSize
                        {MessageType::CAS, &AccStoreServer::CasHandler},
                        {MessageType::WRITE, &AccStoreServer::WriteHandler},
                        {MessageType::WATCH_RANK_STATE, &AccStoreServer::WatchRankStateHandler},
-                       {MessageType::HEARTBEAT, &AccStoreServer::HeartbeatHandler}},
+                       {MessageType::HEARTBEAT, &AccStoreServer::HeartbeatHandler},
+                       {MessageType::SET_TTL, &AccStoreServer::SetHandler},
+                       {MessageType::BARRIER, &AccStoreServer::BarrierHandler},
+                       {MessageType::BITMAP_ALLOC, &AccStoreServer::BitmapAllocHandler},
+                       {MessageType::BITMAP_RELEASE, &AccStoreServer::BitmapReleaseHandler},
+                       {MessageType::GET_RANGE, &AccStoreServer::GetRangeHandler},
+                       {MessageType::APPEND_STREAM, &AccStoreServer::AppendStreamHandler}},
       backend_(std::move(backend)), listenIp_{std::move(ip)}, listenPort_{port}, worldSize_{worldSize}
 {}
 
@@ -54,6 +60,13 @@ Result AccStoreServer::Startup(const smem_tls_config &tlsConfig) noexcept
         return SM_NEW_OBJECT_FAILED;
     }
 
+    if (backend_->IsPersistent()) {
+        // link ids restart from zero in new process, ranks bound to links of the old process are invalid
+        auto count = backend_->DeletePrefix(autoRankingStr_);
+        STORE_LOG_INFO("store restored by backend: " << backend_->BackendName() << ", drop " << count
+                                                     << " ranking keys of old links");
+    }
+
     accTcpServer_->RegisterNewRequestHandler(
         0, [this](const ock::acc::AccTcpRequestContext &context) { return ReceiveMessageHandler(context); });
     accTcpServer_->RegisterNewLinkHandler(
@@ -144,6 +157,11 @@ void AccStoreServer::RegisterBrokenLinkCHandler(const ConfigStoreServerBrokenHan
     externalBrokenHandler_ = handler;
 }
 
+void AccStoreServer::SetValueSizeLimits(const SmemValueSizeLimits &limits) noexcept
+{
+    valueLimits_ = limits;
+}
+
 Result AccStoreServer::ReceiveMessageHandler(const ock::acc::AccTcpRequestContext &context) noexcept
 {
     auto data = reinterpret_cast<const uint8_t *>(context.DataPtr());
@@ -153,7 +171,7 @@ Result AccStoreServer::ReceiveMessageHandler(const ock::acc::AccTcpRequestContex
         return SM_INVALID_PARAM;
     }
 
-    SmemMessage requestMessage;
+    SmemMessageView requestMessage;
     auto size = SmemMessagePacker::Unpack(data, context.DataLen(), requestMessage);
     if (size < 0) {
         STORE_LOG_ERROR("request(" << context.SeqNo() << ") handle invalid body");
@@ -177,6 +195,8 @@ Result AccStoreServer::LinkConnectedHandler(const ock::acc::AccConnReq &req,
     STORE_LOG_INFO("new link connected, linkId: " << link->Id() << ", rank: " << std::hex << req.rankId);
     uint32_t worldSize = static_cast<uint32_t>(req.rankId >> 32);
     uint32_t rankId = static_cast<uint32_t>(req.rankId & 0xFFFFFFFF);
+    // links are accepted by several handshake threads concurrently
+    std::unique_lock<std::mutex> lockGuard{storeMutex_};
     if (worldSize_ == std::numeric_limits<uint32_t>::max()) {
         worldSize_ = worldSize;
         STORE_LOG_INFO("Success to fix world size:" << worldSize_);
@@ -192,7 +212,6 @@ Result AccStoreServer::LinkConnectedHandler(const ock::acc::AccConnReq &req,
     } trans{};
     trans.rankId = rankId;
 
-    std::unique_lock<std::mutex> lockGuard{storeMutex_};
     auto ret = backend_->Put(autoRankingStr, std::vector<uint8_t>(trans.data, trans.data + sizeof(trans.data)), 0);
     STORE_ASSERT_RETURN(ret == SUCCESS, ret);
     aliveRankSet_.insert(rankId);
@@ -222,6 +241,7 @@ Result AccStoreServer::LinkBrokenHandler(const ock::acc::AccTcpLinkComplexPtr &l
         STORE_LOG_INFO("link broken, linkId: " << linkId << " remove rankId: " << rankId);
     }
     heartBeatMap_.erase(link->Id());
+    appendStreams_.erase(linkId);
     if (externalBrokenHandler_ != nullptr) {
         externalBrokenHandler_(link->Id(), backend_);
     } else if (aliveRankSet_.empty()) {
@@ -231,6 +251,7 @@ Result AccStoreServer::LinkBrokenHandler(const ock::acc::AccTcpLinkComplexPtr &l
         waitCtx_.clear();
         keyWaiters_.clear();
         timedWaiters_.clear();
+        barriers_.clear();
         rankStateWaiters_.clear();
         rankStateTaskQueue_ = {};
     }
@@ -251,27 +272,33 @@ Result AccStoreServer::LinkBrokenHandler(const uint32_t linkId) noexcept
         externalBrokenHandler_(linkId, backend_);
     }
     heartBeatMap_.erase(linkId);
+    appendStreams_.erase(linkId);
     return SM_OK;
 }
 
-Result AccStoreServer::SetHandler(const ock::acc::AccTcpRequestContext &context, SmemMessage &request) noexcept
+Result AccStoreServer::SetHandler(const ock::acc::AccTcpRequestContext &context, SmemMessageView &request) noexcept
 {
-    if (request.keys.size() != 1 || request.values.size() != 1) {
+    auto withTTL = request.mt == MessageType::SET_TTL;
+    if ((withTTL ? request.keys.empty() : request.keys.size() != 1) || request.values.size() != 1) {
         STORE_LOG_ERROR("request(" << context.SeqNo() << ") handle invalid body");
         ReplyWithMessage(context, StoreErrorCode::INVALID_MESSAGE, "invalid request: key value should be one");
         return SM_INVALID_PARAM;
     }
 
-    auto &key = request.keys[0];
-    auto &value = request.values[0];
-    if (key.length() > MAX_KEY_LEN_SERVER) {
-        STORE_LOG_ERROR("key length too large, length: " << key.length());
-        return StoreErrorCode::INVALID_KEY;
+    for (auto &k : request.keys) {
+        if (k.length() > MAX_KEY_LEN_SERVER) {
+            STORE_LOG_ERROR("key length too large, length: " << k.length());
+            return StoreErrorCode::INVALID_KEY;
+        }
     }
 
+    std::string key{request.keys[0]};
+    auto &value = request.values[0];
+    auto ttlSeconds = (withTTL && backend_->SupportsTTL()) ? request.userDef : 0L;
+
     STORE_LOG_DEBUG("SET REQUEST(" << context.SeqNo() << ") for key(" << key << ") start.");
     std::list<ock::acc::AccTcpRequestContext> wakeupWaiters;
-    std::vector<uint8_t> reqVal;
+    StoreValuePtr reqVal;
     std::unique_lock<std::mutex> lockGuard{storeMutex_};
 
     if (ExecuteHandle(MessageType::SET, context.Link()->Id(), key, value) != SM_OK) {
@@ -280,17 +307,22 @@ Result AccStoreServer::SetHandler(const ock::acc::AccTcpRequestContext &context,
         ReplyWithMessage(context, StoreErrorCode::ERROR, "failed");
         return StoreErrorCode::ERROR;
     }
+    auto storeValue = StoreValue::Create(value.data, value.size);
     auto ret = backend_->Exist(key);
     if (ret != SUCCESS) {
         auto wPos = keyWaiters_.find(key);
         if (wPos != keyWaiters_.end()) {
             wakeupWaiters = GetOutWaitersInLock(wPos->second);
-            reqVal = value;
+            reqVal = storeValue;
             keyWaiters_.erase(wPos);
         }
-        ret = backend_->Put(key, std::move(value), 0);
-    } else {
-        ret = backend_->Put(key, std::move(value), 0);
+    }
+    ret = backend_->PutValue(key, storeValue, ttlSeconds);
+    if (ret == SUCCESS && ttlSeconds > 0) {
+        // keys already done with, expire together instead of removing by more requests
+        for (auto i = 1UL; i < request.keys.size(); i++) {
+            (void)backend_->Expire(std::string{request.keys[i]}, ttlSeconds);
+        }
     }
     lockGuard.unlock();
 
@@ -302,12 +334,197 @@ Result AccStoreServer::SetHandler(const ock::acc::AccTcpRequestContext &context,
     return SM_OK;
 }
 
-Result AccStoreServer::FindOrInsertRank(const ock::acc::AccTcpRequestContext &context, SmemMessage &request) noexcept
+Result AccStoreServer::BarrierHandler(const ock::acc::AccTcpRequestContext &context, SmemMessageView &request) noexcept
+{
+    if (request.keys.size() != 1 || request.values.size() != 1) {
+        STORE_LOG_ERROR("request(" << context.SeqNo() << ") handle invalid body");
+        ReplyWithMessage(context, StoreErrorCode::INVALID_MESSAGE, "invalid request: key value should be one");
+        return SM_INVALID_PARAM;
+    }
+
+    std::string key{request.keys[0]};
+    if (key.length() > MAX_KEY_LEN_SERVER) {
+        STORE_LOG_ERROR("key length too large, length: " << key.length());
+        return StoreErrorCode::INVALID_KEY;
+    }
+
+    std::string sizeStr{request.values[0].AsString()};
+    long size = 0;
+    if (!mf::StrUtil::String2Int<long>(sizeStr, size) || size <= 0 || size > UINT32_MAX) {
+        STORE_LOG_ERROR("request(" << context.SeqNo() << ") barrier for key(" << key << ") invalid size: " << sizeStr);
+        ReplyWithMessage(context, StoreErrorCode::INVALID_MESSAGE, "invalid request: size should be a number.");
+        return SM_INVALID_PARAM;
+    }
+
+    STORE_LOG_DEBUG("BARRIER REQUEST(" << context.SeqNo() << ") for key(" << key << ") size(" << size << ") start.");
+    // the last one and all parked ones are replied with the same buffer
+    std::vector<ock::acc::AccDataBufferPtr> segments{ock::acc::AccDataBuffer::Create("ok", 2UL)};
+    if (segments[0] == nullptr) {
+        STORE_LOG_ERROR("create response message failed");
+        return SM_MALLOC_FAILED;
+    }
+
+    std::unique_lock<std::mutex> lockGuard{storeMutex_};
+    auto &barrier = barriers_[key];
+    if (barrier.expected == 0) {
+        barrier.expected = static_cast<uint32_t>(size);
+    } else if (barrier.expected != static_cast<uint32_t>(size)) {
+        lockGuard.unlock();
+        STORE_LOG_ERROR("request(" << context.SeqNo() << ") barrier for key(" << key << ") size(" << size
+                                   << ") not match: " << barrier.expected);
+        ReplyWithMessage(context, StoreErrorCode::INVALID_MESSAGE, "invalid request: size not match.");
+        return SM_INVALID_PARAM;
+    }
+
+    if (++barrier.arrived < barrier.expected) {
+        if (request.userDef == 0) {
+            // not waiting, it leaves at once and the barrier still waits for a full round
+            if (--barrier.arrived == 0) {
+                barriers_.erase(key);
+            }
+            lockGuard.unlock();
+            ReplyWithMessage(context, StoreErrorCode::TIMEOUT, "<timeout>");
+            return SM_OK;
+        }
+
+        auto timeout = std::chrono::steady_clock::now() + std::chrono::milliseconds(request.userDef);
+        auto timeoutMs = std::chrono::duration_cast<std::chrono::milliseconds>(timeout.time_since_epoch()).count();
+        StoreWaitContext waitContext{timeoutMs, key, context};
+        auto id = waitContext.Id();
+        waitCtx_.emplace(id, std::move(waitContext));
+        barrier.waiters.emplace(id);
+        if (request.userDef > 0) {
+            timedWaiters_[timeoutMs].emplace(id);
+        }
+        return SM_OK;
+    }
+
+    auto waiters = GetOutWaitersInLock(barrier.waiters);
+    barriers_.erase(key);
+    lockGuard.unlock();
+
+    ReplyWithSegments(context, StoreErrorCode::SUCCESS, segments);
+    for (auto &ctx : waiters) {
+        if (ctx.Link()->Established()) {
+            ReplyWithSegments(ctx, StoreErrorCode::SUCCESS, segments);
+        }
+    }
+    STORE_LOG_DEBUG("BARRIER REQUEST(" << context.SeqNo() << ") for key(" << key << ") reached, wakeup "
+                                       << waiters.size());
+    return SM_OK;
+}
+
+Result AccStoreServer::BitmapAllocHandler(const ock::acc::AccTcpRequestContext &context,
+                                          SmemMessageView &request) noexcept
+{
+    uint32_t bitCount = 0;
+    if (!ParseBitmapRequest(context, request, bitCount) || bitCount == 0) {
+        return SM_INVALID_PARAM;
+    }
+
+    std::string key{request.keys[0]};
+    STORE_LOG_DEBUG("BITMAP_ALLOC REQUEST(" << context.SeqNo() << ") for key(" << key << ") bits(" << bitCount
+                                            << ") start.");
+    std::vector<uint8_t> bitmap;
+    std::list<ock::acc::AccTcpRequestContext> wakeupWaiters;
+    std::unique_lock<std::mutex> lockGuard{storeMutex_};
+    if (backend_->Get(key, bitmap) != SUCCESS) {
+        auto wPos = keyWaiters_.find(key);
+        if (wPos != keyWaiters_.end()) {
+            wakeupWaiters = GetOutWaitersInLock(wPos->second);
+            keyWaiters_.erase(wPos);
+        }
+    }
+
+    bitmap.resize(std::max(bitmap.size(), static_cast<size_t>((bitCount + BITS_PER_BYTE - 1U) / BITS_PER_BYTE)), 0);
+    auto index = bitCount;
+    for (auto i = 0U; i < bitCount; i++) {
+        if ((bitmap[i / BITS_PER_BYTE] & (1U << (i % BITS_PER_BYTE))) == 0) {
+            bitmap[i / BITS_PER_BYTE] |= static_cast<uint8_t>(1U << (i % BITS_PER_BYTE));
+            index = i;
+            break;
+        }
+    }
+
+    StoreValuePtr reqVal;
+    auto ret = StoreErrorCode::IN_USE;
+    if (index < bitCount) {
+        reqVal = StoreValue::Create(std::move(bitmap));
+        ret = backend_->PutValue(key, reqVal, 0);
+    }
+    lockGuard.unlock();
+
+    STORE_LOG_DEBUG("BITMAP_ALLOC REQUEST(" << context.SeqNo() << ") for key(" << key << ") index(" << index
+                                            << ") end.");
+    ReplyWithMessage(context, ret, std::to_string(index));
+    if (!wakeupWaiters.empty() && reqVal != nullptr) {
+        WakeupWaiters(wakeupWaiters, reqVal);
+    }
+    return SM_OK;
+}
+
+Result AccStoreServer::BitmapReleaseHandler(const ock::acc::AccTcpRequestContext &context,
+                                            SmemMessageView &request) noexcept
+{
+    uint32_t index = 0;
+    if (!ParseBitmapRequest(context, request, index)) {
+        return SM_INVALID_PARAM;
+    }
+
+    std::string key{request.keys[0]};
+    STORE_LOG_DEBUG("BITMAP_RELEASE REQUEST(" << context.SeqNo() << ") for key(" << key << ") index(" << index
+                                              << ") start.");
+    std::vector<uint8_t> bitmap;
+    auto bytePos = index / BITS_PER_BYTE;
+    auto bitMask = static_cast<uint8_t>(1U << (index % BITS_PER_BYTE));
+    std::unique_lock<std::mutex> lockGuard{storeMutex_};
+    auto ret = backend_->Get(key, bitmap);
+    if (ret == SUCCESS && (bytePos >= bitmap.size() || (bitmap[bytePos] & bitMask) == 0)) {
+        ret = StoreErrorCode::NOT_EXIST;
+    }
+    if (ret == SUCCESS) {
+        bitmap[bytePos] &= static_cast<uint8_t>(~bitMask);
+        ret = backend_->PutValue(key, StoreValue::Create(std::move(bitmap)), 0);
+    }
+    lockGuard.unlock();
+
+    ReplyWithMessage(context, ret, ret == SUCCESS ? "ok" : "<not_exist>");
+    return SM_OK;
+}
+
+bool AccStoreServer::ParseBitmapRequest(const ock::acc::AccTcpRequestContext &context, SmemMessageView &request,
+                                        uint32_t &number) noexcept
 {
+    if (request.keys.size() != 1 || request.values.size() != 1) {
+        STORE_LOG_ERROR("request(" << context.SeqNo() << ") handle invalid body");
+        ReplyWithMessage(context, StoreErrorCode::INVALID_MESSAGE, "invalid request: key value should be one");
+        return false;
+    }
+
     auto &key = request.keys[0];
+    if (key.length() > MAX_KEY_LEN_SERVER) {
+        STORE_LOG_ERROR("key length too large, length: " << key.length());
+        ReplyWithMessage(context, StoreErrorCode::INVALID_KEY, "invalid request: key too long.");
+        return false;
+    }
+
+    std::string numberStr{request.values[0].AsString()};
+    long value = 0;
+    if (!mf::StrUtil::String2Int<long>(numberStr, value) || value < 0 || value > BITMAP_BITS_MAX) {
+        STORE_LOG_ERROR("request(" << context.SeqNo() << ") bitmap for key(" << key << ") invalid: " << numberStr);
+        ReplyWithMessage(context, StoreErrorCode::INVALID_MESSAGE, "invalid request: value should be a number.");
+        return false;
+    }
+    number = static_cast<uint32_t>(value);
+    return true;
+}
+
+Result AccStoreServer::FindOrInsertRank(const ock::acc::AccTcpRequestContext &context,
+                                        SmemMessageView &request) noexcept
+{
     STORE_ASSERT_RETURN(context.Link() != nullptr, SM_INVALID_PARAM);
     auto linkId = context.Link()->Id();
-    auto rankingKey = key + std::to_string(linkId);
+    auto rankingKey = std::string{request.keys[0]} + std::to_string(linkId);
     STORE_LOG_DEBUG("GET rankingKey(" << rankingKey << ") start.");
     SmemMessage responseMessage{request.mt};
     std::unique_lock<std::mutex> lockGuard{storeMutex_};
@@ -353,7 +570,46 @@ Result AccStoreServer::FindOrInsertRank(const ock::acc::AccTcpRequestContext &co
     return 0;
 }
 
-Result AccStoreServer::GetHandler(const ock::acc::AccTcpRequestContext &context, SmemMessage &request) noexcept
+Result AccStoreServer::GetRangeHandler(const ock::acc::AccTcpRequestContext &context,
+                                       SmemMessageView &request) noexcept
+{
+    SmemValueRange range{};
+    if (request.keys.size() != 1 || request.values.size() != 1 || !request.values[0].ToPod(range)) {
+        STORE_LOG_ERROR("request(" << context.SeqNo() << ") handle invalid body");
+        ReplyWithMessage(context, StoreErrorCode::INVALID_MESSAGE, "invalid request: key & range should be one.");
+        return SM_INVALID_PARAM;
+    }
+
+    std::string key{request.keys[0]};
+    if (key.length() > MAX_KEY_LEN_SERVER) {
+        STORE_LOG_ERROR("key length too large, length: " << key.length());
+        return StoreErrorCode::INVALID_KEY;
+    }
+
+    STORE_LOG_DEBUG("GET_RANGE REQUEST(" << context.SeqNo() << ") for key(" << key << ") offset(" << range.offset
+                                         << ") length(" << range.length << ") start.");
+    StoreValuePtr value;
+    std::unique_lock<std::mutex> lockGuard{storeMutex_};
+    auto ret = backend_->GetValue(key, value);
+    lockGuard.unlock();
+    if (ret != SUCCESS) {
+        ReplyWithMessage(context, StoreErrorCode::NOT_EXIST, "<not exist>");
+        return SM_OK;
+    }
+
+    if (range.offset > value->Size() || range.length > valueLimits_.valueChunkSize) {
+        STORE_LOG_ERROR("request(" << context.SeqNo() << ") get range for key(" << key << ") out of value size: "
+                                   << value->Size());
+        ReplyWithMessage(context, StoreErrorCode::INVALID_MESSAGE, "invalid request: range out of value.");
+        return SM_INVALID_PARAM;
+    }
+
+    auto length = std::min(range.length, value->Size() - range.offset);
+    ReplyWithSegments(context, StoreErrorCode::SUCCESS, BuildRangeSegments(request.mt, value, range.offset, length));
+    return SM_OK;
+}
+
+Result AccStoreServer::GetHandler(const ock::acc::AccTcpRequestContext &context, SmemMessageView &request) noexcept
 {
     if (request.keys.size() != 1 || !request.values.empty()) {
         STORE_LOG_ERROR("request(" << context.SeqNo() << ") handle invalid body");
@@ -361,7 +617,7 @@ Result AccStoreServer::GetHandler(const ock::acc::AccTcpRequestContext &context,
         return SM_INVALID_PARAM;
     }
 
-    auto &key = request.keys[0];
+    std::string key{request.keys[0]};
     if (key.length() > MAX_KEY_LEN_SERVER) {
         STORE_LOG_ERROR("key length too large, length: " << key.length());
         return StoreErrorCode::INVALID_KEY;
@@ -374,15 +630,15 @@ Result AccStoreServer::GetHandler(const ock::acc::AccTcpRequestContext &context,
     STORE_LOG_DEBUG("GET REQUEST(" << context.SeqNo() << ") for key(" << key << ") start.");
     SmemMessage responseMessage{request.mt};
     std::unique_lock<std::mutex> lockGuard{storeMutex_};
-    std::vector<uint8_t> oldValue;
-    auto ret = backend_->Get(key, oldValue);
+    StoreValuePtr oldValue;
+    auto ret = backend_->GetValue(key, oldValue);
     if (ret == SUCCESS) {
-        responseMessage.values.push_back(oldValue);
         lockGuard.unlock();
 
         STORE_LOG_DEBUG("GET REQUEST(" << context.SeqNo() << ") for key(" << key << ") success.");
-        auto response = SmemMessagePacker::Pack(responseMessage);
-        ReplyWithMessage(context, StoreErrorCode::SUCCESS, response);
+        int16_t code = StoreErrorCode::SUCCESS;
+        auto segments = BuildValueSegments(request.mt, oldValue, code);
+        ReplyWithSegments(context, code, segments);
         return SM_OK;
     }
 
@@ -427,7 +683,7 @@ Result AccStoreServer::GetHandler(const ock::acc::AccTcpRequestContext &context,
     return SM_OK;
 }
 
-Result AccStoreServer::AddHandler(const ock::acc::AccTcpRequestContext &context, SmemMessage &request) noexcept
+Result AccStoreServer::AddHandler(const ock::acc::AccTcpRequestContext &context, SmemMessageView &request) noexcept
 {
     if (request.keys.size() != 1 || request.values.size() != 1) {
         STORE_LOG_ERROR("request(" << context.SeqNo() << ") handle invalid body");
@@ -435,14 +691,14 @@ Result AccStoreServer::AddHandler(const ock::acc::AccTcpRequestContext &context,
         return SM_INVALID_PARAM;
     }
 
-    auto &key = request.keys[0];
+    std::string key{request.keys[0]};
     auto &value = request.values[0];
     if (key.length() > MAX_KEY_LEN_SERVER) {
         STORE_LOG_ERROR("key length too large, length: " << key.length());
         return StoreErrorCode::INVALID_KEY;
     }
 
-    std::string valueStr{value.begin(), value.end()};
+    std::string valueStr{value.AsString()};
     STORE_LOG_DEBUG("ADD REQUEST(" << context.SeqNo() << ") for key(" << key << ") value(" << valueStr << ") start.");
 
     long valueNum;
@@ -456,7 +712,7 @@ Result AccStoreServer::AddHandler(const ock::acc::AccTcpRequestContext &context,
 
     auto responseValue = valueNum;
     std::list<ock::acc::AccTcpRequestContext> wakeupWaiters;
-    std::vector<uint8_t> reqVal;
+    StoreValuePtr reqVal;
     std::unique_lock<std::mutex> lockGuard{storeMutex_};
     if (valueNum > 0 && ExecuteHandle(MessageType::ADD, context.Link()->Id(), key, value) != SM_OK) {
         lockGuard.unlock();
@@ -470,10 +726,10 @@ Result AccStoreServer::AddHandler(const ock::acc::AccTcpRequestContext &context,
         auto wPos = keyWaiters_.find(key);
         if (wPos != keyWaiters_.end()) {
             wakeupWaiters = GetOutWaitersInLock(wPos->second);
-            reqVal = value;
             keyWaiters_.erase(wPos);
         }
-        ret = backend_->Put(key, std::move(value), 0);
+        reqVal = StoreValue::Create(value.data, value.size);
+        ret = backend_->PutValue(key, reqVal, 0);
     } else {
         std::string oldValueStr{oldValue.begin(), oldValue.end()};
         long storedValueNum = 0;
@@ -500,7 +756,7 @@ Result AccStoreServer::AddHandler(const ock::acc::AccTcpRequestContext &context,
     return SM_OK;
 }
 
-Result AccStoreServer::RemoveHandler(const ock::acc::AccTcpRequestContext &context, SmemMessage &request) noexcept
+Result AccStoreServer::RemoveHandler(const ock::acc::AccTcpRequestContext &context, SmemMessageView &request) noexcept
 {
     if (request.keys.size() != 1 || !request.values.empty()) {
         STORE_LOG_ERROR("request(" << context.SeqNo() << ") handle invalid body");
@@ -508,7 +764,7 @@ Result AccStoreServer::RemoveHandler(const ock::acc::AccTcpRequestContext &conte
         return SM_INVALID_PARAM;
     }
 
-    auto &key = request.keys[0];
+    std::string key{request.keys[0]};
     if (key.length() > MAX_KEY_LEN_SERVER) {
         STORE_LOG_ERROR("key length too large, length: " << key.length());
         return StoreErrorCode::INVALID_KEY;
@@ -529,7 +785,7 @@ Result AccStoreServer::RemoveHandler(const ock::acc::AccTcpRequestContext &conte
     return SM_OK;
 }
 
-Result AccStoreServer::AppendHandler(const ock::acc::AccTcpRequestContext &context, SmemMessage &request) noexcept
+Result AccStoreServer::AppendHandler(const ock::acc::AccTcpRequestContext &context, SmemMessageView &request) noexcept
 {
     if (request.keys.size() != 1 || request.values.size() != 1) {
         STORE_LOG_ERROR("request(" << context.SeqNo() << ") handle invalid body");
@@ -537,7 +793,7 @@ Result AccStoreServer::AppendHandler(const ock::acc::AccTcpRequestContext &conte
         return SM_INVALID_PARAM;
     }
 
-    auto &key = request.keys[0];
+    std::string key{request.keys[0]};
     auto &value = request.values[0];
     if (key.length() > MAX_KEY_LEN_SERVER) {
         STORE_LOG_ERROR("key length too large, length: " << key.length());
@@ -545,28 +801,100 @@ Result AccStoreServer::AppendHandler(const ock::acc::AccTcpRequestContext &conte
     }
 
     STORE_LOG_DEBUG("APPEND REQUEST(" << context.SeqNo() << ") for key(" << key << ") start.");
-    uint64_t newSize;
-    std::list<ock::acc::AccTcpRequestContext> wakeupWaiters;
-    std::vector<uint8_t> reqVal;
-    std::vector<uint8_t> appendValue = value;
+    return AppendAndReply(context, key, value.ToVector());
+}
+
+Result AccStoreServer::AppendStreamHandler(const ock::acc::AccTcpRequestContext &context,
+                                           SmemMessageView &request) noexcept
+{
+    SmemStreamHead head{};
+    if (request.keys.size() != 1 || request.values.size() != 2 || !request.values[0].ToPod(head)) {
+        STORE_LOG_ERROR("request(" << context.SeqNo() << ") handle invalid body");
+        ReplyWithMessage(context, StoreErrorCode::INVALID_MESSAGE, "invalid request: key & chunk should be one.");
+        return SM_INVALID_PARAM;
+    }
+
+    std::string key{request.keys[0]};
+    auto &chunk = request.values[1];
+    if (key.length() > MAX_KEY_LEN_SERVER) {
+        STORE_LOG_ERROR("key length too large, length: " << key.length());
+        return StoreErrorCode::INVALID_KEY;
+    }
+    if (head.total > MAX_STREAM_VALUE_SIZE || head.offset > head.total || chunk.size > head.total - head.offset) {
+        STORE_LOG_ERROR("request(" << context.SeqNo() << ") append stream for key(" << key << ") invalid chunk, "
+                                   << "offset:" << head.offset << " size:" << chunk.size << " total:" << head.total);
+        ReplyWithMessage(context, StoreErrorCode::INVALID_MESSAGE, "invalid request: chunk out of value.");
+        return SM_INVALID_PARAM;
+    }
+
+    // chunks of a stream come in order on the link, and are handled one by one in the worker of the link
+    auto linkId = context.Link()->Id();
+    StoreAppendStreamPtr stream;
     std::unique_lock<std::mutex> lockGuard{storeMutex_};
-    std::vector<uint8_t> oldValue;
-    auto ret = backend_->Get(key, oldValue);
-    if (ret == SUCCESS) {
-        oldValue.insert(oldValue.end(), value.begin(), value.end());
-        newSize = oldValue.size();
-        ret = backend_->Put(key, oldValue, 0);
+    auto &streams = appendStreams_[linkId];
+    if (head.offset == 0) {
+        stream = std::make_shared<StoreAppendStream>();
+        stream->key = key;
+        stream->total = head.total;
+        streams[head.streamId] = stream;
     } else {
-        newSize = value.size();
+        auto pos = streams.find(head.streamId);
+        stream = pos == streams.end() ? nullptr : pos->second;
+    }
+    auto inOrder = stream != nullptr && stream->key == key && stream->total == head.total &&
+                   stream->data.size() == head.offset;
+    auto completed = inOrder && head.offset + chunk.size == head.total;
+    if (!inOrder || completed) {
+        streams.erase(head.streamId);
+    }
+    if (streams.empty()) {
+        appendStreams_.erase(linkId);
+    }
+    lockGuard.unlock();
+
+    if (!inOrder) {
+        STORE_LOG_ERROR("request(" << context.SeqNo() << ") append stream(" << head.streamId << ") for key(" << key
+                                   << ") chunk at " << head.offset << " out of order");
+        ReplyWithMessage(context, StoreErrorCode::INVALID_MESSAGE, "invalid request: chunk out of order.");
+        return SM_INVALID_PARAM;
+    }
+
+    if (head.offset == 0) {
+        stream->data.reserve(head.total);
+    }
+    stream->data.insert(stream->data.end(), chunk.data, chunk.data + chunk.size);
+    if (!completed) {
+        ReplyWithMessage(context, StoreErrorCode::SUCCESS, std::to_string(stream->data.size()));
+        return SM_OK;
+    }
+
+    STORE_LOG_DEBUG("APPEND_STREAM REQUEST(" << context.SeqNo() << ") for key(" << key << ") size(" << head.total
+                                             << ") completed.");
+    return AppendAndReply(context, key, std::move(stream->data));
+}
+
+Result AccStoreServer::AppendAndReply(const ock::acc::AccTcpRequestContext &context, std::string &key,
+                                      std::vector<uint8_t> &&value) noexcept
+{
+    // only hooked ops pay for a private copy of the value
+    std::vector<uint8_t> hookValue;
+    if (externalOpHandlerMap_.find(MessageType::APPEND) != externalOpHandlerMap_.end()) {
+        hookValue = value;
+    }
+
+    std::list<ock::acc::AccTcpRequestContext> wakeupWaiters;
+    StoreValuePtr newValue;
+    std::unique_lock<std::mutex> lockGuard{storeMutex_};
+    if (backend_->Exist(key) != SUCCESS) {
         auto wPos = keyWaiters_.find(key);
         if (wPos != keyWaiters_.end()) {
             wakeupWaiters = GetOutWaitersInLock(wPos->second);
-            reqVal = value;
             keyWaiters_.erase(wPos);
         }
-        ret = backend_->Put(key, std::move(value), 0);
     }
-    if (ExecuteHandle(MessageType::APPEND, context.Link()->Id(), key, appendValue) != SM_OK) {
+    auto ret = backend_->AppendValue(key, std::move(value), newValue);
+    uint64_t newSize = newValue == nullptr ? 0 : newValue->Size();
+    if (ExecuteHandle(MessageType::APPEND, context.Link()->Id(), key, hookValue) != SM_OK) {
         lockGuard.unlock();
         STORE_LOG_ERROR("APPEND REQUEST(" << context.SeqNo() << ") for key(" << key << ") excute handle failed.");
         ReplyWithMessage(context, StoreErrorCode::ERROR, "failed");
@@ -575,20 +903,20 @@ Result AccStoreServer::AppendHandler(const ock::acc::AccTcpRequestContext &conte
     lockGuard.unlock();
     ReplyWithMessage(context, ret, std::to_string(newSize));
     if (!wakeupWaiters.empty()) {
-        WakeupWaiters(wakeupWaiters, value);
+        WakeupWaiters(wakeupWaiters, newValue);
     }
 
     return SM_OK;
 }
 
-Result AccStoreServer::WriteHandler(const ock::acc::AccTcpRequestContext &context, SmemMessage &request) noexcept
+Result AccStoreServer::WriteHandler(const ock::acc::AccTcpRequestContext &context, SmemMessageView &request) noexcept
 {
     if (request.keys.size() != 1 || request.values.size() != 1) {
         STORE_LOG_ERROR("request(" << context.SeqNo() << ") handle invalid body");
         ReplyWithMessage(context, StoreErrorCode::INVALID_MESSAGE, "invalid request: key & value should be one.");
         return SM_INVALID_PARAM;
     }
-    auto &key = request.keys[0];
+    std::string key{request.keys[0]};
     auto &value = request.values[0];
 
     if (key.length() > MAX_KEY_LEN_SERVER) {
@@ -596,8 +924,10 @@ Result AccStoreServer::WriteHandler(const ock::acc::AccTcpRequestContext &contex
         return StoreErrorCode::INVALID_KEY;
     }
     STORE_LOG_INFO("WRITE REQUEST(" << context.SeqNo() << ") for key(" << key << ") start.");
-    uint32_t offset = *(reinterpret_cast<uint32_t *>(value.data()));
-    size_t realValSize = value.size() - sizeof(uint32_t);
+    STORE_VALIDATE_RETURN(value.size >= sizeof(uint32_t), "value too short, size:" << value.size,
+                          StoreErrorCode::INVALID_MESSAGE);
+    uint32_t offset = *(reinterpret_cast<const uint32_t *>(value.data));
+    size_t realValSize = value.size - sizeof(uint32_t);
     STORE_VALIDATE_RETURN(offset <= MAX_U16_INDEX * realValSize, "offset too large, offset:" << offset,
                           StoreErrorCode::INVALID_KEY);
 
@@ -621,7 +951,7 @@ Result AccStoreServer::WriteHandler(const ock::acc::AccTcpRequestContext &contex
         curValue.resize(offset + realValSize, 0);
         STORE_LOG_INFO("write: not enough kvStore room, expansion size: " << (offset + realValSize));
     }
-    std::copy_n(value.data() + sizeof(uint32_t), realValSize, curValue.data() + offset);
+    std::copy_n(value.data + sizeof(uint32_t), realValSize, curValue.data() + offset);
     if (ExecuteHandle(MessageType::WRITE, context.Link()->Id(), key, value) != SM_OK) {
         lockGuard.unlock();
         STORE_LOG_ERROR("WRITE REQUEST(" << context.SeqNo() << ") for key(" << key << ") excute handle failed.");
@@ -642,7 +972,7 @@ Result AccStoreServer::WriteHandler(const ock::acc::AccTcpRequestContext &contex
 }
 
 Result AccStoreServer::CasHandler(const ock::acc::AccTcpRequestContext &context,
-                                  ock::smem::SmemMessage &request) noexcept
+                                  SmemMessageView &request) noexcept
 {
     const size_t EXPECTDE_KEY = 1;
     const size_t EXPECTED_VAL = 2;
@@ -652,34 +982,32 @@ Result AccStoreServer::CasHandler(const ock::acc::AccTcpRequestContext &context,
         ReplyWithMessage(context, StoreErrorCode::INVALID_MESSAGE, "invalid request: count(key)=1 & count(value)=2");
         return SM_INVALID_PARAM;
     }
-    auto &key = request.keys[0];
+    std::string key{request.keys[0]};
     auto &expected = request.values[0];
-    auto &exchange = request.values[1];
-    auto newValue = exchange;
     if (key.length() > MAX_KEY_LEN_SERVER) {
         STORE_LOG_ERROR("key length too large, length: " << key.length());
         return StoreErrorCode::INVALID_KEY;
     }
-    std::string newValueStr = std::string{newValue.begin(), newValue.end()};
+    auto exchange = StoreValue::Create(request.values[1].data, request.values[1].size);
     std::vector<uint8_t> exists;
     SmemMessage responseMessage{request.mt};
     std::list<ock::acc::AccTcpRequestContext> wakeupWaiters;
     STORE_LOG_DEBUG("CAS REQUEST(" << context.SeqNo() << ") for key(" << key
-                                   << ") start, newValueStr: " << newValueStr);
+                                   << ") start, newValueStr: " << request.values[1].AsString());
     std::unique_lock<std::mutex> lockGuard{storeMutex_};
     std::vector<uint8_t> oldValue;
     auto ret = backend_->Get(key, oldValue);
     if (ret == SUCCESS) {
-        if (expected == oldValue) {
+        if (expected.Equals(oldValue)) {
             exists = std::move(oldValue);
-            ret = backend_->Put(key, exchange, 0);
+            ret = backend_->PutValue(key, exchange, 0);
         } else {
-            exists = oldValue;
+            exists = std::move(oldValue);
         }
     } else {
         ret = SUCCESS;
-        if (expected.empty()) {
-            ret = backend_->Put(key, exchange, 0);
+        if (expected.Empty()) {
+            ret = backend_->PutValue(key, exchange, 0);
             auto wPos = keyWaiters_.find(key);
             if (wPos != keyWaiters_.end()) {
                 wakeupWaiters = GetOutWaitersInLock(wPos->second);
@@ -691,16 +1019,17 @@ Result AccStoreServer::CasHandler(const ock::acc::AccTcpRequestContext &context,
     std::string existsStr = std::string{exists.begin(), exists.end()};
     STORE_LOG_DEBUG("CAS REQUEST(" << context.SeqNo() << ") for key(" << key << ") finished, existsStr: " << existsStr);
 
-    responseMessage.values.push_back(exists);
+    responseMessage.values.push_back(std::move(exists));
     auto response = SmemMessagePacker::Pack(responseMessage);
     ReplyWithMessage(context, ret, response);
     if (!wakeupWaiters.empty()) {
-        WakeupWaiters(wakeupWaiters, newValue);
+        WakeupWaiters(wakeupWaiters, exchange);
     }
     return SM_OK;
 }
 
-Result AccStoreServer::WatchRankStateHandler(const acc::AccTcpRequestContext &context, SmemMessage &request) noexcept
+Result AccStoreServer::WatchRankStateHandler(const acc::AccTcpRequestContext &context,
+                                             SmemMessageView &request) noexcept
 {
     if (request.keys.size() != 1 || request.keys[0] != WATCH_RANK_DOWN_KEY) {
         STORE_LOG_ERROR("request(" << context.SeqNo() << ") handle invalid body");
@@ -722,7 +1051,8 @@ Result AccStoreServer::WatchRankStateHandler(const acc::AccTcpRequestContext &co
     return SM_OK;
 }
 
-Result AccStoreServer::HeartbeatHandler(const ock::acc::AccTcpRequestContext &context, SmemMessage &request) noexcept
+Result AccStoreServer::HeartbeatHandler(const ock::acc::AccTcpRequestContext &context,
+                                        SmemMessageView &request) noexcept
 {
     if (request.keys.size() != 0 || request.values.size() != 0) {
         STORE_LOG_ERROR("heart beat request(" << context.SeqNo() << ") handle invalid body");
@@ -757,17 +1087,17 @@ AccStoreServer::GetOutWaitersInLock(const std::unordered_set<uint64_t> &ids) noe
 }
 
 void AccStoreServer::WakeupWaiters(const std::list<ock::acc::AccTcpRequestContext> &waiters,
-                                   const std::vector<uint8_t> &value) noexcept
+                                   const StoreValuePtr &value) noexcept
 {
-    SmemMessage responseMessage{MessageType::GET};
-    responseMessage.values.push_back(value);
-    auto response = SmemMessagePacker::Pack(responseMessage);
+    // all waiters share the same segments, value is packed only once
+    int16_t code = StoreErrorCode::SUCCESS;
+    auto segments = BuildValueSegments(MessageType::GET, value, code);
     for (auto &context : waiters) {
         STORE_LOG_DEBUG("WAKEUP REQUEST(" << context.SeqNo() << ").");
         if (!context.Link()->Established()) {
             continue;
         }
-        ReplyWithMessage(context, StoreErrorCode::SUCCESS, response);
+        ReplyWithSegments(context, code, segments);
     }
 }
 
@@ -795,6 +1125,79 @@ void AccStoreServer::ReplyWithMessage(const ock::acc::AccTcpRequestContext &ctx,
     ctx.Reply(code, response);
 }
 
+void AccStoreServer::ReplyWithSegments(const ock::acc::AccTcpRequestContext &ctx, int16_t code,
+                                       const std::vector<ock::acc::AccDataBufferPtr> &segments) noexcept
+{
+    if (segments.empty()) {
+        STORE_LOG_ERROR("create response message failed");
+        return;
+    }
+
+    ctx.Reply(code, segments);
+}
+
+std::vector<ock::acc::AccDataBufferPtr> AccStoreServer::BuildValueSegments(MessageType mt,
+                                                                           const StoreValuePtr &value,
+                                                                           int16_t &code) const noexcept
+{
+    auto valueSize = value == nullptr ? 0UL : value->Size();
+    if (valueSize <= valueLimits_.maxSingleValueSize) {
+        code = StoreErrorCode::SUCCESS;
+        return BuildRangeSegments(mt, value, 0, valueSize);
+    }
+
+    // too large for one message, reply the size and let client get it by GET_RANGE
+    code = StoreErrorCode::VALUE_TOO_LARGE;
+    std::vector<ock::acc::AccDataBufferPtr> segments;
+    auto sizeStr = std::to_string(valueSize);
+    auto buffer = ock::acc::AccDataBuffer::Create(sizeStr.c_str(), sizeStr.size());
+    if (buffer != nullptr) {
+        segments.emplace_back(std::move(buffer));
+    }
+    return segments;
+}
+
+std::vector<ock::acc::AccDataBufferPtr> AccStoreServer::BuildRangeSegments(MessageType mt,
+                                                                           const StoreValuePtr &value,
+                                                                           uint64_t offset, uint64_t length) noexcept
+{
+    std::vector<ock::acc::AccDataBufferPtr> segments;
+    auto valueSize = value == nullptr ? 0UL : value->Size();
+    // a range carries the generation of its value, ranges of a value replaced while getting are told apart
+    auto prefix = mt == MessageType::GET_RANGE
+                      ? SmemMessagePacker::PackValuePrefix(
+                            mt, length, valueSize,
+                            SmemMessagePacker::PackPod(SmemRangeHead{value == nullptr ? 0UL : value->Generation()}))
+                      : SmemMessagePacker::PackValuePrefix(mt, length);
+    auto prefixBuffer = ock::acc::AccDataBuffer::Create(prefix.data(), prefix.size());
+    if (prefixBuffer == nullptr) {
+        return segments;
+    }
+    segments.emplace_back(std::move(prefixBuffer));
+    if (value == nullptr) {
+        return segments;
+    }
+
+    // reference value chunks in range directly, chunks are kept alive until sent
+    auto end = offset + length;
+    uint64_t chunkBegin = 0;
+    for (auto &chunk : value->Chunks()) {
+        auto chunkEnd = chunkBegin + chunk->size();
+        if (chunkEnd > offset && chunkBegin < end) {
+            auto begin = std::max(offset, chunkBegin);
+            auto buffer = ock::acc::AccDataBuffer::Create(chunk->data() + (begin - chunkBegin),
+                                                          std::min(end, chunkEnd) - begin, chunk);
+            if (buffer == nullptr) {
+                segments.clear();
+                return segments;
+            }
+            segments.emplace_back(std::move(buffer));
+        }
+        chunkBegin = chunkEnd;
+    }
+    return segments;
+}
+
 void AccStoreServer::TimerThreadTask() noexcept
 {
     std::unordered_set<uint64_t> timeoutIds;
@@ -811,6 +1214,7 @@ void AccStoreServer::TimerThreadTask() noexcept
             timedWaiters_.erase(it);
         }
 
+        RemoveBarrierWaitersInLock(timeoutIds);
         auto timeoutContexts = GetOutWaitersInLock(timeoutIds);
         lockerGuard.unlock();
 
@@ -829,6 +1233,26 @@ void AccStoreServer::TimerThreadTask() noexcept
     }
 }
 
+void AccStoreServer::RemoveBarrierWaitersInLock(const std::unordered_set<uint64_t> &ids) noexcept
+{
+    // a timed out waiter leaves the barrier, later arrivals still wait for a full round
+    for (auto id : ids) {
+        auto it = waitCtx_.find(id);
+        if (it == waitCtx_.end()) {
+            continue;
+        }
+        auto pos = barriers_.find(it->second.Key());
+        if (pos == barriers_.end() || pos->second.waiters.erase(id) == 0) {
+            continue;
+        }
+        STORE_LOG_DEBUG("barrier for key(" << pos->first << ") waiter timeout, arrived " << pos->second.arrived
+                                           << "/" << pos->second.expected);
+        if (--pos->second.arrived == 0) {
+            barriers_.erase(pos);
+        }
+    }
+}
+
 void AccStoreServer::RankStateTask() noexcept
 {
     while (running_) {
@@ -896,5 +1320,18 @@ Result AccStoreServer::ExecuteHandle(int16_t opCode, uint32_t linkId, std::strin
     }
     return it->second(linkId, key, value, backend_);
 }
+
+Result AccStoreServer::ExecuteHandle(int16_t opCode, uint32_t linkId, std::string &key,
+                                     const SmemBytesView &value) noexcept
+{
+    auto it = externalOpHandlerMap_.find(opCode);
+    if (it == externalOpHandlerMap_.end()) {
+        STORE_LOG_DEBUG("execute handle map not find opCode:" << opCode);
+        return SM_OK;
+    }
+    // only hooked ops pay for a private copy of the request value
+    auto bytes = value.ToVector();
+    return it->second(linkId, key, bytes, backend_);
+}
 } // namespace smem
 } // namespace ock
\ No newline at end of file
@@ -71,6 +71,19 @@ private:
     static std::atomic<uint64_t> idGen_;
 };
 
+struct StoreAppendStream {
+    std::string key;
+    uint64_t total{0};
+    std::vector<uint8_t> data;
+};
+using StoreAppendStreamPtr = std::shared_ptr<StoreAppendStream>;
+
+struct StoreBarrierState {
+    uint32_t expected{0};
+    uint32_t arrived{0};
+    std::unordered_set<uint64_t> waiters;
+};
+
 class AccStoreServer : public SmReferable {
 public:
     AccStoreServer(std::string ip, uint16_t port, uint32_t worldSize, StoreBackendPtr backend) noexcept;
@@ -82,6 +95,11 @@ public:
 
     void RegisterOpHandler(int16_t opCode, const ConfigStoreServerOpHandler &handler) noexcept;
 
+    /**
+     * @brief Change the sizes large values are split by, set before any large value is transferred
+     */
+    void SetValueSizeLimits(const SmemValueSizeLimits &limits) noexcept;
+
 private:
     Result ReceiveMessageHandler(const ock::acc::AccTcpRequestContext &context) noexcept;
     Result LinkConnectedHandler(const ock::acc::AccConnReq &req, const ock::acc::AccTcpLinkComplexPtr &link) noexcept;
@@ -89,35 +107,54 @@ private:
     Result LinkBrokenHandler(const uint32_t linkId) noexcept;
 
     /* business handler */
-    Result SetHandler(const ock::acc::AccTcpRequestContext &context, SmemMessage &request) noexcept;
-    Result GetHandler(const ock::acc::AccTcpRequestContext &context, SmemMessage &request) noexcept;
-    Result AddHandler(const ock::acc::AccTcpRequestContext &context, SmemMessage &request) noexcept;
-    Result RemoveHandler(const ock::acc::AccTcpRequestContext &context, SmemMessage &request) noexcept;
-    Result AppendHandler(const ock::acc::AccTcpRequestContext &context, SmemMessage &request) noexcept;
-    Result CasHandler(const ock::acc::AccTcpRequestContext &context, SmemMessage &request) noexcept;
-    Result WatchRankStateHandler(const ock::acc::AccTcpRequestContext &context, SmemMessage &request) noexcept;
-    Result WriteHandler(const ock::acc::AccTcpRequestContext &context, SmemMessage &request) noexcept;
-    Result HeartbeatHandler(const ock::acc::AccTcpRequestContext &context, SmemMessage &request) noexcept;
+    Result SetHandler(const ock::acc::AccTcpRequestContext &context, SmemMessageView &request) noexcept;
+    Result GetHandler(const ock::acc::AccTcpRequestContext &context, SmemMessageView &request) noexcept;
+    Result AddHandler(const ock::acc::AccTcpRequestContext &context, SmemMessageView &request) noexcept;
+    Result RemoveHandler(const ock::acc::AccTcpRequestContext &context, SmemMessageView &request) noexcept;
+    Result AppendHandler(const ock::acc::AccTcpRequestContext &context, SmemMessageView &request) noexcept;
+    Result AppendStreamHandler(const ock::acc::AccTcpRequestContext &context, SmemMessageView &request) noexcept;
+    Result AppendAndReply(const ock::acc::AccTcpRequestContext &context, std::string &key,
+                          std::vector<uint8_t> &&value) noexcept;
+    Result GetRangeHandler(const ock::acc::AccTcpRequestContext &context, SmemMessageView &request) noexcept;
+    Result CasHandler(const ock::acc::AccTcpRequestContext &context, SmemMessageView &request) noexcept;
+    Result WatchRankStateHandler(const ock::acc::AccTcpRequestContext &context, SmemMessageView &request) noexcept;
+    Result WriteHandler(const ock::acc::AccTcpRequestContext &context, SmemMessageView &request) noexcept;
+    Result HeartbeatHandler(const ock::acc::AccTcpRequestContext &context, SmemMessageView &request) noexcept;
+    Result BarrierHandler(const ock::acc::AccTcpRequestContext &context, SmemMessageView &request) noexcept;
+    Result BitmapAllocHandler(const ock::acc::AccTcpRequestContext &context, SmemMessageView &request) noexcept;
+    Result BitmapReleaseHandler(const ock::acc::AccTcpRequestContext &context, SmemMessageView &request) noexcept;
+    bool ParseBitmapRequest(const ock::acc::AccTcpRequestContext &context, SmemMessageView &request,
+                            uint32_t &number) noexcept;
 
     std::list<ock::acc::AccTcpRequestContext> GetOutWaitersInLock(const std::unordered_set<uint64_t> &ids) noexcept;
-    void WakeupWaiters(const std::list<ock::acc::AccTcpRequestContext> &waiters,
-                       const std::vector<uint8_t> &value) noexcept;
+    void WakeupWaiters(const std::list<ock::acc::AccTcpRequestContext> &waiters, const StoreValuePtr &value) noexcept;
     void ReplyWithMessage(const ock::acc::AccTcpRequestContext &ctx, int16_t code, const std::string &message) noexcept;
     void ReplyWithMessage(const ock::acc::AccTcpRequestContext &ctx, int16_t code,
                           const std::vector<uint8_t> &message) noexcept;
+    void ReplyWithSegments(const ock::acc::AccTcpRequestContext &ctx, int16_t code,
+                           const std::vector<ock::acc::AccDataBufferPtr> &segments) noexcept;
+    std::vector<ock::acc::AccDataBufferPtr> BuildValueSegments(MessageType mt, const StoreValuePtr &value,
+                                                               int16_t &code) const noexcept;
+    static std::vector<ock::acc::AccDataBufferPtr> BuildRangeSegments(MessageType mt, const StoreValuePtr &value,
+                                                                      uint64_t offset, uint64_t length) noexcept;
     void TimerThreadTask() noexcept;
+    void RemoveBarrierWaitersInLock(const std::unordered_set<uint64_t> &ids) noexcept;
     void RankStateTask() noexcept;
     void CheckerThreadTask() noexcept;
-    Result FindOrInsertRank(const ock::acc::AccTcpRequestContext &context, SmemMessage &request) noexcept;
+    Result FindOrInsertRank(const ock::acc::AccTcpRequestContext &context, SmemMessageView &request) noexcept;
     Result ExecuteHandle(int16_t opCode, uint32_t linkId, std::string &key, std::vector<uint8_t> &value) noexcept;
+    Result ExecuteHandle(int16_t opCode, uint32_t linkId, std::string &key, const SmemBytesView &value) noexcept;
 
 private:
     static constexpr uint32_t MAX_KEY_LEN_SERVER = 2048U;
+    static constexpr uint32_t BITS_PER_BYTE = 8U;
+    static constexpr long BITMAP_BITS_MAX = 1L << 20;
     // prevent access broken global value during global static destructor
     const std::string autoRankingStr_ = AutoRankingStr;
 
-    using MessageHandle = int32_t (AccStoreServer::*)(const ock::acc::AccTcpRequestContext &, SmemMessage &);
+    using MessageHandle = int32_t (AccStoreServer::*)(const ock::acc::AccTcpRequestContext &, SmemMessageView &);
     const std::unordered_map<MessageType, MessageHandle> requestHandlers_;
+    SmemValueSizeLimits valueLimits_;
 
     std::mutex storeMutex_;
     std::condition_variable storeCond_;
@@ -126,6 +163,10 @@ private:
     std::unordered_map<std::string, std::unordered_set<uint64_t>> keyWaiters_;
     ock::acc::AccTcpServerPtr accTcpServer_;
     std::unordered_map<int64_t, std::unordered_set<uint64_t>> timedWaiters_;
+    /* barriers not reached yet, arrived counts the waiters still parked */
+    std::unordered_map<std::string, StoreBarrierState> barriers_;
+    /* APPEND_STREAM values not completed yet, by link id and stream id */
+    std::unordered_map<uint32_t, std::unordered_map<uint64_t, StoreAppendStreamPtr>> appendStreams_;
     std::thread timerThread_;
     bool running_{false};
 
@@ -31,14 +31,15 @@ const std::string SMEM_GROUP_LISTEN_EVENT_KEY = "EVENT";
 const std::string SMEM_GROUP_DYNAMIC_SIZE_KEY = "DSIZE";
 const std::string SMEM_GROUP_CAS_ALLOC_NUM_KEY = "AT_NUM";
 constexpr uint32_t SMEM_ALLOC_NUM_SIZE = SMEM_SHM_ATOMIC_NUM_LIMIT;
-constexpr uint32_t SMEM_ALLOC_NUM_BUF_LEN = (SMEM_ALLOC_NUM_SIZE + 7) / 8; // uint8_t
 constexpr uint32_t SMEM_GATHER_PREFIX_SIZE = 4U;
+constexpr uint32_t SMEM_GATHERV_PREFIX_SIZE = 8U; // rank id and length
 constexpr int32_t SMEM_GROUP_MS_TO_US = 1000;
 constexpr int64_t SMEM_GROUP_LISTER_TIMEOUT = 10LL * 1000;              // 10s, unit: ms
 constexpr int32_t SMEM_GROUP_SLEEP_TIMEOUT = 100 * SMEM_GROUP_MS_TO_US; // 100ms, unit: us
 constexpr int32_t SMEM_GROUP_SLEEP_5S = 5000 * SMEM_GROUP_MS_TO_US;     // 5s
+constexpr int64_t SMEM_GROUP_KEY_TTL_MIN = 60L;                         // 60s, unit: s
+constexpr int64_t SMEM_GROUP_KEY_TTL_MAX = 24L * 3600;                  // 1day, unit: s
 
-constexpr uint32_t UINT_BIT = 8U;
 constexpr int32_t GROUP_DYNAMIC_SIZE_BIT_LEN = 30;
 constexpr uint32_t GROUP_DYNAMIC_SIZE_BIT_MASK = (1 << 30) - 1;
 
@@ -122,69 +123,8 @@ SmemGroupEnginePtr SmemNetGroupEngine::Create(const StorePtr &store, const SmemG
 Result SmemNetGroupEngine::GroupBarrier()
 {
     SM_ASSERT_RETURN(store_ != nullptr, SM_INVALID_PARAM);
-    uint32_t size = option_.rankSize;
-    std::string idx = std::to_string(groupVersion_) + "_" + std::to_string(++barrierGroupSn_);
-    std::string addKey = idx + "_BA";
-    std::string waitKey = idx + "_BW";
-    int64_t val = 0;
-
-    MonoPerfTrace traceBarrier;
-    /* all guys add 1 to barrier key and get it */
-    MonoPerfTrace traceAdd;
-    auto ret = store_->Add(addKey, 1, val);
-    if (ret != SM_OK) {
-        SM_LOG_AND_SET_LAST_ERROR("store add key: " << store_->GetCompleteKey(addKey)
-                                                    << " failed, result:" << ConfigStore::ErrStr(ret));
-        return SM_ERROR;
-    }
-    traceAdd.RecordEnd();
-    SM_LOG_DEBUG("store add key: " << store_->GetCompleteKey(addKey) << " value: " << val << " size:" << size);
-
-    /* only the first rank needs to clear the last key, and it's unnecessary to clear map for first time */
-    if (val == 1 && barrierGroupSn_ > REMOVE_INTERVAL) {
-        uint32_t removeBarrierGroupSn = barrierGroupSn_ - REMOVE_INTERVAL;
-        std::string removeAddIdx = std::to_string(groupVersion_) + "_" + std::to_string(removeBarrierGroupSn) + "_BA";
-        std::string removeWaitIdx = std::to_string(groupVersion_) + "_" + std::to_string(removeBarrierGroupSn) + "_BW";
-        /* There is no need to return ERROR, when the removed key is already not exist.
-        The WARNING LOG is contained in the remove func itself, no need to print more log. */
-        (void)store_->Remove(removeAddIdx);
-        (void)store_->Remove(removeWaitIdx);
-    }
-
-    /* the last guy set the status to ok, and other guys just wait for the last guy set the value */
-    if (val == size) {
-        ret = store_->Set(waitKey, SMEM_GROUP_SET_STR);
-        if (ret != SM_OK) {
-            SM_LOG_AND_SET_LAST_ERROR("store set key: " << store_->GetCompleteKey(waitKey)
-                                                        << " failed, result:" << ConfigStore::ErrStr(ret));
-            return SM_ERROR;
-        }
-        SM_LOG_DEBUG("store set key: " << store_->GetCompleteKey(waitKey));
-    }
-
-    /* all guys wait for waitKey status with timeout, timeout happens if the ok status not set by the last guy */
-    MonoPerfTrace traceGetStatus;
-    std::string getVal;
-    ret = store_->Get(waitKey, getVal, option_.timeoutMs);
-    if (ret != SM_OK) {
-        SM_LOG_AND_SET_LAST_ERROR("store get key: " << store_->GetCompleteKey(waitKey)
-                                                    << " failed, result:" << ConfigStore::ErrStr(ret));
-        return SM_ERROR;
-    }
-    traceGetStatus.RecordEnd();
-
-    if (getVal != SMEM_GROUP_SET_STR) {
-        SM_LOG_AND_SET_LAST_ERROR("store get key: " << store_->GetCompleteKey(waitKey) << " val is not equal, val: "
-                                                    << getVal << " expect: " << SMEM_GROUP_SET_STR);
-        return SM_ERROR;
-    }
-    traceBarrier.RecordEnd();
-
-    SM_LOG_INFO("groupBarrier successfully, key: " << store_->GetCompleteKey(waitKey) << ", size: " << size
-                                                   << ", timeCostUs: total(" << traceBarrier.PeriodUs() << ") add("
-                                                   << traceAdd.PeriodUs() << ") getStatus(" << traceGetStatus.PeriodUs()
-                                                   << ")");
-    return SM_OK;
+    std::string barrierKey = std::to_string(groupVersion_) + "_" + std::to_string(++barrierGroupSn_) + "_BR";
+    return BarrierWait(barrierKey, option_.rankSize);
 }
 
 Result SmemNetGroupEngine::GroupBarrier(const char *key, uint32_t rankSize, uint32_t rankId)
@@ -197,70 +137,25 @@ Result SmemNetGroupEngine::GroupBarrier(const char *key, uint32_t rankSize, uint
     SM_VALIDATE_RETURN(rankId < rankSize, "rankId is invalid! rank:" << rankId << " size:" << rankSize,
                        SM_INVALID_PARAM);
 
-    uint32_t size = rankSize;
     std::string userKey = std::string(key);
     uint32_t &localSn = userGroupBarrierSn_[userKey];
-    std::string idx = userKey + "_" + std::to_string(++localSn);
-    std::string addKey = idx + "_BA";
-    std::string waitKey = idx + "_BW";
-    int64_t val = 0;
+    return BarrierWait(userKey + "_" + std::to_string(++localSn) + "_BR", rankSize);
+}
 
+Result SmemNetGroupEngine::BarrierWait(const std::string &barrierKey, uint32_t size)
+{
+    /* all guys arrive at the barrier key, store server replies to all of them when the last guy arrives */
     MonoPerfTrace traceBarrier;
-    /* all guys add 1 to barrier key and get it */
-    MonoPerfTrace traceAdd;
-    auto ret = store_->Add(addKey, 1, val);
+    auto ret = store_->Barrier(barrierKey, size, static_cast<int64_t>(option_.timeoutMs));
     if (ret != SM_OK) {
-        SM_LOG_AND_SET_LAST_ERROR("store add key: " << store_->GetCompleteKey(addKey)
-                                                    << " failed, result:" << ConfigStore::ErrStr(ret));
-        return SM_ERROR;
-    }
-    traceAdd.RecordEnd();
-    SM_LOG_DEBUG("store add key: " << store_->GetCompleteKey(addKey) << " value: " << val << " size:" << size);
-
-    /* only the first rank needs to clear the last key, and it's unnecessary to clear map for first time */
-    if (val == 1 && localSn > REMOVE_INTERVAL) {
-        uint32_t removeBarrierGroupSn = localSn - REMOVE_INTERVAL;
-        std::string removeAddIdx = userKey + "_" + std::to_string(removeBarrierGroupSn) + "_BA";
-        std::string removeWaitIdx = userKey + "_" + std::to_string(removeBarrierGroupSn) + "_BW";
-        /* There is no need to return ERROR, when the removed key is already not exist.
-        The WARNING LOG is contained in the remove func itself, no need to print more log. */
-        (void)store_->Remove(removeAddIdx);
-        (void)store_->Remove(removeWaitIdx);
-    }
-
-    /* the last guy set the status to ok, and other guys just wait for the last guy set the value */
-    if (val == size) {
-        ret = store_->Set(waitKey, SMEM_GROUP_SET_STR);
-        if (ret != SM_OK) {
-            SM_LOG_AND_SET_LAST_ERROR("store set key: " << store_->GetCompleteKey(waitKey)
+        SM_LOG_AND_SET_LAST_ERROR("store barrier key: " << store_->GetCompleteKey(barrierKey) << " size: " << size
                                                         << " failed, result:" << ConfigStore::ErrStr(ret));
-            return SM_ERROR;
-        }
-        SM_LOG_DEBUG("store set key: " << store_->GetCompleteKey(waitKey));
-    }
-
-    /* all guys wait for waitKey status with timeout, timeout happens if the ok status not set by the last guy */
-    MonoPerfTrace traceGetStatus;
-    std::string getVal;
-    ret = store_->Get(waitKey, getVal, option_.timeoutMs);
-    if (ret != SM_OK) {
-        SM_LOG_AND_SET_LAST_ERROR("store get key: " << store_->GetCompleteKey(waitKey)
-                                                    << " failed, result:" << ConfigStore::ErrStr(ret));
-        return SM_ERROR;
-    }
-    traceGetStatus.RecordEnd();
-
-    if (getVal != SMEM_GROUP_SET_STR) {
-        SM_LOG_AND_SET_LAST_ERROR("store get key: " << store_->GetCompleteKey(waitKey) << " val is not equal, val: "
-                                                    << getVal << " expect: " << SMEM_GROUP_SET_STR);
         return SM_ERROR;
     }
     traceBarrier.RecordEnd();
 
-    SM_LOG_INFO("groupBarrier successfully, key: " << store_->GetCompleteKey(waitKey) << ", size: " << size
-                                                   << ", timeCostUs: total(" << traceBarrier.PeriodUs() << ") add("
-                                                   << traceAdd.PeriodUs() << ") getStatus(" << traceGetStatus.PeriodUs()
-                                                   << ")");
+    SM_LOG_INFO("groupBarrier successfully, key: " << store_->GetCompleteKey(barrierKey) << ", size: " << size
+                                                   << ", timeCostUs: total(" << traceBarrier.PeriodUs() << ")");
     return SM_OK;
 }
 
@@ -373,48 +268,10 @@ Result SmemNetGroupEngine::GroupAllGather(const char *sendBuf, uint32_t sendSize
     }
     traceAppend.RecordEnd();
 
-    /* only the first rank needs to clear the last key, and it's unnecessary to clear map for first time */
-    if (val == input.size() && allGatherGroupSn_ > REMOVE_INTERVAL) {
-        uint32_t rmAllGatherGroupSn = allGatherGroupSn_ - REMOVE_INTERVAL;
-        std::string removeAddIdx = std::to_string(groupVersion_) + "_" + std::to_string(rmAllGatherGroupSn) + "_GA";
-        std::string removeWaitIdx = std::to_string(groupVersion_) + "_" + std::to_string(rmAllGatherGroupSn) + "_GW";
-        /* There is no need to return ERROR, when the removed key is already not exist.
-        The WARNING LOG is contained in the remove func itself, no need to print more log. */
-        (void)store_->Remove(removeAddIdx);
-        (void)store_->Remove(removeWaitIdx);
-    }
-
-    /* the last guy set ok status */
-    if (val == input.size() * size) {
-        ret = store_->Set(waitKey, SMEM_GROUP_SET_STR);
-        if (ret != SM_OK) {
-            SM_LOG_AND_SET_LAST_ERROR("store set key: " << store_->GetCompleteKey(waitKey)
-                                                        << " failed, result:" << ConfigStore::ErrStr(ret));
-            return SM_ERROR;
-        }
-    }
-
-    /* all guys wait for ok status with timeout */
-    MonoPerfTrace traceGetStatus;
-    std::string getVal;
-    ret = store_->Get(waitKey, getVal, option_.timeoutMs);
-    if (ret != SM_OK) {
-        SM_LOG_AND_SET_LAST_ERROR("store get key: " << store_->GetCompleteKey(waitKey)
-                                                    << " failed, result:" << ConfigStore::ErrStr(ret));
-        return SM_ERROR;
-    }
-    traceGetStatus.RecordEnd();
-
-    if (getVal != SMEM_GROUP_SET_STR) {
-        SM_LOG_AND_SET_LAST_ERROR("store get key: " << store_->GetCompleteKey(waitKey) << " val is not equal, val: "
-                                                    << getVal << " expect: " << SMEM_GROUP_SET_STR);
-        return SM_ERROR;
-    }
-
-    /* get the whole value */
+    /* all guys wait for the last guy and get the whole value */
     MonoPerfTrace traceGetData;
     std::vector<uint8_t> output;
-    ret = store_->Get(addKey, output, option_.timeoutMs);
+    ret = GatherWaitAndFetch(addKey, waitKey, val == input.size() * size, output);
     if (ret != SM_OK || output.size() != input.size() * size) {
         SM_LOG_AND_SET_LAST_ERROR("after wait, store get key: "
                                   << store_->GetCompleteKey(addKey) << " failed, result:" << ConfigStore::ErrStr(ret)
@@ -430,7 +287,7 @@ Result SmemNetGroupEngine::GroupAllGather(const char *sendBuf, uint32_t sendSize
     SM_LOG_INFO("allGather successfully, key: "
                 << store_->GetCompleteKey(addKey) << ", rank: " << option_.rank << ", size: " << size
                 << ", timeCostUs: total(" << traceAllGather.PeriodUs() << ") append(" << traceAppend.PeriodUs()
-                << ") getStatus(" << traceGetStatus.PeriodUs() << ") getData(" << traceGetData.PeriodUs() << ")");
+                << ") getData(" << traceGetData.PeriodUs() << ")");
 
     return SM_OK;
 }
@@ -471,48 +328,10 @@ Result SmemNetGroupEngine::GroupAllGather(const char *key, uint32_t rankSize, ui
     }
     traceAppend.RecordEnd();
 
-    /* only the first rank needs to clear the last key, and it's unnecessary to clear map for first time */
-    if (val == input.size() && allGatherGroupSn_ > REMOVE_INTERVAL) {
-        uint32_t rmAllGatherGroupSn = allGatherGroupSn_ - REMOVE_INTERVAL;
-        std::string removeAddIdx = std::to_string(groupVersion_) + "_" + std::to_string(rmAllGatherGroupSn) + "_GA";
-        std::string removeWaitIdx = std::to_string(groupVersion_) + "_" + std::to_string(rmAllGatherGroupSn) + "_GW";
-        /* There is no need to return ERROR, when the removed key is already not exist.
-        The WARNING LOG is contained in the remove func itself, no need to print more log. */
-        (void)store_->Remove(removeAddIdx);
-        (void)store_->Remove(removeWaitIdx);
-    }
-
-    /* the last guy set ok status */
-    if (val == input.size() * size) {
-        ret = store_->Set(waitKey, SMEM_GROUP_SET_STR);
-        if (ret != SM_OK) {
-            SM_LOG_AND_SET_LAST_ERROR("store set key: " << store_->GetCompleteKey(waitKey)
-                                                        << " failed, result:" << ConfigStore::ErrStr(ret));
-            return SM_ERROR;
-        }
-    }
-
-    /* all guys wait for ok status with timeout */
-    MonoPerfTrace traceGetStatus;
-    std::string getVal;
-    ret = store_->Get(waitKey, getVal, option_.timeoutMs);
-    if (ret != SM_OK) {
-        SM_LOG_AND_SET_LAST_ERROR("store get key: " << store_->GetCompleteKey(waitKey)
-                                                    << " failed, result:" << ConfigStore::ErrStr(ret));
-        return SM_ERROR;
-    }
-    traceGetStatus.RecordEnd();
-
-    if (getVal != SMEM_GROUP_SET_STR) {
-        SM_LOG_AND_SET_LAST_ERROR("store get key: " << store_->GetCompleteKey(waitKey) << " val is not equal, val: "
-                                                    << getVal << " expect: " << SMEM_GROUP_SET_STR);
-        return SM_ERROR;
-    }
-
-    /* get the whole value */
+    /* all guys wait for the last guy and get the whole value */
     MonoPerfTrace traceGetData;
     std::vector<uint8_t> output;
-    ret = store_->Get(addKey, output, option_.timeoutMs);
+    ret = GatherWaitAndFetch(addKey, waitKey, val == input.size() * size, output);
     if (ret != SM_OK || output.size() != input.size() * size) {
         SM_LOG_AND_SET_LAST_ERROR("after wait, store get key: "
                                   << store_->GetCompleteKey(addKey) << " failed, result:" << ConfigStore::ErrStr(ret)
@@ -528,39 +347,188 @@ Result SmemNetGroupEngine::GroupAllGather(const char *key, uint32_t rankSize, ui
     SM_LOG_INFO("allGather successfully, key: "
                 << store_->GetCompleteKey(addKey) << ", rank: " << rankId << ", size: " << size
                 << ", timeCostUs: total(" << traceAllGather.PeriodUs() << ") append(" << traceAppend.PeriodUs()
-                << ") getStatus(" << traceGetStatus.PeriodUs() << ") getData(" << traceGetData.PeriodUs() << ")");
+                << ") getData(" << traceGetData.PeriodUs() << ")");
 
     return SM_OK;
 }
 
-int32_t SmemNetGroupEngine::AllocNumber()
+Result SmemNetGroupEngine::GroupAllGatherV(const std::vector<uint8_t> &input,
+                                           std::map<uint32_t, std::vector<uint8_t>> &outputs)
 {
-    std::vector<uint8_t> expect;
-    std::vector<uint8_t> value(SMEM_ALLOC_NUM_BUF_LEN, 0);
-    std::vector<uint8_t> old;
-    int32_t num;
-    int32_t ret;
-    do {
-        swap(expect, old);
-        if (expect.size() != 0) {
-            value = expect;
+    SM_ASSERT_RETURN(store_ != nullptr, SM_INVALID_PARAM);
+    SM_VALIDATE_RETURN(input.size() <= UINT32_MAX, "input too large: " << input.size(), SM_INVALID_PARAM);
+
+    uint32_t size = option_.rankSize;
+    std::string idx = std::to_string(groupVersion_) + "_" + std::to_string(++allGatherGroupSn_);
+    std::string addKey = idx + "_VA";
+    std::string waitKey = idx + "_VW";
+
+    /* records are appended in order of arrival, each one is prefixed with its rank id and length */
+    std::vector<uint8_t> record(SMEM_GATHERV_PREFIX_SIZE + input.size());
+    auto prefix = reinterpret_cast<uint32_t *>(record.data());
+    prefix[0] = option_.rank;
+    prefix[1] = static_cast<uint32_t>(input.size());
+    (void)std::copy(input.begin(), input.end(), record.begin() + SMEM_GATHERV_PREFIX_SIZE);
+
+    MonoPerfTrace traceAllGather;
+    uint64_t val = 0;
+    auto ret = store_->Append(addKey, record, val);
+    if (ret != SM_OK) {
+        SM_LOG_AND_SET_LAST_ERROR("store append key: " << store_->GetCompleteKey(addKey)
+                                                       << " failed, result:" << ConfigStore::ErrStr(ret));
+        return SM_ERROR;
+    }
+
+    /* length of the whole value is unknown, all guys wait for each other by barrier instead */
+    ret = store_->Barrier(waitKey, size, static_cast<int64_t>(option_.timeoutMs));
+    if (ret != SM_OK) {
+        SM_LOG_AND_SET_LAST_ERROR("store barrier key: " << store_->GetCompleteKey(waitKey)
+                                                        << " failed, result:" << ConfigStore::ErrStr(ret));
+        return SM_ERROR;
+    }
+
+    std::vector<uint8_t> output;
+    ret = GatherVFetch(addKey, waitKey, val == record.size(), output);
+    if (ret != SM_OK) {
+        return SM_ERROR;
+    }
+
+    outputs.clear();
+    uint64_t offset = 0;
+    while (offset + SMEM_GATHERV_PREFIX_SIZE <= output.size()) {
+        uint32_t header[2];
+        (void)std::copy_n(output.data() + offset, SMEM_GATHERV_PREFIX_SIZE, reinterpret_cast<uint8_t *>(header));
+        auto rank = header[0];
+        uint64_t length = header[1];
+        offset += SMEM_GATHERV_PREFIX_SIZE;
+        if (offset + length > output.size() || outputs.find(rank) != outputs.end()) {
+            break;
         }
-        num = -1;
-        for (uint32_t i = 0; i < SMEM_ALLOC_NUM_SIZE; i++) {
-            if ((value[i / UINT_BIT] & (1U << (i % UINT_BIT))) == 0) {
-                num = static_cast<int32_t>(i);
-                value[i / UINT_BIT] ^= 1U << (i % UINT_BIT);
-                break;
-            }
+        outputs.emplace(rank, std::vector<uint8_t>(output.begin() + offset, output.begin() + offset + length));
+        offset += length;
+    }
+    if (offset != output.size() || outputs.size() != size) {
+        SM_LOG_AND_SET_LAST_ERROR("store get key: " << store_->GetCompleteKey(addKey) << " invalid, size: "
+                                                    << output.size() << " records: " << outputs.size()
+                                                    << " group_size: " << size);
+        return SM_ERROR;
+    }
+    traceAllGather.RecordEnd();
+
+    SM_LOG_INFO("allGatherV successfully, key: " << store_->GetCompleteKey(addKey) << ", rank: " << option_.rank
+                                                 << ", size: " << size << ", bytes: " << output.size()
+                                                 << ", timeCostUs: total(" << traceAllGather.PeriodUs() << ")");
+    return SM_OK;
+}
+
+Result SmemNetGroupEngine::GatherVFetch(const std::string &addKey, const std::string &waitKey, bool firstRank,
+                                        std::vector<uint8_t> &output)
+{
+    if (!firstRank) {
+        auto ret = store_->Get(addKey, output, 0);
+        if (ret != SM_OK) {
+            SM_LOG_AND_SET_LAST_ERROR("store get key: " << store_->GetCompleteKey(addKey)
+                                                        << " failed, result:" << ConfigStore::ErrStr(ret));
+            return SM_ERROR;
         }
-        if (num == -1) {
-            SM_LOG_ERROR("there is no free number available for allocation!");
+        return SM_OK;
+    }
+
+    /* the first guy expires keys of this round, and gets the whole value in the same round trip */
+    ConfigStoreAsyncWaiter waiter;
+    waiter.Begin();
+    auto ret = store_->SetWithTTLAsync(
+        waitKey, std::vector<uint8_t>(SMEM_GROUP_SET_STR.begin(), SMEM_GROUP_SET_STR.end()), GroupKeyTTL(), {addKey},
+        [&waiter](Result result) { waiter.Finish(result); });
+    if (ret != SM_OK) {
+        waiter.Finish(ret);
+    }
+    waiter.Begin();
+    ret = store_->GetAsync(addKey, 0, [&waiter, &output](Result result, std::vector<uint8_t> &value) {
+        output = std::move(value);
+        waiter.Finish(result);
+    });
+    if (ret != SM_OK) {
+        waiter.Finish(ret);
+    }
+
+    ret = waiter.Wait();
+    if (ret != SM_OK) {
+        SM_LOG_AND_SET_LAST_ERROR("store set key: " << store_->GetCompleteKey(waitKey) << " and get key: "
+                                                    << store_->GetCompleteKey(addKey)
+                                                    << " failed, result:" << ConfigStore::ErrStr(ret));
+        return SM_ERROR;
+    }
+    return SM_OK;
+}
+
+Result SmemNetGroupEngine::GatherWaitAndFetch(const std::string &addKey, const std::string &waitKey, bool lastRank,
+                                              std::vector<uint8_t> &output)
+{
+    if (!lastRank) {
+        /* wait for ok status set by the last guy with timeout, then get the whole value */
+        std::string getVal;
+        auto ret = store_->Get(waitKey, getVal, option_.timeoutMs);
+        if (ret != SM_OK || getVal != SMEM_GROUP_SET_STR) {
+            SM_LOG_AND_SET_LAST_ERROR("store get key: " << store_->GetCompleteKey(waitKey) << " failed, result:"
+                                                        << ConfigStore::ErrStr(ret) << " val: " << getVal);
             return SM_ERROR;
         }
-        ret = store_->Cas(SMEM_GROUP_CAS_ALLOC_NUM_KEY, expect, value, old);
-    } while (ret != 0 || old != expect);
-    allocedSet_.insert(num);
-    return num;
+        return store_->Get(addKey, output, option_.timeoutMs);
+    }
+
+    /* the whole value is appended already, the last guy sets ok status and gets it in one round trip */
+    ConfigStoreAsyncWaiter waiter;
+    waiter.Begin();
+    auto ret = store_->SetWithTTLAsync(
+        waitKey, std::vector<uint8_t>(SMEM_GROUP_SET_STR.begin(), SMEM_GROUP_SET_STR.end()), GroupKeyTTL(), {addKey},
+        [&waiter](Result result) { waiter.Finish(result); });
+    if (ret != SM_OK) {
+        waiter.Finish(ret);
+    }
+    waiter.Begin();
+    ret = store_->GetAsync(addKey, option_.timeoutMs, [&waiter, &output](Result result, std::vector<uint8_t> &value) {
+        output = std::move(value);
+        waiter.Finish(result);
+    });
+    if (ret != SM_OK) {
+        waiter.Finish(ret);
+    }
+
+    ret = waiter.Wait();
+    if (ret != SM_OK) {
+        SM_LOG_AND_SET_LAST_ERROR("store set key: " << store_->GetCompleteKey(waitKey) << " and get key: "
+                                                    << store_->GetCompleteKey(addKey)
+                                                    << " failed, result:" << ConfigStore::ErrStr(ret));
+        return SM_ERROR;
+    }
+    return SM_OK;
+}
+
+int64_t SmemNetGroupEngine::GroupKeyTTL() const
+{
+    /* keys of a round live long enough for the slowest guy to wait and read them within its timeout */
+    auto timeoutSec = static_cast<int64_t>(std::min(option_.timeoutMs / SMEM_GROUP_MS_TO_US + 1UL,
+                                                    static_cast<uint64_t>(SMEM_GROUP_KEY_TTL_MAX)));
+    return std::min(std::max(timeoutSec * 2L, SMEM_GROUP_KEY_TTL_MIN), SMEM_GROUP_KEY_TTL_MAX);
+}
+
+int32_t SmemNetGroupEngine::AllocNumber()
+{
+    /* the lowest free bit is searched and set by store server, no retry under contention */
+    uint32_t num = 0;
+    auto ret = store_->BitmapAlloc(SMEM_GROUP_CAS_ALLOC_NUM_KEY, SMEM_ALLOC_NUM_SIZE, num);
+    if (ret == StoreErrorCode::IN_USE) {
+        SM_LOG_ERROR("there is no free number available for allocation!");
+        return SM_ERROR;
+    }
+    if (ret != SM_OK) {
+        SM_LOG_AND_SET_LAST_ERROR("store alloc number from key: " << store_->GetCompleteKey(SMEM_GROUP_CAS_ALLOC_NUM_KEY)
+                                                                  << " failed, result:" << ConfigStore::ErrStr(ret));
+        return SM_ERROR;
+    }
+    allocedSet_.insert(static_cast<int32_t>(num));
+    return static_cast<int32_t>(num);
 }
 
 Result SmemNetGroupEngine::ReleaseNumber(int32_t val)
@@ -571,25 +539,14 @@ Result SmemNetGroupEngine::ReleaseNumber(int32_t val)
     }
     allocedSet_.erase(val);
 
-    std::vector<uint8_t> expect;
-    std::vector<uint8_t> value(SMEM_ALLOC_NUM_BUF_LEN, 0);
-    std::vector<uint8_t> old;
-    int32_t ret;
-
-    value[val / UINT_BIT] ^= 1U << (val % UINT_BIT);
-    do {
-        swap(expect, old);
-        if (expect.size() != 0) {
-            value = expect;
-        }
-        if ((value[val / UINT_BIT] >> (val % UINT_BIT)) & 1U) {
-            value[val / UINT_BIT] ^= 1U << (val % UINT_BIT);
-        } else {
-            SM_LOG_WARN("key(" << val << ") has released!");
-            return SM_OK;
-        }
-        ret = store_->Cas(SMEM_GROUP_CAS_ALLOC_NUM_KEY, expect, value, old);
-    } while (ret == 0 && old == expect);
+    auto ret = store_->BitmapRelease(SMEM_GROUP_CAS_ALLOC_NUM_KEY, static_cast<uint32_t>(val));
+    if (ret == StoreErrorCode::NOT_EXIST) {
+        SM_LOG_WARN("key(" << val << ") has released!");
+        return SM_OK;
+    }
+    if (ret != SM_OK) {
+        SM_LOG_ERROR("store release number(" << val << ") failed, result:" << ConfigStore::ErrStr(ret));
+    }
     return SM_OK;
 }
 
@@ -1094,17 +1051,6 @@ void SmemNetGroupEngine::GroupSnClean()
         (void)store_->Remove(removeAddIdx);
         (void)store_->Remove(removeWaitIdx);
     }
-
-    for (uint32_t i = 0; i < REMOVE_INTERVAL; i++) {
-        if (barrierGroupSn_ < i) {
-            break;
-        }
-        uint32_t removeBarrierGroupSn = barrierGroupSn_ - i;
-        std::string removeAddIdx = std::to_string(groupVersion_) + "_" + std::to_string(removeBarrierGroupSn) + "_BA";
-        std::string removeWaitIdx = std::to_string(groupVersion_) + "_" + std::to_string(removeBarrierGroupSn) + "_BW";
-        (void)store_->Remove(removeAddIdx);
-        (void)store_->Remove(removeWaitIdx);
-    }
 }
 } // namespace smem
 } // namespace ock
\ No newline at end of file
@@ -16,6 +16,7 @@
 #include <thread>
 #include <atomic>
 #include <list>
+#include <map>
 #include "smem_common_includes.h"
 #include "smem_config_store.h"
 
@@ -94,6 +95,13 @@ public:
     Result GroupAllGather(const char *key, uint32_t rankSize, uint32_t rankId, const char *sendBuf, uint32_t sendSize,
                           char *recvBuf, uint32_t recvSize);
 
+    /**
+     * @brief all gather data of variable length in the whole group
+     * @param input             [in] data of local rank, length can be different between ranks
+     * @param outputs           [out] data of all ranks, key is rank id
+     */
+    Result GroupAllGatherV(const std::vector<uint8_t> &input, std::map<uint32_t, std::vector<uint8_t>> &outputs);
+
     Result GroupBroadcastExit(int status);
 
     Result RegisterExit(const std::function<void(int)> &exit);
@@ -129,6 +137,12 @@ private:
     bool TestBitmapForRank(uint32_t rankId) const;
     int32_t LinkReconnectHandler();
     void RankExit(int result, const std::string &key, const std::string &value);
+    Result BarrierWait(const std::string &barrierKey, uint32_t size);
+    int64_t GroupKeyTTL() const;
+    Result GatherWaitAndFetch(const std::string &addKey, const std::string &waitKey, bool lastRank,
+                              std::vector<uint8_t> &output);
+    Result GatherVFetch(const std::string &addKey, const std::string &waitKey, bool firstRank,
+                        std::vector<uint8_t> &output);
 
     StoreManagerPtr store_ = nullptr;
     SmemGroupOption option_;
@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025-2025. All rights reserved.
+ * MemFabric_Hybrid is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *          http://license.coscl.org.cn/MulanPSL2
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+*/
+#ifndef MF_PY_COMPLETION_EXECUTOR_H
+#define MF_PY_COMPLETION_EXECUTOR_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <pybind11/pybind11.h>
+
+namespace ock {
+namespace mf {
+/**
+ * Completes python concurrent.futures.Future objects from one native thread.
+ *
+ * Each round the thread issues all queued requests (with ASYNC_COPY_FLAG), calls drain once to wait for them,
+ * then takes GIL once to resolve all futures of the round with the return codes. Async copies are bound to the
+ * stream of the issuing thread, so issue and drain must both run on this thread.
+ */
+class PyCompletionExecutor {
+public:
+    using Issue = std::function<int32_t()>;
+    using Drain = std::function<int32_t()>;
+
+    explicit PyCompletionExecutor(Drain drain) : drain_{std::move(drain)} {}
+
+    ~PyCompletionExecutor()
+    {
+        Stop();
+    }
+
+    PyCompletionExecutor(const PyCompletionExecutor &) = delete;
+    PyCompletionExecutor &operator=(const PyCompletionExecutor &) = delete;
+
+    /* called with GIL held, returns a future resolved with return code of issue, -1 if already stopped */
+    pybind11::object Submit(Issue issue)
+    {
+        auto future = pybind11::module_::import("concurrent.futures").attr("Future")();
+        {
+            std::lock_guard<std::mutex> guard(mutex_);
+            if (!stopped_) {
+                if (!worker_.joinable()) {
+                    worker_ = std::thread([this]() { Run(); });
+                }
+                pending_.push_back(Job{std::move(issue), future});
+                cond_.notify_one();
+                return future;
+            }
+        }
+        future.attr("set_result")(-1);
+        return future;
+    }
+
+    /* issues and resolves queued requests, then stops the thread, GIL is released while joining */
+    void Stop()
+    {
+        {
+            std::lock_guard<std::mutex> guard(mutex_);
+            stopped_ = true;
+        }
+        cond_.notify_all();
+        if (!worker_.joinable()) {
+            return;
+        }
+        if (PyGILState_Check()) {
+            pybind11::gil_scoped_release release;
+            worker_.join();
+        } else {
+            worker_.join();
+        }
+    }
+
+private:
+    struct Job {
+        Issue issue;
+        pybind11::object future;
+    };
+
+    void Run()
+    {
+        std::vector<Job> jobs;
+        std::vector<int32_t> results;
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                cond_.wait(lock, [this]() { return stopped_ || !pending_.empty(); });
+                if (pending_.empty()) {
+                    break;
+                }
+                jobs.swap(pending_);
+            }
+
+            results.resize(jobs.size());
+            for (size_t i = 0; i < jobs.size(); i++) {
+                results[i] = jobs[i].issue();
+            }
+            auto ret = drain_();
+            for (auto &result : results) {
+                result = (result == 0) ? ret : result;
+            }
+
+            pybind11::gil_scoped_acquire acquire;
+            for (size_t i = 0; i < jobs.size(); i++) {
+                try {
+                    if (!jobs[i].future.attr("done")().cast<bool>()) {
+                        jobs[i].future.attr("set_result")(results[i]);
+                    }
+                } catch (pybind11::error_already_set &) {
+                    /* cancelled by caller concurrently, nothing to resolve */
+                }
+            }
+            jobs.clear();
+        }
+    }
+
+private:
+    const Drain drain_;
+    std::mutex mutex_;
+    std::condition_variable cond_;
+    std::vector<Job> pending_;
+    bool stopped_{false};
+    std::thread worker_;
+};
+} // namespace mf
+} // namespace ock
+
+#endif // MF_PY_COMPLETION_EXECUTOR_H
@@ -24,6 +24,7 @@
 #include "smem_shm.h"
 #include "smem_bm.h"
 #include "smem_version.h"
+#include "py_completion_executor.h"
 
 namespace py = pybind11;
 
@@ -111,9 +112,11 @@ private:
 
 class BigMemory {
 public:
-    explicit BigMemory(smem_bm_t hd) noexcept : handle_{hd} {}
+    explicit BigMemory(smem_bm_t hd) noexcept : handle_{hd}, asyncExecutor_{[this]() { return smem_bm_wait(handle_); }}
+    {}
     virtual ~BigMemory() noexcept
     {
+        asyncExecutor_.Stop();
         smem_bm_destroy(handle_);
     }
 
@@ -144,6 +147,7 @@ public:
 
     void Destroy()
     {
+        asyncExecutor_.Stop();
         smem_bm_destroy(handle_);
         handle_ = nullptr;
     }
@@ -174,6 +178,28 @@ public:
         return ret;
     }
 
+    py::object CopyDataAsync(uint64_t src, uint64_t dest, uint64_t size, smem_bm_copy_type type, uint32_t flags)
+    {
+        return asyncExecutor_.Submit([this, src, dest, size, type, flags]() {
+            smem_copy_params params = {(const void *)(ptrdiff_t)src, (void *)(ptrdiff_t)dest, size};
+            return smem_bm_copy(handle_, &params, type, flags | ASYNC_COPY_FLAG);
+        });
+    }
+
+    py::object CopyDataBatchAsync(std::vector<uintptr_t> srcs, std::vector<uintptr_t> dsts, std::vector<size_t> sizes,
+                                  uint32_t count, smem_bm_copy_type type, uint32_t flags)
+    {
+        if (count > srcs.size() || count > dsts.size() || count > sizes.size()) {
+            throw std::invalid_argument(std::string("count is larger than size of src_addrs, dst_addrs or sizes."));
+        }
+        return asyncExecutor_.Submit([this, srcs = std::move(srcs), dsts = std::move(dsts), sizes = std::move(sizes),
+                                      count, type, flags]() mutable {
+            smem_batch_copy_params batch_params = {reinterpret_cast<void **>(srcs.data()),
+                                                   reinterpret_cast<void **>(dsts.data()), sizes.data(), count};
+            return smem_bm_copy_batch(handle_, &batch_params, type, flags | ASYNC_COPY_FLAG);
+        });
+    }
+
     static int32_t Initialize(const std::string &storeURL, uint32_t worldSize, uint16_t deviceId,
                           const smem_bm_config_t &config) noexcept
     {
@@ -225,6 +251,7 @@ public:
 
 private:
     smem_bm_t handle_;
+    ock::mf::PyCompletionExecutor asyncExecutor_;
     static uint32_t worldSize_;
 };
 
@@ -541,6 +568,7 @@ void DefineBmClass(py::module_ &m)
         .value("SDMA", SMEMB_DATA_OP_SDMA)
         .value("HOST_RDMA", SMEMB_DATA_OP_HOST_RDMA)
         .value("HOST_URMA", SMEMB_DATA_OP_HOST_URMA)
+        .value("HOST_SIM", SMEMB_DATA_OP_HOST_SIM)
         .value("HOST_TCP", SMEMB_DATA_OP_HOST_TCP)
         .value("DEVICE_RDMA", SMEMB_DATA_OP_DEVICE_RDMA);
 
@@ -635,7 +663,19 @@ Returns:
              py::arg("src_addrs"), py::arg("dst_addrs"), py::arg("sizes"), py::arg("count"), py::arg("type"),
              py::arg("flags"), R"(cop data with batch.)")
         .def("wait", &BigMemory::Wait, py::call_guard<py::gil_scoped_release>(), R"(
-Wait all issued async copy(s) finish.)");
+Wait all issued async copy(s) finish.)")
+        .def("copy_data_async", &BigMemory::CopyDataAsync, py::arg("src_ptr"), py::arg("dst_ptr"), py::arg("size"),
+             py::arg("type"), py::arg("flags") = 0, R"(
+Asynchronous copy_data, issued and waited on a native completion thread.
+
+Returns:
+    concurrent.futures.Future resolved with 0 if successful, use asyncio.wrap_future to await it)")
+        .def("copy_data_batch_async", &BigMemory::CopyDataBatchAsync, py::arg("src_addrs"), py::arg("dst_addrs"),
+             py::arg("sizes"), py::arg("count"), py::arg("type"), py::arg("flags") = 0, R"(
+Asynchronous copy_data_batch, issued and waited on a native completion thread.
+
+Returns:
+    concurrent.futures.Future resolved with 0 if successful, use asyncio.wrap_future to await it)");
 }
 } // namespace
 
@@ -16,6 +16,8 @@
 #include <thread>
 #include <chrono>
 #include <iostream>
+#include <algorithm>
+#include <type_traits>
 #include <pybind11/stl.h>
 #include "transfer_util.h"
 #include "adapter_logger.h"
@@ -27,11 +29,85 @@ namespace py = pybind11;
 static const char *PY_TRANSFER_LIB_VERSION =
     "library version: " PROJECT_VERSION_RAW ", build time: " __DATE__ " " __TIME__ ", commit: " STR2(GIT_LAST_COMMIT);
 constexpr uint64_t MAX_BATCH_COUNT = 1024 * 1024;
+static_assert(std::is_same<uintptr_t, uint64_t>::value && std::is_same<size_t, uint64_t>::value,
+              "64-bit integer arrays are read as address and size arrays in place");
+
+namespace {
+/**
+ * 1-D array of 64-bit integers exported by buffer protocol, such as numpy.uint64 array or array.array('Q').
+ * Contiguous arrays are used in place, other strides are gathered into local storage.
+ */
+class BatchArrayView {
+public:
+    bool Load(const py::buffer &obj, const char *name)
+    {
+        info_ = obj.request();
+        if (info_.ndim != 1 || info_.itemsize != sizeof(uint64_t) || !IsInteger64Format(info_.format)) {
+            ADAPTER_LOG_ERROR(name << " must be 1-D array of 64-bit integer, ndim=" << info_.ndim
+                                   << ", format=" << info_.format);
+            return false;
+        }
+        if (info_.strides[0] == static_cast<py::ssize_t>(sizeof(uint64_t))) {
+            data_ = static_cast<const uint64_t *>(info_.ptr);
+            return true;
+        }
+        auto base = static_cast<const uint8_t *>(info_.ptr);
+        gathered_.resize(static_cast<size_t>(info_.size));
+        for (py::ssize_t i = 0; i < info_.size; ++i) {
+            std::copy_n(base + i * info_.strides[0], sizeof(uint64_t),
+                        reinterpret_cast<uint8_t *>(&gathered_[static_cast<size_t>(i)]));
+        }
+        data_ = gathered_.data();
+        return true;
+    }
+
+    const uint64_t *Data() const
+    {
+        return data_;
+    }
+
+    size_t Size() const
+    {
+        return static_cast<size_t>(info_.size);
+    }
+
+private:
+    static bool IsInteger64Format(const std::string &format)
+    {
+        auto code = format;
+        if (!code.empty() && (code[0] == '@' || code[0] == '=' || code[0] == '<')) {
+            code = code.substr(1);
+        }
+        return code == "Q" || code == "L" || code == "q" || code == "l";
+    }
+
+private:
+    py::buffer_info info_;
+    const uint64_t *data_{nullptr};
+    std::vector<uint64_t> gathered_;
+};
+}
+
+static bool IsSameBatchSize(size_t bufferCount, size_t peerBufferCount, size_t lengthCount)
+{
+    if (bufferCount != peerBufferCount || bufferCount != lengthCount) {
+        ADAPTER_LOG_ERROR("Buffers(" << bufferCount << "), peer_buffer_addresses(" << peerBufferCount
+                                     << ") and lengths(" << lengthCount << ") is not equal.");
+        return false;
+    }
+    return true;
+}
+
+static bool IsStridedRangeValid(uintptr_t base, size_t stride, size_t count)
+{
+    return count <= 1 || stride <= (UINTPTR_MAX - base) / (count - 1);
+}
 
 TransferAdapterPy::TransferAdapterPy() : handle_(nullptr), sockfd_(-1) {}
 
 TransferAdapterPy::~TransferAdapterPy()
 {
+    asyncExecutor_.reset();
     if (sockfd_ != -1) {
         close(sockfd_);
     }
@@ -103,40 +179,6 @@ int TransferAdapterPy::TransferSyncWrite(const char *destUniqueId, uintptr_t buf
     return ret;
 }
 
-int TransferAdapterPy::BatchTransferSyncWrite(const char *destUniqueId, std::vector<uintptr_t> buffers,
-                                              std::vector<uintptr_t> peer_buffer_addresses, std::vector<size_t> lengths,
-                                              uint32_t flags)
-{
-    ADAPTER_ASSERT_RETURN(handle_ != nullptr, -1);
-    // 检查向量大小是否一致
-    if (buffers.size() != peer_buffer_addresses.size() || buffers.size() != lengths.size() ||
-        buffers.size() > UINT32_MAX) {
-        ADAPTER_LOG_ERROR("Buffers, peer_buffer_addresses and lengths is not equal or too long.");
-        return -1;
-    }
-
-    // 转换向量数据为C风格数组
-    const size_t batchSize = buffers.size();
-    std::vector<const void *> srcAddresses(batchSize);
-    std::vector<void *> destAddresses(batchSize);
-    std::vector<size_t> dataSizes(batchSize);
-
-    // 填充转换后的数组
-    for (size_t i = 0; i < batchSize; ++i) {
-        srcAddresses[i] = reinterpret_cast<const void *>(buffers[i]);
-        destAddresses[i] = reinterpret_cast<void *>(peer_buffer_addresses[i]);
-        dataSizes[i] = lengths[i];
-    }
-
-    // 调用底层批量写入API
-    int ret = smem_trans_batch_write(handle_, srcAddresses.data(), destUniqueId, destAddresses.data(), dataSizes.data(),
-                                     static_cast<uint32_t>(batchSize), flags);
-    if (ret != 0) {
-        ADAPTER_LOG_ERROR("SMEM API smem_trans_batch_write happen error, ret=" << ret);
-    }
-    return ret;
-}
-
 int TransferAdapterPy::TransferSyncRead(const char *destUniqueId, uintptr_t buffer, uintptr_t peer_buffer_address,
                                         size_t length, uint32_t flags)
 {
@@ -189,126 +231,232 @@ int TransferAdapterPy::TransferAsyncWriteSubmit(const char *destUniqueId, uintpt
     return ret;
 }
 
-int TransferAdapterPy::BatchTransferSyncRead(const char *destUniqueId, std::vector<uintptr_t> buffers,
-                                             std::vector<uintptr_t> peer_buffer_addresses, std::vector<size_t> lengths,
+int TransferAdapterPy::BatchTransferSyncWrite(const char *destUniqueId, const std::vector<uintptr_t> &buffers,
+                                              const std::vector<uintptr_t> &peer_buffer_addresses,
+                                              const std::vector<size_t> &lengths, uint32_t flags)
+{
+    ADAPTER_ASSERT_RETURN(IsSameBatchSize(buffers.size(), peer_buffer_addresses.size(), lengths.size()), -1);
+    return BatchTransfer(TransferOpcode::WRITE, destUniqueId,
+                         {buffers.data(), peer_buffer_addresses.data(), lengths.data(), buffers.size()}, std::nullopt,
+                         flags);
+}
+
+int TransferAdapterPy::BatchTransferSyncWrite(const char *destUniqueId, const py::buffer &buffers,
+                                              const py::buffer &peer_buffer_addresses, const py::buffer &lengths,
+                                              uint32_t flags)
+{
+    return BatchTransfer(TransferOpcode::WRITE, destUniqueId, buffers, peer_buffer_addresses, lengths, std::nullopt,
+                         flags);
+}
+
+int TransferAdapterPy::BatchTransferSyncRead(const char *destUniqueId, const std::vector<uintptr_t> &buffers,
+                                             const std::vector<uintptr_t> &peer_buffer_addresses,
+                                             const std::vector<size_t> &lengths, uint32_t flags)
+{
+    ADAPTER_ASSERT_RETURN(IsSameBatchSize(buffers.size(), peer_buffer_addresses.size(), lengths.size()), -1);
+    return BatchTransfer(TransferOpcode::READ, destUniqueId,
+                         {buffers.data(), peer_buffer_addresses.data(), lengths.data(), buffers.size()}, std::nullopt,
+                         flags);
+}
+
+int TransferAdapterPy::BatchTransferSyncRead(const char *destUniqueId, const py::buffer &buffers,
+                                             const py::buffer &peer_buffer_addresses, const py::buffer &lengths,
                                              uint32_t flags)
 {
-    ADAPTER_ASSERT_RETURN(handle_ != nullptr, -1);
-    // 检查向量大小是否一致
-    if (buffers.size() != peer_buffer_addresses.size() || buffers.size() != lengths.size() ||
-        buffers.size() > UINT32_MAX) {
-        ADAPTER_LOG_ERROR("Buffers, peer_buffer_addresses and lengths is not equal or too long.");
+    return BatchTransfer(TransferOpcode::READ, destUniqueId, buffers, peer_buffer_addresses, lengths, std::nullopt,
+                         flags);
+}
+
+int TransferAdapterPy::BatchTransferAsyncWriteSubmit(const char *destUniqueId,
+                                                     const std::vector<uintptr_t> &buffers,
+                                                     const std::vector<uintptr_t> &peer_buffer_addresses,
+                                                     const std::vector<size_t> &lengths,
+                                                     uintptr_t stream, uint32_t flags)
+{
+    ADAPTER_ASSERT_RETURN(IsSameBatchSize(buffers.size(), peer_buffer_addresses.size(), lengths.size()), -1);
+    return BatchTransfer(TransferOpcode::WRITE, destUniqueId,
+                         {buffers.data(), peer_buffer_addresses.data(), lengths.data(), buffers.size()}, stream, flags);
+}
+
+int TransferAdapterPy::BatchTransferAsyncWriteSubmit(const char *destUniqueId,
+                                                     const py::buffer &buffers,
+                                                     const py::buffer &peer_buffer_addresses,
+                                                     const py::buffer &lengths,
+                                                     uintptr_t stream, uint32_t flags)
+{
+    return BatchTransfer(TransferOpcode::WRITE, destUniqueId, buffers, peer_buffer_addresses, lengths, stream, flags);
+}
+
+int TransferAdapterPy::BatchTransferAsyncReadSubmit(const char *destUniqueId,
+                                                    const std::vector<uintptr_t> &buffers,
+                                                    const std::vector<uintptr_t> &peer_buffer_addresses,
+                                                    const std::vector<size_t> &lengths,
+                                                    uintptr_t stream, uint32_t flags)
+{
+    ADAPTER_ASSERT_RETURN(IsSameBatchSize(buffers.size(), peer_buffer_addresses.size(), lengths.size()), -1);
+    return BatchTransfer(TransferOpcode::READ, destUniqueId,
+                         {buffers.data(), peer_buffer_addresses.data(), lengths.data(), buffers.size()}, stream, flags);
+}
+
+int TransferAdapterPy::BatchTransferAsyncReadSubmit(const char *destUniqueId,
+                                                    const py::buffer &buffers,
+                                                    const py::buffer &peer_buffer_addresses,
+                                                    const py::buffer &lengths,
+                                                    uintptr_t stream, uint32_t flags)
+{
+    return BatchTransfer(TransferOpcode::READ, destUniqueId, buffers, peer_buffer_addresses, lengths, stream, flags);
+}
+
+int TransferAdapterPy::BatchTransferStrided(TransferOpcode opcode, const char *destUniqueId, uintptr_t buffer_base,
+                                            size_t buffer_stride, uintptr_t peer_buffer_base,
+                                            size_t peer_buffer_stride, size_t length, size_t count,
+                                            std::optional<uintptr_t> stream, uint32_t flags)
+{
+    if (count == 0 || count > MAX_BATCH_COUNT) {
+        ADAPTER_LOG_ERROR("strided batch count (" << count << ") is zero or exceeds limit(" << MAX_BATCH_COUNT << ")");
         return -1;
     }
-
-    // 转换向量数据为C风格数组
-    const size_t batchSize = buffers.size();
-    std::vector<void *> srcAddresses(batchSize);
-    std::vector<const void *> destAddresses(batchSize);
-    std::vector<size_t> dataSizes(batchSize);
-
-    // 填充转换后的数组
-    for (size_t i = 0; i < batchSize; ++i) {
-        srcAddresses[i] = reinterpret_cast<void *>(buffers[i]);
-        destAddresses[i] = reinterpret_cast<const void *>(peer_buffer_addresses[i]);
-        dataSizes[i] = lengths[i];
+    if (!IsStridedRangeValid(buffer_base, buffer_stride, count) ||
+        !IsStridedRangeValid(peer_buffer_base, peer_buffer_stride, count)) {
+        ADAPTER_LOG_ERROR("strided batch address overflow, count=" << count << ", buffer_stride=" << buffer_stride
+                                                                   << ", peer_buffer_stride=" << peer_buffer_stride);
+        return -1;
     }
 
-    // 调用底层批量读取API
-    int ret = smem_trans_batch_read(handle_, srcAddresses.data(), destUniqueId, destAddresses.data(), dataSizes.data(),
-                                    static_cast<uint32_t>(batchSize), flags);
-    if (ret != 0) {
-        ADAPTER_LOG_ERROR("SMEM API smem_trans_batch_read happen error, ret=" << ret);
+    std::vector<uintptr_t> buffers(count);
+    std::vector<uintptr_t> peerBuffers(count);
+    std::vector<size_t> lengths(count, length);
+    for (size_t i = 0; i < count; ++i) {
+        buffers[i] = buffer_base + i * buffer_stride;
+        peerBuffers[i] = peer_buffer_base + i * peer_buffer_stride;
     }
-    return ret;
+    return BatchTransfer(opcode, destUniqueId, {buffers.data(), peerBuffers.data(), lengths.data(), count}, stream,
+                         flags);
 }
 
-int TransferAdapterPy::BatchTransferAsyncWriteSubmit(const char *destUniqueId,
-                                                     std::vector<uintptr_t> buffers,
-                                                     std::vector<uintptr_t> peer_buffer_addresses,
-                                                     std::vector<size_t> lengths,
-                                                     uintptr_t stream, uint32_t flags)
+int TransferAdapterPy::BatchTransfer(TransferOpcode opcode, const char *destUniqueId, const BatchArgs &args,
+                                     std::optional<uintptr_t> stream, uint32_t flags)
 {
     ADAPTER_ASSERT_RETURN(handle_ != nullptr, -1);
-    // 检查向量大小是否一致
-    if (buffers.size() != peer_buffer_addresses.size() ||
-        buffers.size() != lengths.size() || buffers.size() > UINT32_MAX) {
-        ADAPTER_LOG_ERROR("Buffers, peer_buffer_addresses and lengths is not equal or too long.");
+    if (args.count > UINT32_MAX) {
+        ADAPTER_LOG_ERROR("batch size (" << args.count << ") is too long.");
         return -1;
     }
 
-    // 转换向量数据为C风格数组
-    const size_t batchSize = buffers.size();
-    std::vector<const void*> srcAddresses(batchSize);
-    std::vector<void*> destAddresses(batchSize);
-    std::vector<size_t> dataSizes(batchSize);
-    void *st = reinterpret_cast<void*>(stream);
-
-    // 填充转换后的数组
-    for (size_t i = 0; i < batchSize; ++i) {
-        srcAddresses[i] = reinterpret_cast<const void*>(buffers[i]);
-        destAddresses[i] = reinterpret_cast<void*>(peer_buffer_addresses[i]);
-        dataSizes[i] = lengths[i];
+    // 转换向量数据为C风格数组, 长度数组smem只读取, 直接使用
+    const size_t count = args.count;
+    auto dataSizes = const_cast<size_t *>(args.lengths);
+    auto batchSize = static_cast<uint32_t>(count);
+    int ret;
+    const char *api;
+    if (opcode == TransferOpcode::WRITE) {
+        std::vector<const void *> srcAddresses(count);
+        std::vector<void *> destAddresses(count);
+        for (size_t i = 0; i < count; ++i) {
+            srcAddresses[i] = reinterpret_cast<const void *>(args.buffers[i]);
+            destAddresses[i] = reinterpret_cast<void *>(args.peerBuffers[i]);
+        }
+        if (stream.has_value()) {
+            api = "smem_trans_batch_write_submit";
+            ret = smem_trans_batch_write_submit(handle_, srcAddresses.data(), destUniqueId, destAddresses.data(),
+                                                dataSizes, batchSize, reinterpret_cast<void *>(stream.value()), flags);
+        } else {
+            api = "smem_trans_batch_write";
+            ret = smem_trans_batch_write(handle_, srcAddresses.data(), destUniqueId, destAddresses.data(), dataSizes,
+                                         batchSize, flags);
+        }
+    } else {
+        std::vector<void *> srcAddresses(count);
+        std::vector<const void *> destAddresses(count);
+        for (size_t i = 0; i < count; ++i) {
+            srcAddresses[i] = reinterpret_cast<void *>(args.buffers[i]);
+            destAddresses[i] = reinterpret_cast<const void *>(args.peerBuffers[i]);
+        }
+        if (stream.has_value()) {
+            api = "smem_trans_batch_read_submit";
+            ret = smem_trans_batch_read_submit(handle_, srcAddresses.data(), destUniqueId, destAddresses.data(),
+                                               dataSizes, batchSize, reinterpret_cast<void *>(stream.value()), flags);
+        } else {
+            api = "smem_trans_batch_read";
+            ret = smem_trans_batch_read(handle_, srcAddresses.data(), destUniqueId, destAddresses.data(), dataSizes,
+                                        batchSize, flags);
+        }
     }
-
-    // 调用底层批量写入API
-    int ret = smem_trans_batch_write_submit(
-        handle_,
-        srcAddresses.data(),
-        destUniqueId,
-        destAddresses.data(),
-        dataSizes.data(),
-        static_cast<uint32_t>(batchSize),
-        st,
-        flags);
     if (ret != 0) {
-        ADAPTER_LOG_ERROR("SMEM API smem_trans_batch_write happen error, ret=" << ret);
+        ADAPTER_LOG_ERROR("SMEM API " << api << " happen error, ret=" << ret);
     }
     return ret;
 }
 
-int TransferAdapterPy::BatchTransferAsyncReadSubmit(const char *destUniqueId,
-                                                    std::vector<uintptr_t> buffers,
-                                                    std::vector<uintptr_t> peer_buffer_addresses,
-                                                    std::vector<size_t> lengths,
-                                                    uintptr_t stream, uint32_t flags)
+int TransferAdapterPy::BatchTransfer(TransferOpcode opcode, const char *destUniqueId, const py::buffer &buffers,
+                                     const py::buffer &peerBuffers, const py::buffer &lengths,
+                                     std::optional<uintptr_t> stream, uint32_t flags)
 {
-    ADAPTER_ASSERT_RETURN(handle_ != nullptr, -1);
-    // 检查向量大小是否一致
-    if (buffers.size() != peer_buffer_addresses.size() ||
-        buffers.size() != lengths.size() || buffers.size() > UINT32_MAX) {
-        ADAPTER_LOG_ERROR("Buffers, peer_buffer_addresses and lengths is not equal or too long.");
+    // called with GIL held, the views must be released after GIL is taken back
+    BatchArrayView bufferView;
+    BatchArrayView peerView;
+    BatchArrayView lengthView;
+    if (!bufferView.Load(buffers, "buffers") || !peerView.Load(peerBuffers, "peer_buffers") ||
+        !lengthView.Load(lengths, "lengths")) {
         return -1;
     }
+    ADAPTER_ASSERT_RETURN(IsSameBatchSize(bufferView.Size(), peerView.Size(), lengthView.Size()), -1);
 
-    // 转换向量数据为C风格数组
-    const size_t batchSize = buffers.size();
-    std::vector<void*> srcAddresses(batchSize);
-    std::vector<const void*> destAddresses(batchSize);
-    std::vector<size_t> dataSizes(batchSize);
-    void *st = reinterpret_cast<void*>(stream);
-
-    // 填充转换后的数组
-    for (size_t i = 0; i < batchSize; ++i) {
-        srcAddresses[i] = reinterpret_cast<void*>(buffers[i]);
-        destAddresses[i] = reinterpret_cast<const void*>(peer_buffer_addresses[i]);
-        dataSizes[i] = lengths[i];
+    BatchArgs args{reinterpret_cast<const uintptr_t *>(bufferView.Data()),
+                   reinterpret_cast<const uintptr_t *>(peerView.Data()),
+                   reinterpret_cast<const size_t *>(lengthView.Data()), bufferView.Size()};
+    py::gil_scoped_release release;
+    return BatchTransfer(opcode, destUniqueId, args, stream, flags);
+}
+
+py::object TransferAdapterPy::TransferAsync(TransferOpcode opcode, const char *destUniqueId, uintptr_t buffer,
+                                            uintptr_t peer_buffer_address, size_t length, uint32_t flags)
+{
+    return SubmitAsync(opcode, destUniqueId, {buffer}, {peer_buffer_address}, {length}, flags);
+}
+
+py::object TransferAdapterPy::BatchTransferAsync(TransferOpcode opcode, const char *destUniqueId,
+                                                 const std::vector<uintptr_t> &buffers,
+                                                 const std::vector<uintptr_t> &peer_buffer_addresses,
+                                                 const std::vector<size_t> &lengths, uint32_t flags)
+{
+    if (!IsSameBatchSize(buffers.size(), peer_buffer_addresses.size(), lengths.size())) {
+        throw std::invalid_argument("buffers, peer_buffers and lengths is not equal.");
     }
+    return SubmitAsync(opcode, destUniqueId, buffers, peer_buffer_addresses, lengths, flags);
+}
 
-    // 调用底层批量读取API
-    int ret = smem_trans_batch_read_submit(
-        handle_,
-        srcAddresses.data(),
-        destUniqueId,
-        destAddresses.data(),
-        dataSizes.data(),
-        static_cast<uint32_t>(batchSize),
-        st,
-        flags);
-    if (ret != 0) {
-        ADAPTER_LOG_ERROR("SMEM API smem_trans_batch_read happen error, ret=" << ret);
+py::object TransferAdapterPy::BatchTransferAsync(TransferOpcode opcode, const char *destUniqueId,
+                                                 const py::buffer &buffers, const py::buffer &peer_buffer_addresses,
+                                                 const py::buffer &lengths, uint32_t flags)
+{
+    BatchArrayView bufferView;
+    BatchArrayView peerView;
+    BatchArrayView lengthView;
+    if (!bufferView.Load(buffers, "buffers") || !peerView.Load(peer_buffer_addresses, "peer_buffers") ||
+        !lengthView.Load(lengths, "lengths") ||
+        !IsSameBatchSize(bufferView.Size(), peerView.Size(), lengthView.Size())) {
+        throw std::invalid_argument("buffers, peer_buffers and lengths must be 1-D 64-bit arrays of same size.");
     }
-    return ret;
+    auto count = bufferView.Size();
+    return SubmitAsync(opcode, destUniqueId, {bufferView.Data(), bufferView.Data() + count},
+                       {peerView.Data(), peerView.Data() + count}, {lengthView.Data(), lengthView.Data() + count},
+                       flags);
+}
+
+py::object TransferAdapterPy::SubmitAsync(TransferOpcode opcode, std::string destUniqueId,
+                                          std::vector<uintptr_t> buffers, std::vector<uintptr_t> peerBuffers,
+                                          std::vector<size_t> lengths, uint32_t flags)
+{
+    if (asyncExecutor_ == nullptr) {
+        asyncExecutor_ = std::make_unique<ock::mf::PyCompletionExecutor>([this]() { return smem_trans_wait(handle_); });
+    }
+    return asyncExecutor_->Submit([this, opcode, destUniqueId = std::move(destUniqueId), buffers = std::move(buffers),
+                                   peerBuffers = std::move(peerBuffers), lengths = std::move(lengths), flags]() {
+        return BatchTransfer(opcode, destUniqueId.c_str(),
+                             {buffers.data(), peerBuffers.data(), lengths.data(), buffers.size()}, std::nullopt,
+                             flags | ASYNC_COPY_FLAG);
+    });
 }
 
 int TransferAdapterPy::RegisterMemory(uintptr_t buffer_addr, size_t capacity)
@@ -348,6 +496,7 @@ int TransferAdapterPy::BatchRegisterMemory(std::vector<uintptr_t> buffer_addrs,
 
 void TransferAdapterPy::TransferDestroy()
 {
+    asyncExecutor_.reset();
     smem_trans_destroy(handle_, 0);
     handle_ = nullptr;
 }
@@ -402,10 +551,23 @@ PYBIND11_MODULE(_pymf_transfer, m)
             .def("transfer_sync_write", &TransferAdapterPy::TransferSyncWrite, py::call_guard<py::gil_scoped_release>(),
                  py::arg("dest_session"), py::arg("buffer"), py::arg("peer_buffer"), py::arg("length"),
                  py::arg("flags") = 0)
-            .def("batch_transfer_sync_write", &TransferAdapterPy::BatchTransferSyncWrite,
+            .def("batch_transfer_sync_write", py::overload_cast<const char *, const py::buffer &,
+                 const py::buffer &, const py::buffer &, uint32_t>(&TransferAdapterPy::BatchTransferSyncWrite),
+                 py::arg("dest_session"), py::arg("buffers"), py::arg("peer_buffers"), py::arg("lengths"),
+                 py::arg("flags") = 0)
+            .def("batch_transfer_sync_write", py::overload_cast<const char *, const std::vector<uintptr_t> &,
+                 const std::vector<uintptr_t> &, const std::vector<size_t> &, uint32_t>(
+                 &TransferAdapterPy::BatchTransferSyncWrite),
                  py::call_guard<py::gil_scoped_release>(), py::arg("dest_session"), py::arg("buffers"),
                  py::arg("peer_buffers"), py::arg("lengths"), py::arg("flags") = 0)
-            .def("batch_transfer_async_write_submit", &TransferAdapterPy::BatchTransferAsyncWriteSubmit,
+            .def("batch_transfer_async_write_submit", py::overload_cast<const char *, const py::buffer &,
+                 const py::buffer &, const py::buffer &, uintptr_t, uint32_t>(
+                 &TransferAdapterPy::BatchTransferAsyncWriteSubmit),
+                 py::arg("dest_session"), py::arg("buffers"), py::arg("peer_buffers"), py::arg("lengths"),
+                 py::arg("stream"), py::arg("flags") = 0)
+            .def("batch_transfer_async_write_submit", py::overload_cast<const char *,
+                 const std::vector<uintptr_t> &, const std::vector<uintptr_t> &, const std::vector<size_t> &,
+                 uintptr_t, uint32_t>(&TransferAdapterPy::BatchTransferAsyncWriteSubmit),
                  py::call_guard<py::gil_scoped_release>(), py::arg("dest_session"), py::arg("buffers"),
                  py::arg("peer_buffers"), py::arg("lengths"), py::arg("stream"), py::arg("flags") = 0)
             .def("transfer_sync_read", &TransferAdapterPy::TransferSyncRead, py::call_guard<py::gil_scoped_release>(),
@@ -417,12 +579,64 @@ PYBIND11_MODULE(_pymf_transfer, m)
             .def("transfer_async_read_submit", &TransferAdapterPy::TransferAsyncReadSubmit,
                  py::call_guard<py::gil_scoped_release>(), py::arg("dest_session"), py::arg("buffer"),
                  py::arg("peer_buffer"), py::arg("length"), py::arg("stream"), py::arg("flags") = 0)
-            .def("batch_transfer_sync_read", &TransferAdapterPy::BatchTransferSyncRead,
+            .def("batch_transfer_sync_read", py::overload_cast<const char *, const py::buffer &,
+                 const py::buffer &, const py::buffer &, uint32_t>(&TransferAdapterPy::BatchTransferSyncRead),
+                 py::arg("dest_session"), py::arg("buffers"), py::arg("peer_buffers"), py::arg("lengths"),
+                 py::arg("flags") = 0)
+            .def("batch_transfer_sync_read", py::overload_cast<const char *, const std::vector<uintptr_t> &,
+                 const std::vector<uintptr_t> &, const std::vector<size_t> &, uint32_t>(
+                 &TransferAdapterPy::BatchTransferSyncRead),
                  py::call_guard<py::gil_scoped_release>(), py::arg("dest_session"), py::arg("buffers"),
                  py::arg("peer_buffers"), py::arg("lengths"), py::arg("flags") = 0)
-            .def("batch_transfer_async_read_submit", &TransferAdapterPy::BatchTransferAsyncReadSubmit,
+            .def("batch_transfer_async_read_submit", py::overload_cast<const char *, const py::buffer &,
+                 const py::buffer &, const py::buffer &, uintptr_t, uint32_t>(
+                 &TransferAdapterPy::BatchTransferAsyncReadSubmit),
+                 py::arg("dest_session"), py::arg("buffers"), py::arg("peer_buffers"), py::arg("lengths"),
+                 py::arg("stream"), py::arg("flags") = 0)
+            .def("batch_transfer_async_read_submit", py::overload_cast<const char *,
+                 const std::vector<uintptr_t> &, const std::vector<uintptr_t> &, const std::vector<size_t> &,
+                 uintptr_t, uint32_t>(&TransferAdapterPy::BatchTransferAsyncReadSubmit),
                  py::call_guard<py::gil_scoped_release>(), py::arg("dest_session"), py::arg("buffers"),
                  py::arg("peer_buffers"), py::arg("lengths"), py::arg("stream"), py::arg("flags") = 0)
+            .def("batch_transfer_strided", &TransferAdapterPy::BatchTransferStrided,
+                 py::call_guard<py::gil_scoped_release>(), py::arg("opcode"), py::arg("dest_session"),
+                 py::arg("buffer_base"), py::arg("buffer_stride"), py::arg("peer_buffer_base"),
+                 py::arg("peer_buffer_stride"), py::arg("length"), py::arg("count"), py::arg("stream") = py::none(),
+                 py::arg("flags") = 0, R"(
+transfer count blocks laid out regularly, the i-th block is length bytes at base + i * stride.
+Parameters:
+    opcode (TransferOpcode): Read or Write
+    stream (int): submit to this stream if set, otherwise transfer synchronously
+Returns:
+    returns zero on success. On error, none-zero is returned.
+)")
+            .def("transfer_write_async", [](TransferAdapterPy &self, const char *dest, uintptr_t buffer,
+                 uintptr_t peer, size_t length, uint32_t flags) {
+                    return self.TransferAsync(TransferAdapterPy::TransferOpcode::WRITE, dest, buffer, peer, length,
+                                              flags);
+                 }, py::arg("dest_session"), py::arg("buffer"), py::arg("peer_buffer"), py::arg("length"),
+                 py::arg("flags") = 0)
+            .def("transfer_read_async", [](TransferAdapterPy &self, const char *dest, uintptr_t buffer,
+                 uintptr_t peer, size_t length, uint32_t flags) {
+                    return self.TransferAsync(TransferAdapterPy::TransferOpcode::READ, dest, buffer, peer, length,
+                                              flags);
+                 }, py::arg("dest_session"), py::arg("buffer"), py::arg("peer_buffer"), py::arg("length"),
+                 py::arg("flags") = 0)
+            .def("batch_transfer_async", py::overload_cast<TransferAdapterPy::TransferOpcode, const char *,
+                 const py::buffer &, const py::buffer &, const py::buffer &, uint32_t>(
+                 &TransferAdapterPy::BatchTransferAsync),
+                 py::arg("opcode"), py::arg("dest_session"), py::arg("buffers"), py::arg("peer_buffers"),
+                 py::arg("lengths"), py::arg("flags") = 0)
+            .def("batch_transfer_async", py::overload_cast<TransferAdapterPy::TransferOpcode, const char *,
+                 const std::vector<uintptr_t> &, const std::vector<uintptr_t> &, const std::vector<size_t> &,
+                 uint32_t>(&TransferAdapterPy::BatchTransferAsync),
+                 py::arg("opcode"), py::arg("dest_session"), py::arg("buffers"), py::arg("peer_buffers"),
+                 py::arg("lengths"), py::arg("flags") = 0, R"(
+transfer batch on a native completion thread without blocking the caller.
+Returns:
+    concurrent.futures.Future resolved with zero on success or none-zero error code,
+    asyncio callers can await asyncio.wrap_future(future).
+)")
             .def("register_memory", &TransferAdapterPy::RegisterMemory, py::call_guard<py::gil_scoped_release>(),
                  py::arg("buffer_addr"), py::arg("capacity"))
             .def("unregister_memory", &TransferAdapterPy::UnregisterMemory, py::call_guard<py::gil_scoped_release>(),
@@ -14,8 +14,13 @@
 
 #include <pybind11/pybind11.h>
 #include <mutex>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
 #include "smem_bm_def.h"
 #include "smem_trans.h"
+#include "py_completion_executor.h"
 
 #ifdef UINTPTR_MAX
 using uintptr_t = ::uintptr_t;
@@ -49,15 +54,23 @@ public:
     int TransferSyncWrite(const char *destUniqueId, uintptr_t buffer, uintptr_t peer_buffer_address, size_t length,
                           uint32_t flags);
 
-    int BatchTransferSyncWrite(const char *destUniqueId, std::vector<uintptr_t> buffers,
-                               std::vector<uintptr_t> peer_buffer_addresses, std::vector<size_t> lengths,
+    int BatchTransferSyncWrite(const char *destUniqueId, const std::vector<uintptr_t> &buffers,
+                               const std::vector<uintptr_t> &peer_buffer_addresses, const std::vector<size_t> &lengths,
+                               uint32_t flags);
+
+    int BatchTransferSyncWrite(const char *destUniqueId, const pybind11::buffer &buffers,
+                               const pybind11::buffer &peer_buffer_addresses, const pybind11::buffer &lengths,
                                uint32_t flags);
 
     int TransferSyncRead(const char *destUniqueId, uintptr_t buffer, uintptr_t peer_buffer_address, size_t length,
                          uint32_t flags);
 
-    int BatchTransferSyncRead(const char *destUniqueId, std::vector<uintptr_t> buffers,
-                              std::vector<uintptr_t> peer_buffer_addresses, std::vector<size_t> lengths,
+    int BatchTransferSyncRead(const char *destUniqueId, const std::vector<uintptr_t> &buffers,
+                              const std::vector<uintptr_t> &peer_buffer_addresses, const std::vector<size_t> &lengths,
+                              uint32_t flags);
+
+    int BatchTransferSyncRead(const char *destUniqueId, const pybind11::buffer &buffers,
+                              const pybind11::buffer &peer_buffer_addresses, const pybind11::buffer &lengths,
                               uint32_t flags);
 
     int TransferAsyncReadSubmit(const char *destUniqueId, uintptr_t buffer, uintptr_t peer_buffer_address,
@@ -67,17 +80,47 @@ public:
                                  size_t length, uintptr_t stream, uint32_t flags);
 
     int BatchTransferAsyncWriteSubmit(const char *destUniqueId,
-                                      std::vector<uintptr_t> buffers,
-                                      std::vector<uintptr_t> peer_buffer_addresses,
-                                      std::vector<size_t> lengths,
+                                      const std::vector<uintptr_t> &buffers,
+                                      const std::vector<uintptr_t> &peer_buffer_addresses,
+                                      const std::vector<size_t> &lengths,
+                                      uintptr_t stream, uint32_t flags);
+
+    int BatchTransferAsyncWriteSubmit(const char *destUniqueId,
+                                      const pybind11::buffer &buffers,
+                                      const pybind11::buffer &peer_buffer_addresses,
+                                      const pybind11::buffer &lengths,
                                       uintptr_t stream, uint32_t flags);
 
     int BatchTransferAsyncReadSubmit(const char *destUniqueId,
-                                     std::vector<uintptr_t> buffers,
-                                     std::vector<uintptr_t> peer_buffer_addresses,
-                                     std::vector<size_t> lengths,
+                                     const std::vector<uintptr_t> &buffers,
+                                     const std::vector<uintptr_t> &peer_buffer_addresses,
+                                     const std::vector<size_t> &lengths,
+                                     uintptr_t stream, uint32_t flags);
+
+    int BatchTransferAsyncReadSubmit(const char *destUniqueId,
+                                     const pybind11::buffer &buffers,
+                                     const pybind11::buffer &peer_buffer_addresses,
+                                     const pybind11::buffer &lengths,
                                      uintptr_t stream, uint32_t flags);
 
+    // transfer count blocks laid out regularly, i-th block is [base + i * stride, + length), submit to stream if set
+    int BatchTransferStrided(TransferOpcode opcode, const char *destUniqueId, uintptr_t buffer_base,
+                             size_t buffer_stride, uintptr_t peer_buffer_base, size_t peer_buffer_stride,
+                             size_t length, size_t count, std::optional<uintptr_t> stream, uint32_t flags);
+
+    // issued with ASYNC_COPY_FLAG and waited on a native completion thread, future resolves with return code
+    pybind11::object TransferAsync(TransferOpcode opcode, const char *destUniqueId, uintptr_t buffer,
+                                   uintptr_t peer_buffer_address, size_t length, uint32_t flags);
+
+    pybind11::object BatchTransferAsync(TransferOpcode opcode, const char *destUniqueId,
+                                        const std::vector<uintptr_t> &buffers,
+                                        const std::vector<uintptr_t> &peer_buffer_addresses,
+                                        const std::vector<size_t> &lengths, uint32_t flags);
+
+    pybind11::object BatchTransferAsync(TransferOpcode opcode, const char *destUniqueId,
+                                        const pybind11::buffer &buffers, const pybind11::buffer &peer_buffer_addresses,
+                                        const pybind11::buffer &lengths, uint32_t flags);
+
     int RegisterMemory(uintptr_t buffer_addr, size_t capacity);
 
     // must be called before TransferAdapterPy::~TransferAdapterPy()
@@ -89,9 +132,29 @@ public:
 
     void UnInitialize();
 
+private:
+    // addresses and sizes of one batch, viewed in place from the caller's arrays
+    struct BatchArgs {
+        const uintptr_t *buffers;
+        const uintptr_t *peerBuffers;
+        const size_t *lengths;
+        size_t count;
+    };
+
+    int BatchTransfer(TransferOpcode opcode, const char *destUniqueId, const BatchArgs &args,
+                      std::optional<uintptr_t> stream, uint32_t flags);
+
+    int BatchTransfer(TransferOpcode opcode, const char *destUniqueId, const pybind11::buffer &buffers,
+                      const pybind11::buffer &peerBuffers, const pybind11::buffer &lengths,
+                      std::optional<uintptr_t> stream, uint32_t flags);
+
+    pybind11::object SubmitAsync(TransferOpcode opcode, std::string destUniqueId, std::vector<uintptr_t> buffers,
+                                 std::vector<uintptr_t> peerBuffers, std::vector<size_t> lengths, uint32_t flags);
+
 private:
     smem_bm_t handle_;
     int sockfd_;
+    std::unique_ptr<ock::mf::PyCompletionExecutor> asyncExecutor_;
 };
 
 #endif // PYTRANSFER_H
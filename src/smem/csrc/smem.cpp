@@ -9,6 +9,7 @@
  * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
  * See the Mulan PSL v2 for more details.
 */
+#include <sys/stat.h>
 #include <atomic>
 #include "smem_common_includes.h"
 #include "smem_version.h"
@@ -88,6 +89,22 @@ SMEM_API int32_t smem_set_conf_store_tls(bool enable, const char *tls_info, cons
     return ock::smem::SM_OK;
 }
 
+SMEM_API int32_t smem_set_conf_store_persist_dir(const char *persist_dir)
+{
+    if (persist_dir == nullptr || persist_dir[0] == '\0') {
+        ock::smem::StoreFactory::SetPersistDir("");
+        return ock::smem::SM_OK;
+    }
+
+    struct stat dirStat {};
+    if (stat(persist_dir, &dirStat) != 0 || !S_ISDIR(dirStat.st_mode)) {
+        SM_LOG_ERROR("config store persist dir is not a directory.");
+        return ock::smem::SM_INVALID_PARAM;
+    }
+    ock::smem::StoreFactory::SetPersistDir(persist_dir);
+    return ock::smem::SM_OK;
+}
+
 SMEM_API const char *smem_get_last_err_msg()
 {
     return ock::smem::SmLastError::GetAndClear(false);
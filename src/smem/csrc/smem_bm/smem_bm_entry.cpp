@@ -11,6 +11,9 @@
 */
 #include "smem_bm_entry.h"
 
+#include <algorithm>
+#include <map>
+
 #include "hybm_big_mem.h"
 #include "hybm_data_op.h"
 #include "smem_store_factory.h"
@@ -19,6 +22,7 @@
 
 namespace ock {
 namespace smem {
+const std::string SMEM_BM_JOIN_INFO_KEY_PREFIX = "JI_"; // join info of each rank, kept for the later joining ones
 
 int32_t SmemBmEntry::Initialize(const hybm_options &options)
 {
@@ -138,24 +142,93 @@ Result SmemBmEntry::JoinHandle(uint32_t rk)
                                            << ", rank size is: " << globalGroup_->GetRankSize());
     SM_ASSERT_RETURN(inited_, SM_NOT_INITIALIZED);
 
-    std::vector<uint32_t> allRanks(globalGroup_->GetRankSize());
-    auto ret = globalGroup_->GroupAllGather((const char *)&options_.rank, sizeof(uint32_t), (char *)allRanks.data(),
-                                            sizeof(uint32_t) * globalGroup_->GetRankSize());
+    /* only the joining rank gathers its info to members, it gets info of members published at their joining */
+    bool joining = (rk == options_.rank);
+    std::vector<uint8_t> localInfo;
+    for (auto info : {&entityInfo_, &hbmSliceInfo_, &dramSliceInfo_}) {
+        PackJoinInfo(*info, localInfo);
+    }
+    if (joining) {
+        auto ret = _configStore->Set(JoinInfoKey(options_.rank), localInfo);
+        if (ret != SM_OK) {
+            SM_LOG_ERROR("publish join info failed, result: " << ConfigStore::ErrStr(ret));
+            return SM_ERROR;
+        }
+    }
+
+    std::map<uint32_t, std::vector<uint8_t>> allInfo;
+    auto ret = globalGroup_->GroupAllGatherV(joining ? localInfo : std::vector<uint8_t>{}, allInfo);
     if (ret != 0) {
-        SM_LOG_ERROR("hybm gather ranks failed, result: " << ret);
+        SM_LOG_ERROR("hybm gather join info failed, result: " << ret);
         return SM_ERROR;
     }
+    if (joining) {
+        ret = FetchJoinInfo(allInfo);
+        if (ret != SM_OK) {
+            return SM_ERROR;
+        }
+    } else {
+        /* local slice is imported together with the new one, as ranks imported before are skipped */
+        allInfo[options_.rank] = localInfo;
+    }
+
+    std::vector<uint32_t> allRanks;
+    std::vector<hybm_exchange_info> entities;
+    std::vector<hybm_exchange_info> hbmSlices;
+    std::vector<hybm_exchange_info> dramSlices;
+    for (auto &it : allInfo) {
+        allRanks.emplace_back(it.first);
+        if (it.second.empty()) {
+            continue;
+        }
 
-    if ((ret = ExchangeEntityForJoin()) != SM_OK) {
-        return ret;
+        uint64_t offset = 0;
+        hybm_exchange_info entity;
+        hybm_exchange_info hbmSlice;
+        hybm_exchange_info dramSlice;
+        if (UnpackJoinInfo(it.second, offset, entity) != SM_OK ||
+            UnpackJoinInfo(it.second, offset, hbmSlice) != SM_OK ||
+            UnpackJoinInfo(it.second, offset, dramSlice) != SM_OK) {
+            SM_LOG_ERROR("invalid join info from rank: " << it.first << ", size: " << it.second.size());
+            return SM_ERROR;
+        }
+        entities.emplace_back(entity);
+        if (hbmSlice.descLen > 0) {
+            hbmSlices.emplace_back(hbmSlice);
+        }
+        if (dramSlice.descLen > 0) {
+            dramSlices.emplace_back(dramSlice);
+        }
     }
 
-    if ((ret = ExchangeSliceForJoin(hbmSliceInfo_)) != SM_OK) {
-        return ret;
+    ret = hybm_import(entity_, entities.data(), entities.size(), nullptr, HYBM_FLAG_EXPORT_ENTITY);
+    if (ret != 0) {
+        SM_LOG_ERROR("hybm import entity failed, result: " << ret);
+        return SM_ERROR;
     }
 
-    if ((ret = ExchangeSliceForJoin(dramSliceInfo_)) != SM_OK) {
-        return ret;
+    /* slices of a rank can be imported only after the rank imported entities of others */
+    ret = globalGroup_->GroupBarrier();
+    if (ret != 0) {
+        SM_LOG_ERROR("hybm barrier failed, result: " << ret);
+        return SM_ERROR;
+    }
+
+    for (auto slices : {&hbmSlices, &dramSlices}) {
+        if (slices->empty()) {
+            continue;
+        }
+        ret = hybm_import(entity_, slices->data(), slices->size(), nullptr, 0);
+        if (ret != 0) {
+            SM_LOG_ERROR("hybm import slice failed, result: " << ret);
+            return SM_ERROR;
+        }
+    }
+
+    ret = globalGroup_->GroupBarrier();
+    if (ret != 0) {
+        SM_LOG_ERROR("hybm barrier failed, result: " << ret);
+        return SM_ERROR;
     }
 
     ret = hybm_mmap(entity_, 0);
@@ -179,60 +252,70 @@ Result SmemBmEntry::LeaveHandle(uint32_t rk)
         SM_LOG_ERROR("hybm leave failed, result: " << ret);
         return SM_ERROR;
     }
+
+    /* the leaving rank removes its join info, members remove it too in case the rank is down without leaving */
+    ret = _configStore->Remove(JoinInfoKey(rk), false);
+    if (ret != SM_OK && ret != StoreErrorCode::NOT_EXIST) {
+        SM_LOG_WARN("remove join info of rank: " << rk << " failed, result: " << ConfigStore::ErrStr(ret));
+    }
     return SM_OK;
 }
 
-Result SmemBmEntry::ExchangeSliceForJoin(const hybm_exchange_info &sliceInfo)
+Result SmemBmEntry::FetchJoinInfo(std::map<uint32_t, std::vector<uint8_t>> &allInfo)
 {
-    if (sliceInfo.descLen == 0) {
-        return SM_OK;
-    }
-
-    std::vector<hybm_exchange_info> allExInfo(coreOptions_.rankCount);
-    auto totalSize = sizeof(hybm_exchange_info) * globalGroup_->GetRankSize();
-    auto ret = globalGroup_->GroupAllGather((const char *)&sliceInfo, sizeof(hybm_exchange_info),
-                                            (char *)allExInfo.data(), totalSize);
-    if (ret != 0) {
-        SM_LOG_ERROR("hybm gather export failed, result: " << ret);
-        return SM_ERROR;
-    }
+    /* info of all members is got in one round trip */
+    ConfigStoreAsyncWaiter waiter;
+    for (auto &it : allInfo) {
+        if (!it.second.empty()) {
+            continue;
+        }
 
-    ret = hybm_import(entity_, allExInfo.data(), globalGroup_->GetRankSize(), nullptr, 0);
-    if (ret != 0) {
-        SM_LOG_ERROR("hybm import failed, result: " << ret);
-        return SM_ERROR;
+        auto &info = it.second;
+        waiter.Begin();
+        auto ret = _configStore->GetAsync(JoinInfoKey(it.first), 0,
+                                          [&waiter, &info](Result result, std::vector<uint8_t> &value) {
+                                              info = std::move(value);
+                                              waiter.Finish(result);
+                                          });
+        if (ret != SM_OK) {
+            waiter.Finish(ret);
+        }
     }
 
-    ret = globalGroup_->GroupBarrier();
-    if (ret != 0) {
-        SM_LOG_ERROR("hybm barrier failed, result: " << ret);
+    auto ret = waiter.Wait();
+    if (ret != SM_OK) {
+        SM_LOG_ERROR("get join info of members failed, result: " << ConfigStore::ErrStr(ret));
         return SM_ERROR;
     }
-
     return SM_OK;
 }
 
-Result SmemBmEntry::ExchangeEntityForJoin()
+std::string SmemBmEntry::JoinInfoKey(uint32_t rank)
 {
-    std::vector<hybm_exchange_info> allExInfo(coreOptions_.rankCount);
-    auto ret = globalGroup_->GroupAllGather((char *)&entityInfo_, sizeof(hybm_exchange_info), (char *)allExInfo.data(),
-                                            sizeof(hybm_exchange_info) * globalGroup_->GetRankSize());
-    if (ret != 0) {
-        SM_LOG_ERROR("hybm gather export failed, result: " << ret);
-        return SM_ERROR;
-    }
+    return SMEM_BM_JOIN_INFO_KEY_PREFIX + std::to_string(rank);
+}
 
-    ret = hybm_import(entity_, allExInfo.data(), globalGroup_->GetRankSize(), nullptr, HYBM_FLAG_EXPORT_ENTITY);
-    if (ret != 0) {
-        SM_LOG_ERROR("hybm import failed, result: " << ret);
+void SmemBmEntry::PackJoinInfo(const hybm_exchange_info &info, std::vector<uint8_t> &buffer)
+{
+    auto descLen = std::min(info.descLen, static_cast<uint32_t>(sizeof(info.desc)));
+    auto lenBytes = reinterpret_cast<const uint8_t *>(&descLen);
+    buffer.insert(buffer.end(), lenBytes, lenBytes + sizeof(descLen));
+    buffer.insert(buffer.end(), info.desc, info.desc + descLen);
+}
+
+Result SmemBmEntry::UnpackJoinInfo(const std::vector<uint8_t> &buffer, uint64_t &offset, hybm_exchange_info &info)
+{
+    bzero(&info, sizeof(hybm_exchange_info));
+    if (offset + sizeof(info.descLen) > buffer.size()) {
         return SM_ERROR;
     }
-
-    ret = globalGroup_->GroupBarrier();
-    if (ret != 0) {
-        SM_LOG_ERROR("hybm barrier failed, result: " << ret);
+    (void)std::copy_n(buffer.data() + offset, sizeof(info.descLen), reinterpret_cast<uint8_t *>(&info.descLen));
+    offset += sizeof(info.descLen);
+    if (info.descLen > sizeof(info.desc) || offset + info.descLen > buffer.size()) {
         return SM_ERROR;
     }
+    (void)std::copy_n(buffer.data() + offset, info.descLen, info.desc);
+    offset += info.descLen;
     return SM_OK;
 }
 
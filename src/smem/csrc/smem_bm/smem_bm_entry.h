@@ -77,8 +77,10 @@ private:
 
     Result JoinHandle(uint32_t rk);
     Result LeaveHandle(uint32_t rk);
-    Result ExchangeSliceForJoin(const hybm_exchange_info &sliceInfo);
-    Result ExchangeEntityForJoin();
+    Result FetchJoinInfo(std::map<uint32_t, std::vector<uint8_t>> &allInfo);
+    static std::string JoinInfoKey(uint32_t rank);
+    static void PackJoinInfo(const hybm_exchange_info &info, std::vector<uint8_t> &buffer);
+    static Result UnpackJoinInfo(const std::vector<uint8_t> &buffer, uint64_t &offset, hybm_exchange_info &info);
 
 private:
     /* hot used variables */
@@ -31,6 +31,8 @@ namespace ock {
 namespace smem {
 // reserve 128GB dram va for malloc per rank, refine to configurable later
 constexpr uint64_t TRANS_RESERVE_DRAM_VA_SIZE = 1024ULL * 1024 * 1024 * 128;
+// host only entry reserves less, 512 ranks stay below the load address of PIE executables
+constexpr uint64_t TRANS_HOST_ONLY_DRAM_VA_SIZE = 1024ULL * 1024 * 1024 * 8;
 
 SmemTransEntryPtr SmemTransEntry::Create(const std::string &name, const std::string &storeUrl,
                                          const smem_trans_config_t &config)
@@ -94,6 +96,7 @@ int32_t SmemTransEntry::Initialize(const smem_trans_config_t &config)
     SM_VALIDATE_RETURN(ret == SM_OK, "store helper generate rankId failed: " << ret, ret);
 
     config_ = config;
+    hostOnly_ = (config.dataOpType & (SMEMB_DATA_OP_SDMA | SMEMB_DATA_OP_DEVICE_RDMA)) == 0;
     auto options = GenerateHybmOptions();
     options.bmDataOpType = static_cast<hybm_data_op_type>(HYBM_DOP_TYPE_DEFAULT);
     if (config.dataOpType & SMEMB_DATA_OP_SDMA) {
@@ -112,6 +115,10 @@ int32_t SmemTransEntry::Initialize(const smem_trans_config_t &config)
         auto temp = static_cast<uint32_t>(options.bmDataOpType) | HYBM_DOP_TYPE_DEVICE_RDMA;
         options.bmDataOpType = static_cast<hybm_data_op_type>(temp);
     }
+    if (config.dataOpType & SMEMB_DATA_OP_HOST_SIM) {
+        auto temp = static_cast<uint32_t>(options.bmDataOpType) | HYBM_DOP_TYPE_HOST_SIM;
+        options.bmDataOpType = static_cast<hybm_data_op_type>(temp);
+    }
 
     entity_ = hybm_create_entity(entityId_, &options, 0);
     SM_VALIDATE_RETURN(entity_ != nullptr, "create new entity failed.", SM_ERROR);
@@ -183,8 +190,9 @@ void* SmemTransEntry::MallocDram(uint64_t size)
         return nullptr;
     }
 
-    if (size > TRANS_RESERVE_DRAM_VA_SIZE) {
-        SM_LOG_ERROR("malloc failed, invalid size:" << size << ", should be less than or equal " << TRANS_RESERVE_DRAM_VA_SIZE);
+    auto maxSize = hostOnly_ ? TRANS_HOST_ONLY_DRAM_VA_SIZE : TRANS_RESERVE_DRAM_VA_SIZE;
+    if (size > maxSize) {
+        SM_LOG_ERROR("malloc failed, invalid size:" << size << ", should be less than or equal " << maxSize);
         return nullptr;
     }
 
@@ -319,7 +327,7 @@ Result SmemTransEntry::BatchSyncTransfer(void *localAddrs[], const std::string &
     SM_VALIDATE_RETURN(remoteAddrs != nullptr, "invalid remoteAddrs, which is null", SM_INVALID_PARAM);
     SM_VALIDATE_RETURN(dataSizes != nullptr, "invalid dataSizes, which is null", SM_INVALID_PARAM);
     SM_VALIDATE_RETURN(batchSize != 0, "invalid batchSize, which is 0", SM_INVALID_PARAM);
-    SM_VALIDATE_RETURN(flags == 0 || flags == COPY_EXTEND_FLAG, "invalid flags", SM_INVALID_PARAM);
+    SM_VALIDATE_RETURN((flags & ~(ASYNC_COPY_FLAG | COPY_EXTEND_FLAG)) == 0, "invalid flags", SM_INVALID_PARAM);
     for (auto i = 0U; i < batchSize; i++) {
         SM_VALIDATE_RETURN(localAddrs[i] != nullptr, "localAddrs, which is null", SM_INVALID_PARAM);
         SM_VALIDATE_RETURN(remoteAddrs[i] != nullptr, "remoteAddrs, which is null", SM_INVALID_PARAM);
@@ -364,11 +372,15 @@ Result SmemTransEntry::BatchSyncTransfer(void *localAddrs[], const std::string &
     switch (opcode) {
         case SMEMB_COPY_L2G: {
             hybm_batch_copy_params copyParams = {localAddrs, mappedAddress.data(), dataSizes, batchSize};
-            ret = hybm_data_batch_copy(entity_, &copyParams, HYBM_LOCAL_DEVICE_TO_GLOBAL_DEVICE, stream, flag);
+            ret = hybm_data_batch_copy(entity_, &copyParams,
+                                       hostOnly_ ? HYBM_LOCAL_HOST_TO_GLOBAL_HOST : HYBM_LOCAL_DEVICE_TO_GLOBAL_DEVICE,
+                                       stream, flag);
         } break;
         case SMEMB_COPY_G2L: {
             hybm_batch_copy_params copyParams = {mappedAddress.data(), localAddrs, dataSizes, batchSize};
-            ret = hybm_data_batch_copy(entity_, &copyParams, HYBM_GLOBAL_DEVICE_TO_LOCAL_DEVICE, stream, flag);
+            ret = hybm_data_batch_copy(entity_, &copyParams,
+                                       hostOnly_ ? HYBM_GLOBAL_HOST_TO_LOCAL_HOST : HYBM_GLOBAL_DEVICE_TO_LOCAL_DEVICE,
+                                       stream, flag);
         } break;
         default:
             SM_LOG_ERROR("unexpect copy type[" << opcode << "] is invalid.");
@@ -380,6 +392,12 @@ Result SmemTransEntry::BatchSyncTransfer(void *localAddrs[], const std::string &
     return ret;
 }
 
+Result SmemTransEntry::Wait()
+{
+    SM_VALIDATE_RETURN(entity_ != nullptr, "entity is null", SM_NOT_INITIALIZED);
+    return hybm_wait(entity_);
+}
+
 bool SmemTransEntry::ParseTransName(const std::string &name, ock::mf::net_addr_t &ip, uint16_t &port)
 {
     UrlExtraction extraction;
@@ -663,13 +681,14 @@ hybm_options SmemTransEntry::GenerateHybmOptions()
 {
     hybm_options options{};
     options.bmType = HYBM_TYPE_HOST_INITIATE;
-    options.memType = static_cast<hybm_mem_type>(HYBM_MEM_TYPE_DEVICE | HYBM_MEM_TYPE_HOST);
+    options.memType =
+        hostOnly_ ? HYBM_MEM_TYPE_HOST : static_cast<hybm_mem_type>(HYBM_MEM_TYPE_DEVICE | HYBM_MEM_TYPE_HOST);
     options.rankCount = 512U;
     options.rankId = rankId_;
     options.devId = config_.deviceId;
     options.deviceVASpace = 0;
-    options.hostVASpace = TRANS_RESERVE_DRAM_VA_SIZE;
-    options.maxDRAMSize = TRANS_RESERVE_DRAM_VA_SIZE;
+    options.hostVASpace = hostOnly_ ? TRANS_HOST_ONLY_DRAM_VA_SIZE : TRANS_RESERVE_DRAM_VA_SIZE;
+    options.maxDRAMSize = options.hostVASpace;
     options.scene = HYBM_SCENE_TRANS;
     options.role = config_.role == SMEM_TRANS_SENDER ? HYBM_ROLE_SENDER : HYBM_ROLE_RECEIVER;
     options.dramShmFd = -1;
@@ -76,6 +76,7 @@ public:
     Result BatchSyncTransfer(void *localAddrs[], const std::string &remoteUniqueId, void *remoteAddrs[],
                              const size_t dataSizes[], uint32_t batchSize, smem_bm_copy_type opcode, void *stream,
                              uint32_t flags);
+    Result Wait();
 
 private:
     bool ParseTransName(const std::string &name, ock::mf::net_addr_t &ip, uint16_t &port);
@@ -112,6 +113,7 @@ private:
     smem_trans_config_t config_{}; /* config of transfer entry */
     WorkerUniqueId workerUniqueId_;
     uint32_t sliceInfoSize_{0}; /* same in user dev legacy segment and vmm segment */
+    bool hostOnly_{false};      /* no device data op, only host memory is allocated and copied */
     std::thread watchThread_;
     std::thread watchConnectThread_;
     std::mutex watchMutex_;
@@ -139,10 +139,10 @@ int32_t SmemStoreFaultHandler::WriteRankInfoMap(const uint32_t linkId, const std
 int32_t SmemStoreFaultHandler::AppendRankInfoMap(const uint32_t linkId, const std::string &key,
                                                  std::vector<uint8_t> &value, const StoreBackendPtr &backend)
 {
-    std::vector<uint8_t> oldValue;
-    auto ret = backend->Get(key, oldValue);
+    StoreValuePtr oldValue;
+    auto ret = backend->GetValue(key, oldValue);
     SM_VALIDATE_RETURN(ret == SUCCESS, "kv store not find key:" << key, SM_INVALID_PARAM);
-    uint16_t index = oldValue.size() / value.size() - 1;
+    uint16_t index = oldValue->Size() / value.size() - 1;
     if (key.find(SENDER_DEVICE_INFO_KEY) != std::string::npos ||
         key.find(RECEIVER_DEVICE_INFO_KEY) != std::string::npos) {
         auto it = linkIdToRankInfoMap_.find(linkId);
@@ -297,7 +297,6 @@ int SmemStoreHelper::StoreSliceInfo(const hybm_exchange_info &info, const Stored
 
 int SmemStoreHelper::ReStoreSliceInfo() noexcept
 {
-    int64_t totalValue = 0;
     SM_LOG_INFO("begin recover slice info, size = " << storeSliceInfo_.size() << ", key = " << localKeys_.sliceInfo);
     for (auto &singleInfo : storeSliceInfo_) {
         uint32_t offset = singleInfo.first * singleInfo.second.size();
@@ -306,37 +305,73 @@ int SmemStoreHelper::ReStoreSliceInfo() noexcept
             SM_LOG_ERROR("store recover slice info failed: " << ret);
             return SM_ERROR;
         }
+    }
 
-        ret = store_->Add(localKeys_.sliceCount, 1L, totalValue);
+    // all slices written, count them in flight together
+    ConfigStoreAsyncWaiter waiter;
+    for (size_t i = 0; i < storeSliceInfo_.size(); i++) {
+        waiter.Begin();
+        auto ret = store_->AddAsync(localKeys_.sliceCount, 1L, [&waiter](Result result, int64_t) {
+            waiter.Finish(result);
+        });
         if (ret != 0) {
-            SM_LOG_ERROR("store add count for slice info failed: " << ret);
-            return SM_ERROR;
+            waiter.Finish(ret);
+            break;
         }
     }
+    auto ret = waiter.Wait();
+    if (ret != 0) {
+        SM_LOG_ERROR("store add count for slice info failed: " << ret);
+        return SM_ERROR;
+    }
 
     return SM_OK;
 }
 
+int SmemStoreHelper::FetchCountAndInfo(const std::string &countKey, const std::string &infoKey, int64_t &count,
+                                       std::vector<uint8_t> &values) noexcept
+{
+    // info is appended before count increased, get it without waiting, it does not exist when count is zero
+    ConfigStoreAsyncWaiter waiter;
+    waiter.Begin();
+    auto ret = store_->AddAsync(countKey, 0L, [&waiter, &count](Result result, int64_t value) {
+        count = value;
+        waiter.Finish(result);
+    });
+    if (ret != 0) {
+        waiter.Finish(ret);
+    }
+    waiter.Begin();
+    ret = store_->GetAsync(infoKey, 0L, [&waiter, &values](Result result, std::vector<uint8_t> &value) {
+        values = std::move(value);
+        waiter.Finish(result == NOT_EXIST ? SM_OK : result);
+    });
+    if (ret != 0) {
+        waiter.Finish(ret);
+    }
+
+    ret = waiter.Wait();
+    if (ret != 0) {
+        SM_LOG_ERROR("store add(0) for key(" << countKey << ") and get key(" << infoKey << ") failed: " << ret);
+        return SM_ERROR;
+    }
+    return SM_OK;
+}
+
 void SmemStoreHelper::FindNewRemoteRanks(const FindRanksCbFunc &cb) noexcept
 {
     SM_ASSERT_RET_VOID(deviceExpSize_ != 0);
 
     std::vector<uint8_t> values;
     int64_t totalValue = 0;
-    auto ret = store_->Add(remoteKeys_.deviceCount, 0L, totalValue);
+    auto ret = FetchCountAndInfo(remoteKeys_.deviceCount, remoteKeys_.deviceInfo, totalValue, values);
     if (ret != 0) {
-        SM_LOG_ERROR("store add(0) for key(" << remoteKeys_.deviceCount << ") count failed: " << ret);
         return;
     }
     if (totalValue == 0 && remoteDeviceInfoLastTime_.size() == 0) {
         SM_LOG_DEBUG("remote device count is 0, local device count is 0, no need to find new device");
         return;
     }
-    ret = store_->Get(remoteKeys_.deviceInfo, values);
-    if (ret != 0) {
-        SM_LOG_ERROR("store get devices info with key(" << remoteKeys_.deviceInfo << ") failed: " << ret);
-        return;
-    }
     SM_LOG_DEBUG("FindNewRemoteRanks deal key("
                  << remoteKeys_.deviceInfo << ", role: " << transRole_ << ", remote device info size:" << values.size()
                  << ", last local device info size:" << remoteDeviceInfoLastTime_.size());
@@ -355,20 +390,14 @@ void SmemStoreHelper::FindNewRemoteSlices(const FindSlicesCbFunc &cb) noexcept
     SM_ASSERT_RET_VOID(sliceExpSize_ != 0);
     std::vector<uint8_t> values;
     int64_t totalValue = 0;
-    auto ret = store_->Add(remoteKeys_.sliceCount, 0L, totalValue);
+    auto ret = FetchCountAndInfo(remoteKeys_.sliceCount, remoteKeys_.sliceInfo, totalValue, values);
     if (ret != 0) {
-        SM_LOG_ERROR("store add(0) for key(" << remoteKeys_.sliceCount << ") total count failed: " << ret);
         return;
     }
     if (totalValue == 0 && remoteSlicesInfoLastTime_.size() == 0) {
         SM_LOG_DEBUG("remote slice count is 0, local slice count is 0, no need to find new slices");
         return;
     }
-    ret = store_->Get(remoteKeys_.sliceInfo, values);
-    if (ret != 0) {
-        SM_LOG_ERROR("store get for key(" << remoteKeys_.sliceInfo << ") all slices failed: " << ret);
-        return;
-    }
     std::vector<hybm_exchange_info> addInfo;
     std::vector<StoredSliceInfo> addStoreSs;
     std::vector<StoredSliceInfo> removeStoreSs;
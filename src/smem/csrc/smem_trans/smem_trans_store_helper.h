@@ -123,6 +123,8 @@ public:
 private:
     int RecoverRankInformation(std::vector<uint8_t> rankIdValue, uint16_t &rankId, const smem_trans_config_t &cfg,
                                std::string key, bool &isRestore) noexcept;
+    int FetchCountAndInfo(const std::string &countKey, const std::string &infoKey, int64_t &count,
+                          std::vector<uint8_t> &values) noexcept;
     void CompareAndUpdateDeviceInfo(uint32_t minCount, std::vector<uint8_t> &values,
                                     std::vector<hybm_exchange_info> &addInfo) noexcept;
     void CompareAndUpdateSliceInfo(uint32_t minCount, std::vector<uint8_t> &values,
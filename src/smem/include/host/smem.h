@@ -75,6 +75,15 @@ int32_t smem_set_log_level(int level);
  */
 int32_t smem_set_conf_store_tls(bool enable, const char *tls_info, const uint32_t tls_info_len);
 
+/**
+ * @brief Set directory to persist key space of config store server, the server started after this call
+ * reloads keys from the directory, so clients can resume after restart of the server process without re-join
+ *
+ * @param persist_dir      [in] directory of persist files, NULL or empty to keep key space in memory only
+ * @return Returns 0 on success or an error code on failure
+ */
+int32_t smem_set_conf_store_persist_dir(const char *persist_dir);
+
 /**
  * @brief Callback function definition of get private key password de-crypted, see smem_set_config_store_tls_key
  *
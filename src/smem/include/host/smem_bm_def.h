@@ -27,6 +27,7 @@ typedef void *smem_bm_t;
 #define SMEM_BM_BIND_NUMA_FLAG_LEN          7
 #define SMEM_TLS_PATH_SIZE                  256
 #define SMEM_BM_FLAG_CREATE_WITH_SHM        (1U << 8)
+#define SMEM_BM_FLAG_DRAM_NUMA_INTERLEAVE   (1U << 9) /* interleave local DRAM pages across numa nodes */
 
 /**
 * @brief Smem memory type
@@ -48,6 +49,7 @@ typedef enum {
     SMEMB_DATA_OP_HOST_TCP = 1U << 2,
     SMEMB_DATA_OP_DEVICE_RDMA = 1U << 3,
     SMEMB_DATA_OP_HOST_URMA = 1U << 4,
+    SMEMB_DATA_OP_HOST_SIM = 1U << 5,
     SMEMB_DATA_OP_BUTT
 } smem_bm_data_op_type;
 
@@ -64,7 +66,7 @@ typedef enum {
     SMEMB_COPY_GH2H = 6, /* copy data from global host space to host memory */
     SMEMB_COPY_H2GH = 7, /* copy data from host memory to global host space */
     SMEMB_COPY_G2G = 8,  /* copy data from global space to global space */
-    SMEMB_COPY_AUTO = 9,
+    SMEMB_COPY_AUTO = 9, /* infer direction from addresses, data operator chosen by predicted cost */
     /* add here */
     SMEMB_COPY_BUTT
 } smem_bm_copy_type;
@@ -105,7 +107,7 @@ typedef struct {
     uint32_t flags;                   /* optional flags, default 0 */
     char tag[32];                     /* tag of bm, eg:tag_1 */
     char tagOpInfo[256];              /* optype of tag to tag, eg: tag1:DEVICE_SDMA:tag1,tag1:DEVICE_RDMA:tag2 */
-    int dramShmFd;
+    int dramShmFd;                    /* share memory fd of local DRAM, used with SMEM_BM_FLAG_CREATE_WITH_SHM */
 } smem_bm_create_option_t;
 
 typedef struct {
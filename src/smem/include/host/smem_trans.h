@@ -238,6 +238,14 @@ int32_t smem_trans_batch_write_submit(smem_trans_t handle, const void *localAddr
                                       const char *remoteUniqueId, void *remoteAddrs[], size_t dataSizes[],
                                       uint32_t batchSize, void *stream, uint32_t flags);
 
+/**
+ * @brief Wait all transfers issued by current thread with ASYNC_COPY_FLAG and without stream finish
+ *
+ * @param handle           [in] transfer object handle
+ * @return 0 if successful
+ */
+int32_t smem_trans_wait(smem_trans_t handle);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,213 @@
+#!/usr/bin/env python
+# coding=utf-8
+# Copyright (c) Huawei Technologies Co., Ltd. 2025-2025. All rights reserved.
+# MemFabric_Hybrid is licensed under Mulan PSL v2.
+# You can use this software according to the terms and conditions of the Mulan PSL v2.
+# You may obtain a copy of Mulan PSL v2 at:
+#          http://license.coscl.org.cn/MulanPSL2
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+# EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+# MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+# See the Mulan PSL v2 for more details.
+
+"""
+测试Future返回的异步接口:
+  TransferEngine.transfer_write_async/transfer_read_async/batch_transfer_async
+  BigMemory.copy_data_async/copy_data_batch_async
+两个进程分别作为Prefill(发送端)和Decode(接收端)，用NPU tensor的checksum校验数据。
+"""
+
+import argparse
+import asyncio
+import concurrent.futures
+import logging
+import multiprocessing
+import sys
+
+import numpy as np
+import torch
+from torch_npu import npu
+import memfabric_hybrid as mf_hybrid
+from memfabric_hybrid import TransferEngine, TransferOpcode, create_config_store, set_conf_store_tls
+
+KB = 1024
+MB = 1024 * KB
+
+TRANS_STORE_URL = "tcp://127.0.0.1:20030"
+BM_STORE_URL = "tcp://127.0.0.1:20032"
+SENDER_ID = "127.0.0.1:20034"
+RECEIVER_ID = "127.0.0.1:20036"
+BLOCK_SIZE = 1 * MB
+BLOCK_COUNT = 8
+FUTURE_TIMEOUT = 60
+
+DEVICES = [0, 1]
+
+
+def checksum(tensor: torch.Tensor):
+    npu.current_stream().synchronize()
+    return torch.sum(tensor, dtype=torch.float32).item()
+
+
+def wait_future(future: concurrent.futures.Future):
+    assert isinstance(future, concurrent.futures.Future)
+    ret = future.result(timeout=FUTURE_TIMEOUT)
+    assert ret == 0, f"async transfer failed, {ret=}"
+
+
+async def await_futures(futures):
+    results = await asyncio.gather(*[asyncio.wrap_future(future) for future in futures])
+    assert all(ret == 0 for ret in results), f"async transfer failed, {results=}"
+
+
+def create_engine(role: str, unique_id: str, device_id: int) -> TransferEngine:
+    npu.set_device(device_id)
+    engine = TransferEngine()
+    ret = engine.initialize(TRANS_STORE_URL, unique_id, role, device_id)
+    if ret != 0:
+        raise RuntimeError(f"TransferEngine initialize failed, {ret=}")
+    return engine
+
+
+def run_receiver(device_id: int, conn, done_barrier):
+    set_conf_store_tls(False, "")
+    engine = create_engine("Decode", RECEIVER_ID, device_id)
+    buffer = torch.zeros((BLOCK_COUNT, BLOCK_SIZE // 2), dtype=torch.float16, device="npu")
+    assert engine.register_memory(buffer.data_ptr(), BLOCK_COUNT * BLOCK_SIZE) == 0
+    conn.send(buffer.data_ptr())
+    done_barrier.wait()
+    conn.send([checksum(buffer[i]) for i in range(BLOCK_COUNT)])
+    done_barrier.wait()
+    engine.unregister_memory(buffer.data_ptr())
+    engine.destroy()
+    engine.unInitialize()
+
+
+def run_sender(device_id: int, conn, done_barrier):
+    set_conf_store_tls(False, "")
+    create_config_store(TRANS_STORE_URL)
+    engine = create_engine("Prefill", SENDER_ID, device_id)
+    source = torch.rand((BLOCK_COUNT, BLOCK_SIZE // 2), dtype=torch.float16, device="npu")
+    readback = torch.zeros_like(source)
+    assert engine.register_memory(source.data_ptr(), BLOCK_COUNT * BLOCK_SIZE) == 0
+    assert engine.register_memory(readback.data_ptr(), BLOCK_COUNT * BLOCK_SIZE) == 0
+    npu.current_stream().synchronize()
+    peer_base = conn.recv()
+
+    local = [source.data_ptr() + i * BLOCK_SIZE for i in range(BLOCK_COUNT)]
+    peer = [peer_base + i * BLOCK_SIZE for i in range(BLOCK_COUNT)]
+
+    # 单块写: block 0
+    wait_future(engine.transfer_write_async(RECEIVER_ID, local[0], peer[0], BLOCK_SIZE))
+    # 列表批量写: block 1..3, asyncio等待
+    asyncio.run(await_futures([
+        engine.batch_transfer_async(TransferOpcode.Write, RECEIVER_ID, local[1:4], peer[1:4], [BLOCK_SIZE] * 3)
+    ]))
+    # numpy数组批量写: block 4..7, 两个请求同时在途
+    futures = [
+        engine.batch_transfer_async(TransferOpcode.Write, RECEIVER_ID, np.array(local[4:6], dtype=np.uint64),
+                                    np.array(peer[4:6], dtype=np.uint64), np.full(2, BLOCK_SIZE, dtype=np.uint64)),
+        engine.batch_transfer_async(TransferOpcode.Write, RECEIVER_ID, np.array(local[6:], dtype=np.uint64),
+                                    np.array(peer[6:], dtype=np.uint64), np.full(2, BLOCK_SIZE, dtype=np.uint64)),
+    ]
+    asyncio.run(await_futures(futures))
+
+    # 读回: 单块读 + 批量读
+    read = [readback.data_ptr() + i * BLOCK_SIZE for i in range(BLOCK_COUNT)]
+    futures = [engine.transfer_read_async(RECEIVER_ID, read[0], peer[0], BLOCK_SIZE),
+               engine.batch_transfer_async(TransferOpcode.Read, RECEIVER_ID, read[1:], peer[1:],
+                                           [BLOCK_SIZE] * (BLOCK_COUNT - 1))]
+    for future in futures:
+        wait_future(future)
+
+    done_barrier.wait()
+    expect = [checksum(source[i]) for i in range(BLOCK_COUNT)]
+    assert conn.recv() == expect, "data written by async transfer mismatch"
+    assert [checksum(readback[i]) for i in range(BLOCK_COUNT)] == expect, "data read by async transfer mismatch"
+
+    # 非法目的端也通过Future返回错误码, 而不是抛异常
+    assert engine.transfer_write_async("127.0.0.1:1", local[0], peer[0], BLOCK_SIZE).result(FUTURE_TIMEOUT) != 0
+    done_barrier.wait()
+
+    engine.unregister_memory(source.data_ptr())
+    engine.unregister_memory(readback.data_ptr())
+    engine.destroy()
+    engine.unInitialize()
+    logging.info("transfer async test success.")
+
+
+def run_big_memory(device_id: int):
+    mf_hybrid.set_log_level(0)
+    assert mf_hybrid.initialize() == 0
+    config = mf_hybrid.bm.BmConfig()
+    config.start_store = True
+    config.rank_id = 0
+    config.auto_ranking = False
+    assert mf_hybrid.bm.initialize(store_url=BM_STORE_URL, world_size=1, device_id=device_id, config=config) == 0
+    handle = mf_hybrid.bm.create(id=0, local_dram_size=0, local_hbm_size=BLOCK_COUNT * BLOCK_SIZE,
+                                 data_op_type=mf_hybrid.bm.BmDataOpType.SDMA, flags=0)
+    assert handle.join() == 0
+    npu.set_device(device_id)
+
+    gva = handle.peer_rank_ptr(0, mf_hybrid.bm.BmMemType.DEVICE)
+    source = torch.rand((BLOCK_COUNT, BLOCK_SIZE // 2), dtype=torch.float16, device="npu")
+    readback = torch.zeros_like(source)
+    npu.current_stream().synchronize()
+
+    wait_future(handle.copy_data_async(source.data_ptr(), gva, BLOCK_SIZE, mf_hybrid.bm.BmCopyType.L2G))
+    src = [source.data_ptr() + i * BLOCK_SIZE for i in range(1, BLOCK_COUNT)]
+    dst = [gva + i * BLOCK_SIZE for i in range(1, BLOCK_COUNT)]
+    asyncio.run(await_futures([
+        handle.copy_data_batch_async(src, dst, [BLOCK_SIZE] * len(src), len(src), mf_hybrid.bm.BmCopyType.L2G)
+    ]))
+    futures = [handle.copy_data_async(gva + i * BLOCK_SIZE, readback.data_ptr() + i * BLOCK_SIZE, BLOCK_SIZE,
+                                      mf_hybrid.bm.BmCopyType.G2L) for i in range(BLOCK_COUNT)]
+    for future in futures:
+        wait_future(future)
+    assert checksum(readback) == checksum(source), "data copied by async copy mismatch"
+
+    handle.leave()
+    handle.destroy()
+    mf_hybrid.bm.uninitialize()
+    mf_hybrid.uninitialize()
+    logging.info("big memory async test success.")
+
+
+def main_process():
+    sender_conn, receiver_conn = multiprocessing.Pipe()
+    done_barrier = multiprocessing.Barrier(2)
+    children = [
+        multiprocessing.Process(name="Sender-Process", target=run_sender,
+                                args=(DEVICES[0], sender_conn, done_barrier)),
+        multiprocessing.Process(name="Receiver-Process", target=run_receiver,
+                                args=(DEVICES[1], receiver_conn, done_barrier)),
+    ]
+    [child.start() for child in children]
+    [child.join() for child in children]
+    failed = [child.name for child in children if child.exitcode != 0]
+
+    bm_child = multiprocessing.Process(name="BigMemory-Process", target=run_big_memory, args=(DEVICES[0],))
+    bm_child.start()
+    bm_child.join()
+    if bm_child.exitcode != 0:
+        failed.append(bm_child.name)
+
+    if failed:
+        logging.error(f"async test failed: {failed}")
+        sys.exit(1)
+    logging.info("async test all success.")
+
+
+if __name__ == "__main__":
+    logging.basicConfig(
+        level=logging.INFO,
+        format="%(asctime)s - %(processName)s - %(levelname)s - [PID: %(process)d] - %(message)s",
+        datefmt="%Y-%m-%d %H:%M:%S",
+        stream=sys.stdout,
+    )
+    parser = argparse.ArgumentParser()
+    parser.add_argument("--devices", help="specify two device_id to use", type=int, nargs=2, metavar="id",
+                        default=[0, 1])
+    args = parser.parse_args()
+    DEVICES = args.devices
+    main_process()
@@ -13,6 +13,7 @@
 #include <mockcpp/mockcpp.hpp>
 #include <gtest/gtest.h>
 #include <cstring>
+#include <sys/stat.h>
 #include <thread>
 #include <iostream>
 #include <string>
@@ -431,6 +432,246 @@ TEST_F(AccLinksTest, test_server_connect_to_peer_server_should_return_ok)
     std::cout << "finish" << std::endl;
 }
 
+TEST_F(AccLinksTest, test_server_shared_port_listeners_accept_all_links)
+{
+    mServer->Stop();
+    AccTcpServerOptions opts;
+    opts.enableListener = true;
+    opts.linkSendQueueSize = LINK_SEND_QUEUE_SIZE;
+    opts.listenIp = "127.0.0.1";
+    opts.listenPort = LISTEN_PORT;
+    opts.version = 1;
+    opts.workerCount = WORKER_COUNT;
+    opts.workerPollTimeoutMs = UNO_48;
+    opts.listenerCount = UNO_2;
+    opts.handshakeThreadCount = UNO_2;
+    ASSERT_EQ(ACC_OK, mServer->Start(opts));
+
+    AccTcpServerPtr mClient = AccClientInit();
+    ASSERT_TRUE(mClient != nullptr);
+    const uint32_t linkCount = 8;
+    std::vector<AccTcpLinkComplexPtr> links(linkCount);
+    for (uint32_t i = 0; i < linkCount; i++) {
+        AccConnReq req{};
+        req.rankId = i;
+        req.version = 1;
+        ASSERT_EQ(ACC_OK, mClient->ConnectToPeerServer("127.0.0.1", LISTEN_PORT, req, 1, links[i]));
+    }
+    ASSERT_EQ(linkCount, g_rankLinkMap.size());
+    for (auto &link : links) {
+        link->Close();
+    }
+    mClient->Stop();
+}
+
+TEST_F(AccLinksTest, test_tls_handshake_stat_zero_without_tls)
+{
+    AccConnReq req{};
+    req.rankId = 0;
+    req.version = 1;
+    AccTcpLinkComplexPtr link;
+    AccTcpServerPtr mClient = AccClientInit();
+    ASSERT_TRUE(mClient != nullptr);
+    ASSERT_EQ(ACC_OK, mClient->ConnectToPeerServer("127.0.0.1", LISTEN_PORT, req, 1, link));
+    auto clientStat = mClient->GetTlsHandshakeStat();
+    auto serverStat = mServer->GetTlsHandshakeStat();
+    EXPECT_EQ(0U, clientStat.fullHandshakes + clientStat.resumedHandshakes);
+    EXPECT_EQ(0U, serverStat.fullHandshakes + serverStat.resumedHandshakes);
+    link->Close();
+    mClient->Stop();
+}
+
+bool RunCertScript(const std::string &script, const std::string &args)
+{
+    // 证书由仓库test/certs下的脚本生成，需要python3及cryptography
+    std::string file = __FILE__;
+    auto pos = file.rfind("test/ut/");
+    if (pos == std::string::npos) {
+        return false;
+    }
+    auto cmd = "python3 " + file.substr(0, pos) + "test/certs/" + script + " " + args + " > /dev/null 2>&1";
+    return system(cmd.c_str()) == 0;
+}
+
+bool CopyOpensslLib(const std::string &name, const std::string &libDir)
+{
+    // 动态加载要求so为普通文件且权限不大于550，系统库目录下多为软链接，拷贝一份
+    const char *libDirs[] = {"/usr/lib64", "/usr/lib/x86_64-linux-gnu", "/usr/lib/aarch64-linux-gnu", "/usr/lib"};
+    for (const std::string dir : libDirs) {
+        auto src = dir + "/" + name;
+        if (::access(src.c_str(), R_OK) != 0) {
+            continue;
+        }
+        auto dst = libDir + "/" + name;
+        return system(("cp -L " + src + " " + dst + " && chmod 550 " + dst).c_str()) == 0;
+    }
+    return false;
+}
+
+AccTlsOption TlsOption(const std::string &topPath, const std::string &role)
+{
+    AccTlsOption option;
+    option.enableTls = true;
+    option.tlsTopPath = topPath;
+    option.tlsCert = "/" + role + ".cert.pem";
+    option.tlsPk = "/" + role + ".private.key.pem";
+    option.tlsCaPath = "ca";
+    option.tlsCaFile = {"ca.cert.pem"};
+    return option;
+}
+
+bool GenerateTlsFiles(const std::string &top)
+{
+    if (mkdir((top + "/ca").c_str(), 0750) != 0 || mkdir((top + "/lib").c_str(), 0750) != 0) {
+        return false;
+    }
+    auto ca = " --ca_cert_path " + top + "/ca/ca.cert.pem --ca_key_path " + top + "/ca.private.key.pem";
+    return RunCertScript("generate_root_cert.py", ca) &&
+           RunCertScript("generate_server_cert.py", ca + " --server_cert_path " + top + "/server.cert.pem" +
+                                                        " --server_key_path " + top + "/server.private.key.pem") &&
+           RunCertScript("generate_client_cert.py", ca + " --client_cert_path " + top + "/client.cert.pem" +
+                                                        " --client_key_path " + top + "/client.private.key.pem");
+}
+
+AccTcpServerPtr StartTlsServer(const std::string &top, const AccTlsOption &tlsOption)
+{
+    auto server = AccTcpServer::Create();
+    if (server == nullptr || server->LoadDynamicLib(top + "/lib") != ACC_OK) {
+        return nullptr;
+    }
+    server->RegisterNewRequestHandler(TEST_OP_REPLY_MSG, [](const AccTcpRequestContext &context) { return 0; });
+    server->RegisterNewLinkHandler([](const AccConnReq &req, const AccTcpLinkComplexPtr &link) { return 0; });
+    server->RegisterLinkBrokenHandler([](const AccTcpLinkComplexPtr &link) { return 0; });
+    AccTcpServerOptions opts;
+    opts.enableListener = true;
+    opts.listenIp = "127.0.0.1";
+    opts.listenPort = LISTEN_PORT + 1;
+    opts.reusePort = true;
+    opts.version = 1;
+    opts.workerCount = WORKER_COUNT;
+    opts.workerPollTimeoutMs = UNO_48;
+    ock::smem::UrlExtraction extraction;
+    extraction.ExtractIpPortFromUrl("tcp://127.0.0.1:" + std::to_string(opts.listenPort));
+    if (server->Start(opts, tlsOption) != ACC_OK) {
+        return nullptr;
+    }
+    return server;
+}
+
+AccTcpServerPtr StartTlsClient(const std::string &top)
+{
+    auto client = AccTcpServer::Create();
+    if (client == nullptr || client->LoadDynamicLib(top + "/lib") != ACC_OK) {
+        return nullptr;
+    }
+    client->RegisterNewRequestHandler(0, [](const AccTcpRequestContext &context) { return 0; });
+    client->RegisterLinkBrokenHandler([](const AccTcpLinkComplexPtr &link) { return 0; });
+    AccTcpServerOptions clientOpts;
+    clientOpts.workerCount = WORKER_COUNT;
+    clientOpts.workerPollTimeoutMs = UNO_48;
+    if (client->Start(clientOpts, TlsOption(top, "client")) != ACC_OK) {
+        return nullptr;
+    }
+    return client;
+}
+
+void WaitServerHandshakes(const AccTcpServerPtr &server, uint64_t count)
+{
+    // 服务端在握手线程中统计，等待连接处理完成
+    for (auto i = 0; i < 100; i++) {
+        auto stat = server->GetTlsHandshakeStat();
+        if (stat.fullHandshakes + stat.resumedHandshakes >= count) {
+            return;
+        }
+        usleep(10 * 1000); // 10ms
+    }
+}
+
+TEST_F(AccLinksTest, test_tls_reconnect_resumes_session)
+{
+    char dirTemplate[] = "/tmp/acc_links_tls_XXXXXX";
+    ASSERT_NE(nullptr, mkdtemp(dirTemplate));
+    std::string top = dirTemplate;
+    if (!GenerateTlsFiles(top)) {
+        system(("rm -rf " + top).c_str());
+        GTEST_SKIP() << "failed to generate certs by test/certs scripts";
+    }
+    ASSERT_TRUE(CopyOpensslLib("libssl.so", top + "/lib"));
+    ASSERT_TRUE(CopyOpensslLib("libcrypto.so", top + "/lib"));
+
+    auto server = StartTlsServer(top, TlsOption(top, "server"));
+    ASSERT_TRUE(server != nullptr);
+    auto client = StartTlsClient(top);
+    ASSERT_TRUE(client != nullptr);
+
+    // 第一次连接完整握手，断开重连后使用服务端签发的ticket恢复会话
+    AccConnReq req{};
+    req.version = 1;
+    for (auto i = 0; i < 2; i++) {
+        AccTcpLinkComplexPtr link;
+        ASSERT_EQ(ACC_OK, client->ConnectToPeerServer("127.0.0.1", LISTEN_PORT + 1, req, 1, link));
+        link->Close();
+    }
+    auto clientStat = client->GetTlsHandshakeStat();
+    EXPECT_EQ(1U, clientStat.fullHandshakes);
+    EXPECT_EQ(1U, clientStat.resumedHandshakes);
+
+    WaitServerHandshakes(server, 2U);
+    auto serverStat = server->GetTlsHandshakeStat();
+    EXPECT_EQ(1U, serverStat.fullHandshakes);
+    EXPECT_EQ(1U, serverStat.resumedHandshakes);
+
+    client->Stop();
+    server->Stop();
+    system(("rm -rf " + top).c_str());
+}
+
+TEST_F(AccLinksTest, test_tls_restarted_server_resumes_session_with_ticket_key_file)
+{
+    char dirTemplate[] = "/tmp/acc_links_tls_XXXXXX";
+    ASSERT_NE(nullptr, mkdtemp(dirTemplate));
+    std::string top = dirTemplate;
+    if (!GenerateTlsFiles(top)) {
+        system(("rm -rf " + top).c_str());
+        GTEST_SKIP() << "failed to generate certs by test/certs scripts";
+    }
+    ASSERT_TRUE(CopyOpensslLib("libssl.so", top + "/lib"));
+    ASSERT_TRUE(CopyOpensslLib("libcrypto.so", top + "/lib"));
+    auto keyFile = top + "/ticket.key";
+    ASSERT_EQ(0, system(("head -c 48 /dev/urandom > " + keyFile + " && chmod 600 " + keyFile).c_str()));
+
+    auto client = StartTlsClient(top);
+    ASSERT_TRUE(client != nullptr);
+
+    // 每个服务端实例代表一次重启：随机密钥的实例无法解密上一实例签发的ticket，共享密钥文件的实例可以
+    auto withKeyFile = TlsOption(top, "server");
+    withKeyFile.tlsTicketKeyFile = keyFile;
+    std::vector<AccTlsOption> instances = {TlsOption(top, "server"), TlsOption(top, "server"), withKeyFile,
+                                           withKeyFile};
+    AccConnReq req{};
+    req.version = 1;
+    AccTlsHandshakeStat lastServerStat{};
+    for (auto &option : instances) {
+        auto server = StartTlsServer(top, option);
+        ASSERT_TRUE(server != nullptr);
+        AccTcpLinkComplexPtr link;
+        ASSERT_EQ(ACC_OK, client->ConnectToPeerServer("127.0.0.1", LISTEN_PORT + 1, req, 1, link));
+        link->Close();
+        WaitServerHandshakes(server, 1U);
+        lastServerStat = server->GetTlsHandshakeStat();
+        server->Stop();
+    }
+
+    auto clientStat = client->GetTlsHandshakeStat();
+    EXPECT_EQ(3U, clientStat.fullHandshakes);
+    EXPECT_EQ(1U, clientStat.resumedHandshakes);
+    EXPECT_EQ(0U, lastServerStat.fullHandshakes);
+    EXPECT_EQ(1U, lastServerStat.resumedHandshakes);
+
+    client->Stop();
+    system(("rm -rf " + top).c_str());
+}
+
 TEST_F(AccLinksTest, test_server_connect_to_peer_server_should_return_error)
 {
     const std::string nextIp = "127.0.0.1";
@@ -572,6 +813,24 @@ TEST_F(AccLinksTest, test_server_start_workerStartCpuId_validate_should_return_e
     ASSERT_TRUE(ret != true);
 }
 
+TEST_F(AccLinksTest, test_server_start_listenerCount_validate_should_return_error)
+{
+    mServer->Stop();
+    AccTcpServerOptions opts;
+    opts.enableListener = true;
+    opts.linkSendQueueSize = LINK_SEND_QUEUE_SIZE;
+    opts.listenIp = "127.0.0.1";
+    opts.listenPort = LISTEN_PORT;
+    opts.workerCount = WORKER_COUNT;
+    opts.listenerCount = 0;
+    ASSERT_EQ(ACC_INVALID_PARAM, mServer->Start(opts));
+    opts.listenerCount = UNO_32;
+    ASSERT_EQ(ACC_INVALID_PARAM, mServer->Start(opts));
+    opts.listenerCount = 1;
+    opts.handshakeThreadCount = UNO_1024;
+    ASSERT_EQ(ACC_INVALID_PARAM, mServer->Start(opts));
+}
+
 TEST_F(AccLinksTest, test_server_start_keepaliveIdleTime_validate_should_return_error)
 {
     mServer->Stop();
@@ -9,11 +9,18 @@
  * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
  * See the Mulan PSL v2 for more details.
  */
+#include <sys/mman.h>
+#include <unistd.h>
+#include <cstring>
+#include <vector>
 #include <gtest/gtest.h>
 #include <mockcpp/mockcpp.hpp>
 
 #include "hybm_logger.h"
+#include "hybm_data_op.h"
 #include "hybm_data_op_factory.h"
+#include "hybm_data_op_shm.h"
+#include "shm_transport_manager.h"
 #include "hybm_compose_data_op.h"
 
 class DataOperatorMock : public ock::mf::DataOperator {
@@ -110,6 +117,8 @@ public:
     CreateDevRdmaDataOperator(uint32_t rankId, const std::shared_ptr<ock::mf::transport::TransportManager> &tm);
     static std::shared_ptr<ock::mf::DataOperator>
     CreateHostRdmaDataOperator(uint32_t rankId, const std::shared_ptr<ock::mf::transport::TransportManager> &tm);
+    static std::shared_ptr<ock::mf::HostDataOpShm>
+    CreateShmDataOperator(uint32_t rankId, const std::shared_ptr<ock::mf::transport::TransportManager> &tm);
 
 protected:
     uint32_t OpOr()
@@ -128,6 +137,7 @@ protected:
     static std::shared_ptr<DataOperatorMock> sdmaDataOpMock;
     static std::shared_ptr<DataOperatorMock> devRdmaDataOpMock;
     static std::shared_ptr<DataOperatorMock> hostRdmaDataOpMock;
+    static std::shared_ptr<ock::mf::HostDataOpShm> shmDataOp;
 };
 
 std::shared_ptr<DataOperatorMock> HybmComposeDataOpTest::sdmaDataOpMock = std::make_shared<DataOperatorMock>("sdma");
@@ -135,6 +145,7 @@ std::shared_ptr<DataOperatorMock> HybmComposeDataOpTest::devRdmaDataOpMock =
     std::make_shared<DataOperatorMock>("dev_rdma");
 std::shared_ptr<DataOperatorMock> HybmComposeDataOpTest::hostRdmaDataOpMock =
     std::make_shared<DataOperatorMock>("host_rdma");
+std::shared_ptr<ock::mf::HostDataOpShm> HybmComposeDataOpTest::shmDataOp;
 
 void HybmComposeDataOpTest::SetUp()
 {
@@ -170,6 +181,13 @@ HybmComposeDataOpTest::CreateHostRdmaDataOperator(uint32_t rankId,
     return hostRdmaDataOpMock;
 }
 
+std::shared_ptr<ock::mf::HostDataOpShm>
+HybmComposeDataOpTest::CreateShmDataOperator(uint32_t rankId,
+                                             const std::shared_ptr<ock::mf::transport::TransportManager> &tm)
+{
+    return shmDataOp;
+}
+
 TEST_F(HybmComposeDataOpTest, initialize_with_bm_type_ai_core)
 {
     hybm_options options;
@@ -769,3 +787,323 @@ TEST_F(HybmComposeDataOpTest, dwait_no_sdma_failed)
     ASSERT_EQ(1UL, devRdmaDataOpMock->uninitializeCount);
     ASSERT_EQ(1UL, hostRdmaDataOpMock->uninitializeCount);
 }
+
+TEST_F(HybmComposeDataOpTest, routed_data_operators_follow_reach_and_cost)
+{
+    hybm_options options{};
+    options.bmType = HYBM_TYPE_HOST_INITIATE;
+    options.bmDataOpType = static_cast<hybm_data_op_type>(OpOr(HYBM_DOP_TYPE_SDMA, HYBM_DOP_TYPE_HOST_RDMA));
+    auto tag = std::make_shared<ock::mf::HybmEntityTagInfo>();
+    tag->TagInfoInit(options);
+
+    union {
+        uint32_t (ock::mf::HybmEntityTagInfo::*getRank2RankOpType)(uint32_t rankId1, uint32_t rankId2);
+        uint32_t (*mocker)(ock::mf::HybmEntityTagInfo *, uint32_t, uint32_t);
+    } u;
+    u.getRank2RankOpType = &ock::mf::HybmEntityTagInfo::GetRank2RankOpType;
+    MOCKER(u.mocker).stubs().will(returnValue(OpOr(HYBM_DOP_TYPE_SDMA, HYBM_DOP_TYPE_HOST_RDMA)));
+    MOCKER(ock::mf::DataOperatorFactory::CreateSdmaDataOperator).stubs().will(invoke(CreateSdmaDataOperator));
+    MOCKER(ock::mf::DataOperatorFactory::CreateHostRdmaDataOperator).stubs().will(invoke(CreateHostRdmaDataOperator));
+
+    ock::mf::HostComposeDataOp dataOp(options, nullptr, tag);
+    ASSERT_EQ(ock::mf::BErrorCode::BM_OK, dataOp.Initialize());
+    auto reachTypes = HYBM_DOP_TYPE_HOST_RDMA;
+    dataOp.SetReachFunc([&reachTypes](uint32_t rankId) { return reachTypes; });
+
+    // async copies are not measured, the order comes from the priors only
+    hybm_copy_params largeParams{reinterpret_cast<void *>(0x1000UL), reinterpret_cast<void *>(0x2000UL),
+                                 256UL * 1024UL * 1024UL};
+    hybm_copy_params smallParams{largeParams.src, largeParams.dest, 4096UL};
+    ock::mf::ExtOptions extOptions{};
+    extOptions.srcRankId = 0U;
+    extOptions.destRankId = 1U;
+    extOptions.flags = ock::mf::COPY_AUTO_ROUTE_FLAG | ASYNC_COPY_FLAG;
+
+    // sdma does not reach rank 1, large copy still goes to host rdma
+    ASSERT_EQ(ock::mf::BErrorCode::BM_OK,
+              dataOp.DataCopy(largeParams, HYBM_LOCAL_DEVICE_TO_GLOBAL_DEVICE, extOptions));
+    EXPECT_EQ(0UL, sdmaDataOpMock->dataCopyCount);
+    EXPECT_EQ(1UL, hostRdmaDataOpMock->dataCopyCount);
+
+    // both reach, small copy prefers the lower latency and large copy the higher bandwidth
+    reachTypes = static_cast<hybm_data_op_type>(OpOr(HYBM_DOP_TYPE_SDMA, HYBM_DOP_TYPE_HOST_RDMA));
+    ASSERT_EQ(ock::mf::BErrorCode::BM_OK,
+              dataOp.DataCopy(smallParams, HYBM_LOCAL_DEVICE_TO_GLOBAL_DEVICE, extOptions));
+    EXPECT_EQ(0UL, sdmaDataOpMock->dataCopyCount);
+    EXPECT_EQ(2UL, hostRdmaDataOpMock->dataCopyCount);
+    ASSERT_EQ(ock::mf::BErrorCode::BM_OK,
+              dataOp.DataCopy(largeParams, HYBM_LOCAL_DEVICE_TO_GLOBAL_DEVICE, extOptions));
+    EXPECT_EQ(1UL, sdmaDataOpMock->dataCopyCount);
+    EXPECT_EQ(2UL, hostRdmaDataOpMock->dataCopyCount);
+
+    // reach of the peer is not checked for copies inside local rank
+    reachTypes = HYBM_DOP_TYPE_HOST_RDMA;
+    extOptions.destRankId = 0U;
+    ASSERT_EQ(ock::mf::BErrorCode::BM_OK,
+              dataOp.DataCopy(largeParams, HYBM_LOCAL_DEVICE_TO_GLOBAL_DEVICE, extOptions));
+    EXPECT_EQ(2UL, sdmaDataOpMock->dataCopyCount);
+    EXPECT_EQ(2UL, hostRdmaDataOpMock->dataCopyCount);
+    dataOp.UnInitialize();
+}
+
+TEST_F(HybmComposeDataOpTest, split_data_copy_by_host_and_device_path)
+{
+    hybm_options options{};
+    options.bmType = HYBM_TYPE_HOST_INITIATE;
+    options.bmDataOpType = static_cast<hybm_data_op_type>(OpOr(HYBM_DOP_TYPE_SDMA, HYBM_DOP_TYPE_HOST_RDMA));
+    auto tag = std::make_shared<ock::mf::HybmEntityTagInfo>();
+    tag->TagInfoInit(options);
+
+    union {
+        uint32_t (ock::mf::HybmEntityTagInfo::*getRank2RankOpType)(uint32_t rankId1, uint32_t rankId2);
+        uint32_t (*mocker)(ock::mf::HybmEntityTagInfo *, uint32_t, uint32_t);
+    } u;
+    u.getRank2RankOpType = &ock::mf::HybmEntityTagInfo::GetRank2RankOpType;
+    MOCKER(u.mocker).stubs().will(returnValue(OpOr(HYBM_DOP_TYPE_SDMA, HYBM_DOP_TYPE_HOST_RDMA)));
+    MOCKER(ock::mf::DataOperatorFactory::CreateSdmaDataOperator).stubs().will(invoke(CreateSdmaDataOperator));
+    MOCKER(ock::mf::DataOperatorFactory::CreateHostRdmaDataOperator).stubs().will(invoke(CreateHostRdmaDataOperator));
+
+    hybm_copy_params copyParams{reinterpret_cast<void *>(0x1000UL), reinterpret_cast<void *>(0x2000UL),
+                                256UL * 1024UL * 1024UL};
+    ock::mf::ExtOptions extOptions{};
+    extOptions.srcRankId = 0U;
+    extOptions.destRankId = 1U;
+
+    ock::mf::HostComposeDataOp dataOp(options, nullptr, tag);
+    ASSERT_EQ(ock::mf::BErrorCode::BM_OK, dataOp.Initialize());
+    // async copy is not split, large one goes to sdma alone
+    extOptions.flags = ock::mf::COPY_AUTO_ROUTE_FLAG | ASYNC_COPY_FLAG;
+    ASSERT_EQ(ock::mf::BErrorCode::BM_OK, dataOp.DataCopy(copyParams, HYBM_LOCAL_HOST_TO_GLOBAL_HOST, extOptions));
+    EXPECT_EQ(1UL, sdmaDataOpMock->dataCopyCount);
+    EXPECT_EQ(0UL, hostRdmaDataOpMock->dataCopyCount);
+
+    // large sync copy between host memory runs on both paths
+    extOptions.flags = ock::mf::COPY_AUTO_ROUTE_FLAG;
+    ASSERT_EQ(ock::mf::BErrorCode::BM_OK, dataOp.DataCopy(copyParams, HYBM_LOCAL_HOST_TO_GLOBAL_HOST, extOptions));
+    EXPECT_EQ(2UL, sdmaDataOpMock->dataCopyCount);
+    EXPECT_EQ(1UL, hostRdmaDataOpMock->dataCopyCount);
+    dataOp.UnInitialize();
+
+    // failed host part is copied again by the routed operators, sdma first
+    ock::mf::HostComposeDataOp failedOp(options, nullptr, tag);
+    ASSERT_EQ(ock::mf::BErrorCode::BM_OK, failedOp.Initialize());
+    hostRdmaDataOpMock->dataCopyResult = ock::mf::BErrorCode::BM_ERROR;
+    ASSERT_EQ(ock::mf::BErrorCode::BM_OK, failedOp.DataCopy(copyParams, HYBM_LOCAL_HOST_TO_GLOBAL_HOST, extOptions));
+    EXPECT_EQ(4UL, sdmaDataOpMock->dataCopyCount);
+    EXPECT_EQ(2UL, hostRdmaDataOpMock->dataCopyCount);
+    failedOp.UnInitialize();
+}
+
+TEST_F(HybmComposeDataOpTest, local_rank_copy_not_recorded_as_path_cost)
+{
+    hybm_options options{};
+    options.bmType = HYBM_TYPE_HOST_INITIATE;
+    options.bmDataOpType = static_cast<hybm_data_op_type>(OpOr(HYBM_DOP_TYPE_SDMA, HYBM_DOP_TYPE_HOST_RDMA));
+    auto tag = std::make_shared<ock::mf::HybmEntityTagInfo>();
+    tag->TagInfoInit(options);
+
+    union {
+        uint32_t (ock::mf::HybmEntityTagInfo::*getRank2RankOpType)(uint32_t rankId1, uint32_t rankId2);
+        uint32_t (*mocker)(ock::mf::HybmEntityTagInfo *, uint32_t, uint32_t);
+    } u;
+    u.getRank2RankOpType = &ock::mf::HybmEntityTagInfo::GetRank2RankOpType;
+    MOCKER(u.mocker).stubs().will(returnValue(OpOr(HYBM_DOP_TYPE_SDMA, HYBM_DOP_TYPE_HOST_RDMA)));
+    MOCKER(ock::mf::DataOperatorFactory::CreateSdmaDataOperator).stubs().will(invoke(CreateSdmaDataOperator));
+    MOCKER(ock::mf::DataOperatorFactory::CreateHostRdmaDataOperator).stubs().will(invoke(CreateHostRdmaDataOperator));
+
+    ock::mf::HostComposeDataOp dataOp(options, nullptr, tag);
+    ASSERT_EQ(ock::mf::BErrorCode::BM_OK, dataOp.Initialize());
+
+    // copies inside local rank fall back to host rdma and take almost no time, as a memcpy does
+    hybm_copy_params copyParams{reinterpret_cast<void *>(0x1000UL), reinterpret_cast<void *>(0x2000UL),
+                                64UL * 1024UL * 1024UL};
+    ock::mf::ExtOptions extOptions{};
+    sdmaDataOpMock->dataCopyResult = ock::mf::BErrorCode::BM_ERROR;
+    for (auto i = 0; i < 30; i++) {
+        ASSERT_EQ(ock::mf::BErrorCode::BM_OK,
+                  dataOp.DataCopy(copyParams, HYBM_LOCAL_DEVICE_TO_GLOBAL_DEVICE, extOptions));
+    }
+    EXPECT_EQ(30UL, hostRdmaDataOpMock->dataCopyCount);
+
+    // host rdma to a remote rank keeps its prior bandwidth, large copy still goes to sdma first
+    sdmaDataOpMock->dataCopyResult = ock::mf::BErrorCode::BM_OK;
+    extOptions.destRankId = 1U;
+    extOptions.flags = ock::mf::COPY_AUTO_ROUTE_FLAG;
+    ASSERT_EQ(ock::mf::BErrorCode::BM_OK, dataOp.DataCopy(copyParams, HYBM_LOCAL_DEVICE_TO_GLOBAL_DEVICE, extOptions));
+    EXPECT_EQ(31UL, sdmaDataOpMock->dataCopyCount);
+    EXPECT_EQ(30UL, hostRdmaDataOpMock->dataCopyCount);
+    dataOp.UnInitialize();
+}
+
+TEST_F(HybmComposeDataOpTest, batch_data_copy_shm_follows_rank_op_types)
+{
+    // rank 0 is local and maps the share memory of co-located rank 1, both live in this process
+    constexpr uint64_t slotSize = 1024UL * 1024UL;
+    int fds[2];
+    for (auto &fd : fds) {
+        fd = memfd_create("hybm_compose_ut", 0);
+        ASSERT_GE(fd, 0);
+        ASSERT_EQ(0, ftruncate(fd, static_cast<off_t>(slotSize)));
+    }
+    auto gva = mmap(nullptr, slotSize * 2UL, PROT_NONE, MAP_ANONYMOUS | MAP_NORESERVE | MAP_PRIVATE, -1, 0);
+    ASSERT_NE(MAP_FAILED, gva);
+    auto peerView = static_cast<uint8_t *>(mmap(nullptr, slotSize, PROT_READ | PROT_WRITE, MAP_SHARED, fds[1], 0));
+    ASSERT_NE(MAP_FAILED, static_cast<void *>(peerView));
+
+    auto local = std::make_shared<ock::mf::transport::shm::ShmTransportManager>();
+    auto remote = std::make_shared<ock::mf::transport::shm::ShmTransportManager>();
+    ock::mf::transport::TransportOptions transOptions{};
+    transOptions.rankCount = 2U;
+    transOptions.dramSpaceSize = slotSize;
+    transOptions.dramShmFd = fds[0];
+    ASSERT_EQ(ock::mf::BErrorCode::BM_OK, local->OpenDevice(transOptions));
+    transOptions.rankId = 1U;
+    transOptions.dramShmFd = fds[1];
+    ASSERT_EQ(ock::mf::BErrorCode::BM_OK, remote->OpenDevice(transOptions));
+    ock::mf::transport::TransportMemoryRegion mr;
+    mr.addr = reinterpret_cast<uint64_t>(gva);
+    mr.size = slotSize;
+    mr.flags = ock::mf::transport::REG_MR_FLAG_DRAM | ock::mf::transport::REG_MR_FLAG_SELF |
+               ock::mf::transport::REG_MR_FLAG_SHM;
+    ASSERT_EQ(ock::mf::BErrorCode::BM_OK, local->RegisterMemoryRegion(mr));
+    ock::mf::transport::HybmTransPrepareOptions prepare;
+    prepare.options[0U].nic = local->GetNic();
+    prepare.options[1U].nic = remote->GetNic();
+    ASSERT_EQ(ock::mf::BErrorCode::BM_OK, local->Prepare(prepare));
+    shmDataOp = std::make_shared<ock::mf::HostDataOpShm>(0U, local);
+
+    hybm_options options{};
+    options.bmType = HYBM_TYPE_HOST_INITIATE;
+    options.bmDataOpType =
+        static_cast<hybm_data_op_type>(OpOr(HYBM_DOP_TYPE_SDMA, HYBM_DOP_TYPE_DEVICE_RDMA, HYBM_DOP_TYPE_HOST_RDMA));
+    auto tag = std::make_shared<ock::mf::HybmEntityTagInfo>();
+    tag->TagInfoInit(options);
+    ASSERT_EQ(ock::mf::BErrorCode::BM_OK, tag->AddRankTag(0U, "a"));
+    ASSERT_EQ(ock::mf::BErrorCode::BM_OK, tag->AddRankTag(1U, "b"));
+    ASSERT_EQ(ock::mf::BErrorCode::BM_OK,
+              tag->AddTagOpInfo("a:DEVICE_SDMA:a,a:DEVICE_RDMA:a,a:HOST_RDMA:b,a:DEVICE_RDMA:c"));
+    MOCKER(ock::mf::DataOperatorFactory::CreateSdmaDataOperator).stubs().will(invoke(CreateSdmaDataOperator));
+    MOCKER(ock::mf::DataOperatorFactory::CreateDevRdmaDataOperator).stubs().will(invoke(CreateDevRdmaDataOperator));
+    MOCKER(ock::mf::DataOperatorFactory::CreateHostRdmaDataOperator).stubs().will(invoke(CreateHostRdmaDataOperator));
+    MOCKER(ock::mf::DataOperatorFactory::CreateShmDataOperator).stubs().will(invoke(CreateShmDataOperator));
+
+    ock::mf::HostComposeDataOp dataOp(options, nullptr, tag);
+    ASSERT_EQ(ock::mf::BErrorCode::BM_OK, dataOp.Initialize());
+
+    std::vector<uint8_t> data(4096UL, 0x6B);
+    void *sources[] = {data.data()};
+    void *destinations[] = {reinterpret_cast<void *>(reinterpret_cast<uint64_t>(gva) + slotSize)};
+    size_t sizes[] = {data.size()};
+    hybm_batch_copy_params copyParams{sources, destinations, sizes, 1U};
+    ock::mf::ExtOptions extOptions{};
+    extOptions.groupMap[std::make_pair(0U, 1U)].push_back(0U);
+
+    // whole batch goes to sdma first, share memory is not touched
+    ASSERT_EQ(ock::mf::BErrorCode::BM_OK,
+              dataOp.BatchDataCopy(copyParams, HYBM_LOCAL_HOST_TO_GLOBAL_HOST, extOptions));
+    EXPECT_EQ(1UL, sdmaDataOpMock->batchDataCopyCount);
+    EXPECT_NE(0, memcmp(peerView, data.data(), data.size()));
+
+    // sdma failed, rank pair with host rdma copies by share memory
+    sdmaDataOpMock->batchDataCopyResult = ock::mf::BErrorCode::BM_ERROR;
+    ASSERT_EQ(ock::mf::BErrorCode::BM_OK,
+              dataOp.BatchDataCopy(copyParams, HYBM_LOCAL_HOST_TO_GLOBAL_HOST, extOptions));
+    EXPECT_EQ(2UL, sdmaDataOpMock->batchDataCopyCount);
+    EXPECT_EQ(0UL, devRdmaDataOpMock->batchDataCopyCount);
+    EXPECT_EQ(0, memcmp(peerView, data.data(), data.size()));
+
+    // rank pair without host rdma is not copied by share memory even it is reachable
+    memset(peerView, 0, data.size());
+    ASSERT_EQ(ock::mf::BErrorCode::BM_OK, tag->AddRankTag(1U, "c"));
+    ASSERT_EQ(ock::mf::BErrorCode::BM_OK,
+              dataOp.BatchDataCopy(copyParams, HYBM_LOCAL_HOST_TO_GLOBAL_HOST, extOptions));
+    EXPECT_EQ(3UL, sdmaDataOpMock->batchDataCopyCount);
+    EXPECT_EQ(1UL, devRdmaDataOpMock->batchDataCopyCount);
+    EXPECT_EQ(0UL, hostRdmaDataOpMock->batchDataCopyCount);
+    EXPECT_NE(0, memcmp(peerView, data.data(), data.size()));
+
+    dataOp.UnInitialize();
+    shmDataOp = nullptr;
+    munmap(peerView, slotSize);
+    munmap(gva, slotSize * 2UL);
+    for (auto fd : fds) {
+        close(fd);
+    }
+}
+
+TEST_F(HybmComposeDataOpTest, routed_copy_probes_path_not_chosen)
+{
+    hybm_options options{};
+    options.bmType = HYBM_TYPE_HOST_INITIATE;
+    options.bmDataOpType = static_cast<hybm_data_op_type>(OpOr(HYBM_DOP_TYPE_SDMA, HYBM_DOP_TYPE_HOST_RDMA));
+    auto tag = std::make_shared<ock::mf::HybmEntityTagInfo>();
+    tag->TagInfoInit(options);
+
+    union {
+        uint32_t (ock::mf::HybmEntityTagInfo::*getRank2RankOpType)(uint32_t rankId1, uint32_t rankId2);
+        uint32_t (*mocker)(ock::mf::HybmEntityTagInfo *, uint32_t, uint32_t);
+    } u;
+    u.getRank2RankOpType = &ock::mf::HybmEntityTagInfo::GetRank2RankOpType;
+    MOCKER(u.mocker).stubs().will(returnValue(OpOr(HYBM_DOP_TYPE_SDMA, HYBM_DOP_TYPE_HOST_RDMA)));
+    MOCKER(ock::mf::DataOperatorFactory::CreateSdmaDataOperator).stubs().will(invoke(CreateSdmaDataOperator));
+    MOCKER(ock::mf::DataOperatorFactory::CreateHostRdmaDataOperator).stubs().will(invoke(CreateHostRdmaDataOperator));
+
+    ock::mf::HostComposeDataOp dataOp(options, nullptr, tag);
+    ASSERT_EQ(ock::mf::BErrorCode::BM_OK, dataOp.Initialize());
+
+    // small sync copies go to host rdma by its lower latency, sdma is still measured once in a while
+    hybm_copy_params copyParams{reinterpret_cast<void *>(0x1000UL), reinterpret_cast<void *>(0x2000UL), 4096UL};
+    ock::mf::ExtOptions extOptions{};
+    extOptions.srcRankId = 0U;
+    extOptions.destRankId = 1U;
+    extOptions.flags = ock::mf::COPY_AUTO_ROUTE_FLAG;
+    for (auto i = 0; i < 128; i++) {
+        ASSERT_EQ(ock::mf::BErrorCode::BM_OK,
+                  dataOp.DataCopy(copyParams, HYBM_LOCAL_DEVICE_TO_GLOBAL_DEVICE, extOptions));
+    }
+    EXPECT_EQ(2UL, sdmaDataOpMock->dataCopyCount);
+    EXPECT_EQ(126UL, hostRdmaDataOpMock->dataCopyCount);
+
+    // async copies are not measured and never probe
+    extOptions.flags = ock::mf::COPY_AUTO_ROUTE_FLAG | ASYNC_COPY_FLAG;
+    for (auto i = 0; i < 128; i++) {
+        ASSERT_EQ(ock::mf::BErrorCode::BM_OK,
+                  dataOp.DataCopy(copyParams, HYBM_LOCAL_DEVICE_TO_GLOBAL_DEVICE, extOptions));
+    }
+    EXPECT_EQ(2UL, sdmaDataOpMock->dataCopyCount);
+    EXPECT_EQ(254UL, hostRdmaDataOpMock->dataCopyCount);
+    dataOp.UnInitialize();
+}
+
+TEST_F(HybmComposeDataOpTest, split_data_copy_treats_sim_as_host_path)
+{
+    hybm_options options{};
+    options.bmType = HYBM_TYPE_HOST_INITIATE;
+    options.bmDataOpType = static_cast<hybm_data_op_type>(OpOr(HYBM_DOP_TYPE_SDMA, HYBM_DOP_TYPE_HOST_SIM));
+    auto tag = std::make_shared<ock::mf::HybmEntityTagInfo>();
+    tag->TagInfoInit(options);
+
+    union {
+        uint32_t (ock::mf::HybmEntityTagInfo::*getRank2RankOpType)(uint32_t rankId1, uint32_t rankId2);
+        uint32_t (*mocker)(ock::mf::HybmEntityTagInfo *, uint32_t, uint32_t);
+    } u;
+    u.getRank2RankOpType = &ock::mf::HybmEntityTagInfo::GetRank2RankOpType;
+    MOCKER(u.mocker).stubs().will(returnValue(OpOr(HYBM_DOP_TYPE_SDMA, HYBM_DOP_TYPE_HOST_SIM)));
+    MOCKER(ock::mf::DataOperatorFactory::CreateSdmaDataOperator).stubs().will(invoke(CreateSdmaDataOperator));
+    MOCKER(ock::mf::DataOperatorFactory::CreateSimDataOperator).stubs().will(invoke(CreateHostRdmaDataOperator));
+
+    ock::mf::HostComposeDataOp dataOp(options, nullptr, tag);
+    ASSERT_EQ(ock::mf::BErrorCode::BM_OK, dataOp.Initialize());
+
+    // sim copies host memory as the other host paths do, large sync copy runs on it and sdma together
+    hybm_copy_params copyParams{reinterpret_cast<void *>(0x1000UL), reinterpret_cast<void *>(0x2000UL),
+                                256UL * 1024UL * 1024UL};
+    ock::mf::ExtOptions extOptions{};
+    extOptions.srcRankId = 0U;
+    extOptions.destRankId = 1U;
+    extOptions.flags = ock::mf::COPY_AUTO_ROUTE_FLAG;
+    ASSERT_EQ(ock::mf::BErrorCode::BM_OK, dataOp.DataCopy(copyParams, HYBM_LOCAL_HOST_TO_GLOBAL_HOST, extOptions));
+    EXPECT_EQ(1UL, sdmaDataOpMock->dataCopyCount);
+    EXPECT_EQ(1UL, hostRdmaDataOpMock->dataCopyCount);
+    dataOp.UnInitialize();
+}
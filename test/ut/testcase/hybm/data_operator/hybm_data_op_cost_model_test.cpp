@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025-2025. All rights reserved.
+ * MemFabric_Hybrid is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *          http://license.coscl.org.cn/MulanPSL2
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ */
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "hybm_data_op_cost_model.h"
+
+using namespace ock::mf;
+
+namespace {
+constexpr uint64_t COST_KB = 1024UL;
+constexpr uint64_t COST_MB = 1024UL * 1024UL;
+}
+
+class HybmDataOpCostModelTest : public testing::Test {};
+
+TEST_F(HybmDataOpCostModelTest, small_copy_prefers_low_latency)
+{
+    DataOpCostModel model;
+    EXPECT_LT(model.Predict(HYBM_DOP_TYPE_HOST_SHM, 4UL * COST_KB), model.Predict(HYBM_DOP_TYPE_SDMA, 4UL * COST_KB));
+    EXPECT_LT(model.Predict(HYBM_DOP_TYPE_SDMA, 256UL * COST_MB),
+              model.Predict(HYBM_DOP_TYPE_HOST_SHM, 256UL * COST_MB));
+    EXPECT_GT(model.Predict(static_cast<hybm_data_op_type>(HYBM_DOP_TYPE_SDMA | HYBM_DOP_TYPE_HOST_RDMA), 1UL),
+              model.Predict(HYBM_DOP_TYPE_HOST_TCP, 256UL * COST_MB));
+}
+
+TEST_F(HybmDataOpCostModelTest, measured_copies_move_estimates)
+{
+    DataOpCostModel model;
+    auto bandwidth = model.Bandwidth(HYBM_DOP_TYPE_HOST_RDMA);
+    // 64MB in 64ms is about 1GB/s, far below the prior
+    for (auto i = 0; i < 30; i++) {
+        model.Record(HYBM_DOP_TYPE_HOST_RDMA, 64UL * COST_MB, 64UL * 1000UL * 1000UL);
+    }
+    EXPECT_LT(model.Bandwidth(HYBM_DOP_TYPE_HOST_RDMA), bandwidth / 5.0);
+    EXPECT_NEAR(1.0, model.Bandwidth(HYBM_DOP_TYPE_HOST_RDMA), 0.1);
+
+    auto latency = model.Predict(HYBM_DOP_TYPE_SDMA, 0);
+    for (auto i = 0; i < 30; i++) {
+        model.Record(HYBM_DOP_TYPE_SDMA, 1UL * COST_KB, 200UL * 1000UL);
+    }
+    EXPECT_GT(model.Predict(HYBM_DOP_TYPE_SDMA, 0), latency * 5.0);
+    EXPECT_LT(model.Predict(HYBM_DOP_TYPE_HOST_SHM, 1UL * COST_KB), model.Predict(HYBM_DOP_TYPE_SDMA, 1UL * COST_KB));
+}
+
+TEST_F(HybmDataOpCostModelTest, split_by_bandwidth)
+{
+    DataOpCostModel model;
+    for (auto i = 0; i < 30; i++) {
+        model.Record(HYBM_DOP_TYPE_SDMA, 64UL * COST_MB, 4UL * 1000UL * 1000UL);
+        model.Record(HYBM_DOP_TYPE_HOST_RDMA, 64UL * COST_MB, 4UL * 1000UL * 1000UL);
+    }
+
+    // same bandwidth, about half each and page aligned
+    auto size = 256UL * COST_MB + 100UL;
+    auto firstSize = model.SplitSize(HYBM_DOP_TYPE_SDMA, HYBM_DOP_TYPE_HOST_RDMA, size);
+    EXPECT_EQ(0UL, firstSize % 4096UL);
+    EXPECT_GT(firstSize, size * 4UL / 10UL);
+    EXPECT_LT(firstSize, size * 6UL / 10UL);
+
+    // small copy or a very slow second path is not split
+    EXPECT_EQ(0UL, model.SplitSize(HYBM_DOP_TYPE_SDMA, HYBM_DOP_TYPE_HOST_RDMA, 64UL * COST_KB));
+    EXPECT_EQ(0UL, model.SplitSize(HYBM_DOP_TYPE_SDMA, HYBM_DOP_TYPE_HOST_TCP, size));
+    EXPECT_EQ(0UL, model.SplitSize(HYBM_DOP_TYPE_SDMA, HYBM_DOP_TYPE_SDMA, size));
+}
+
+TEST_F(HybmDataOpCostModelTest, shm_not_slower_than_host_rdma)
+{
+    DataOpCostModel model;
+    for (auto size : {4UL * COST_KB, 256UL * COST_KB, 4UL * COST_MB, 256UL * COST_MB}) {
+        EXPECT_LT(model.Predict(HYBM_DOP_TYPE_HOST_SHM, size), model.Predict(HYBM_DOP_TYPE_HOST_RDMA, size));
+    }
+}
+
+TEST_F(HybmDataOpCostModelTest, probe_other_paths_in_turn)
+{
+    DataOpCostModel model;
+    EXPECT_EQ(0U, model.ProbeIndex(1U, 4UL * COST_KB));
+    EXPECT_EQ(0U, model.ProbeIndex(3U, 64UL * COST_MB));
+
+    std::vector<uint32_t> probes;
+    for (auto i = 0; i < 64 * 4; i++) {
+        auto index = model.ProbeIndex(3U, 4UL * COST_KB);
+        if (index != 0U) {
+            probes.push_back(index);
+        }
+    }
+    EXPECT_EQ(std::vector<uint32_t>({1U, 2U, 1U, 2U}), probes);
+}
@@ -0,0 +1,311 @@
+/*
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025-2025. All rights reserved.
+ * MemFabric_Hybrid is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *          http://license.coscl.org.cn/MulanPSL2
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ */
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "hybm_data_op_shm.h"
+#include "shm_transport_manager.h"
+
+using namespace ock::mf;
+using namespace ock::mf::transport;
+
+namespace {
+// large enough for copies split over the workers of HostCopyEngine, the files are sparse
+constexpr uint64_t SHM_SLOT_SIZE = 64UL * 1024UL * 1024UL;
+constexpr uint64_t SHM_DATA_OFFSET = 8192UL;
+
+std::vector<std::string> PeerNicFields(const std::string &nic)
+{
+    std::vector<std::string> fields;
+    std::istringstream input(nic);
+    std::string field;
+    while (std::getline(input, field, ':')) {
+        fields.push_back(field);
+    }
+    return fields;
+}
+
+std::string JoinNic(const std::vector<std::string> &fields)
+{
+    std::string nic;
+    for (auto &field : fields) {
+        nic += (nic.empty() ? "" : ":") + field;
+    }
+    return nic;
+}
+}
+
+class HybmDataOpShmTest : public testing::Test {
+protected:
+    void SetUp() override
+    {
+        for (auto &fd : fds_) {
+            fd = memfd_create("hybm_shm_trans_ut", 0);
+            ASSERT_GE(fd, 0);
+            ASSERT_EQ(0, ftruncate(fd, static_cast<off_t>(SHM_SLOT_SIZE)));
+        }
+        // gva space of two ranks, only used for address translation
+        gva_ = mmap(nullptr, SHM_SLOT_SIZE * 2UL, PROT_NONE, MAP_ANONYMOUS | MAP_NORESERVE | MAP_PRIVATE, -1, 0);
+        ASSERT_NE(MAP_FAILED, gva_);
+        auto view = mmap(nullptr, SHM_SLOT_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, fds_[1], 0);
+        ASSERT_NE(MAP_FAILED, view);
+        peerView_ = static_cast<uint8_t *>(view);
+    }
+
+    void TearDown() override
+    {
+        munmap(peerView_, SHM_SLOT_SIZE);
+        munmap(gva_, SHM_SLOT_SIZE * 2UL);
+        for (auto fd : fds_) {
+            close(fd);
+        }
+    }
+
+    /* rank 0 is local and maps the share memory of rank 1, both live in this process */
+    void OpenPair(std::shared_ptr<shm::ShmTransportManager> &local, std::shared_ptr<shm::ShmTransportManager> &remote)
+    {
+        local = std::make_shared<shm::ShmTransportManager>();
+        remote = std::make_shared<shm::ShmTransportManager>();
+        TransportOptions options{};
+        options.rankCount = 2U;
+        options.dramSpaceSize = SHM_SLOT_SIZE;
+        options.rankId = 0U;
+        options.dramShmFd = fds_[0];
+        ASSERT_EQ(BM_OK, local->OpenDevice(options));
+        options.rankId = 1U;
+        options.dramShmFd = fds_[1];
+        ASSERT_EQ(BM_OK, remote->OpenDevice(options));
+
+        TransportMemoryRegion mr;
+        mr.addr = reinterpret_cast<uint64_t>(gva_);
+        mr.size = SHM_SLOT_SIZE;
+        mr.flags = REG_MR_FLAG_DRAM | REG_MR_FLAG_SELF | REG_MR_FLAG_SHM;
+        ASSERT_EQ(BM_OK, local->RegisterMemoryRegion(mr));
+
+        HybmTransPrepareOptions prepare;
+        prepare.options[0U].nic = local->GetNic();
+        prepare.options[1U].nic = remote->GetNic();
+        ASSERT_EQ(BM_OK, local->Prepare(prepare));
+    }
+
+    uint64_t PeerAddress(uint64_t offset) const
+    {
+        return reinterpret_cast<uint64_t>(gva_) + SHM_SLOT_SIZE + offset;
+    }
+
+    int fds_[2]{-1, -1};
+    void *gva_{nullptr};
+    uint8_t *peerView_{nullptr};
+};
+
+TEST_F(HybmDataOpShmTest, write_and_read_co_located_rank)
+{
+    std::shared_ptr<shm::ShmTransportManager> local;
+    std::shared_ptr<shm::ShmTransportManager> remote;
+    OpenPair(local, remote);
+    EXPECT_TRUE(local->Reaches(1U));
+    EXPECT_FALSE(local->Reaches(0U));
+    EXPECT_FALSE(remote->Reaches(0U));
+
+    std::vector<uint8_t> data(4096UL, 0x5A);
+    ASSERT_EQ(BM_OK, local->WriteRemote(1U, reinterpret_cast<uint64_t>(data.data()), PeerAddress(SHM_DATA_OFFSET),
+                                        data.size()));
+    EXPECT_EQ(0, memcmp(peerView_ + SHM_DATA_OFFSET, data.data(), data.size()));
+
+    std::vector<uint8_t> readBack(data.size(), 0);
+    ASSERT_EQ(BM_OK, local->ReadRemote(1U, reinterpret_cast<uint64_t>(readBack.data()), PeerAddress(SHM_DATA_OFFSET),
+                                       readBack.size()));
+    EXPECT_EQ(data, readBack);
+
+    EXPECT_EQ(BM_INVALID_PARAM, local->WriteRemote(1U, reinterpret_cast<uint64_t>(data.data()),
+                                                   PeerAddress(SHM_SLOT_SIZE - 1024UL), data.size()));
+    EXPECT_EQ(BM_NOT_SUPPORTED, remote->WriteRemote(0U, reinterpret_cast<uint64_t>(data.data()),
+                                                    reinterpret_cast<uint64_t>(gva_), data.size()));
+
+    ASSERT_EQ(BM_OK, local->RemoveRanks({1U}));
+    EXPECT_FALSE(local->Reaches(1U));
+}
+
+TEST_F(HybmDataOpShmTest, peer_identity_checked_before_map)
+{
+    auto local = std::make_shared<shm::ShmTransportManager>();
+    TransportOptions options{};
+    options.rankCount = 2U;
+    options.dramSpaceSize = SHM_SLOT_SIZE;
+    options.dramShmFd = fds_[0];
+    ASSERT_EQ(BM_OK, local->OpenDevice(options));
+    TransportMemoryRegion mr;
+    mr.addr = reinterpret_cast<uint64_t>(gva_);
+    mr.size = SHM_SLOT_SIZE;
+    mr.flags = REG_MR_FLAG_DRAM | REG_MR_FLAG_SELF | REG_MR_FLAG_SHM;
+    ASSERT_EQ(BM_OK, local->RegisterMemoryRegion(mr));
+
+    // nic of a peer is host:pid namespace:pid:fd:dev:inode
+    auto peer = std::make_shared<shm::ShmTransportManager>();
+    options.rankId = 1U;
+    options.dramShmFd = fds_[1];
+    ASSERT_EQ(BM_OK, peer->OpenDevice(options));
+    auto fields = PeerNicFields(peer->GetNic());
+    ASSERT_EQ(6U, fields.size());
+
+    HybmTransPrepareOptions prepare;
+    prepare.options[1U].nic = JoinNic({"ffffffff", fields[1], fields[2], fields[3], fields[4], fields[5]});
+    ASSERT_EQ(BM_OK, local->Prepare(prepare));
+    EXPECT_FALSE(local->Reaches(1U));
+
+    // same pid in another pid namespace is a different process
+    prepare.options[1U].nic = JoinNic({fields[0], fields[1] + "0", fields[2], fields[3], fields[4], fields[5]});
+    ASSERT_EQ(BM_OK, local->Prepare(prepare));
+    EXPECT_FALSE(local->Reaches(1U));
+
+    // the fd now refers to another file than the published one
+    struct stat other {};
+    ASSERT_EQ(0, fstat(fds_[0], &other));
+    prepare.options[1U].nic = JoinNic({fields[0], fields[1], fields[2], fields[3], fields[4],
+                                       std::to_string(other.st_ino)});
+    ASSERT_EQ(BM_OK, local->Prepare(prepare));
+    EXPECT_FALSE(local->Reaches(1U));
+
+    prepare.options[1U].nic = peer->GetNic();
+    ASSERT_EQ(BM_OK, local->Prepare(prepare));
+    EXPECT_TRUE(local->Reaches(1U));
+
+    prepare.options[1U].nic = "invalid";
+    ASSERT_EQ(BM_OK, local->Prepare(prepare));
+    EXPECT_FALSE(local->Reaches(1U));
+}
+
+TEST_F(HybmDataOpShmTest, data_operator_directions)
+{
+    std::shared_ptr<shm::ShmTransportManager> local;
+    std::shared_ptr<shm::ShmTransportManager> remote;
+    OpenPair(local, remote);
+
+    HostDataOpShm nullOp(0U, nullptr);
+    EXPECT_EQ(BM_INVALID_PARAM, nullOp.Initialize());
+
+    HostDataOpShm op(0U, local);
+    ASSERT_EQ(BM_OK, op.Initialize());
+
+    ExtOptions options{};
+    options.srcRankId = 0U;
+    options.destRankId = 1U;
+    EXPECT_TRUE(op.Reaches(HYBM_LOCAL_HOST_TO_GLOBAL_HOST, options));
+    EXPECT_TRUE(op.Reaches(HYBM_GLOBAL_HOST_TO_GLOBAL_HOST, options));
+    EXPECT_FALSE(op.Reaches(HYBM_GLOBAL_HOST_TO_LOCAL_HOST, options));
+    EXPECT_FALSE(op.Reaches(HYBM_LOCAL_DEVICE_TO_GLOBAL_DEVICE, options));
+
+    std::vector<uint8_t> data(8192UL, 0x3C);
+    hybm_copy_params params{data.data(), reinterpret_cast<void *>(PeerAddress(0UL)), data.size()};
+    ASSERT_EQ(BM_OK, op.DataCopy(params, HYBM_LOCAL_HOST_TO_GLOBAL_HOST, options));
+    EXPECT_EQ(0, memcmp(peerView_, data.data(), data.size()));
+
+    std::vector<uint8_t> readBack(data.size(), 0);
+    void *sources[] = {reinterpret_cast<void *>(PeerAddress(0UL))};
+    void *destinations[] = {readBack.data()};
+    size_t sizes[] = {readBack.size()};
+    hybm_batch_copy_params batch{sources, destinations, sizes, 1U};
+    options.srcRankId = 1U;
+    options.destRankId = 0U;
+    ASSERT_EQ(BM_OK, op.BatchDataCopy(batch, HYBM_GLOBAL_HOST_TO_LOCAL_HOST, options));
+    EXPECT_EQ(data, readBack);
+    EXPECT_EQ(BM_NOT_SUPPORTED, op.DataCopy(params, HYBM_LOCAL_DEVICE_TO_GLOBAL_DEVICE, options));
+    op.UnInitialize();
+}
+
+TEST_F(HybmDataOpShmTest, copy_bytes_large_size)
+{
+    std::shared_ptr<shm::ShmTransportManager> local;
+    std::shared_ptr<shm::ShmTransportManager> remote;
+    OpenPair(local, remote);
+
+    // unaligned size and remote offset, copied in parts by the copy engine
+    const uint64_t size = 40UL * 1024UL * 1024UL + 123UL;
+    const uint64_t offset = SHM_DATA_OFFSET + 7UL;
+    std::vector<uint8_t> src(size);
+    for (uint64_t i = 0; i < size; i++) {
+        src[i] = static_cast<uint8_t>(i * 7UL);
+    }
+    ASSERT_EQ(BM_OK, local->WriteRemote(1U, reinterpret_cast<uint64_t>(src.data()), PeerAddress(offset), size));
+    EXPECT_EQ(0, memcmp(peerView_ + offset, src.data(), size));
+
+    std::vector<uint8_t> dest(size, 0);
+    ASSERT_EQ(BM_OK, local->ReadRemote(1U, reinterpret_cast<uint64_t>(dest.data()), PeerAddress(offset), size));
+    EXPECT_EQ(src, dest);
+}
+
+TEST_F(HybmDataOpShmTest, batch_copy_by_transport_batch)
+{
+    std::shared_ptr<shm::ShmTransportManager> local;
+    std::shared_ptr<shm::ShmTransportManager> remote;
+    OpenPair(local, remote);
+    HostDataOpShm op(0U, local);
+    ASSERT_EQ(BM_OK, op.Initialize());
+
+    // small entries of different sizes and unaligned offsets, scheduled together by the copy engine
+    constexpr uint32_t count = 16U;
+    std::vector<std::vector<uint8_t>> data(count);
+    void *sources[count];
+    void *destinations[count];
+    size_t sizes[count];
+    uint64_t offset = SHM_DATA_OFFSET;
+    for (uint32_t i = 0; i < count; i++) {
+        data[i].assign(1024UL * (i + 1U) + i, static_cast<uint8_t>(i + 1U));
+        sources[i] = data[i].data();
+        destinations[i] = reinterpret_cast<void *>(PeerAddress(offset));
+        sizes[i] = data[i].size();
+        offset += data[i].size() + 3UL;
+    }
+    hybm_batch_copy_params batch{sources, destinations, sizes, count};
+    ExtOptions options{};
+    options.srcRankId = 0U;
+    options.destRankId = 1U;
+    ASSERT_EQ(BM_OK, op.BatchDataCopy(batch, HYBM_LOCAL_HOST_TO_GLOBAL_HOST, options));
+    for (uint32_t i = 0; i < count; i++) {
+        auto peerOffset = reinterpret_cast<uint64_t>(destinations[i]) - PeerAddress(0UL);
+        EXPECT_EQ(0, memcmp(peerView_ + peerOffset, data[i].data(), sizes[i]));
+    }
+
+    std::vector<std::vector<uint8_t>> readBack(count);
+    void *readDestinations[count];
+    for (uint32_t i = 0; i < count; i++) {
+        readBack[i].assign(sizes[i], 0);
+        readDestinations[i] = readBack[i].data();
+    }
+    hybm_batch_copy_params readBatch{destinations, readDestinations, sizes, count};
+    options.srcRankId = 1U;
+    options.destRankId = 0U;
+    ASSERT_EQ(BM_OK, op.BatchDataCopy(readBatch, HYBM_GLOBAL_HOST_TO_LOCAL_HOST, options));
+    EXPECT_EQ(data, readBack);
+
+    // addresses of the whole batch are checked before any byte moves
+    memset(peerView_, 0, SHM_DATA_OFFSET + 4096UL);
+    std::vector<uint8_t> head(4096UL, 0x7E);
+    void *badSources[] = {head.data(), head.data()};
+    void *badDestinations[] = {reinterpret_cast<void *>(PeerAddress(SHM_DATA_OFFSET)),
+                               reinterpret_cast<void *>(PeerAddress(SHM_SLOT_SIZE - 1024UL))};
+    size_t badSizes[] = {head.size(), head.size()};
+    hybm_batch_copy_params badBatch{badSources, badDestinations, badSizes, 2U};
+    options.srcRankId = 0U;
+    options.destRankId = 1U;
+    EXPECT_EQ(BM_INVALID_PARAM, op.BatchDataCopy(badBatch, HYBM_LOCAL_HOST_TO_GLOBAL_HOST, options));
+    std::vector<uint8_t> zeros(head.size(), 0);
+    EXPECT_EQ(0, memcmp(peerView_ + SHM_DATA_OFFSET, zeros.data(), zeros.size()));
+    EXPECT_EQ(BM_NOT_SUPPORTED, op.BatchDataCopy(badBatch, HYBM_GLOBAL_HOST_TO_LOCAL_HOST, options));
+    op.UnInitialize();
+}
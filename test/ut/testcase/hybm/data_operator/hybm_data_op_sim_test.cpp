@@ -0,0 +1,310 @@
+/*
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025-2025. All rights reserved.
+ * MemFabric_Hybrid is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *          http://license.coscl.org.cn/MulanPSL2
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ */
+#include <sys/wait.h>
+#include <unistd.h>
+#include <chrono>
+#include <cstdlib>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "hybm_data_op.h"
+#include "hybm_data_op_factory.h"
+#include "sim_transport_manager.h"
+
+using namespace ock::mf;
+using namespace ock::mf::transport;
+
+namespace {
+constexpr uint64_t SIM_BUFFER_SIZE = 4096UL;
+}
+
+class HybmDataOpSimTest : public testing::Test {
+protected:
+    void SetUp() override
+    {
+        unsetenv("MEMFABRIC_HYBRID_SIM_LATENCY_US");
+        unsetenv("MEMFABRIC_HYBRID_SIM_BANDWIDTH_MBPS");
+        localBuffer_.assign(SIM_BUFFER_SIZE, 0);
+        remoteBuffer_.assign(SIM_BUFFER_SIZE, 0);
+    }
+
+    void TearDown() override
+    {
+        unsetenv("MEMFABRIC_HYBRID_SIM_LATENCY_US");
+        unsetenv("MEMFABRIC_HYBRID_SIM_BANDWIDTH_MBPS");
+    }
+
+    /* rank 0 is local, rank 1 owns remoteBuffer_, both live in this process */
+    void OpenPair(std::shared_ptr<sim::SimTransportManager> &local, std::shared_ptr<sim::SimTransportManager> &remote)
+    {
+        local = std::make_shared<sim::SimTransportManager>();
+        remote = std::make_shared<sim::SimTransportManager>();
+        TransportOptions options{};
+        options.rankCount = 2U;
+        options.rankId = 0U;
+        ASSERT_EQ(BM_OK, local->OpenDevice(options));
+        options.rankId = 1U;
+        ASSERT_EQ(BM_OK, remote->OpenDevice(options));
+
+        TransportMemoryRegion mr;
+        mr.addr = reinterpret_cast<uint64_t>(remoteBuffer_.data());
+        mr.size = remoteBuffer_.size();
+        ASSERT_EQ(BM_OK, remote->RegisterMemoryRegion(mr));
+        TransportMemoryKey key{};
+        ASSERT_EQ(BM_OK, remote->QueryMemoryKey(mr.addr + 1UL, key));
+
+        HybmTransPrepareOptions prepare;
+        prepare.options.emplace(1U, TransportRankPrepareInfo{remote->GetNic(), key});
+        ASSERT_EQ(BM_OK, local->Prepare(prepare));
+    }
+
+    /* rank 2 owns the given buffer and lives in this process too */
+    void AddRank2(const std::shared_ptr<sim::SimTransportManager> &local,
+                  std::shared_ptr<sim::SimTransportManager> &rank2, std::vector<uint8_t> &buffer)
+    {
+        rank2 = std::make_shared<sim::SimTransportManager>();
+        TransportOptions options{};
+        options.rankCount = 3U;
+        options.rankId = 2U;
+        ASSERT_EQ(BM_OK, rank2->OpenDevice(options));
+        TransportMemoryRegion mr;
+        mr.addr = reinterpret_cast<uint64_t>(buffer.data());
+        mr.size = buffer.size();
+        ASSERT_EQ(BM_OK, rank2->RegisterMemoryRegion(mr));
+        TransportMemoryKey key{};
+        ASSERT_EQ(BM_OK, rank2->QueryMemoryKey(mr.addr, key));
+
+        HybmTransPrepareOptions prepare;
+        prepare.options.emplace(2U, TransportRankPrepareInfo{rank2->GetNic(), key});
+        ASSERT_EQ(BM_OK, local->UpdateRankOptions(prepare));
+    }
+
+    std::vector<uint8_t> localBuffer_;
+    std::vector<uint8_t> remoteBuffer_;
+};
+
+TEST_F(HybmDataOpSimTest, Transport_ReadWriteRegisteredRegion)
+{
+    std::shared_ptr<sim::SimTransportManager> local;
+    std::shared_ptr<sim::SimTransportManager> remote;
+    OpenPair(local, remote);
+
+    auto lAddr = reinterpret_cast<uint64_t>(localBuffer_.data());
+    auto rAddr = reinterpret_cast<uint64_t>(remoteBuffer_.data());
+    localBuffer_.assign(SIM_BUFFER_SIZE, 0x5a);
+    EXPECT_EQ(BM_OK, local->WriteRemote(1U, lAddr, rAddr, SIM_BUFFER_SIZE));
+    EXPECT_EQ(remoteBuffer_, localBuffer_);
+
+    remoteBuffer_.assign(SIM_BUFFER_SIZE, 0xa5);
+    EXPECT_EQ(BM_OK, local->ReadRemoteAsync(1U, lAddr, rAddr + 16UL, SIM_BUFFER_SIZE - 16UL));
+    EXPECT_EQ(BM_OK, local->Synchronize(1U));
+    EXPECT_EQ(0xa5, localBuffer_[SIM_BUFFER_SIZE - 17UL]);
+
+    EXPECT_EQ(BM_INVALID_PARAM, local->WriteRemote(1U, lAddr, rAddr + 1UL, SIM_BUFFER_SIZE));
+    EXPECT_EQ(BM_INVALID_PARAM, local->WriteRemote(2U, lAddr, rAddr, 1UL));
+    EXPECT_EQ(BM_OK, local->RemoveRanks({1U}));
+    EXPECT_EQ(BM_INVALID_PARAM, local->ReadRemote(1U, lAddr, rAddr, 1UL));
+}
+
+TEST_F(HybmDataOpSimTest, Transport_LatencyModelDelaysCompletion)
+{
+    setenv("MEMFABRIC_HYBRID_SIM_LATENCY_US", "2000", 1);
+    std::shared_ptr<sim::SimTransportManager> local;
+    std::shared_ptr<sim::SimTransportManager> remote;
+    OpenPair(local, remote);
+    EXPECT_EQ(2000000UL, local->GetLinkModel().latencyNs);
+
+    auto lAddr = reinterpret_cast<uint64_t>(localBuffer_.data());
+    auto rAddr = reinterpret_cast<uint64_t>(remoteBuffer_.data());
+    auto start = std::chrono::steady_clock::now();
+    for (auto i = 0; i < 20; i++) {
+        EXPECT_EQ(BM_OK, local->WriteRemoteAsync(1U, lAddr, rAddr, SIM_BUFFER_SIZE));
+    }
+    EXPECT_EQ(BM_OK, local->Synchronize(1U));
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    EXPECT_GE(elapsed, std::chrono::microseconds(2000));
+    /* latency of pipelined async transfers overlaps, serialized ones would take 40ms */
+    EXPECT_LT(elapsed, std::chrono::milliseconds(20));
+}
+
+TEST_F(HybmDataOpSimTest, DataOp_CopyLocalAndRemoteHost)
+{
+    std::shared_ptr<sim::SimTransportManager> local;
+    std::shared_ptr<sim::SimTransportManager> remote;
+    OpenPair(local, remote);
+    auto op = DataOperatorFactory::CreateSimDataOperator(0U, local);
+    ASSERT_EQ(BM_OK, op->Initialize());
+
+    std::vector<uint8_t> localGva(SIM_BUFFER_SIZE, 0x11);
+    ExtOptions options{};
+    options.srcRankId = 0U;
+    options.destRankId = 0U;
+    hybm_copy_params params{localGva.data(), localBuffer_.data(), SIM_BUFFER_SIZE};
+    EXPECT_EQ(BM_OK, op->DataCopy(params, HYBM_GLOBAL_HOST_TO_LOCAL_HOST, options));
+    EXPECT_EQ(localGva, localBuffer_);
+
+    options.destRankId = 1U;
+    params = {localBuffer_.data(), remoteBuffer_.data(), SIM_BUFFER_SIZE};
+    options.flags = ASYNC_COPY_FLAG;
+    EXPECT_EQ(BM_OK, op->DataCopy(params, HYBM_LOCAL_HOST_TO_GLOBAL_HOST, options));
+    EXPECT_EQ(BM_OK, op->Wait(0));
+    EXPECT_EQ(localGva, remoteBuffer_);
+
+    options.flags = 0;
+    EXPECT_EQ(BM_NOT_SUPPORTED, op->DataCopy(params, HYBM_LOCAL_DEVICE_TO_GLOBAL_HOST, options));
+    op->UnInitialize();
+}
+
+TEST_F(HybmDataOpSimTest, DataOp_SyncBatchWaitsOnlyTouchedRanks)
+{
+    /* 1MB/s: each 4KB transfer occupies the link about 4ms */
+    setenv("MEMFABRIC_HYBRID_SIM_BANDWIDTH_MBPS", "1", 1);
+    std::shared_ptr<sim::SimTransportManager> local;
+    std::shared_ptr<sim::SimTransportManager> remote;
+    std::shared_ptr<sim::SimTransportManager> rank2;
+    std::vector<uint8_t> rank2Buffer(SIM_BUFFER_SIZE, 0);
+    OpenPair(local, remote);
+    AddRank2(local, rank2, rank2Buffer);
+    auto op = DataOperatorFactory::CreateSimDataOperator(0U, local);
+    ASSERT_EQ(BM_OK, op->Initialize());
+
+    auto start = std::chrono::steady_clock::now();
+    ExtOptions options{};
+    options.srcRankId = 0U;
+    options.destRankId = 1U;
+    options.flags = ASYNC_COPY_FLAG;
+    hybm_copy_params params{localBuffer_.data(), remoteBuffer_.data(), SIM_BUFFER_SIZE};
+    for (auto i = 0; i < 50; i++) {
+        ASSERT_EQ(BM_OK, op->DataCopy(params, HYBM_LOCAL_HOST_TO_GLOBAL_HOST, options));
+    }
+
+    /* sync batch with rank 2 must not wait for the 200ms of async copies pending on rank 1 */
+    localBuffer_.assign(SIM_BUFFER_SIZE, 0x3c);
+    void *sources[] = {localBuffer_.data()};
+    void *destinations[] = {rank2Buffer.data()};
+    uint64_t sizes[] = {SIM_BUFFER_SIZE};
+    hybm_batch_copy_params batch{sources, destinations, sizes, 1U};
+    options.destRankId = 2U;
+    options.flags = 0;
+    EXPECT_EQ(BM_OK, op->BatchDataCopy(batch, HYBM_LOCAL_HOST_TO_GLOBAL_HOST, options));
+    EXPECT_EQ(localBuffer_, rank2Buffer);
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(100));
+
+    /* they are still waited by Wait */
+    EXPECT_EQ(BM_OK, op->Wait(0));
+    EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(200));
+    op->UnInitialize();
+}
+
+TEST_F(HybmDataOpSimTest, Transport_WaitForConnectedHonorsTimeout)
+{
+    std::shared_ptr<sim::SimTransportManager> local;
+    std::shared_ptr<sim::SimTransportManager> remote;
+    OpenPair(local, remote);
+    EXPECT_EQ(BM_OK, local->WaitForConnected(0));
+
+    /* a peer whose process has already exited never connects */
+    auto pid = fork();
+    ASSERT_NE(-1, pid);
+    if (pid == 0) {
+        _exit(0);
+    }
+    ASSERT_EQ(pid, waitpid(pid, nullptr, 0));
+    HybmTransPrepareOptions prepare;
+    prepare.options.emplace(2U, TransportRankPrepareInfo{"sim://" + std::to_string(pid), TransportMemoryKey{}});
+    ASSERT_EQ(BM_OK, local->UpdateRankOptions(prepare));
+
+    auto start = std::chrono::steady_clock::now();
+    EXPECT_EQ(BM_TIMEOUT, local->WaitForConnected(20L * 1000L * 1000L));
+    EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(20));
+
+    EXPECT_EQ(BM_OK, local->RemoveRanks({2U}));
+    EXPECT_EQ(BM_OK, local->WaitForConnected(0));
+}
+
+TEST_F(HybmDataOpSimTest, Transport_ReadWriteOtherProcess)
+{
+    int keyPipe[2];
+    int donePipe[2];
+    ASSERT_EQ(0, pipe(keyPipe));
+    ASSERT_EQ(0, pipe(donePipe));
+
+    auto pid = fork();
+    ASSERT_NE(-1, pid);
+    if (pid == 0) {
+        /* child is rank 1, owns remoteBuffer_ and checks the bytes written by parent */
+        close(keyPipe[0]);
+        close(donePipe[1]);
+        sim::SimTransportManager remote;
+        TransportOptions options{};
+        options.rankCount = 2U;
+        options.rankId = 1U;
+        remoteBuffer_.assign(SIM_BUFFER_SIZE, 0x77);
+        TransportMemoryRegion mr;
+        mr.addr = reinterpret_cast<uint64_t>(remoteBuffer_.data());
+        mr.size = remoteBuffer_.size();
+        TransportMemoryKey key{};
+        if (remote.OpenDevice(options) != BM_OK || remote.RegisterMemoryRegion(mr) != BM_OK ||
+            remote.QueryMemoryKey(mr.addr, key) != BM_OK ||
+            write(keyPipe[1], &key, sizeof(key)) != static_cast<ssize_t>(sizeof(key))) {
+            _exit(1);
+        }
+        char done = 0;
+        if (read(donePipe[0], &done, sizeof(done)) != sizeof(done)) {
+            _exit(2);
+        }
+        _exit(remoteBuffer_[0] == 0x5a && remoteBuffer_[SIM_BUFFER_SIZE - 1UL] == 0x5a ? 0 : 3);
+    }
+
+    close(keyPipe[1]);
+    close(donePipe[0]);
+    TransportMemoryKey key{};
+    ASSERT_EQ(static_cast<ssize_t>(sizeof(key)), read(keyPipe[0], &key, sizeof(key)));
+    close(keyPipe[0]);
+
+    sim::SimTransportManager local;
+    TransportOptions options{};
+    options.rankCount = 2U;
+    options.rankId = 0U;
+    ASSERT_EQ(BM_OK, local.OpenDevice(options));
+    HybmTransPrepareOptions prepare;
+    prepare.options.emplace(1U, TransportRankPrepareInfo{"sim://" + std::to_string(pid), key});
+    ASSERT_EQ(BM_OK, local.Prepare(prepare));
+    EXPECT_EQ(BM_OK, local.WaitForConnected(0));
+
+    /* address of remoteBuffer_ in the child, it is a copy of this process */
+    auto lAddr = reinterpret_cast<uint64_t>(localBuffer_.data());
+    auto rAddr = reinterpret_cast<uint64_t>(remoteBuffer_.data());
+    auto readRet = local.ReadRemote(1U, lAddr, rAddr, SIM_BUFFER_SIZE);
+    if (readRet != BM_OK) {
+        char done = 1;
+        auto written = write(donePipe[1], &done, sizeof(done));
+        close(donePipe[1]);
+        waitpid(pid, nullptr, 0);
+        ASSERT_EQ(static_cast<ssize_t>(sizeof(done)), written);
+        GTEST_SKIP() << "process_vm_readv is not permitted in this environment";
+    }
+    EXPECT_EQ(std::vector<uint8_t>(SIM_BUFFER_SIZE, 0x77), localBuffer_);
+
+    localBuffer_.assign(SIM_BUFFER_SIZE, 0x5a);
+    EXPECT_EQ(BM_OK, local.WriteRemoteAsync(1U, lAddr, rAddr, SIM_BUFFER_SIZE));
+    EXPECT_EQ(BM_OK, local.Synchronize(1U));
+    EXPECT_EQ(BM_INVALID_PARAM, local.WriteRemote(1U, lAddr, rAddr + 1UL, SIM_BUFFER_SIZE));
+
+    char done = 1;
+    EXPECT_EQ(static_cast<ssize_t>(sizeof(done)), write(donePipe[1], &done, sizeof(done)));
+    close(donePipe[1]);
+    int status = 0;
+    ASSERT_EQ(pid, waitpid(pid, &status, 0));
+    EXPECT_TRUE(WIFEXITED(status));
+    EXPECT_EQ(0, WEXITSTATUS(status));
+}
@@ -0,0 +1,94 @@
+/*
+* Copyright (c) Huawei Technologies Co., Ltd. 2025-2025. All rights reserved.
+ * MemFabric_Hybrid is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *          http://license.coscl.org.cn/MulanPSL2
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+*/
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include <gtest/gtest.h>
+#include "hybm_host_copy_engine.h"
+
+using namespace ock::mf;
+
+namespace {
+constexpr uint64_t COPY_MB = 1024UL * 1024UL;
+
+std::vector<uint8_t> Pattern(uint64_t size, uint64_t seed)
+{
+    std::vector<uint8_t> data(size);
+    for (uint64_t i = 0; i < size; i++) {
+        data[i] = static_cast<uint8_t>(i * 7UL + seed);
+    }
+    return data;
+}
+}
+
+class HybmHostCopyEngineTest : public ::testing::Test {
+protected:
+    void TearDown() override
+    {
+        unsetenv("MEMFABRIC_HYBRID_COPY_THREADS");
+    }
+};
+
+TEST_F(HybmHostCopyEngineTest, copy_split_to_workers)
+{
+    setenv("MEMFABRIC_HYBRID_COPY_THREADS", "4", 1);
+    // odd size and unaligned destination cover head and tail of streaming copy
+    const uint64_t size = 40UL * COPY_MB + 123UL;
+    auto src = Pattern(size, 1UL);
+    std::vector<uint8_t> dest(size + 1UL, 0);
+    HostCopyEngine::Instance().Copy(dest.data() + 1, src.data(), size);
+    EXPECT_EQ(0, memcmp(dest.data() + 1, src.data(), size));
+    EXPECT_EQ(0, dest[0]);
+
+    std::vector<uint8_t> small(100UL, 0);
+    HostCopyEngine::Instance().Copy(small.data(), src.data(), small.size());
+    EXPECT_EQ(0, memcmp(small.data(), src.data(), small.size()));
+    HostCopyEngine::Instance().Copy(small.data(), src.data(), 0);
+}
+
+TEST_F(HybmHostCopyEngineTest, batch_copy_mixed_sizes)
+{
+    setenv("MEMFABRIC_HYBRID_COPY_THREADS", "3", 1);
+    std::vector<uint64_t> sizes;
+    for (auto i = 0U; i < 200U; i++) {
+        sizes.emplace_back(128UL * 1024UL + i * 4099UL);
+    }
+    sizes.emplace_back(17UL * COPY_MB);
+    sizes.emplace_back(1UL);
+
+    std::vector<std::vector<uint8_t>> srcData;
+    std::vector<std::vector<uint8_t>> destData;
+    std::vector<const void *> srcs;
+    std::vector<void *> dests;
+    for (auto i = 0U; i < sizes.size(); i++) {
+        srcData.emplace_back(Pattern(sizes[i], i));
+        destData.emplace_back(sizes[i], 0);
+    }
+    for (auto i = 0U; i < sizes.size(); i++) {
+        srcs.emplace_back(srcData[i].data());
+        dests.emplace_back(destData[i].data());
+    }
+
+    HostCopyEngine::Instance().BatchCopy(dests.data(), srcs.data(), sizes.data(), static_cast<uint32_t>(sizes.size()));
+    for (auto i = 0U; i < sizes.size(); i++) {
+        EXPECT_EQ(srcData[i], destData[i]) << "entry " << i;
+    }
+}
+
+TEST_F(HybmHostCopyEngineTest, worker_count_bounded)
+{
+    EXPECT_EQ(1U, HostCopyEngine::WorkerCount(COPY_MB));
+    EXPECT_LE(HostCopyEngine::WorkerCount(1024UL * 1024UL * COPY_MB), 16U);
+    setenv("MEMFABRIC_HYBRID_COPY_THREADS", "100", 1);
+    EXPECT_EQ(16U, HostCopyEngine::WorkerCount(64UL * COPY_MB));
+    EXPECT_EQ(1U, HostCopyEngine::WorkerCount(COPY_MB));
+}
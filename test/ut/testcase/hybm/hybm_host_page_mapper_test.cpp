@@ -0,0 +1,60 @@
+/*
+* Copyright (c) Huawei Technologies Co., Ltd. 2025-2025. All rights reserved.
+ * MemFabric_Hybrid is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *          http://license.coscl.org.cn/MulanPSL2
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+*/
+#include <sys/mman.h>
+#include <unistd.h>
+#include <cstring>
+#include <gtest/gtest.h>
+#include "hybm_host_page_mapper.h"
+
+using namespace ock::mf;
+
+class HybmHostPageMapperTest : public ::testing::Test {};
+
+TEST_F(HybmHostPageMapperTest, fixed_private_mapping_falls_back)
+{
+    const uint64_t size = 4UL * 1024UL * 1024UL;
+    auto reserved = mmap(nullptr, size * 2UL, PROT_NONE, MAP_ANONYMOUS | MAP_NORESERVE | MAP_PRIVATE, -1, 0);
+    ASSERT_NE(MAP_FAILED, reserved);
+    auto aligned = reinterpret_cast<uint8_t *>((reinterpret_cast<uint64_t>(reserved) + size - 1UL) & ~(size - 1UL));
+
+    // 1GB pages are skipped for a 4MB range, others depend on the host
+    HostPageMapping mapping;
+    ASSERT_EQ(BM_OK, HostPageMapper::Map(aligned, size, -1, 0, HOST_PAGE_HUGETLB_1G, mapping));
+    EXPECT_EQ(static_cast<void *>(aligned), mapping.address);
+    EXPECT_EQ(size, mapping.size);
+    EXPECT_NE(HOST_PAGE_HUGETLB_1G, mapping.kind);
+    EXPECT_EQ(mapping.kind == HOST_PAGE_NORMAL ? 4096UL : 2UL * 1024UL * 1024UL, mapping.pageSize);
+    memset(aligned, 1, size);
+    munmap(reserved, size * 2UL);
+
+    ASSERT_EQ(BM_OK, HostPageMapper::Map(nullptr, 4096UL, -1, 0, HOST_PAGE_HUGETLB_1G, mapping));
+    EXPECT_EQ(HOST_PAGE_NORMAL, mapping.kind);
+    EXPECT_STREQ("4K", HostPageMapper::KindName(mapping.kind));
+    munmap(mapping.address, mapping.size);
+}
+
+TEST_F(HybmHostPageMapperTest, share_fd_mapping_uses_file_pages)
+{
+    const uint64_t size = 2UL * 1024UL * 1024UL;
+    auto fd = memfd_create("hybm_page_mapper_ut", 0);
+    ASSERT_GE(fd, 0);
+    ASSERT_EQ(0, ftruncate(fd, static_cast<off_t>(size)));
+
+    HostPageMapping mapping;
+    ASSERT_EQ(BM_OK, HostPageMapper::Map(nullptr, size, fd, 0, HOST_PAGE_HUGETLB_1G, mapping));
+    EXPECT_TRUE(mapping.kind == HOST_PAGE_THP || mapping.kind == HOST_PAGE_NORMAL);
+    memset(mapping.address, 1, size);
+    munmap(mapping.address, mapping.size);
+    close(fd);
+
+    EXPECT_EQ(BM_INVALID_PARAM, HostPageMapper::Map(nullptr, size, 1000000, 0, HOST_PAGE_HUGETLB_1G, mapping));
+}
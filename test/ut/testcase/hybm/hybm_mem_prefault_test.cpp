@@ -0,0 +1,57 @@
+/*
+* Copyright (c) Huawei Technologies Co., Ltd. 2025-2025. All rights reserved.
+ * MemFabric_Hybrid is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *          http://license.coscl.org.cn/MulanPSL2
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+*/
+#include <sys/mman.h>
+#include <unistd.h>
+#include <cstdlib>
+#include <vector>
+#include <gtest/gtest.h>
+#include "hybm_mem_prefault.h"
+
+using namespace ock::mf;
+
+class HybmMemPrefaultTest : public ::testing::Test {
+protected:
+    void TearDown() override
+    {
+        unsetenv("MEMFABRIC_HYBRID_PREFAULT_THREADS");
+    }
+};
+
+TEST_F(HybmMemPrefaultTest, populate_all_pages_with_workers)
+{
+    const uint64_t pageSize = 4096UL;
+    const uint64_t size = pageSize * 37UL;
+    setenv("MEMFABRIC_HYBRID_PREFAULT_THREADS", "4", 1);
+    auto addr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_ANONYMOUS | MAP_PRIVATE, -1, 0);
+    ASSERT_NE(MAP_FAILED, addr);
+
+    PrefaultStat stat;
+    EXPECT_EQ(BM_OK, MemPrefault::Populate(addr, size, pageSize, stat));
+    EXPECT_EQ(4U, stat.workers);
+    std::vector<unsigned char> resident(size / static_cast<uint64_t>(getpagesize()));
+    ASSERT_EQ(0, mincore(addr, size, resident.data()));
+    for (auto page : resident) {
+        EXPECT_NE(0, page & 1U);
+    }
+    munmap(addr, size);
+}
+
+TEST_F(HybmMemPrefaultTest, worker_count_bounded)
+{
+    const uint64_t gb = 1024UL * 1024UL * 1024UL;
+    EXPECT_EQ(1U, MemPrefault::WorkerCount(gb / 2UL));
+    EXPECT_LE(MemPrefault::WorkerCount(1024UL * gb), 16U);
+    setenv("MEMFABRIC_HYBRID_PREFAULT_THREADS", "100", 1);
+    EXPECT_EQ(16U, MemPrefault::WorkerCount(gb));
+    setenv("MEMFABRIC_HYBRID_PREFAULT_THREADS", "abc", 1);
+    EXPECT_EQ(1U, MemPrefault::WorkerCount(gb / 2UL));
+}
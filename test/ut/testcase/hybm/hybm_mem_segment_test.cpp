@@ -274,6 +274,33 @@ TEST_F(HybmMemSegmentTest, ConnBasedSegment_ValidateOptions)
     EXPECT_EQ(segBadType.ValidateOptions(), ock::mf::BM_INVALID_PARAM);
 }
 
+/**
+* ConnBasedSegment_Import_ReturnsPeerAddress
+*  - 导入时通过addresses返回对端分片的虚拟地址，trans场景据此映射远端地址。
+*/
+TEST_F(HybmMemSegmentTest, ConnBasedSegment_Import_ReturnsPeerAddress)
+{
+    ock::mf::MemSegmentOptions opt{};
+    opt.segType = ock::mf::HYBM_MST_DRAM;
+    opt.maxSize = ock::mf::HYBM_LARGE_PAGE_SIZE;
+    opt.rankCnt = 2;
+    opt.rankId = 0;
+    ock::mf::HybmConnBasedSegment seg(opt, 0);
+
+    ock::mf::HostExportInfo peer{};
+    peer.rankId = 1;
+    peer.vAddress = 0x280200000000UL;
+    peer.size = ock::mf::HYBM_LARGE_PAGE_SIZE;
+    std::string info;
+    ASSERT_EQ(ock::mf::LiteralExInfoTranslater<ock::mf::HostExportInfo>{}.Serialize(peer, info), ock::mf::BM_OK);
+
+    void *address = nullptr;
+    ASSERT_EQ(seg.Import({info}, &address), ock::mf::BM_OK);
+    EXPECT_EQ(address, reinterpret_cast<void *>(peer.vAddress));
+    EXPECT_EQ(seg.Mmap(), ock::mf::BM_OK);
+    EXPECT_EQ(seg.Unmap(), ock::mf::BM_OK);
+}
+
 /**
 * DevLegacySegment_GetReserveChunkSize
 *  - 该函数用来计算 GVA 预留时的 chunk 大小，保证：
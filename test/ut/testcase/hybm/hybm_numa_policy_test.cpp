@@ -0,0 +1,96 @@
+/*
+* Copyright (c) Huawei Technologies Co., Ltd. 2025-2025. All rights reserved.
+ * MemFabric_Hybrid is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *          http://license.coscl.org.cn/MulanPSL2
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+*/
+#include <linux/mempolicy.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#include <string>
+#include <gtest/gtest.h>
+#include "hybm_numa_policy.h"
+
+using namespace ock::mf;
+
+namespace {
+constexpr unsigned long NUMA_TEST_MAX_NODE = 64UL;
+
+/* empty if node 0 can be bound here, otherwise why the placement test is skipped */
+std::string NumaBindUnsupported(void *addr, uint64_t size)
+{
+    unsigned long mask = 0UL;
+    if (syscall(SYS_get_mempolicy, nullptr, &mask, NUMA_TEST_MAX_NODE, nullptr, MPOL_F_MEMS_ALLOWED) != 0) {
+        if (errno == EPERM || errno == ENOSYS) {
+            return "get_mempolicy not permitted: " + std::to_string(errno);
+        }
+        return "";
+    }
+    if ((mask & 1UL) == 0) {
+        return "numa node 0 not allowed";
+    }
+    unsigned long node0 = 1UL;
+    if (syscall(SYS_mbind, addr, size, MPOL_BIND, &node0, NUMA_TEST_MAX_NODE + 1UL, 0) != 0) {
+        if (errno == EPERM || errno == ENOSYS) {
+            return "mbind not permitted: " + std::to_string(errno);
+        }
+        return "";
+    }
+    syscall(SYS_mbind, addr, size, MPOL_DEFAULT, nullptr, 0UL, 0);
+    return "";
+}
+}
+
+class HybmNumaPolicyTest : public ::testing::Test {};
+
+TEST_F(HybmNumaPolicyTest, create_from_flags)
+{
+    const uint32_t performance = 1U << HYBM_PERFORMANCE_MODE_FLAG_INDEX;
+    EXPECT_EQ(HOST_NUMA_POLICY_NONE, HostNumaPolicy::Create(0U, "").Type());
+    EXPECT_EQ(HOST_NUMA_POLICY_NONE, HostNumaPolicy::Create(1U, "").Type());
+
+    auto bind = HostNumaPolicy::Create(performance | 1U, "");
+    EXPECT_EQ(HOST_NUMA_POLICY_BIND, bind.Type());
+    ASSERT_EQ(1U, bind.Nodes().size());
+    EXPECT_EQ(1U, bind.Nodes()[0]);
+    EXPECT_EQ("bind(1)", bind.ToString());
+
+    // loopback has no device, NIC local falls back to first touch
+    EXPECT_EQ(-1, HostNumaPolicy::NicNumaNode("tcp://127.0.0.1:10002"));
+    EXPECT_EQ(-1, HostNumaPolicy::NicNumaNode("tcp://[::1]:10002"));
+    auto nicLocal = HostNumaPolicy::Create(performance | HYBM_BIND_NUMA_AUTO_AFFINITY_FLAG, "tcp://127.0.0.1:10002");
+    EXPECT_EQ(HOST_NUMA_POLICY_NONE, nicLocal.Type());
+
+    auto interleave = HostNumaPolicy::Create(HYBM_FLAG_DRAM_NUMA_INTERLEAVE | performance | 1U, "");
+    EXPECT_NE(HOST_NUMA_POLICY_BIND, interleave.Type());
+}
+
+TEST_F(HybmNumaPolicyTest, bind_and_report_placement)
+{
+    const uint64_t pageSize = 4096UL;
+    const uint64_t size = pageSize * 16UL;
+    auto addr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_ANONYMOUS | MAP_PRIVATE, -1, 0);
+    ASSERT_NE(MAP_FAILED, addr);
+    auto reason = NumaBindUnsupported(addr, size);
+    if (!reason.empty()) {
+        munmap(addr, size);
+        GTEST_SKIP() << reason;
+    }
+
+    auto policy = HostNumaPolicy::Create(1U << HYBM_PERFORMANCE_MODE_FLAG_INDEX, "");
+    ASSERT_EQ(BM_OK, policy.Apply(addr, size));
+    memset(addr, 0, size / 2U);
+    auto placement = HostNumaPolicy::Placement(addr, size, pageSize);
+    EXPECT_EQ(size / 2U, placement[0]);
+    EXPECT_EQ(size / 2U, placement[-1]);
+    EXPECT_EQ("unknown:0MB node0:0MB", HostNumaPolicy::PlacementString(placement));
+    munmap(addr, size);
+}
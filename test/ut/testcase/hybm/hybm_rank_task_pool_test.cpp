@@ -0,0 +1,84 @@
+/*
+* Copyright (c) Huawei Technologies Co., Ltd. 2025-2025. All rights reserved.
+ * MemFabric_Hybrid is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *          http://license.coscl.org.cn/MulanPSL2
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+*/
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+#include "hybm_ptracer.h"
+#include "hybm_rank_task_pool.h"
+
+using namespace ock::mf;
+
+class HybmRankTaskPoolTest : public ::testing::Test {};
+
+TEST_F(HybmRankTaskPoolTest, run_all_ranks_ok)
+{
+    const uint32_t rankCount = 64;
+    std::atomic<uint32_t> done{0};
+    std::atomic<uint32_t> prepared{0};
+    std::vector<RankTask> tasks;
+    for (auto i = 0U; i < rankCount; i++) {
+        tasks.push_back({i, [&done]() { done++; return BM_OK; }, nullptr});
+    }
+
+    auto prepare = [&prepared]() -> Result { prepared++; return BM_OK; };
+    auto ret = RankTaskPool::Run("UtRank", TP_HYBM_SEGMENT_MMAP_RANK, tasks, prepare);
+    EXPECT_EQ(BM_OK, ret);
+    EXPECT_EQ(rankCount, done.load());
+    EXPECT_GT(prepared.load(), 0U);
+    EXPECT_EQ(BM_OK, RankTaskPool::Run("UtRank", TP_HYBM_SEGMENT_MMAP_RANK, {}, prepare));
+}
+
+TEST_F(HybmRankTaskPoolTest, failed_rank_rolls_back_others_in_order)
+{
+    const uint32_t rankCount = 32;
+    const uint32_t failedRank = 5;
+    std::mutex mutex;
+    std::vector<uint32_t> rolledBack;
+    std::vector<RankTask> tasks;
+    for (auto i = 0U; i < rankCount; i++) {
+        auto run = [i]() -> Result { return i == failedRank || i == failedRank + 1 ? BM_DL_FUNCTION_FAILED - i : BM_OK; };
+        auto rollback = [i, &mutex, &rolledBack]() {
+            std::lock_guard<std::mutex> guard(mutex);
+            rolledBack.push_back(i);
+        };
+        tasks.push_back({i, run, rollback});
+    }
+
+    auto ret = RankTaskPool::Run("UtRank", TP_HYBM_SEGMENT_MMAP_RANK, tasks);
+    EXPECT_EQ(BM_DL_FUNCTION_FAILED - static_cast<int32_t>(failedRank), ret);
+    ASSERT_EQ(rankCount - 2U, rolledBack.size());
+    for (auto i = 1U; i < rolledBack.size(); i++) {
+        EXPECT_GT(rolledBack[i - 1U], rolledBack[i]);
+    }
+}
+
+TEST_F(HybmRankTaskPoolTest, prepare_worker_failed)
+{
+    std::atomic<uint32_t> done{0};
+    std::vector<RankTask> tasks;
+    for (auto i = 0U; i < 8U; i++) {
+        auto run = [&done]() -> Result {
+            // slow enough for workers to take some tasks from caller thread
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            done++;
+            return BM_OK;
+        };
+        tasks.push_back({i, run, nullptr});
+    }
+
+    auto ret = RankTaskPool::Run("UtRank", TP_HYBM_SEGMENT_IMPORT_RANK, tasks, []() -> Result { return BM_ERROR; });
+    EXPECT_EQ(BM_ERROR, ret);
+    EXPECT_LT(done.load(), 8U);
+}
@@ -794,4 +794,26 @@ TEST_F(HybmVaManagerTest, MixedOperations_AddRemoveQueryMixed)
     EXPECT_TRUE(manager.IsGva(gva2));
 
     EXPECT_TRUE(manager.GetAllocCount() == TEST_COUNT_ONE);
-}
\ No newline at end of file
+}
+
+// 测试49: FreeReserveGva - 释放的空间被复用并与相邻空闲区间合并
+TEST_F(HybmVaManagerTest, FreeReserveGva_ReusesAndMergesFreeSpace)
+{
+    ReservedGvaInfo first = manager.AllocReserveGva(TEST_RANK_ZERO, TEST_SIZE_SIXTEEN_MB, TEST_MEM_TYPE_HOST);
+    ReservedGvaInfo second = manager.AllocReserveGva(TEST_RANK_ONE, TEST_SIZE_SIXTEEN_MB, TEST_MEM_TYPE_HOST);
+    ReservedGvaInfo third = manager.AllocReserveGva(TEST_RANK_TWO, TEST_SIZE_SIXTEEN_MB, TEST_MEM_TYPE_HOST);
+    EXPECT_TRUE(second.start == first.End());
+    EXPECT_TRUE(third.start == second.End());
+
+    manager.FreeReserveGva(second.start);
+    ReservedGvaInfo reused = manager.AllocReserveGva(TEST_RANK_THREE, TEST_SIZE_SIXTEEN_MB, TEST_MEM_TYPE_HOST);
+    EXPECT_TRUE(reused.start == second.start);
+
+    manager.FreeReserveGva(first.start);
+    manager.FreeReserveGva(reused.start);
+    manager.FreeReserveGva(third.start);
+    EXPECT_TRUE(manager.GetReservedCount() == TEST_SIZE_ZERO);
+
+    ReservedGvaInfo merged = manager.AllocReserveGva(TEST_RANK_ZERO, TEST_SIZE_SIXTY_FOUR_MB, TEST_MEM_TYPE_HOST);
+    EXPECT_TRUE(merged.start == first.start);
+}
@@ -9,6 +9,9 @@
  * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
  * See the Mulan PSL v2 for more details.
 */
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <thread>
 #include <mutex>
 #include <condition_variable>
@@ -460,4 +463,336 @@ TEST_F(AccConfigStoreTest, set_get_binary_data)
     ret = g_server->Get(key, valueOut);
     ASSERT_EQ(0, ret);
     ASSERT_EQ(value, valueOut);
-}
\ No newline at end of file
+}
+
+TEST_F(AccConfigStoreTest, append_many_then_get_check)
+{
+    std::string key = "append_many_then_get_key";
+    const uint32_t recordSize = 516U;
+    const uint32_t recordCount = 100U;
+    std::vector<uint8_t> expected;
+    uint64_t size = 0;
+    for (auto i = 0U; i < recordCount; i++) {
+        std::vector<uint8_t> record(recordSize, static_cast<uint8_t>(i));
+        expected.insert(expected.end(), record.begin(), record.end());
+        auto ret = g_client->Append(key, record, size);
+        ASSERT_EQ(ock::smem::StoreErrorCode::SUCCESS, ret);
+        ASSERT_EQ(expected.size(), size);
+
+        std::vector<uint8_t> valueOut;
+        ret = g_client->Get(key, valueOut, 0);
+        ASSERT_EQ(ock::smem::StoreErrorCode::SUCCESS, ret);
+        ASSERT_EQ(expected, valueOut);
+    }
+}
+
+TEST_F(AccConfigStoreTest, async_add_many_in_flight)
+{
+    std::string key = "async_add_many_in_flight_key";
+    const int64_t requestCount = 200;
+    std::mutex valuesMutex;
+    std::vector<int64_t> values;
+    ConfigStoreAsyncWaiter waiter;
+    for (auto i = 0; i < requestCount; i++) {
+        waiter.Begin();
+        auto ret = g_client->AddAsync(key, 1, [&](Result result, int64_t value) {
+            std::unique_lock<std::mutex> locker{valuesMutex};
+            values.push_back(value);
+            locker.unlock();
+            waiter.Finish(result);
+        });
+        ASSERT_EQ(0, ret);
+    }
+    ASSERT_EQ(0, waiter.Wait());
+
+    std::sort(values.begin(), values.end());
+    ASSERT_EQ(static_cast<size_t>(requestCount), values.size());
+    for (auto i = 0; i < requestCount; i++) {
+        ASSERT_EQ(i + 1, values[i]);
+    }
+}
+
+TEST_F(AccConfigStoreTest, async_set_then_get_check)
+{
+    std::string key = "async_set_then_get_key";
+    std::string value = "async_set_then_get_value";
+    std::vector<uint8_t> valueOut;
+    Result getResult = -1;
+    ConfigStoreAsyncWaiter waiter;
+    waiter.Begin();
+    auto ret = g_client->GetAsync(key, -1, [&](Result result, std::vector<uint8_t> &v) {
+        getResult = result;
+        valueOut = std::move(v);
+        waiter.Finish(result);
+    });
+    ASSERT_EQ(0, ret);
+
+    waiter.Begin();
+    ret = g_client->SetAsync(key, std::vector<uint8_t>(value.begin(), value.end()),
+                             [&](Result result) { waiter.Finish(result); });
+    ASSERT_EQ(0, ret);
+    ASSERT_EQ(0, waiter.Wait());
+    ASSERT_EQ(0, getResult);
+    ASSERT_EQ(value, std::string(valueOut.begin(), valueOut.end()));
+}
+
+TEST_F(AccConfigStoreTest, async_get_not_exist_and_prefix)
+{
+    auto prefixStore = StoreFactory::PrefixStore(g_client, "async_prefix/");
+    ASSERT_TRUE(prefixStore != nullptr);
+    ASSERT_EQ(0, g_client->Set("async_prefix/key", std::vector<uint8_t>{1, 2, 3}));
+
+    Result notExistResult = -1;
+    std::vector<uint8_t> valueOut;
+    ConfigStoreAsyncWaiter waiter;
+    waiter.Begin();
+    auto ret = prefixStore->GetAsync("not_exist_key", 0, [&](Result result, std::vector<uint8_t> &) {
+        notExistResult = result;
+        waiter.Finish(SM_OK);
+    });
+    ASSERT_EQ(0, ret);
+    waiter.Begin();
+    ret = prefixStore->GetAsync("key", 0, [&](Result result, std::vector<uint8_t> &v) {
+        valueOut = std::move(v);
+        waiter.Finish(result);
+    });
+    ASSERT_EQ(0, ret);
+    ASSERT_EQ(0, waiter.Wait());
+    ASSERT_EQ(StoreErrorCode::NOT_EXIST, notExistResult);
+    ASSERT_EQ((std::vector<uint8_t>{1, 2, 3}), valueOut);
+}
+
+TEST_F(AccConfigStoreTest, async_waiting_gets_not_stall_others)
+{
+    // more waiting gets than async slots, later async requests still go on
+    const uint32_t waitCount = 36U;
+    std::string keyPrefix = "async_waiting_gets_key_";
+    ConfigStoreAsyncWaiter getWaiter;
+    for (auto i = 0U; i < waitCount; i++) {
+        getWaiter.Begin();
+        auto ret = g_client->GetAsync(keyPrefix + std::to_string(i), -1,
+                                      [&](Result result, std::vector<uint8_t> &) { getWaiter.Finish(result); });
+        ASSERT_EQ(0, ret);
+    }
+
+    ConfigStoreAsyncWaiter setWaiter;
+    setWaiter.Begin();
+    auto ret = g_client->SetAsync(keyPrefix + std::to_string(0), std::vector<uint8_t>{1},
+                                  [&](Result result) { setWaiter.Finish(result); });
+    ASSERT_EQ(0, ret);
+    ASSERT_EQ(0, setWaiter.Wait());
+
+    for (auto i = 1U; i < waitCount; i++) {
+        ASSERT_EQ(0, g_client->Set(keyPrefix + std::to_string(i), std::vector<uint8_t>{1}));
+    }
+    ASSERT_EQ(0, getWaiter.Wait());
+}
+
+TEST_F(AccConfigStoreTest, set_with_ttl_expire_keys)
+{
+    std::string addKey = "set_with_ttl_add_key";
+    std::string waitKey = "set_with_ttl_wait_key";
+    int64_t value = 0;
+    ASSERT_EQ(0, g_client->Add(addKey, 1, value));
+    ASSERT_EQ(0, g_client->SetWithTTL(waitKey, std::vector<uint8_t>{1}, 1, {addKey}));
+
+    std::vector<uint8_t> valueOut;
+    ASSERT_EQ(0, g_client->Get(waitKey, valueOut, 0));
+    ASSERT_EQ(0, g_client->Get(addKey, valueOut, 0));
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(1100));
+    ASSERT_EQ(StoreErrorCode::NOT_EXIST, g_client->Get(waitKey, valueOut, 0));
+    ASSERT_EQ(StoreErrorCode::NOT_EXIST, g_client->Get(addKey, valueOut, 0));
+
+    // expired key is created again by later request, without time-to-live
+    ASSERT_EQ(0, g_client->Add(addKey, 1, value));
+    ASSERT_EQ(1, value);
+    ASSERT_NE(0, g_client->SetWithTTL(waitKey, std::vector<uint8_t>{1}, -1));
+}
+
+TEST_F(AccConfigStoreTest, barrier_release_all_and_timeout)
+{
+    std::string key = "barrier_release_all_key";
+    const uint32_t size = 4;
+    std::vector<std::thread> threads;
+    std::vector<Result> results(size - 1, -1);
+    for (auto i = 0U; i < size - 1; i++) {
+        threads.emplace_back([&results, &key, i]() { results[i] = g_client->Barrier(key, size, -1); });
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    ASSERT_EQ(0, g_client->Barrier(key, size, -1));
+    for (auto &t : threads) {
+        t.join();
+    }
+    for (auto result : results) {
+        ASSERT_EQ(0, result);
+    }
+
+    std::thread waiter([]() { ASSERT_EQ(0, g_client->Barrier("barrier_timeout_key", 2, 1000)); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    ASSERT_EQ(StoreErrorCode::INVALID_MESSAGE, g_client->Barrier("barrier_timeout_key", 3, 100));
+    ASSERT_EQ(0, g_client->Barrier("barrier_timeout_key", 2, 100));
+    waiter.join();
+
+    // timed out barrier is dropped, the same key starts a new one
+    ASSERT_EQ(StoreErrorCode::TIMEOUT, g_client->Barrier("barrier_timeout_key", 2, 100));
+    ASSERT_EQ(StoreErrorCode::TIMEOUT, g_client->Barrier("barrier_timeout_key", 3, 100));
+    ASSERT_EQ(StoreErrorCode::TIMEOUT, g_client->Barrier("barrier_timeout_key", 2, 0));
+    ASSERT_EQ(StoreErrorCode::TIMEOUT, g_client->Barrier("barrier_timeout_key", 2, 0));
+}
+
+TEST_F(AccConfigStoreTest, barrier_timeout_not_counted_as_arrived)
+{
+    std::string key = "barrier_round_key";
+    const uint32_t size = 3;
+    std::atomic<uint32_t> released{0};
+    std::vector<std::thread> threads;
+    threads.emplace_back([&]() {
+        EXPECT_EQ(0, g_client->Barrier(key, size, -1));
+        released++;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    ASSERT_EQ(StoreErrorCode::TIMEOUT, g_client->Barrier(key, size, 100));
+    ASSERT_EQ(StoreErrorCode::TIMEOUT, g_client->Barrier(key, size, 0));
+
+    // two arrived after the timeouts, the barrier still waits for the third one
+    threads.emplace_back([&]() {
+        EXPECT_EQ(0, g_client->Barrier(key, size, -1));
+        released++;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+    EXPECT_EQ(0U, released.load());
+
+    ASSERT_EQ(0, g_client->Barrier(key, size, 1000));
+    for (auto &t : threads) {
+        t.join();
+    }
+    EXPECT_EQ(2U, released.load());
+}
+
+TEST_F(AccConfigStoreTest, bitmap_alloc_lowest_and_release)
+{
+    std::string key = "bitmap_alloc_key";
+    const uint32_t bitCount = 64;
+    const uint32_t threadCount = 8;
+    std::vector<std::thread> threads;
+    std::vector<uint32_t> indexes(bitCount, bitCount);
+    for (auto t = 0U; t < threadCount; t++) {
+        threads.emplace_back([&indexes, &key, t]() {
+            for (auto i = t; i < bitCount; i += threadCount) {
+                ASSERT_EQ(0, g_client->BitmapAlloc(key, bitCount, indexes[i]));
+            }
+        });
+    }
+    for (auto &t : threads) {
+        t.join();
+    }
+    std::sort(indexes.begin(), indexes.end());
+    for (auto i = 0U; i < bitCount; i++) {
+        ASSERT_EQ(i, indexes[i]);
+    }
+
+    uint32_t index = 0;
+    ASSERT_EQ(StoreErrorCode::IN_USE, g_client->BitmapAlloc(key, bitCount, index));
+    ASSERT_EQ(0, g_client->BitmapRelease(key, 9));
+    ASSERT_EQ(StoreErrorCode::NOT_EXIST, g_client->BitmapRelease(key, 9));
+    ASSERT_EQ(0, g_client->BitmapRelease(key, 3));
+    ASSERT_EQ(0, g_client->BitmapAlloc(key, bitCount, index));
+    ASSERT_EQ(3U, index);
+    ASSERT_EQ(StoreErrorCode::NOT_EXIST, g_client->BitmapRelease("bitmap_not_exist_key", 0));
+}
+
+TEST_F(AccConfigStoreTest, unpack_view_points_into_buffer)
+{
+    SmemMessage message{MessageType::CAS, "view_key", std::vector<uint8_t>{}, std::vector<uint8_t>(4096, 'x')};
+    message.userDef = 7L;
+    auto packed = SmemMessagePacker::Pack(message);
+
+    SmemMessageView view;
+    ASSERT_EQ(static_cast<int64_t>(packed.size()), SmemMessagePacker::Unpack(packed.data(), packed.size(), view));
+    ASSERT_EQ(MessageType::CAS, view.mt);
+    ASSERT_EQ(7L, view.userDef);
+    ASSERT_EQ(1U, view.keys.size());
+    ASSERT_EQ("view_key", view.keys[0]);
+    ASSERT_EQ(2U, view.values.size());
+    ASSERT_TRUE(view.values[0].Empty());
+    ASSERT_TRUE(view.values[1].Equals(message.values[1]));
+    ASSERT_GE(view.values[1].data, packed.data());
+    ASSERT_LE(view.values[1].data + view.values[1].size, packed.data() + packed.size());
+
+    for (auto len : {packed.size() - 1U, packed.size() - 4096U, static_cast<size_t>(40U)}) {
+        ASSERT_EQ(-1, SmemMessagePacker::Unpack(packed.data(), len, view));
+    }
+}
+
+TEST_F(AccConfigStoreTest, append_and_get_value_in_chunks)
+{
+    std::string key = "stream_value_key";
+    std::vector<uint8_t> value(MAX_SINGLE_VALUE_SIZE * 3U + 5U);
+    for (auto i = 0U; i < value.size(); i++) {
+        value[i] = static_cast<uint8_t>(i * 7U);
+    }
+    uint64_t size = 0;
+    ASSERT_EQ(0, g_client->Append(key, value, size));
+    ASSERT_EQ(value.size(), size);
+    ASSERT_EQ(0, g_client->Append(key, std::vector<uint8_t>{'e'}, size));
+    ASSERT_EQ(value.size() + 1U, size);
+    value.push_back('e');
+
+    std::vector<uint8_t> valueOut;
+    ASSERT_EQ(0, g_client->Get(key, valueOut, 0));
+    ASSERT_EQ(value, valueOut);
+
+    uint64_t totalSize = 0;
+    ASSERT_EQ(0, g_client->GetRange(key, VALUE_CHUNK_SIZE - 3U, 10U, valueOut, totalSize));
+    ASSERT_EQ(value.size(), totalSize);
+    ASSERT_EQ(std::vector<uint8_t>(value.begin() + VALUE_CHUNK_SIZE - 3U, value.begin() + VALUE_CHUNK_SIZE + 7U),
+              valueOut);
+    ASSERT_EQ(0, g_client->GetRange(key, totalSize, 10U, valueOut, totalSize));
+    ASSERT_TRUE(valueOut.empty());
+    ASSERT_EQ(StoreErrorCode::INVALID_MESSAGE, g_client->GetRange(key, totalSize + 1U, 10U, valueOut, totalSize));
+    ASSERT_EQ(StoreErrorCode::NOT_EXIST, g_client->GetRange("stream_no_key", 0, 10U, valueOut, totalSize));
+}
+
+TEST_F(AccConfigStoreTest, get_by_ranges_never_mixes_replaced_values)
+{
+    // small limits split a value into many ranges, so replacing happens between ranges of one get
+    SmemValueSizeLimits limits;
+    limits.maxSingleValueSize = 16 * 1024UL;
+    limits.valueChunkSize = 4 * 1024UL;
+    auto client = dynamic_cast<TcpConfigStore *>(g_client.Get());
+    auto server = dynamic_cast<TcpConfigStore *>(g_server.Get());
+    ASSERT_TRUE(client != nullptr && server != nullptr);
+    ASSERT_EQ(0, client->SetValueSizeLimits(limits));
+    ASSERT_EQ(0, server->SetValueSizeLimits(limits));
+
+    std::string key = "replaced_range_key";
+    const std::vector<uint8_t> valueA(256 * 1024UL, 'a');
+    const std::vector<uint8_t> valueB(valueA.size(), 'b');
+    ASSERT_EQ(0, g_server->Set(key, valueA));
+
+    std::atomic<bool> writing{true};
+    std::thread writer([&]() {
+        for (auto i = 0; i < 50; i++) {
+            g_server->Set(key, (i % 2 == 0) ? valueB : valueA);
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        writing.store(false);
+    });
+
+    // same sized values, a torn read would not be found by size
+    auto mixed = 0;
+    std::vector<uint8_t> valueOut;
+    while (writing.load()) {
+        if (g_client->Get(key, valueOut, 0) == 0 && valueOut != valueA && valueOut != valueB) {
+            mixed++;
+        }
+    }
+    writer.join();
+    EXPECT_EQ(0, mixed);
+    ASSERT_EQ(0, g_client->Get(key, valueOut, 0));
+    EXPECT_EQ(valueA, valueOut);
+
+    ASSERT_EQ(0, client->SetValueSizeLimits(SmemValueSizeLimits{}));
+    ASSERT_EQ(0, server->SetValueSizeLimits(SmemValueSizeLimits{}));
+}
@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025-2025. All rights reserved.
+ * MemFabric_Hybrid is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *          http://license.coscl.org.cn/MulanPSL2
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+*/
+#include <fcntl.h>
+#include <unistd.h>
+#include <chrono>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include "gtest/gtest.h"
+#include "smem_file_mapped_backend.h"
+#include "smem_store_factory.h"
+#include "smem_net_common.h"
+
+using namespace ock::smem;
+
+class SmemFileMappedBackendTest : public testing::Test {
+public:
+    void SetUp() override
+    {
+        char dirTemplate[] = "/tmp/smem_store_ut_XXXXXX";
+        ASSERT_NE(nullptr, mkdtemp(dirTemplate));
+        dir_ = dirTemplate;
+        path_ = dir_ + "/store.log";
+    }
+
+    void TearDown() override
+    {
+        unlink(path_.c_str());
+        unlink((dir_ + "/config_store_" + std::to_string(port_) + ".log").c_str());
+        rmdir(dir_.c_str());
+    }
+
+    static std::vector<uint8_t> ToBytes(const std::string &str)
+    {
+        return std::vector<uint8_t>(str.begin(), str.end());
+    }
+
+    static std::string GetString(const FileMappedBackendPtr &backend, const std::string &key)
+    {
+        std::vector<uint8_t> value;
+        if (backend->Get(key, value) != StoreErrorCode::SUCCESS) {
+            return "<not exist>";
+        }
+        return std::string(value.begin(), value.end());
+    }
+
+protected:
+    std::string dir_;
+    std::string path_;
+    uint16_t port_ = 0;
+};
+
+TEST_F(SmemFileMappedBackendTest, reload_after_put_append_delete)
+{
+    auto backend = SmMakeRef<SmemFileMappedBackend>();
+    ASSERT_EQ(StoreErrorCode::SUCCESS, backend->Initialize(path_, "", ""));
+    ASSERT_EQ(StoreErrorCode::SUCCESS, backend->Put("key1", ToBytes("value1"), 0));
+    ASSERT_EQ(StoreErrorCode::SUCCESS, backend->Put("key2", ToBytes("value2"), 0));
+    ASSERT_EQ(StoreErrorCode::SUCCESS, backend->Put("key1", ToBytes("value1-new"), 0));
+    StoreValuePtr newValue;
+    ASSERT_EQ(StoreErrorCode::SUCCESS, backend->AppendValue("key3", ToBytes("hello"), newValue));
+    ASSERT_EQ(StoreErrorCode::SUCCESS, backend->AppendValue("key3", ToBytes(" world"), newValue));
+    ASSERT_EQ(StoreErrorCode::SUCCESS, backend->Delete("key2"));
+    backend->UnInitialize();
+
+    auto reloaded = SmMakeRef<SmemFileMappedBackend>();
+    ASSERT_EQ(StoreErrorCode::SUCCESS, reloaded->Initialize(path_, "", ""));
+    ASSERT_EQ("value1-new", GetString(reloaded, "key1"));
+    ASSERT_EQ("<not exist>", GetString(reloaded, "key2"));
+    ASSERT_EQ("hello world", GetString(reloaded, "key3"));
+}
+
+TEST_F(SmemFileMappedBackendTest, expired_key_deleted_from_log)
+{
+    auto backend = SmMakeRef<SmemFileMappedBackend>();
+    ASSERT_EQ(StoreErrorCode::SUCCESS, backend->Initialize(path_, "", ""));
+    ASSERT_TRUE(backend->SupportsTTL());
+    ASSERT_EQ(StoreErrorCode::SUCCESS, backend->Put("ttl_key", ToBytes("value1"), 1));
+    ASSERT_EQ(StoreErrorCode::SUCCESS, backend->Put("expire_key", ToBytes("value2"), 0));
+    ASSERT_EQ(StoreErrorCode::SUCCESS, backend->Put("keep_key", ToBytes("value3"), 0));
+    ASSERT_EQ(StoreErrorCode::SUCCESS, backend->Expire("expire_key", 1));
+    ASSERT_EQ(StoreErrorCode::NOT_EXIST, backend->Expire("missing_key", 1));
+    ASSERT_EQ("value1", GetString(backend, "ttl_key"));
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(1100));
+    ASSERT_EQ("<not exist>", GetString(backend, "ttl_key"));
+    ASSERT_EQ(StoreErrorCode::NOT_EXIST, backend->Exist("expire_key"));
+    ASSERT_EQ("value3", GetString(backend, "keep_key"));
+    // modification collects expired keys
+    ASSERT_EQ(StoreErrorCode::SUCCESS, backend->Put("other_key", ToBytes("value4"), 0));
+    backend->UnInitialize();
+
+    auto reloaded = SmMakeRef<SmemFileMappedBackend>();
+    ASSERT_EQ(StoreErrorCode::SUCCESS, reloaded->Initialize(path_, "", ""));
+    ASSERT_EQ("<not exist>", GetString(reloaded, "ttl_key"));
+    ASSERT_EQ("<not exist>", GetString(reloaded, "expire_key"));
+    ASSERT_EQ("value3", GetString(reloaded, "keep_key"));
+    ASSERT_EQ("value4", GetString(reloaded, "other_key"));
+}
+
+TEST_F(SmemFileMappedBackendTest, torn_record_dropped_on_reload)
+{
+    auto backend = SmMakeRef<SmemFileMappedBackend>();
+    ASSERT_EQ(StoreErrorCode::SUCCESS, backend->Initialize(path_, "", ""));
+    ASSERT_EQ(StoreErrorCode::SUCCESS, backend->Put("key1", ToBytes("value1"), 0));
+    auto tornOffset = backend->LogSize();
+    ASSERT_EQ(StoreErrorCode::SUCCESS, backend->Put("key2", ToBytes("value2"), 0));
+    backend->UnInitialize();
+
+    // clear magic of the last record, as the process crashed before record finished
+    auto fd = open(path_.c_str(), O_RDWR);
+    ASSERT_GE(fd, 0);
+    uint32_t zero = 0;
+    ASSERT_EQ(static_cast<ssize_t>(sizeof(zero)), pwrite(fd, &zero, sizeof(zero), static_cast<off_t>(tornOffset)));
+    close(fd);
+
+    auto reloaded = SmMakeRef<SmemFileMappedBackend>();
+    ASSERT_EQ(StoreErrorCode::SUCCESS, reloaded->Initialize(path_, "", ""));
+    ASSERT_EQ(tornOffset, reloaded->LogSize());
+    ASSERT_EQ("value1", GetString(reloaded, "key1"));
+    ASSERT_EQ("<not exist>", GetString(reloaded, "key2"));
+
+    ASSERT_EQ(StoreErrorCode::SUCCESS, reloaded->Put("key3", ToBytes("v3"), 0));
+    reloaded->UnInitialize();
+    ASSERT_EQ(StoreErrorCode::SUCCESS, reloaded->Initialize(path_, "", ""));
+    ASSERT_EQ("value1", GetString(reloaded, "key1"));
+    ASSERT_EQ("<not exist>", GetString(reloaded, "key2"));
+    ASSERT_EQ("v3", GetString(reloaded, "key3"));
+}
+
+TEST_F(SmemFileMappedBackendTest, compact_keeps_live_keys)
+{
+    auto backend = SmMakeRef<SmemFileMappedBackend>();
+    ASSERT_EQ(StoreErrorCode::SUCCESS, backend->Initialize(path_, "", ""));
+    for (auto i = 0; i < 1000; i++) {
+        ASSERT_EQ(StoreErrorCode::SUCCESS, backend->Put("key" + std::to_string(i % 10), ToBytes(std::to_string(i)), 0));
+    }
+    auto sizeBefore = backend->LogSize();
+    ASSERT_EQ(StoreErrorCode::SUCCESS, backend->Compact());
+    ASSERT_LT(backend->LogSize(), sizeBefore);
+    ASSERT_EQ(StoreErrorCode::SUCCESS, backend->Put("key0", ToBytes("after-compact"), 0));
+    backend->UnInitialize();
+
+    auto reloaded = SmMakeRef<SmemFileMappedBackend>();
+    ASSERT_EQ(StoreErrorCode::SUCCESS, reloaded->Initialize(path_, "", ""));
+    ASSERT_EQ("after-compact", GetString(reloaded, "key0"));
+    for (auto i = 1; i < 10; i++) {
+        ASSERT_EQ(std::to_string(990 + i), GetString(reloaded, "key" + std::to_string(i)));
+    }
+}
+
+TEST_F(SmemFileMappedBackendTest, log_file_in_use)
+{
+    auto backend = SmMakeRef<SmemFileMappedBackend>();
+    ASSERT_EQ(StoreErrorCode::SUCCESS, backend->Initialize(path_, "", ""));
+
+    auto other = SmMakeRef<SmemFileMappedBackend>();
+    ASSERT_EQ(StoreErrorCode::IN_USE, other->Initialize(path_, "", ""));
+
+    backend->UnInitialize();
+    ASSERT_EQ(StoreErrorCode::SUCCESS, other->Initialize(path_, "", ""));
+}
+
+TEST_F(SmemFileMappedBackendTest, store_server_restart_keeps_keys)
+{
+    port_ = 11000U + getpid() % 1000U;
+    UrlExtraction option;
+    option.ExtractIpPortFromUrl("tcp://127.0.0.1:" + std::to_string(port_));
+    StoreFactory::SetPersistDir(dir_);
+    auto server = StoreFactory::CreateStore("0.0.0.0", port_, true, 2, 0);
+    ASSERT_TRUE(server != nullptr);
+    auto client = StoreFactory::CreateStore("127.0.0.1", port_, false, 2, 1);
+    ASSERT_TRUE(client != nullptr);
+    ASSERT_EQ(0, client->Set("restart_key", ToBytes("restart_value")));
+
+    // stop server before client, or the server clears all keys when the last client leaves
+    server = nullptr;
+    StoreFactory::DestroyStore("0.0.0.0", port_);
+    client = nullptr;
+    StoreFactory::DestroyStore("127.0.0.1", port_);
+
+    server = StoreFactory::CreateStore("0.0.0.0", port_, true, 2, 0);
+    ASSERT_TRUE(server != nullptr);
+    client = StoreFactory::CreateStore("127.0.0.1", port_, false, 2, 1);
+    ASSERT_TRUE(client != nullptr);
+    std::vector<uint8_t> value;
+    ASSERT_EQ(0, client->Get("restart_key", value, 0));
+    ASSERT_EQ("restart_value", std::string(value.begin(), value.end()));
+
+    server = nullptr;
+    StoreFactory::DestroyStore("0.0.0.0", port_);
+    client = nullptr;
+    StoreFactory::DestroyStore("127.0.0.1", port_);
+    StoreFactory::SetPersistDir("");
+}
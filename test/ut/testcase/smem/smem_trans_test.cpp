@@ -372,6 +372,129 @@ TEST_F(SmemTransTest, smem_trans_read_write)
     delete[] recv_buffer;
 }
 
+TEST_F(SmemTransTest, smem_trans_wait_failed_invalid_param)
+{
+    pid_t pid = fork();
+    EXPECT_NE(pid, -1);
+
+    if (pid == 0) {
+        int dummy = 0;
+        if (smem_trans_wait(&dummy) != SM_INVALID_PARAM) {
+            exit(1);
+        }
+        if (smem_trans_init(&g_trans_options) != SM_OK) {
+            exit(2);
+        }
+        if (smem_trans_wait(nullptr) != SM_INVALID_PARAM) {
+            exit(3);
+        }
+        if (smem_trans_wait(&dummy) == SM_OK) {
+            exit(4);
+        }
+        smem_trans_uninit(0);
+        exit(0);
+    }
+
+    int status;
+    EXPECT_NE(waitpid(pid, &status, 0), -1);
+    EXPECT_TRUE(WIFEXITED(status));
+    EXPECT_EQ(WEXITSTATUS(status), 0);
+}
+
+TEST_F(SmemTransTest, smem_trans_async_write_then_wait)
+{
+    uint32_t rankSize = 2;
+    int *sender_buffer = new int[500];
+    int *recv_buffer = new int[500];
+    size_t capacities = 500 * sizeof(int);
+    smem_trans_config_t sender_trans_options = {SMEM_TRANS_SENDER, SMEM_DEFAUT_WAIT_TIME, 0, 0};
+    smem_trans_config_t recv_trans_options = {SMEM_TRANS_RECEIVER, SMEM_DEFAUT_WAIT_TIME, 1, 0};
+
+    auto func = [](uint32_t rank, smem_trans_config_t trans_options, std::vector<int *> addrPtrs,
+                   size_t capacities, const std::array<const char *, 2> unique_ids) {
+        trans_options.dataOpType = SMEMB_DATA_OP_SDMA;
+        int ret = smem_trans_init(&trans_options);
+        if (ret != 0) {
+            exit(1);
+        }
+        auto handle = smem_trans_create(STORE_URL, unique_ids[rank], &trans_options);
+        if (handle == nullptr) {
+            exit(2);
+        }
+
+        ret = smem_trans_register_mem(handle, addrPtrs[rank], capacities, 0);
+        if (ret != SM_OK) {
+            exit(3);
+        }
+
+        if (rank == 0) {
+            // 两次异步写只下发, 由一次wait统一等待完成
+            auto half = capacities / 2;
+            ret = smem_trans_write(handle, addrPtrs[0], unique_ids[1], addrPtrs[1], half, ASYNC_COPY_FLAG);
+            if (ret != SM_OK) {
+                exit(4);
+            }
+            ret = smem_trans_write(handle, reinterpret_cast<uint8_t *>(addrPtrs[0]) + half, unique_ids[1],
+                                   reinterpret_cast<uint8_t *>(addrPtrs[1]) + half, capacities - half,
+                                   ASYNC_COPY_FLAG);
+            if (ret != SM_OK) {
+                exit(5);
+            }
+            ret = smem_trans_wait(handle);
+            if (ret != SM_OK) {
+                exit(6);
+            }
+            // 没有在途的异步拷贝时直接返回
+            ret = smem_trans_wait(handle);
+            if (ret != SM_OK) {
+                exit(7);
+            }
+        }
+
+        ret = smem_trans_deregister_mem(handle, addrPtrs[rank]);
+        if (ret != SM_OK) {
+            exit(8);
+        }
+
+        smem_trans_destroy(handle, 0);
+        smem_trans_uninit(0);
+    };
+
+    const std::array<const char *, 2> unique_ids = {{"127.0.0.1:5321", "127.0.0.1:5322"}};
+    std::vector<int *> addrPtrs = {sender_buffer, recv_buffer};
+    std::vector<smem_trans_config_t> trans_options = {sender_trans_options, recv_trans_options};
+
+    pid_t pids[rankSize];
+    for (uint32_t i = 0; i < rankSize; ++i) {
+        pids[i] = fork();
+        ASSERT_NE(pids[i], -1);
+        if (pids[i] == 0) {
+            smem_set_conf_store_tls(false, nullptr, 0);
+            if (i == 0) {
+                smem_create_config_store(STORE_URL);
+            }
+            func(i, trans_options[i], addrPtrs, capacities, unique_ids);
+            exit(0);
+        }
+    }
+
+    for (uint32_t i = 0; i < rankSize; ++i) {
+        int status = 0;
+        waitpid(pids[i], &status, 0);
+        EXPECT_TRUE(WIFEXITED(status));
+        if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+            EXPECT_EQ(WEXITSTATUS(status), 0);
+            for (uint32_t j = 0; j < rankSize; ++j) {
+                if (i != j && pids[j] > 0) {
+                    kill(pids[j], SIGKILL);
+                }
+            }
+        }
+    }
+    delete[] sender_buffer;
+    delete[] recv_buffer;
+}
+
 TEST_F(SmemTransTest, smem_trans_malloc)
 {
     size_t mallocTinySize = 0x8000000; // 128MB